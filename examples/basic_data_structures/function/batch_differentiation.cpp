@@ -0,0 +1,189 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/batch_differentiation.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example compares automatic differentiation in several
+ *    directions at once and the evaluation and differentiation at
+ *    several points at once with one call per direction resp. per
+ *    point. The batch is also evaluated in single precision.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i, j, k;
+
+    // DEFINE THE FUNCTION:
+    // --------------------
+    DifferentialState x1, x2, x3;
+    Control           u;
+
+    IntermediateState s = sin(x1)*x2 + exp(0.3*x3) - u*u;
+
+    Function f;
+
+    f << s*s + pow(x2,3) + log(2.0+x1*x1);
+    f << cos(s)/(1.0+x3*x3) + x1/x2;
+
+    const int nv      = f.getNumberOfVariables()+1;
+    const int dim     = f.getDim();
+    const int nDir    = 4;
+    const int nPoints = 6;
+
+    double *x  = new double[nv];
+    double *r  = new double[dim];
+    double *d  = new double[dim];
+    double *a  = new double[nv];
+
+    for( i = 0; i < nv; ++i )
+        x[i] = 0.1*(i+1);
+
+
+    // SEVERAL DIRECTIONS AT ONCE (seed k at S[k*nv], result k at D[k*dim]):
+    // -----------------------------------------------------------------------
+    double *S = new double[nDir*nv ];
+    double *D = new double[nDir*dim];
+    double *B = new double[nDir*dim];
+    double *A = new double[nDir*nv ];
+
+    for( k = 0; k < nDir*nv; ++k ){
+        S[k] = sin( 1.0+k );
+        A[k] = 0.0;
+    }
+    for( k = 0; k < nDir*dim; ++k )
+        B[k] = cos( 2.0+k );
+
+    f.evaluate   ( 0, x, r );
+    f.AD_forward ( 0, nDir, S, D );
+    f.AD_backward( 0, nDir, B, A );
+
+    double eForward  = 0.0;
+    double eBackward = 0.0;
+
+    for( k = 0; k < nDir; ++k ){
+
+        f.AD_forward( 0, &S[k*nv], d );
+        for( j = 0; j < dim; ++j )
+            if( fabs( d[j] - D[k*dim+j] ) > eForward ) eForward = fabs( d[j] - D[k*dim+j] );
+
+        for( i = 0; i < nv; ++i ) a[i] = 0.0;
+        f.AD_backward( 0, &B[k*dim], a );
+        for( i = 0; i < nv; ++i )
+            if( fabs( a[i] - A[k*nv+i] ) > eBackward ) eBackward = fabs( a[i] - A[k*nv+i] );
+    }
+
+    printf("vector mode:  forward %.1e  backward %.1e \n", eForward, eBackward );
+
+
+    // SEVERAL POINTS AT ONCE (variable i of point p at X[i*nPoints+p]):
+    // -------------------------------------------------------------------
+    double *X  = new double[nv *nPoints];
+    double *R  = new double[dim*nPoints];
+    double *SX = new double[nv *nPoints];
+    double *DX = new double[dim*nPoints];
+
+    for( i = 0; i < nv; ++i ){
+        for( k = 0; k < nPoints; ++k ){
+            X [i*nPoints+k] = 0.1*(i+1) + 0.05*k;
+            SX[i*nPoints+k] = sin( 1.0+i+k );
+        }
+    }
+
+    f.evaluateBatch  ( 10, nPoints, X,  R  );
+    f.AD_forwardBatch( 10, nPoints, SX, DX );
+
+    double eValue  = 0.0;
+    double eDirect = 0.0;
+
+    for( k = 0; k < nPoints; ++k ){
+
+        for( i = 0; i < nv; ++i ){
+            x[i] = 0.1*(i+1) + 0.05*k;
+            a[i] = sin( 1.0+i+k );
+        }
+        f.evaluate  ( 0, x, r );
+        f.AD_forward( 0, a, d );
+
+        for( j = 0; j < dim; ++j ){
+            if( fabs( r[j] - R [j*nPoints+k] ) > eValue  ) eValue  = fabs( r[j] - R [j*nPoints+k] );
+            if( fabs( d[j] - DX[j*nPoints+k] ) > eDirect ) eDirect = fabs( d[j] - DX[j*nPoints+k] );
+        }
+    }
+
+    printf("batch mode:   evaluation %.1e  forward %.1e \n", eValue, eDirect );
+
+
+    // THE SAME POINTS IN SINGLE PRECISION (COMPILED FUNCTIONS ONLY):
+    // ----------------------------------------------------------------
+    float *XS  = new float[nv *nPoints];
+    float *RS  = new float[dim*nPoints];
+    float *SXS = new float[nv *nPoints];
+    float *DXS = new float[dim*nPoints];
+
+    f.compile();
+
+    for( i = 0; i < nv; ++i ){
+        for( k = 0; k < nPoints; ++k ){
+            XS [i*nPoints+k] = (float)( 0.1*(i+1) + 0.05*k );
+            SXS[i*nPoints+k] = (float)sin( 1.0+i+k );
+        }
+    }
+
+    f.evaluateBatch  ( 10, nPoints, XS,  RS  );
+    f.AD_forwardBatch( 10, nPoints, SXS, DXS );
+
+    eValue  = 0.0;
+    eDirect = 0.0;
+
+    for( k = 0; k < dim*nPoints; ++k ){
+        if( fabs( RS [k] - R [k] ) > eValue *fabs( R [k] ) ) eValue  = fabs( RS [k] - R [k] )/fabs( R [k] );
+        if( fabs( DXS[k] - DX[k] ) > eDirect*fabs( DX[k] ) ) eDirect = fabs( DXS[k] - DX[k] )/fabs( DX[k] );
+    }
+
+    printf("float batch:  evaluation %.1e  forward %.1e (relative) \n", eValue, eDirect );
+
+    delete[] XS; delete[] RS; delete[] SXS; delete[] DXS;
+
+    delete[] x;  delete[] r;  delete[] d;  delete[] a;
+    delete[] S;  delete[] D;  delete[] B;  delete[] A;
+    delete[] X;  delete[] R;  delete[] SX; delete[] DX;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,178 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/coloured_finite_differences.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example links a black-box C function with a batched
+ *    callback and a tridiagonal Jacobian. Its sparsity pattern is
+ *    probed, such that the Jacobian is obtained by coloured finite
+ *    differences from one batched call with colours+1 points. The
+ *    forward derivatives at two storage positions are compared
+ *    with the exact Jacobian, and the calls of the callbacks are
+ *    counted.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+const int N = 8;
+
+
+void chainPoint( const double *x, double *f ){
+
+    int i;
+
+    for( i = 0; i < N; ++i ){
+        f[i] = x[i]*x[i];
+        if( i > 0   ) f[i] -= x[i-1];
+        if( i < N-1 ) f[i] += sin( x[i+1] );
+    }
+}
+
+
+// (userData counts the single and the batched calls)
+void chain( double *x, double *f, void *userData ){
+
+    ((int*)userData)[0]++;
+    chainPoint( x, f );
+}
+
+
+void chainBatch( int nPoints, double *x, double *f, void *userData ){
+
+    int i, p;
+
+    double xp[N], fp[N];
+
+    ((int*)userData)[1]++;
+
+    for( p = 0; p < nPoints; ++p ){
+        for( i = 0; i < N; ++i ) xp[i] = x[i*nPoints+p];
+        chainPoint( xp, fp );
+        for( i = 0; i < N; ++i ) f[i*nPoints+p] = fp[i];
+    }
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i, j, k;
+
+    int nCalls[2] = { 0, 0 };
+
+    // LINK THE C FUNCTION AND PROBE ITS SPARSITY PATTERN:
+    // ---------------------------------------------------
+    CFunction map( N, chain );
+
+    map.setUserData( nCalls );
+    map.setBatchFunction( chainBatch );
+
+    double x0[N];
+    for( i = 0; i < N; ++i ) x0[i] = 0.3*(i+1);
+
+    map.detectSparsityPattern( N, x0 );
+
+    SparsityPattern pattern;
+    map.getSparsityPattern( pattern );
+
+    int color[N];
+    const int nColors = pattern.getColumnColoring( color );
+
+    printf("Jacobian: %d non-zeros, %d colours \n", pattern.getNumberOfNonzeros(), nColors );
+
+
+    // USE IT IN A FUNCTION:
+    // ---------------------
+    DifferentialState x(N);
+
+    Function f;
+    f << map(x);
+
+    const int nv  = f.getNumberOfVariables()+1;
+
+    double *xx   = new double[nv];
+    double *seed = new double[nv];
+    double  r [N];
+    double  df[N];
+
+    for( i = 0; i < nv; ++i ) seed[i] = 0.0;
+
+    // (two storage positions, e.g. two stages of an integrator)
+    double xs[2][N];
+
+    for( k = 0; k < 2; ++k ){
+        for( i = 0; i < N; ++i ){
+            xs[k][i] = 0.2*(i+1) - 0.5*k;
+            xx[ f.index( VT_DIFFERENTIAL_STATE, i ) ] = xs[k][i];
+        }
+        f.evaluate( k, xx, r );
+    }
+
+    nCalls[0] = nCalls[1] = 0;
+
+    // ALL FORWARD DIRECTIONS, ALTERNATING THE STORAGE POSITIONS:
+    // ----------------------------------------------------------
+    double error = 0.0;
+
+    for( j = 0; j < N; ++j ){
+        for( k = 0; k < 2; ++k ){
+
+            seed[ f.index( VT_DIFFERENTIAL_STATE, j ) ] = 1.0;
+            f.AD_forward( k, seed, df );
+            seed[ f.index( VT_DIFFERENTIAL_STATE, j ) ] = 0.0;
+
+            for( i = 0; i < N; ++i ){
+
+                double exact = 0.0;
+
+                if( i == j   ) exact =  2.0*xs[k][i];
+                if( i == j+1 ) exact = -1.0;
+                if( i == j-1 ) exact =  cos( xs[k][j] );
+
+                if( fabs( df[i] - exact ) > error ) error = fabs( df[i] - exact );
+            }
+        }
+    }
+
+    printf("forward AD: %d directions at 2 positions, error %.1e \n", N, error );
+    printf("callbacks:  %d single calls, %d batched calls \n", nCalls[0], nCalls[1] );
+
+    delete[] xx;
+    delete[] seed;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,99 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/evaluation_profile.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example profiles the evaluation of a function with a
+ *    deep chain of intermediate states and prints its most
+ *    expensive subtrees. It also compares the time of the
+ *    profiled evaluations with the time of plain ones.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i;
+
+    const int nChain       = 12;
+    const int nEvaluations = 1000;
+
+    // DEFINE A DEEP FUNCTION:
+    // -----------------------
+    DifferentialState x, y;
+
+    Expression z = x;
+
+    for( i = 0; i < nChain; ++i )
+        z = sin( z ) + 0.01*y*z;
+
+    FunctionEvaluationTree f;
+
+    f << z;
+    f << exp( z ) + y*y;
+
+    const int nv = f.getNumberOfVariables()+1;
+
+    double *xx = new double[nv];
+    double  r[2];
+
+    for( i = 0; i < nv; ++i ) xx[i] = 0.3*(i+1);
+
+
+    // PLAIN AND PROFILED EVALUATIONS:
+    // -------------------------------
+    double t[2];
+
+    t[0] = -acadoGetTime();
+    for( i = 0; i < nEvaluations; ++i ) f.evaluate( 0, xx, r );
+    t[0] += acadoGetTime();
+
+    f.setProfiling( BT_TRUE );
+
+    t[1] = -acadoGetTime();
+    for( i = 0; i < nEvaluations; ++i ) f.evaluate( 0, xx, r );
+    t[1] += acadoGetTime();
+
+    f.printProfile( 5 );
+
+    printf("profiled / plain evaluation time: %.1f \n", t[1]/t[0] );
+
+    delete[] xx;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
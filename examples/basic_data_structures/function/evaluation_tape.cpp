@@ -0,0 +1,155 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/evaluation_tape.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example compares the evaluation and the first order
+ *    derivatives of a function compiled into an evaluation tape,
+ *    evaluated with a caller-owned work space and compiled to
+ *    native code, with the results of the expression tree.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+double maxDifference( int n, const double *a, const double *b ){
+
+    int i;
+    double result = 0.0;
+
+    for( i = 0; i < n; ++i )
+        if( fabs( a[i] - b[i] ) > result ) result = fabs( a[i] - b[i] );
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i;
+
+    // DEFINE THE FUNCTION:
+    // --------------------
+    DifferentialState x1, x2, x3;
+    Control           u;
+    Parameter         p;
+
+    IntermediateState s = sin(x1)*x2 + exp(0.3*x3) - u*u;
+    IntermediateState t = s*s + pow(x2,3) + log(2.0+x1*x1);
+
+    Function f;
+
+    f << t + tan(0.1*x1)*acos(0.2*x2) + asin(0.1*x3) + atan(u);
+    f << cos(s)/(1.0+x3*x3) + pow(x1*x1+1.0,p) + x1/x2;
+    f << x2;
+
+
+    // COPIES EVALUATED BY A TAPE AND BY NATIVE CODE:
+    // ----------------------------------------------
+    Function g( f );
+    g.compile();
+
+    Function h( f );
+    BooleanType hasNative = BT_FALSE;
+    if( h.compileNative() == SUCCESSFUL_RETURN ) hasNative = BT_TRUE;
+
+    EvaluationWorkspace ws;
+    g.initWorkspace( ws );
+
+    const int nv  = f.getNumberOfVariables()+1;
+    const int dim = f.getDim();
+
+    double *x     = new double[nv ];
+    double *seed  = new double[nv ];
+    double *bseed = new double[dim];
+
+    double *r [4];
+    double *df[4];
+    double *b [4];
+
+    for( i = 0; i < 4; ++i ){
+        r [i] = new double[dim];
+        df[i] = new double[dim];
+        b [i] = new double[nv ];
+    }
+
+    for( i = 0; i < nv; ++i ){
+        x[i]    = 0.1*(i+1);
+        seed[i] = sin( 1.0+i );
+        b[0][i] = b[1][i] = b[2][i] = b[3][i] = 0.0;
+    }
+    for( i = 0; i < dim; ++i )
+        bseed[i] = 1.0 - 0.5*i;
+
+
+    // EVALUATE AND DIFFERENTIATE:
+    // ---------------------------
+    f.evaluate( 0, x, r[0] );  f.AD_forward( 0, seed, df[0] );  f.AD_backward( 0, bseed, b[0] );
+    g.evaluate( 0, x, r[1] );  g.AD_forward( 0, seed, df[1] );  g.AD_backward( 0, bseed, b[1] );
+
+    g.evaluate( ws, x, r[2] ); g.AD_forward( ws, seed, df[2] ); g.AD_backward( ws, bseed, b[2] );
+
+    if( hasNative == BT_TRUE ){
+        h.evaluate( 0, x, r[3] );  h.AD_forward( 0, seed, df[3] );  h.AD_backward( 0, bseed, b[3] );
+    }
+
+
+    // PRINT THE DIFFERENCES TO THE EXPRESSION TREE:
+    // ---------------------------------------------
+    printf("               | evaluation | forward AD | backward AD \n");
+    printf("  tape         |  %.1e   |  %.1e   |  %.1e \n",
+           maxDifference( dim,r[0],r[1] ), maxDifference( dim,df[0],df[1] ), maxDifference( nv,b[0],b[1] ) );
+    printf("  work space   |  %.1e   |  %.1e   |  %.1e \n",
+           maxDifference( dim,r[0],r[2] ), maxDifference( dim,df[0],df[2] ), maxDifference( nv,b[0],b[2] ) );
+
+    if( hasNative == BT_TRUE )
+        printf("  native code  |  %.1e   |  %.1e   |  %.1e \n",
+               maxDifference( dim,r[0],r[3] ), maxDifference( dim,df[0],df[3] ), maxDifference( nv,b[0],b[3] ) );
+    else
+        printf("  native code  |  (no C compiler available) \n");
+
+    for( i = 0; i < 4; ++i ){
+        delete[] r [i];
+        delete[] df[i];
+        delete[] b [i];
+    }
+    delete[] x;
+    delete[] seed;
+    delete[] bseed;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,229 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/function_to_file.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example writes a function (including its symbolic
+ *    derivative) to a binary file, reads it back into a new
+ *    function and checks that both functions yield identical
+ *    values and derivatives. Finally, it checks that a file with
+ *    another format and a file with an invalid variable are rejected.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+int countDifferences( int n, const double *a, const double *b ){
+
+    int i;
+    int result = 0;
+
+    // (the entries are compared bit by bit):
+    for( i = 0; i < n; ++i )
+        if( memcmp( &a[i], &b[i], sizeof(double) ) != 0 ) result++;
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i;
+
+    // DEFINE THE FUNCTION:
+    // --------------------
+    DifferentialState x1, x2, x3;
+    Control           u;
+    Parameter         p;
+
+    IntermediateState s = sin(x1)*x2 + exp(0.3*x3) - u*u;
+
+    FunctionEvaluationTree f;
+
+    f << s*s + pow(x2,3) + log(2.0+x1*x1) + atan(u);
+    f << cos(s)/(1.0+x3*x3) + pow(x1*x1+1.0,p);
+
+
+    // THE SYMBOLIC DERIVATIVE W.R.T. x1 IS WRITTEN, TOO:
+    // --------------------------------------------------
+    const int ix = f.index( VT_DIFFERENTIAL_STATE, 0 );
+
+    if( f.differentiate( ix ) == 0 ){
+        printf("the function could not be differentiated \n");
+        return 1;
+    }
+
+
+    // WRITE THE FUNCTION TO A FILE AND READ IT BACK:
+    // ----------------------------------------------
+    FunctionEvaluationTree g;
+
+    FILE *file = tmpfile();
+
+    if( file == 0 || f.write( file ) != SUCCESSFUL_RETURN ){
+        printf("the function could not be written \n");
+        return 1;
+    }
+
+    rewind( file );
+
+    if( g.read( file ) != SUCCESSFUL_RETURN ){
+        printf("the function could not be read \n");
+        fclose( file );
+        return 1;
+    }
+
+    fclose( file );
+
+
+    // COMPARE THE VALUES AND DERIVATIVES:
+    // -----------------------------------
+    const int nv  = f.getNumberOfVariables()+1;
+    const int dim = f.getDim();
+
+    if( g.getNumberOfVariables()+1 != nv || g.getDim() != dim ){
+        printf("the dimensions differ \n");
+        return 1;
+    }
+
+    double *x     = new double[nv ];
+    double *seed  = new double[nv ];
+    double *bseed = new double[dim];
+    double *rf    = new double[dim];
+    double *rg    = new double[dim];
+    double *df    = new double[dim];
+    double *dg    = new double[dim];
+    double *bf    = new double[nv ];
+    double *bg    = new double[nv ];
+
+    for( i = 0; i < nv; ++i ){
+        x[i]    = 0.1*(i+1);
+        seed[i] = sin( 1.0+i );
+        bf[i]   = bg[i] = 0.0;
+    }
+    for( i = 0; i < dim; ++i )
+        bseed[i] = 1.0 - 0.5*i;
+
+    f.evaluate( 0, x, rf );  f.AD_forward( 0, seed, df );  f.AD_backward( 0, bseed, bf );
+    g.evaluate( 0, x, rg );  g.AD_forward( 0, seed, dg );  g.AD_backward( 0, bseed, bg );
+
+    printf("entries which differ after reading: evaluation %d, forward AD %d, backward AD %d \n",
+           countDifferences( dim,rf,rg ), countDifferences( dim,df,dg ), countDifferences( nv,bf,bg ) );
+
+
+    // THE SYMBOLIC DERIVATIVE OF g IS LOOKED UP IN THE MEMO THAT HAS BEEN READ:
+    // -------------------------------------------------------------------------
+    // (both derivative trees are owned by their functions)
+    FunctionEvaluationTree *dfx = f.differentiate( ix );
+    FunctionEvaluationTree *dgx = g.differentiate( g.index( VT_DIFFERENTIAL_STATE, 0 ) );
+
+    double *xf = new double[dfx->getNumberOfVariables()+1];
+    double *xg = new double[dgx->getNumberOfVariables()+1];
+
+    for( i = 0; i <= dfx->getNumberOfVariables(); ++i ) xf[i] = 0.0;
+    for( i = 0; i <= dgx->getNumberOfVariables(); ++i ) xg[i] = 0.0;
+
+    xf[ dfx->index( VT_DIFFERENTIAL_STATE, 0 ) ] = xg[ dgx->index( VT_DIFFERENTIAL_STATE, 0 ) ] = 0.1;
+    xf[ dfx->index( VT_DIFFERENTIAL_STATE, 1 ) ] = xg[ dgx->index( VT_DIFFERENTIAL_STATE, 1 ) ] = 0.2;
+    xf[ dfx->index( VT_DIFFERENTIAL_STATE, 2 ) ] = xg[ dgx->index( VT_DIFFERENTIAL_STATE, 2 ) ] = 0.3;
+    xf[ dfx->index( VT_CONTROL           , 0 ) ] = xg[ dgx->index( VT_CONTROL           , 0 ) ] = 0.4;
+    xf[ dfx->index( VT_PARAMETER         , 0 ) ] = xg[ dgx->index( VT_PARAMETER         , 0 ) ] = 0.5;
+
+    dfx->evaluate( 0, xf, df );
+    dgx->evaluate( 0, xg, dg );
+
+    printf("entries which differ after reading: symbolic derivative %d \n", countDifferences( dim,df,dg ) );
+
+
+    // A FILE WITH ANOTHER VERSION OR NUMBER FORMAT IS REJECTED:
+    // ---------------------------------------------------------
+    file = tmpfile();
+
+    if( file == 0 || f.write( file ) != SUCCESSFUL_RETURN ){
+        printf("the function could not be written \n");
+        return 1;
+    }
+
+    // (the byte after the file id holds the version of the format)
+    fseek( file, 8, SEEK_SET );
+    fputc( 0, file );
+    rewind( file );
+
+    if( g.read( file ) == SUCCESSFUL_RETURN ) printf("a file with another format has been read \n");
+    else                                      printf("a file with another format has been rejected \n");
+
+    fclose( file );
+
+
+    // A VARIABLE WITH A NEGATIVE INDEX IS REJECTED:
+    // ---------------------------------------------
+    file = tmpfile();
+
+    if( file == 0 || f.write( file ) != SUCCESSFUL_RETURN ){
+        printf("the function could not be written \n");
+        return 1;
+    }
+
+    // (the node records follow the file id, the format, the flags and
+    //  the header of the operator table)
+    int    record[5];
+    double value;
+    long   position = 8 + 4 + 2*sizeof(int) + 4*sizeof(int);
+
+    fseek( file, position, SEEK_SET );
+
+    while( fread( record, sizeof(int), 5, file ) == 5 && fread( &value, sizeof(double), 1, file ) == 1 &&
+           ( record[0] != ON_VARIABLE || record[3] >= 0 ) )
+        position += 5*sizeof(int) + sizeof(double);
+
+    record[2] = -7;
+    fseek( file, position, SEEK_SET );
+    fwrite( record, sizeof(int), 5, file );
+    rewind( file );
+
+    if( g.read( file ) == SUCCESSFUL_RETURN ) printf("a variable with a negative index has been read \n");
+    else                                      printf("a variable with a negative index has been rejected \n");
+
+    fclose( file );
+
+    delete[] x;   delete[] seed; delete[] bseed;
+    delete[] rf;  delete[] rg;   delete[] df;
+    delete[] dg;  delete[] bf;   delete[] bg;
+    delete[] xf;  delete[] xg;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
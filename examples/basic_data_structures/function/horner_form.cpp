@@ -0,0 +1,140 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/horner_form.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example sets up a dense polynomial surrogate model of
+ *    degree 6 in 6 variables, converts it to multivariate Horner
+ *    form and compares the values, the forward derivatives and
+ *    the evaluation times of the compiled function before and
+ *    after the conversion.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+const int nX     = 6;
+const int degree = 6;
+
+
+// (adds all monomials of the given degree in x[k], ..., x[nX-1])
+void addMonomials( Expression &p, DifferentialState *x, int k, int degree_,
+                   Expression monomial, int &nTerms ){
+
+    if( degree_ == 0 || k == nX ){
+
+        if( degree_ == 0 ){
+            nTerms++;
+            p = p + ( sin( 1.0*nTerms )/nTerms )*monomial;
+        }
+        return;
+    }
+
+    for( int e = degree_; e >= 0; --e )
+        addMonomials( p, x, k+1, degree_-e, e > 0 ? monomial*pow( x[k], e ) : monomial, nTerms );
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i, j;
+
+    const int nEvaluations = 2000;
+
+    // DEFINE THE POLYNOMIAL MODEL:
+    // ----------------------------
+    DifferentialState x[nX];
+
+    Expression p = 0.5;
+    int nTerms = 0;
+
+    for( i = 1; i <= degree; ++i )
+        addMonomials( p, x, 0, i, Expression( 1.0 ), nTerms );
+
+    Function f;
+    f << p;
+
+    f.compile();
+
+    const int nv = f.getNumberOfVariables()+1;
+
+    double *xx   = new double[nv];
+    double *seed = new double[nv];
+    double  r[2], df[2][nX];
+
+    for( i = 0; i < nv; ++i ){
+        xx  [i] = 0.0;
+        seed[i] = 0.0;
+    }
+    for( i = 0; i < nX; ++i )
+        xx[ f.index( VT_DIFFERENTIAL_STATE, i ) ] = 0.9 - 0.15*i;
+
+    printf("polynomial of degree %d in %d variables with %d terms \n", degree, nX, nTerms+1 );
+
+
+    // EVALUATE BEFORE AND AFTER THE CONVERSION:
+    // -----------------------------------------
+    double t[2];
+
+    for( j = 0; j < 2; ++j ){
+
+        if( j == 1 ) f.convertToHornerForm();
+
+        t[j] = -acadoGetTime();
+        for( i = 0; i < nEvaluations; ++i ) f.evaluate( 0, xx, &r[j] );
+        t[j] += acadoGetTime();
+
+        for( i = 0; i < nX; ++i ){
+            seed[ f.index( VT_DIFFERENTIAL_STATE, i ) ] = 1.0;
+            f.AD_forward( 0, seed, &df[j][i] );
+            seed[ f.index( VT_DIFFERENTIAL_STATE, i ) ] = 0.0;
+        }
+    }
+
+    double error = 0.0;
+    for( i = 0; i < nX; ++i )
+        if( fabs( df[0][i]-df[1][i] ) > error ) error = fabs( df[0][i]-df[1][i] );
+
+    printf("value:      %.10e (expanded)  %.10e (Horner) \n", r[0], r[1] );
+    printf("derivative: largest difference %.1e \n", error );
+    printf("time:       Horner / expanded %.2f \n", t[1]/t[0] );
+
+    delete[] xx;
+    delete[] seed;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
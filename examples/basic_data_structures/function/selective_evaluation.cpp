@@ -0,0 +1,189 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/selective_evaluation.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example evaluates and differentiates a few selected
+ *    components of a function and compares them with the full
+ *    evaluation, both for the expression tree and for the
+ *    compiled tape. Finally, components reading the results of
+ *    a C function which is evaluated by another component are
+ *    selected.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+void my_function( double *x_, double *f, void *userData ){
+
+    f[0] = x_[0]*x_[0] + x_[1];
+    f[1] = sin( x_[0] )*x_[1];
+}
+
+
+double maxDifference( int n, const int *comp, const double *a, const double *b ){
+
+    int i;
+    double result = 0.0;
+
+    for( i = 0; i < n; ++i )
+        if( fabs( a[comp[i]] - b[i] ) > result ) result = fabs( a[comp[i]] - b[i] );
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i;
+
+    // DEFINE THE FUNCTION:
+    // --------------------
+    DifferentialState x1, x2, x3;
+    Control           u;
+
+    IntermediateState s = sin(x1)*x2 + exp(0.3*x3);
+    IntermediateState r = s*s - u*x3;
+    IntermediateState q = cos(u)*x1;
+
+    FunctionEvaluationTree f;
+
+    f << r + x2;
+    f << q*q;
+    f << s + q;
+    f << log(1.0+r*r);
+
+    const int nv  = f.getNumberOfVariables()+1;
+    const int dim = f.getDim();
+
+    const int comp[2] = { 3, 1 };
+
+    double *x     = new double[nv ];
+    double *seed  = new double[nv ];
+    double *bseed = new double[dim];
+    double *rf    = new double[dim];
+    double *df    = new double[dim];
+    double *bf    = new double[nv ];
+    double *rs    = new double[dim];
+    double *ds    = new double[dim];
+    double *bs    = new double[nv ];
+
+
+    // COMPARE THE SELECTED COMPONENTS (TREE AND TAPE):
+    // ------------------------------------------------
+    for( int pass = 0; pass < 2; ++pass ){
+
+        if( pass == 1 ) f.compile();
+
+        for( i = 0; i < nv; ++i ){
+            x[i]    = 0.1*(i+1);
+            seed[i] = sin( 1.0+i );
+            bf[i]   = bs[i] = 0.0;
+        }
+        for( i = 0; i < dim; ++i )
+            bseed[i] = 0.0;
+
+        bseed[comp[0]] = 1.0;
+        bseed[comp[1]] = -0.5;
+
+        double bsel[2] = { 1.0, -0.5 };
+
+        // (the selection is evaluated first, such that it can not
+        //  use intermediate states stored by the full evaluation)
+        f.evaluate   ( 0, x   , rs  , 2, comp );
+        f.AD_forward ( 0, seed, ds  , 2, comp );
+        f.AD_backward( 0, bsel, bs  , 2, comp );
+
+        f.evaluate( 0, x, rf );  f.AD_forward( 0, seed, df );  f.AD_backward( 0, bseed, bf );
+
+        double bdiff = 0.0;
+        for( i = 0; i < nv; ++i )
+            if( fabs( bf[i]-bs[i] ) > bdiff ) bdiff = fabs( bf[i]-bs[i] );
+
+        printf("%s  selected vs. full:  evaluation %.1e  forward %.1e  backward %.1e \n",
+               pass == 0 ? "tree" : "tape",
+               maxDifference( 2,comp,rf,rs ), maxDifference( 2,comp,df,ds ), bdiff );
+    }
+
+
+    // C FUNCTIONS ARE EVALUATED BY THEIR FIRST COMPONENT:
+    // ---------------------------------------------------
+    CFunction map( 2, my_function );
+
+    IntermediateState y(2);
+
+    y(0) = x1;
+    y(1) = 2.0*x2+1.0;
+
+    Expression m = map(y);
+
+    FunctionEvaluationTree g;
+
+    g << m(0) + x3;
+    g << u*u;
+    g << m(1)*x1;
+
+    const int nvg  = g.getNumberOfVariables()+1;
+    const int dimg = g.getDim();
+
+    const int cComp[1] = { 2 };
+
+    double *xg = new double[nvg ];
+    double *sg = new double[nvg ];
+    double *rg = new double[dimg];
+    double *dg = new double[dimg];
+
+    for( i = 0; i < nvg; ++i ){
+        xg[i] = 0.2*(i+1);
+        sg[i] = cos( 1.0+i );
+    }
+
+    g.evaluate  ( 0, xg, rs, 1, cComp );
+    g.AD_forward( 0, sg, ds, 1, cComp );
+
+    g.evaluate( 0, xg, rg );  g.AD_forward( 0, sg, dg );
+
+    printf("C function  selected vs. full:  evaluation %.1e  forward %.1e \n",
+           maxDifference( 1,cComp,rg,rs ), maxDifference( 1,cComp,dg,ds ) );
+
+    delete[] x;   delete[] seed; delete[] bseed;
+    delete[] rf;  delete[] df;   delete[] bf;
+    delete[] rs;  delete[] ds;   delete[] bs;
+    delete[] xg;  delete[] sg;   delete[] rg;  delete[] dg;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,146 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/shared_expressions.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example builds a function whose components share
+ *    sub-expressions and contain trivial operations, which are
+ *    simplified and hoisted into intermediate states while the
+ *    function is set up. The results are compared with the plain
+ *    C formulas and the symbolic (memoized) derivatives with
+ *    forward AD.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* the components of the function as plain C code: */
+void referenceFunction( double x, double y, double *f ){
+
+    double e = x*y + sin( x*y );
+
+    f[0] = e*e + x + x*y;
+    f[1] = exp( e ) + y;
+    f[2] = 3.0*x*x*x + 2.0*x*x*y + x*y*y + x/4.0;
+}
+
+
+double maxDifference( int n, const double *a, const double *b ){
+
+    int i;
+    double result = 0.0;
+
+    for( i = 0; i < n; ++i )
+        if( fabs( a[i] - b[i] ) > result ) result = fabs( a[i] - b[i] );
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i, j;
+
+    // DEFINE THE FUNCTION (x*y and y*x SHARE ONE NODE, 1*x AND +0 ARE REMOVED):
+    // ---------------------------------------------------------------------------
+    DifferentialState x, y;
+
+    Expression e = x*y + sin( y*x );
+
+    FunctionEvaluationTree f;
+
+    f << e*e + 1.0*x + 0.0 + y*x;
+    f << exp( e ) - ( -y );
+    f << 3.0*x*x*x + 2.0*x*x*y + x*y*y + x/4.0;
+
+    const int nv  = f.getNumberOfVariables()+1;
+    const int dim = f.getDim();
+    const int ix  = f.index( VT_DIFFERENTIAL_STATE, 0 );
+    const int iy  = f.index( VT_DIFFERENTIAL_STATE, 1 );
+
+    double *xx   = new double[nv ];
+    double *r    = new double[dim];
+    double *ref  = new double[dim];
+    double *seed = new double[nv ];
+    double *d    = new double[dim];
+
+    for( i = 0; i < nv; ++i ) xx[i] = 0.0;
+    xx[ix] = 0.7;
+    xx[iy] = 1.3;
+
+    f.evaluate( 0, xx, r );
+    referenceFunction( 0.7, 1.3, ref );
+
+    printf("evaluation vs. C code:                    %.1e \n", maxDifference( dim,r,ref ) );
+
+
+    // SYMBOLIC DERIVATIVES (MEMOIZED IN THE OPERATOR TABLE) VS. FORWARD AD:
+    // -----------------------------------------------------------------------
+    double eDerivative = 0.0;
+
+    for( j = 0; j < 2; ++j ){
+
+        const int index = ( j == 0 ) ? ix : iy;
+
+        // (the derivative tree is owned by f):
+        FunctionEvaluationTree *df = f.differentiate( index );
+
+        double *dx = new double[df->getNumberOfVariables()+1];
+        for( i = 0; i <= df->getNumberOfVariables(); ++i ) dx[i] = 0.0;
+
+        dx[ df->index( VT_DIFFERENTIAL_STATE, 0 ) ] = 0.7;
+        dx[ df->index( VT_DIFFERENTIAL_STATE, 1 ) ] = 1.3;
+
+        df->evaluate( 0, dx, ref );
+
+        for( i = 0; i < nv; ++i ) seed[i] = 0.0;
+        seed[index] = 1.0;
+
+        f.evaluate  ( 0, xx, r );
+        f.AD_forward( 0, seed, d );
+
+        if( maxDifference( dim,d,ref ) > eDerivative ) eDerivative = maxDifference( dim,d,ref );
+
+        delete[] dx;
+    }
+
+    printf("symbolic derivatives vs. forward AD:      %.1e \n", eDerivative );
+
+    delete[] xx;  delete[] r;  delete[] ref;  delete[] seed;  delete[] d;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,175 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/function/sparse_jacobian.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example computes a sparse Jacobian with one forward
+ *    direction per colour of its sparsity pattern and a sparse
+ *    Hessian with one direction per colour of a star colouring, and
+ *    compares them with the dense results.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/function.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    int i, j, k;
+
+    // DEFINE A FUNCTION WITH A SPARSE JACOBIAN:
+    // ------------------------------------------
+    const int N = 8;
+
+    DifferentialState x(N);
+    Control           u(2);
+
+    Function f;
+
+    for( i = 0; i < N-1; ++i )
+        f << x(i)*x(i+1) + sin( x(i) );
+    f << exp( x(N-1) )*u(0) + u(1)*u(1);
+
+    const int nv  = f.getNumberOfVariables()+1;
+    const int dim = f.getDim();
+
+    double *xx = new double[nv];
+    double *r  = new double[dim];
+
+    for( i = 0; i < nv; ++i )
+        xx[i] = 0.3 + 0.1*i;
+
+    f.evaluate( 0, xx, r );
+
+
+    // DENSE JACOBIAN (one direction per variable):
+    // ---------------------------------------------
+    double *seed  = new double[nv];
+    double *d     = new double[dim];
+    double *dense = new double[dim*nv];
+
+    for( j = 0; j < nv; ++j ){
+
+        for( i = 0; i < nv; ++i ) seed[i] = 0.0;
+        seed[j] = 1.0;
+
+        f.AD_forward( 0, seed, d );
+        for( i = 0; i < dim; ++i ) dense[i*nv+j] = d[i];
+    }
+
+
+    // COMPRESSED JACOBIAN (one direction per colour):
+    // ------------------------------------------------
+    SparsityPattern pattern;
+    f.getSparsityPattern( pattern );
+
+    int *color = new int[nv];
+    const int nColors = pattern.getColumnColoring( color );
+
+    double *S = new double[nColors*nv ];
+    double *D = new double[nColors*dim];
+
+    for( k = 0; k < nColors*nv; ++k ) S[k] = 0.0;
+    for( j = 0; j < nv; ++j ) S[color[j]*nv+j] = 1.0;
+
+    f.AD_forward( 0, nColors, S, D );
+
+    double eJacobian = 0.0;
+    double eOutside  = 0.0;
+
+    for( i = 0; i < dim; ++i ){
+        for( j = 0; j < nv; ++j ){
+
+            if( pattern.isNonzero( i,j ) == BT_TRUE ){
+                if( fabs( D[color[j]*dim+i] - dense[i*nv+j] ) > eJacobian )
+                    eJacobian = fabs( D[color[j]*dim+i] - dense[i*nv+j] );
+            }
+            else
+                if( fabs( dense[i*nv+j] ) > eOutside ) eOutside = fabs( dense[i*nv+j] );
+        }
+    }
+
+    printf("Jacobian: %d variables, %d colours, difference %.1e, outside of the pattern %.1e \n",
+           nv, nColors, eJacobian, eOutside );
+
+    // SPARSE HESSIAN OF THE WEIGHTED SUM bseed^T f:
+    // ---------------------------------------------
+    double *bseed = new double[dim];
+    for( i = 0; i < dim; ++i ) bseed[i] = 1.0 - 0.2*i;
+
+    SparsityPattern hessianPattern;
+    f.getHessianSparsityPattern( hessianPattern );
+
+    double *H = new double[hessianPattern.getNumberOfNonzeros()+1];
+    f.AD_hessian( 0, bseed, H );
+
+    double *zero = new double[dim];
+    double *J    = new double[nv ];
+    double *h    = new double[nv ];
+
+    for( i = 0; i < dim; ++i ) zero[i] = 0.0;
+
+    double eHessian = 0.0;
+    k = 0;
+
+    for( j = 0; j < nv; ++j ){
+
+        for( i = 0; i < nv; ++i ){ seed[i] = 0.0; J[i] = 0.0; h[i] = 0.0; }
+        seed[j] = 1.0;
+
+        f.AD_forward  ( 0, seed, d );
+        f.AD_backward2( 0, bseed, zero, J, h );
+
+        // row j of the lower triangle:
+        for( ; k < hessianPattern.getRowStart()[j+1]; ++k )
+            if( fabs( H[k] - h[ hessianPattern.getColIndex()[k] ] ) > eHessian )
+                eHessian = fabs( H[k] - h[ hessianPattern.getColIndex()[k] ] );
+    }
+
+    int *starColor = new int[nv];
+    const int nStarColors = hessianPattern.getSymmetric().getStarColoring( starColor );
+
+    printf("Hessian:  %d non-zeros, %d colours, difference %.1e \n",
+           hessianPattern.getNumberOfNonzeros(), nStarColors, eHessian );
+
+
+    delete[] xx;    delete[] r;     delete[] seed;  delete[] d;
+    delete[] dense; delete[] color; delete[] S;     delete[] D;
+    delete[] bseed; delete[] H;     delete[] zero;  delete[] J;
+    delete[] h;     delete[] starColor;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,139 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/factorization_tutorial.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This tutorial example solves linear systems with the
+ *    reusable LU, QR, Cholesky and LDL^T factorizations and
+ *    prints the residuals of the solutions of A*x = b and
+ *    A^T*x = b.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+Matrix randomMatrix( uint m, uint n ){
+
+    uint i, j;
+    Matrix A( m,n );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            A( i,j ) = (double)rand() / RAND_MAX - 0.5;
+
+    return A;
+}
+
+
+/* the largest entry of |A*x - b| (or |A^T*x - b| if transposed): */
+double residual( const Matrix &A, const Vector &x, const Vector &b, BooleanType transposed ){
+
+    uint i, j;
+    double result = 0.0;
+
+    for( i = 0; i < b.getDim(); ++i ){
+
+        double r = -b( i );
+        for( j = 0; j < x.getDim(); ++j )
+            r += ( transposed == BT_TRUE ? A( j,i ) : A( i,j ) ) * x( j );
+
+        if( fabs( r ) > result ) result = fabs( r );
+    }
+
+    return result;
+}
+
+
+/* solves both systems and prints the residuals: */
+void printResiduals( const char *name, MatrixFactorization &factorization,
+                     const Matrix &A, const Vector &b ){
+
+    if( factorization.factorize( A ) != SUCCESSFUL_RETURN ){
+        printf("  %-9s |  factorization failed \n", name );
+        return;
+    }
+
+    Vector x = b;
+    Vector y = b;
+
+    factorization.solve( x );
+    factorization.solveTranspose( y );
+
+    printf("  %-9s |  %.1e |  %.1e \n", name,
+           residual( A,x,b,BT_FALSE ), residual( A,y,b,BT_TRUE ) );
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint size[3] = { 5, 40, 100 };
+
+    uint run1, i;
+
+    LUFactorization       lu;
+    QRFactorization       qr;
+    CholeskyFactorization cholesky;
+    LDLFactorization      ldl;
+
+    for( run1 = 0; run1 < 3; run1++ ){
+
+        const uint n = size[run1];
+
+        // A GENERAL AND A SYMMETRIC POSITIVE DEFINITE MATRIX:
+        // ----------------------------------------------------
+        Matrix A = randomMatrix( n,n );
+        Matrix B = randomMatrix( n,n );
+        Matrix S = B^B;
+
+        for( i = 0; i < n; ++i )
+            S( i,i ) += 1.0;
+
+        Vector b( n );
+        for( i = 0; i < n; ++i ) b( i ) = (double)rand() / RAND_MAX;
+
+
+        // THE FACTORIZATION OBJECTS RE-USE THEIR MEMORY FOR EACH SIZE:
+        // ------------------------------------------------------------
+        printf("n = %3d:     |  A*x = b |  A^T*x = b \n", n );
+
+        printResiduals( "LU",       lu,       A, b );
+        printResiduals( "QR",       qr,       A, b );
+        printResiduals( "Cholesky", cholesky, S, b );
+        printResiduals( "LDL^T",    ldl,      S, b );
+    }
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,227 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/matrix_multiplication_benchmark.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This example compares the blocked matrix-matrix and
+ *    matrix-vector products of the ACADO Matrix class with
+ *    the plain triple loop they replace. It also compares the
+ *    in-place updates addProduct and addTransposeProduct with
+ *    the update via a temporary, C = C + A*B.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+/* the reference implementation (plain triple loop), which adds the product to C if addToC is BT_TRUE: */
+void referenceGemm( const Matrix &A, const Matrix &B, Matrix &C, BooleanType transA, BooleanType addToC ){
+
+    uint i, j, k;
+
+    uint m = transA == BT_TRUE ? A.getNumCols() : A.getNumRows();
+    uint l = transA == BT_TRUE ? A.getNumRows() : A.getNumCols();
+
+    if( addToC == BT_FALSE ){
+        C.init( m, B.getNumCols() );
+        C.setZero();
+    }
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < B.getNumCols(); ++j )
+            for( k = 0; k < l; ++k )
+                C( i,j ) += ( transA == BT_TRUE ? A( k,i ) : A( i,k ) ) * B( k,j );
+}
+
+
+void referenceGemv( const Matrix &A, const Vector &x, Vector &y ){
+
+    uint i, j;
+
+    y.init( A.getNumRows() );
+    y.setZero();
+
+    for( i = 0; i < A.getNumRows(); ++i )
+        for( j = 0; j < A.getNumCols(); ++j )
+            y( i ) += A( i,j ) * x( j );
+}
+
+
+double maxDifference( VectorspaceElement &a, VectorspaceElement &b ){
+
+    uint i;
+    double result = 0.0;
+
+    for( i = 0; i < a.getDim(); ++i )
+        if( fabs( a(i) - b(i) ) > result ) result = fabs( a(i) - b(i) );
+
+    return result;
+}
+
+
+Matrix randomMatrix( uint m, uint n ){
+
+    uint i, j;
+    Matrix A( m,n );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            A( i,j ) = (double)rand() / RAND_MAX - 0.5;
+
+    return A;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint size[5] = { 8, 32, 64, 128, 256 };
+
+    uint run1;
+    int  run2;
+
+
+    // PRODUCTS:
+    // ---------
+    printf("  size |  A*B old [s]  new [s] |  A^T*B old [s]  new [s] |  A*x old [s]  new [s] | difference \n");
+
+    for( run1 = 0; run1 < 5; run1++ ){
+
+        const uint n = size[run1];
+        const int  nRepeat = (int)( 2.0e7 / ( (double)n*n*n ) ) + 1;
+
+        Matrix A = randomMatrix( n,n );
+        Matrix B = randomMatrix( n,n );
+        Vector x( n );
+        for( uint i = 0; i < n; ++i ) x( i ) = (double)rand() / RAND_MAX;
+
+        Matrix C1, C2;
+        Vector y1, y2;
+        double t[6];
+
+        t[0] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) referenceGemm( A,B,C1,BT_FALSE,BT_FALSE );
+        t[0] += acadoGetTime();
+
+        t[1] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) C2 = A*B;
+        t[1] += acadoGetTime();
+
+        double e = maxDifference( C1,C2 );
+
+        t[2] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) referenceGemm( A,B,C1,BT_TRUE,BT_FALSE );
+        t[2] += acadoGetTime();
+
+        t[3] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) C2 = A^B;
+        t[3] += acadoGetTime();
+
+        e += maxDifference( C1,C2 );
+
+        t[4] = -acadoGetTime();
+        for( run2 = 0; run2 < (int)n*nRepeat; run2++ ) referenceGemv( A,x,y1 );
+        t[4] += acadoGetTime();
+
+        t[5] = -acadoGetTime();
+        for( run2 = 0; run2 < (int)n*nRepeat; run2++ ) y2 = A*x;
+        t[5] += acadoGetTime();
+
+        e += maxDifference( y1,y2 );
+
+        printf("  %4d |  %.2e  %.2e |  %.2e  %.2e |  %.2e  %.2e | %.1e \n",
+               n, t[0]/nRepeat, t[1]/nRepeat, t[2]/nRepeat, t[3]/nRepeat,
+               t[4]/(n*nRepeat), t[5]/(n*nRepeat), e );
+    }
+
+
+    // UPDATES C += A*B AND C += A^T*B:
+    // --------------------------------
+    // (all variants start from the same matrix and accumulate the
+    //  product nRepeat times, the difference is divided by nRepeat)
+    printf("\n  size |  C += A*B loop [s]  C+A*B [s]  addProduct [s] |  C += A^T*B loop [s]  C+(A^B) [s]  addTransposeProduct [s] | difference \n");
+
+    for( run1 = 0; run1 < 5; run1++ ){
+
+        const uint n = size[run1];
+        const int  nRepeat = (int)( 2.0e7 / ( (double)n*n*n ) ) + 1;
+
+        Matrix A  = randomMatrix( n,n );
+        Matrix B  = randomMatrix( n,n );
+        Matrix C0 = randomMatrix( n,n );
+
+        Matrix C1, C2, C3;
+        double t[6];
+
+        C1 = C0;
+        t[0] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) referenceGemm( A,B,C1,BT_FALSE,BT_TRUE );
+        t[0] += acadoGetTime();
+
+        C2 = C0;
+        t[1] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) C2 = C2 + A*B;
+        t[1] += acadoGetTime();
+
+        C3 = C0;
+        t[2] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) C3.addProduct( A,B );
+        t[2] += acadoGetTime();
+
+        double e = ( maxDifference( C1,C2 ) + maxDifference( C1,C3 ) ) / nRepeat;
+
+        C1 = C0;
+        t[3] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) referenceGemm( A,B,C1,BT_TRUE,BT_TRUE );
+        t[3] += acadoGetTime();
+
+        C2 = C0;
+        t[4] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) C2 = C2 + (A^B);
+        t[4] += acadoGetTime();
+
+        C3 = C0;
+        t[5] = -acadoGetTime();
+        for( run2 = 0; run2 < nRepeat; run2++ ) C3.addTransposeProduct( A,B );
+        t[5] += acadoGetTime();
+
+        e += ( maxDifference( C1,C2 ) + maxDifference( C1,C3 ) ) / nRepeat;
+
+        printf("  %4d |        %.2e   %.2e        %.2e |          %.2e     %.2e                 %.2e | %.1e \n",
+               n, t[0]/nRepeat, t[1]/nRepeat, t[2]/nRepeat,
+               t[3]/nRepeat, t[4]/nRepeat, t[5]/nRepeat, e );
+    }
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
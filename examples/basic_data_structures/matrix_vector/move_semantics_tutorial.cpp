@@ -0,0 +1,262 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/move_semantics_tutorial.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This tutorial example moves dense matrices, vectors, vector space
+ *    elements and block matrices, checks that the moved-from objects are
+ *    left valid and empty, and compares the sums and differences of
+ *    temporaries with those of copies.
+ *    Without compiler support for rvalue references, only the copies
+ *    are evaluated.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+Matrix randomMatrix( uint m, uint n ){
+
+    uint i, j;
+    Matrix A( m,n );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            A( i,j ) = (double)rand() / RAND_MAX - 0.5;
+
+    return A;
+}
+
+
+Vector randomVector( uint n ){
+
+    uint i;
+    Vector x( n );
+
+    for( i = 0; i < n; ++i )
+        x( i ) = (double)rand() / RAND_MAX - 0.5;
+
+    return x;
+}
+
+
+double maxDifference( const Matrix &A, const Matrix &B ){
+
+    uint i, j;
+    double result = 0.0;
+
+    if( A.getNumRows() != B.getNumRows() || A.getNumCols() != B.getNumCols() )
+        return INFTY;
+
+    for( i = 0; i < A.getNumRows(); ++i )
+        for( j = 0; j < A.getNumCols(); ++j )
+            if( fabs( A( i,j ) - B( i,j ) ) > result ) result = fabs( A( i,j ) - B( i,j ) );
+
+    return result;
+}
+
+
+double maxDifference( const Vector &x, const Vector &y ){
+
+    uint i;
+    double result = 0.0;
+
+    if( x.getDim() != y.getDim() )
+        return INFTY;
+
+    for( i = 0; i < x.getDim(); ++i )
+        if( fabs( x( i ) - y( i ) ) > result ) result = fabs( x( i ) - y( i ) );
+
+    return result;
+}
+
+
+/* a moved-from matrix has to be empty and usable again: */
+BooleanType isValidAndEmpty( Matrix &A ){
+
+    if( A.getNumRows() != 0 || A.getNumCols() != 0 || A.isEmpty() == BT_FALSE )
+        return BT_FALSE;
+
+    A.init( 2,3 );
+    A.setAll( 1.0 );
+
+    return ( A.getNumRows() == 2 && A.getNumCols() == 3 && acadoIsEqual( A( 1,2 ),1.0 ) == BT_TRUE ) ? BT_TRUE : BT_FALSE;
+}
+
+
+/* a moved-from vector has to be empty and usable again: */
+BooleanType isValidAndEmpty( Vector &x ){
+
+    if( x.getDim() != 0 || x.isEmpty() == BT_FALSE )
+        return BT_FALSE;
+
+    x.init( 4 );
+    x.setAll( 1.0 );
+
+    return ( x.getDim() == 4 && acadoIsEqual( x( 3 ),1.0 ) == BT_TRUE ) ? BT_TRUE : BT_FALSE;
+}
+
+
+/* a moved-from vector space element has to be empty and usable again: */
+BooleanType isValidAndEmpty( VectorspaceElement &v ){
+
+    if( v.getDim() != 0 || v.isEmpty() == BT_FALSE )
+        return BT_FALSE;
+
+    v.init( 4 );
+    v.setAll( 1.0 );
+
+    return ( v.getDim() == 4 && acadoIsEqual( v( 3 ),1.0 ) == BT_TRUE ) ? BT_TRUE : BT_FALSE;
+}
+
+
+/* a moved-from block matrix has to be empty and usable again: */
+BooleanType isValidAndEmpty( BlockMatrix &M ){
+
+    if( M.getNumRows() != 0 || M.getNumCols() != 0 || M.isEmpty() == BT_FALSE )
+        return BT_FALSE;
+
+    M.init( 2,2 );
+    M.setIdentity( 1,1,3 );
+
+    return ( M.getNumRows() == 2 && M.getNumCols() == 2 && M.getType( 1,1 ) == SBMT_ONE ) ? BT_TRUE : BT_FALSE;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint m = 20;
+    const uint n = 15;
+
+    Matrix A = randomMatrix( m,n );
+    Matrix B = randomMatrix( m,n );
+    Vector x = randomVector( n );
+    Vector y = randomVector( n );
+
+    double eMatrix = 0.0, eVector = 0.0;
+    int    nFailed = 0;
+
+
+    // SUMS AND DIFFERENCES OF COPIES:
+    // -------------------------------
+    const Matrix ApB = A + B;
+    const Matrix AmB = A - B;
+    const Vector xpy = x + y;
+    const Vector xmy = x - y;
+
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+    // MOVE CONSTRUCTION AND MOVE ASSIGNMENT:
+    // --------------------------------------
+    Matrix A1 = A;
+    Matrix A2( std::move( A1 ) );
+    Matrix A3;
+    Matrix A4 = B;
+
+    A3 = std::move( A2 );
+    A4 = std::move( A3 );
+
+    Vector x1 = x;
+    Vector x2( std::move( x1 ) );
+    Vector x3;
+    Vector x4 = y;
+
+    x3 = std::move( x2 );
+    x4 = std::move( x3 );
+
+    if( isValidAndEmpty( A1 ) == BT_FALSE || isValidAndEmpty( A2 ) == BT_FALSE || isValidAndEmpty( A3 ) == BT_FALSE )
+        nFailed++;
+    if( isValidAndEmpty( x1 ) == BT_FALSE || isValidAndEmpty( x2 ) == BT_FALSE || isValidAndEmpty( x3 ) == BT_FALSE )
+        nFailed++;
+
+    VectorspaceElement v1( x );
+    VectorspaceElement v2( std::move( v1 ) );
+    VectorspaceElement v3( 3 );
+
+    v3 = std::move( v2 );
+
+    if( isValidAndEmpty( v1 ) == BT_FALSE || isValidAndEmpty( v2 ) == BT_FALSE || v3.getDim() != n )
+        nFailed++;
+
+    BlockMatrix M1( 2,1 );
+    BlockMatrix M3( 3,3 );
+
+    M1.setDense( 0,0,A );
+    M1.setIdentity( 1,0,n );
+
+    BlockMatrix M2( std::move( M1 ) );
+
+    M3 = std::move( M2 );
+
+    if( isValidAndEmpty( M1 ) == BT_FALSE || isValidAndEmpty( M2 ) == BT_FALSE )
+        nFailed++;
+    if( M3.getNumRows() != 2 || M3.getNumCols() != 1 || M3.getType( 1,0 ) != SBMT_ONE || maxDifference( M3.getBlock( 0,0 ),A ) > 0.0 )
+        nFailed++;
+
+    eMatrix = maxDifference( A4,A );
+    eVector = maxDifference( x4,x );
+
+    printf("moved-from objects valid and empty: %s \n", nFailed == 0 ? "yes" : "no" );
+    printf("moved objects:                      matrix %.1e  vector %.1e \n", eMatrix, eVector );
+
+
+    // SUMS AND DIFFERENCES OF TEMPORARIES (RE-USING THEIR STORAGE):
+    // -------------------------------------------------------------
+    double eSum = 0.0, eDiff = 0.0, e;
+
+    e = maxDifference( Matrix( A ) + B,           ApB ); if( e > eSum  ) eSum  = e;
+    e = maxDifference( A + Matrix( B ),           ApB ); if( e > eSum  ) eSum  = e;
+    e = maxDifference( Matrix( A ) + Matrix( B ), ApB ); if( e > eSum  ) eSum  = e;
+    e = maxDifference( Matrix( A ) - B,           AmB ); if( e > eDiff ) eDiff = e;
+
+    e = maxDifference( Vector( x ) + y,           xpy ); if( e > eSum  ) eSum  = e;
+    e = maxDifference( x + Vector( y ),           xpy ); if( e > eSum  ) eSum  = e;
+    e = maxDifference( Vector( x ) + Vector( y ), xpy ); if( e > eSum  ) eSum  = e;
+    e = maxDifference( Vector( x ) - y,           xmy ); if( e > eDiff ) eDiff = e;
+
+    printf("temporaries vs. copies:             sum %.1e  difference %.1e \n", eSum, eDiff );
+
+    if( eMatrix > 0.0 || eVector > 0.0 || eSum > 0.0 || eDiff > 0.0 )
+        nFailed++;
+
+#else
+
+    printf("no rvalue references: sum %.1e  difference %.1e (copies only) \n",
+           maxDifference( ApB - B,A ), maxDifference( xmy + y,x ) );
+
+#endif
+
+    return nFailed == 0 ? 0 : 1;
+}
+/* <<< end tutorial code <<< */
@@ -0,0 +1,184 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/sparse_matrix_tutorial.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This tutorial example stores a random sparse matrix and a
+ *    block matrix in the compressed row (CSR) and compressed column
+ *    (CSC) formats and compares the sparse matrix-vector products
+ *    and the format conversions with the dense results.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+
+Matrix randomSparseMatrix( uint m, uint n, double density ){
+
+    uint i, j;
+    Matrix A( m,n );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            A( i,j ) = ( (double)rand() / RAND_MAX < density ) ? (double)rand() / RAND_MAX - 0.5 : 0.0;
+
+    return A;
+}
+
+
+double maxDifference( const Matrix &A, const Matrix &B ){
+
+    uint i, j;
+    double result = 0.0;
+
+    for( i = 0; i < A.getNumRows(); ++i )
+        for( j = 0; j < A.getNumCols(); ++j )
+            if( fabs( A( i,j ) - B( i,j ) ) > result ) result = fabs( A( i,j ) - B( i,j ) );
+
+    return result;
+}
+
+
+/* the largest entry of |A*x - y| (or |A^T*x - y| if transposed): */
+double productDifference( const Matrix &A, const double *x, const double *y, BooleanType transposed ){
+
+    uint i, j;
+    double result = 0.0;
+
+    const uint m = ( transposed == BT_TRUE ) ? A.getNumCols() : A.getNumRows();
+    const uint n = ( transposed == BT_TRUE ) ? A.getNumRows() : A.getNumCols();
+
+    for( i = 0; i < m; ++i ){
+
+        double r = -y[i];
+        for( j = 0; j < n; ++j )
+            r += ( transposed == BT_TRUE ? A( j,i ) : A( i,j ) ) * x[j];
+
+        if( fabs( r ) > result ) result = fabs( r );
+    }
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint m = 60;
+    const uint n = 45;
+
+    uint i, j;
+
+    // A RANDOM DENSE MATRIX WITH ABOUT 10% NON-ZEROS:
+    // ------------------------------------------------
+    Matrix A = randomSparseMatrix( m,n,0.1 );
+
+    SparseMatrix csr( A,SSF_CSR );
+    SparseMatrix csc( A,SSF_CSC );
+
+    double *x  = new double[n];
+    double *xT = new double[m];
+    double *y  = new double[m];
+    double *yT = new double[n];
+
+    for( i = 0; i < n; ++i ) x [i] = sin( 1.0+i );
+    for( i = 0; i < m; ++i ) xT[i] = cos( 1.0+i );
+
+    printf("%d x %d matrix with %d non-zeros \n", m, n, csr.getNumberOfNonzeros() );
+
+
+    // SPARSE MATRIX-VECTOR PRODUCTS VS. THE DENSE PRODUCTS:
+    // -----------------------------------------------------
+    csr.multiply         ( x, y  );
+    csr.multiplyTranspose( xT,yT );
+
+    printf("CSR:  A*x %.1e  A^T*x %.1e \n",
+           productDifference( A,x,y,BT_FALSE ), productDifference( A,xT,yT,BT_TRUE ) );
+
+    csc.multiply         ( x, y  );
+    csc.multiplyTranspose( xT,yT );
+
+    printf("CSC:  A*x %.1e  A^T*x %.1e \n",
+           productDifference( A,x,y,BT_FALSE ), productDifference( A,xT,yT,BT_TRUE ) );
+
+
+    // FORMAT CONVERSIONS AND TRANSPOSES VS. THE DENSE MATRIX:
+    // -------------------------------------------------------
+    Matrix AT( n,m );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            AT( j,i ) = A( i,j );
+
+    printf("CSR -> CSC -> CSR: %.1e  transposed CSR: %.1e  transposed CSC: %.1e \n",
+           maxDifference( A, csr.convert( SSF_CSC ).convert( SSF_CSR ).getDense() ),
+           maxDifference( AT,csr.transpose().getDense() ),
+           maxDifference( AT,csc.transpose().getDense() ) );
+
+
+    // A BLOCK MATRIX WITH DENSE, IDENTITY AND EMPTY BLOCKS:
+    // -----------------------------------------------------
+    Matrix B11 = randomSparseMatrix( 4,3,1.0 );
+    Matrix B12 = randomSparseMatrix( 4,5,1.0 );
+    Matrix B22 = randomSparseMatrix( 3,5,1.0 );
+
+    BlockMatrix B( 2,2 );
+    B.setDense   ( 0,0,B11 );
+    B.setDense   ( 0,1,B12 );
+    B.setIdentity( 1,0,3   );
+    B.setDense   ( 1,1,B22 );
+
+    Matrix Bdense( 7,8 );
+    Bdense.setZero();
+
+    for( i = 0; i < 4; ++i ){
+        for( j = 0; j < 3; ++j ) Bdense( i,j   ) = B11( i,j );
+        for( j = 0; j < 5; ++j ) Bdense( i,j+3 ) = B12( i,j );
+    }
+    for( i = 0; i < 3; ++i ){
+        Bdense( i+4,i ) = 1.0;
+        for( j = 0; j < 5; ++j ) Bdense( i+4,j+3 ) = B22( i,j );
+    }
+
+    SparseMatrix Bcsc( B,SSF_CSC );
+
+    printf("block matrix: %d non-zeros, difference to the dense matrix %.1e \n",
+           Bcsc.getNumberOfNonzeros(), maxDifference( Bdense,Bcsc.getDense() ) );
+
+    delete[] x;  delete[] xT;
+    delete[] y;  delete[] yT;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
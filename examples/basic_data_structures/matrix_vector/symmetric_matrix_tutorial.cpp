@@ -0,0 +1,152 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/symmetric_matrix_tutorial.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This tutorial example accumulates a symmetric matrix in packed
+ *    storage by rank-one and rank-k updates and compares the result,
+ *    its products with vectors and matrices and the solution of a
+ *    linear system by its Cholesky factor with the dense results.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+Matrix randomMatrix( uint m, uint n ){
+
+    uint i, j;
+    Matrix A( m,n );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            A( i,j ) = (double)rand() / RAND_MAX - 0.5;
+
+    return A;
+}
+
+
+double maxDifference( const Matrix &A, const Matrix &B ){
+
+    uint i, j;
+    double result = 0.0;
+
+    for( i = 0; i < A.getNumRows(); ++i )
+        for( j = 0; j < A.getNumCols(); ++j )
+            if( fabs( A( i,j ) - B( i,j ) ) > result ) result = fabs( A( i,j ) - B( i,j ) );
+
+    return result;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint n = 30;
+    const uint k = 50;
+
+    uint i, j;
+
+    // RANK-K UPDATE VS. THE DENSE PRODUCT A^T*A:
+    // ------------------------------------------
+    Matrix A = randomMatrix( k,n );
+
+    SymmetricMatrix S( n );
+    S.addRankKUpdate( A );
+
+    Matrix H = A^A;
+
+    printf("%d x %d matrix with %d stored entries \n", n, n, S.getNumberOfEntries() );
+    printf("rank-k update vs. A^T*A:      %.1e \n", maxDifference( H,S.getDense() ) );
+
+
+    // RANK-ONE UPDATES (the rows of A scaled by 0.5) VS. 0.5*A^T*A:
+    // -------------------------------------------------------------
+    SymmetricMatrix S1( n );
+    double *a = new double[n];
+
+    for( i = 0; i < k; ++i ){
+        for( j = 0; j < n; ++j ) a[j] = A( i,j );
+        S1.addRankOneUpdate( a,0.5 );
+    }
+
+    Matrix H1 = H;
+    H1 *= 0.5;
+
+    printf("rank-one updates vs. A^T*A/2: %.1e \n", maxDifference( H1,S1.getDense() ) );
+
+
+    // PRODUCTS WITH A VECTOR AND A MATRIX:
+    // ------------------------------------
+    Vector x( n );
+    for( i = 0; i < n; ++i ) x( i ) = sin( 1.0+i );
+
+    Matrix B = randomMatrix( n,4 );
+
+    Vector y = S*x;
+    Vector z = H*x;
+
+    double eVector = 0.0;
+    for( i = 0; i < n; ++i )
+        if( fabs( y( i ) - z( i ) ) > eVector ) eVector = fabs( y( i ) - z( i ) );
+
+    printf("products: vector %.1e  matrix %.1e \n", eVector, maxDifference( H*B,S*B ) );
+
+
+    // CHOLESKY SOLUTION OF (A^T*A + I)*x = b:
+    // ---------------------------------------
+    for( i = 0; i < n; ++i ){
+        S( i,i ) += 1.0;
+        H( i,i ) += 1.0;
+    }
+
+    if( S.computeCholeskyDecomposition( ) != SUCCESSFUL_RETURN ){
+        printf("the matrix is not positive definite \n");
+        delete[] a;
+        return 1;
+    }
+
+    Vector b = S.solveCholesky( x );
+    Vector r = H*b;
+
+    double eResidual = 0.0;
+    for( i = 0; i < n; ++i )
+        if( fabs( r( i ) - x( i ) ) > eResidual ) eResidual = fabs( r( i ) - x( i ) );
+
+    printf("Cholesky residual:            %.1e \n", eResidual );
+
+    delete[] a;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
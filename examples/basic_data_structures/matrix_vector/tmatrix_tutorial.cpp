@@ -0,0 +1,159 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+ /**
+ *    \file examples/matrix_vector/tmatrix_tutorial.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ *
+ *    This tutorial example computes products of templated matrices
+ *    with double entries, writes through row and column views and
+ *    converts them to and from arrays, and compares the results
+ *    with the dense Matrix class.
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+USING_NAMESPACE_ACADO
+
+
+Matrix randomMatrix( uint m, uint n ){
+
+    uint i, j;
+    Matrix A( m,n );
+
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            A( i,j ) = (double)rand() / RAND_MAX - 0.5;
+
+    return A;
+}
+
+
+double maxDifference( const Matrix &A, const Matrix &B ){
+
+    uint i, j;
+    double result = 0.0;
+
+    for( i = 0; i < A.getNumRows(); ++i )
+        for( j = 0; j < A.getNumCols(); ++j )
+            if( fabs( A( i,j ) - B( i,j ) ) > result ) result = fabs( A( i,j ) - B( i,j ) );
+
+    return result;
+}
+
+
+/* copies a Tmatrix<double> into a dense matrix: */
+Matrix toMatrix( const Tmatrix<double> &T ){
+
+    uint i, j;
+    Matrix A( T.getNumRows(),T.getNumCols() );
+
+    for( i = 0; i < A.getNumRows(); ++i )
+        for( j = 0; j < A.getNumCols(); ++j )
+            A( i,j ) = T( i,j );
+
+    return A;
+}
+
+
+/* >>> start tutorial code >>> */
+int main( ){
+
+    const uint m = 20;
+    const uint n = 15;
+    const uint p = 10;
+
+    uint i, j;
+
+    Matrix A = randomMatrix( m,n );
+    Matrix B = randomMatrix( n,p );
+
+    Tmatrix<double> TA( m,n );
+    Tmatrix<double> TB( n,p );
+
+    for( i = 0; i < m; ++i ) for( j = 0; j < n; ++j ) TA( i,j ) = A( i,j );
+    for( i = 0; i < n; ++i ) for( j = 0; j < p; ++j ) TB( i,j ) = B( i,j );
+
+
+    // MATRIX PRODUCT AND SUM VS. THE DENSE MATRIX CLASS:
+    // --------------------------------------------------
+    Tmatrix<double> TC = TA*TB;
+    Matrix C = A*B;
+
+    Tmatrix<double> TD = TC;
+    TD += TC;
+    TD *= 0.25;
+
+    Matrix D = C;
+    D *= 0.5;
+
+    printf("product %.1e  sum %.1e \n",
+           maxDifference( C,toMatrix( TC ) ), maxDifference( D,toMatrix( TD ) ) );
+
+
+    // ROW AND COLUMN VIEWS WRITE THROUGH TO THE MATRIX:
+    // -------------------------------------------------
+    Tmatrix<double> row( 1,n );
+    Tmatrix<double> col( m,1 );
+
+    for( j = 0; j < n; ++j ) row( 0,j ) = 1.0 + j;
+    for( i = 0; i < m; ++i ) col( i,0 ) = -1.0 - i;
+
+    TA.row( 3 ) = row;
+    TA.col( 5 ) = col;
+
+    for( j = 0; j < n; ++j ) A( 3,j ) = 1.0 + j;
+    for( i = 0; i < m; ++i ) A( i,5 ) = -1.0 - i;
+
+    printf("row and column views %.1e \n", maxDifference( A,toMatrix( TA ) ) );
+
+
+    // ARRAY (COLUMN-WISE) ROUND TRIP AND SWAP:
+    // ----------------------------------------
+    double *data = TA.array();
+
+    double eArray = 0.0;
+    for( i = 0; i < m; ++i )
+        for( j = 0; j < n; ++j )
+            if( fabs( data[j*m+i] - A( i,j ) ) > eArray ) eArray = fabs( data[j*m+i] - A( i,j ) );
+
+    Tmatrix<double> TE( m,n );
+    TE.array( data );
+
+    Tmatrix<double> TF;
+    TF.swap( TE );
+
+    printf("array %.1e  round trip and swap %.1e \n", eArray, maxDifference( A,toMatrix( TF ) ) );
+
+    delete[] data;
+
+    return 0;
+}
+/* <<< end tutorial code <<< */
@@ -99,6 +99,10 @@ class BandedCP{
     // BANDED CP IN BLOCK-MATRIX FORMAT:
     // -----------------------------------------------------------------------------------
 
+    // The Hessian is kept as a dense BlockMatrix, as the condensing and the QP
+    // solvers access its blocks as dense matrices. Symmetric contributions are
+    // accumulated in packed storage (see SymmetricMatrix) before they are
+    // written into the blocks.
     BlockMatrix                   hessian;    /**< the Hessian matrix                  */
     BlockMatrix         objectiveGradient;    /**< the gradient of the objective       */
 
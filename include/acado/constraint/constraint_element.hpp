@@ -231,6 +231,32 @@ class ConstraintElement{
 		virtual returnValue initializeEvaluationPoints(	const OCPiterate& iter
 														);
 
+        /** Computes the first order derivatives of the rows firstRow,..., \n
+         *  firstRow+nc-1 of the given function and the (negative) Hessian \n
+         *  of bseed^T function w.r.t. the ny variables listed in index,    \n
+         *  based on the evaluation stored at the buffer position number.  \n
+         *  The Hessian is obtained by compressed forward-over-backward    \n
+         *  differentiation (see Function::AD_hessian), the first order    \n
+         *  derivatives in forward or backward mode, whichever needs less  \n
+         *  directions.                                                     \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         */
+        returnValue computeSecondOrderDerivatives( Function &function,
+                                                   int       number,
+                                                   const int *index,
+                                                   double   *bseed,
+                                                   int       firstRow,
+                                                   int       nc,
+                                                   Matrix   &D,
+                                                   Matrix   &H );
+
+        /** Stores the first order derivatives D in the block row dRow of \n
+         *  dBackward and adds the Hessian H to the blocks of the grid     \n
+         *  point pos (among N points) of the hessian.                     \n
+         */
+        void setSecondOrderBlocks( const Matrix &D, const Matrix &H,
+                                   int dRow, int pos, int N, BlockMatrix &hessian );
+
 
 
     //
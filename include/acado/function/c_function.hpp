@@ -36,6 +36,7 @@
 
 
 #include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/sparsity_pattern.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -259,6 +260,87 @@ class CFunction{
 
 
 
+    /** Specify a C function which evaluates several points per   \n
+     *  call (see cFcnBatchPtr for the storage of the points). It  \n
+     *  is used by evaluateBatch and for the finite differences of \n
+     *  the Jacobian.                                              \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue setBatchFunction( cFcnBatchPtr cFcnBatch_ /**< the batched function */ );
+
+
+    /** Evaluates the function at nPoints points at once; the     \n
+     *  i-th input of the p-th point is x[i*nPoints+p], the j-th   \n
+     *  result result[j*nPoints+p]. Without a batched C function   \n
+     *  the points are evaluated one after the other.              \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     virtual returnValue evaluateBatch( int     nPoints /**< number of points */,
+                                        double *x       /**< the points       */,
+                                        double *result  /**< the results      */ );
+
+
+    /** Evaluates the function at nPoints points at once (see      \n
+     *  above) and stores the points at the storage positions      \n
+     *  number,...,number+nPoints-1 for automatic differentiation   \n
+     *  (as evaluate( number, x, result ) does for one point).      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue evaluateBatch( int     number  /**< first storage position */,
+                                int     nPoints /**< number of points       */,
+                                double *x       /**< the points             */,
+                                double *result  /**< the results            */ );
+
+
+    /** Declares the structural sparsity pattern of the Jacobian  \n
+     *  (getDim() rows, one column per input). As long as no       \n
+     *  derivatives are given by C functions, the Jacobian is then \n
+     *  computed by finite differences in compressed form: the     \n
+     *  columns are coloured such that columns of the same colour  \n
+     *  do not share a row, and all inputs of one colour are       \n
+     *  perturbed at once, which needs colours+1 evaluations (one  \n
+     *  batched call). The Jacobian is kept for the last point of  \n
+     *  each storage position, so that further directions at this \n
+     *  point need no evaluation.                                  \n
+     *  The pattern has to be set before the function is applied   \n
+     *  to an Expression.                                          \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                     \n
+     */
+     returnValue setSparsityPattern( const SparsityPattern &pattern /**< the pattern */ );
+
+
+    /** Determines the sparsity pattern of the Jacobian by        \n
+     *  perturbing every input separately at the point x and at    \n
+     *  two random points near x (3*(nInputs+1) evaluations in one \n
+     *  batched call) and declares the union of the detected       \n
+     *  patterns (see setSparsityPattern). Entries which vanish at \n
+     *  all of these points are still missed; if in doubt, the     \n
+     *  pattern should be declared by setSparsityPattern.          \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue detectSparsityPattern( uint    nInputs /**< number of inputs */,
+                                        double *x       /**< the probe point  */ );
+
+
+    /** Returns the declared sparsity pattern of the Jacobian     \n
+     *  (empty if none).                                           \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     */
+     returnValue getSparsityPattern( SparsityPattern &pattern ) const;
+
+
+    /** Computes the non-zeros of the Jacobian at x in the order  \n
+     *  of the declared sparsity pattern by coloured finite        \n
+     *  differences.                                               \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_MEMBER_NOT_INITIALISED                        \n
+     */
+     returnValue jacobian( double *x /**< the point             */,
+                           double *J /**< the non-zeros of the Jacobian */ );
+
+
+
 //
 //  PROTECTED FUNCTIONS:
 //
@@ -275,6 +357,39 @@ protected:
      void deleteAll();
 
 
+     /** Evaluates nPoints points of nInputs inputs each. */
+     void evaluatePoints( uint nInputs, int nPoints, double *x, double *result );
+
+
+     /** Stores the point x at the given storage position. */
+     void storePoint( int number, const double *x );
+
+
+     /** Returns BT_TRUE if the Jacobian is computed by coloured \n
+      *  finite differences.                                      \n
+      */
+     BooleanType hasCompressedJacobian() const;
+
+
+     /** Makes sure that the Jacobian (and the value) kept for the \n
+      *  storage position number belong to the point x. Each        \n
+      *  position has its own Jacobian, such that AD at alternating \n
+      *  positions (e.g. the stages of an integrator) does not      \n
+      *  recompute it.                                              \n
+      */
+     void updateJacobian( int number, double *x );
+
+
+     /** Computes f and df = J*seed from the Jacobian kept for the  \n
+      *  storage position number (see updateJacobian).             \n
+      */
+     void forwardJacobian( int number, double *x, double *seed, double *f, double *df );
+
+
+     /** Releases the Jacobians of all storage positions. */
+     void clearJacobian();
+
+
 
 //
 //  PROTECTED MEMBERS:
@@ -288,6 +403,7 @@ protected:
         cFcnPtr   cFcn         ;
         cFcnDPtr  cFcnDForward ;
         cFcnDPtr  cFcnDBackward;
+        cFcnBatchPtr cFcnBatch ;
 
   
 	void* user_data        ;    /**< pointer specified by the setUserData function, passed to the c function when being called */
@@ -299,6 +415,15 @@ protected:
         uint     maxAlloc      ;    /**< actual memory allocation         */
         double **xStore        ;    /**< storage of evaluation variables  */
         double **seedStore     ;    /**< storage of evaluation seeds      */
+
+        SparsityPattern jacobianPattern;  /**< declared pattern of the Jacobian  */
+        int     *jacobianColor ;    /**< colours of the columns           */
+        int      nJacobianColors;   /**< number of colours                */
+        uint     nJacobians    ;    /**< number of stored Jacobians       */
+        double **jacobianX     ;    /**< points of the stored Jacobians   */
+        double **jacobianF     ;    /**< values at these points           */
+        double **jacobianValues;    /**< non-zeros of the Jacobians       */
+        BooleanType *jacobianValid; /**< whether the above are up to date */
 };
 
 
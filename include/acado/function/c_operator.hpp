@@ -89,6 +89,34 @@ public:
                                   double *result    /**< the result           */  );
 
 
+    /** Evaluates the C function at nPoints points at once (one    \n
+     *  batched call, see CFunction::setBatchFunction). The point p \n
+     *  is stored at x[p*nv] and at the storage position number+p;  \n
+     *  the subsequent calls of evaluate( number+p, ... ) use the   \n
+     *  batched results. Nothing is done if this component is not   \n
+     *  the one which evaluates the C function.                     \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     */
+    returnValue evaluateBatch( int     number  /**< first storage position */,
+                               int     nPoints /**< number of points       */,
+                               int     nv      /**< distance of the points */,
+                               double *x       /**< the points             */ );
+
+
+    /** Returns BT_TRUE if this component evaluates the C function \n
+     *  (the other components read its results from x).            \n
+     */
+    BooleanType isFirstComponent() const;
+
+
+    /** Returns the ID shared by all components of the C function. */
+    int getTypeID() const;
+
+
+    /** Returns the argument of the C function. */
+    const Expression& getArgument() const;
+
+
     /** Evaluates the expression (templated version) */
     virtual returnValue evaluate( EvaluationBase *x );
 	
@@ -408,6 +436,14 @@ public:
     virtual BooleanType isSymbolic() const;
 
 
+
+     /** Imports the expression into the given operator table \n
+      *  (see OperatorTable).                                 \n
+      *  \return a new reference on the imported node.        \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
 //
 //  PROTECTED FUNCTIONS:
 //
@@ -424,6 +460,12 @@ protected:
      void deleteAll();
 
 
+     /** Enlarges the buffer such that it has the storage \n
+      *  position number.                                  \n
+      */
+     void allocateBuffer( int number );
+
+
 
 //
 //  PROTECTED MEMBERS:
@@ -445,6 +487,9 @@ protected:
 
     BooleanType      first;   /**< Whether this compontent is evaluated first */
 
+    int         batchBegin;   /**< First storage position evaluated by evaluateBatch */
+    int           batchEnd;   /**< End of the storage positions of evaluateBatch     */
+
     int               *idx;   /**< variable index list                        */
     int       globalTypeID;   /**< global ID of the C-Operator              */
     static int     counter;   /**< counter of the C-Operators               */
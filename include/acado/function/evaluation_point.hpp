@@ -145,6 +145,18 @@ public:
     inline Vector getDX() const;
 
 
+    /** Copies the first dim entries of the point into the column \n
+     *  idx of nPoints points stored in structure-of-arrays        \n
+     *  layout (see Function::evaluateBatch).                      \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *          RET_INDEX_OUT_OF_BOUNDS                           \n
+     */
+    inline returnValue copyToBatch( double     *x       /**< the batch        */,
+                                    const uint &dim     /**< number of rows   */,
+                                    const uint &nPoints /**< number of points */,
+                                    const uint &point   /**< the column       */ ) const;
+
+
 	    /** Prints the data of this object.              \n
      *  Due to the efficient implementation of       \n
      *  this class not everything might be stored.   \n
@@ -105,6 +105,21 @@ inline Vector EvaluationPoint::getDX() const{ return backCopy( idx[6], nd ); }
 
 inline double* EvaluationPoint::getEvaluationPointer() const{ return z; }
 
+
+inline returnValue EvaluationPoint::copyToBatch( double *x, const uint &dim,
+                                                 const uint &nPoints, const uint &point ) const{
+
+    uint i;
+
+    if( dim > N || point >= nPoints )
+        return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    for( i = 0; i < dim; i++ )
+        x[i*nPoints+point] = z[i];
+
+    return SUCCESSFUL_RETURN;
+}
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
@@ -0,0 +1,189 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/evaluation_profile.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_EVALUATION_PROFILE_HPP
+#define ACADO_TOOLKIT_EVALUATION_PROFILE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+class Operator;
+
+
+/**
+ *	\brief Collects evaluation counts and timings of the nodes of a symbolic function.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class EvaluationProfile stores, for every operator node of a
+ *  FunctionEvaluationTree with profiling switched on, how often the node
+ *  is evaluated and how many processor cycles the evaluation of the
+ *  subtree below the node takes, as well as the cost of every
+ *  intermediate state. The report lists the most expensive subtrees
+ *  together with the number of references to them, which exposes
+ *  shared subexpressions that are evaluated several times.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class EvaluationProfile{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    EvaluationProfile( );
+
+    /** Copy constructor (deep copy). */
+    EvaluationProfile( const EvaluationProfile& arg );
+
+    /** Destructor. */
+    ~EvaluationProfile( );
+
+    /** Assignment operator (deep copy). */
+    EvaluationProfile& operator=( const EvaluationProfile& arg );
+
+
+    /** Removes all nodes, states and measurements. \n
+     *  \return SUCCESSFUL_RETURN                    \n
+     */
+    returnValue clear();
+
+
+    /** Adds a node which is evaluated nEvaluations times per     \n
+     *  evaluation of the function and referenced nReferences     \n
+     *  times (by other nodes or as a component); the evaluation  \n
+     *  of its subtree takes nOperations operator evaluations.    \n
+     *  \return the index of the node                              \n
+     */
+    int addNode( Operator *node, int nEvaluations, int nReferences, double nOperations );
+
+    /** Sets the number of operator evaluations of one evaluation \n
+     *  of the function.                                           \n
+     */
+    inline void setNumberOfOperations( double nOperations_ );
+
+    /** Adds the intermediate state with the given expression.   \n
+     *  \return the index of the state                             \n
+     */
+    int addState( Operator *expression );
+
+
+    /** Records one evaluation of the function. */
+    inline void recordEvaluation( );
+
+    /** Records the cycles of one evaluation of the subtree below \n
+     *  the node with the given index.                             \n
+     */
+    inline void recordNode( int idx, unsigned long long cycles );
+
+    /** Returns the index of the first node to be timed after the  \n
+     *  next evaluation and moves on to the following ones, as      \n
+     *  long as their subtrees take (together) no more operator     \n
+     *  evaluations than the function. nSelected returns their      \n
+     *  number; the nodes idx, idx+1, ... (modulo the number of     \n
+     *  nodes) are to be timed.                                     \n
+     */
+    int selectNodes( int &nSelected );
+
+    /** Records the cycles of one evaluation of a state. */
+    inline void recordState( int idx, unsigned long long cycles );
+
+
+    /** Returns the number of nodes. */
+    inline int getNumberOfNodes( ) const;
+
+    /** Returns the node with the given index. */
+    inline Operator* getNode( int idx ) const;
+
+    /** Returns the number of intermediate states. */
+    inline int getNumberOfStates( ) const;
+
+
+    /** Prints the nTop most expensive subtrees (the cycles of a   \n
+     *  subtree are weighted with its number of evaluations) and   \n
+     *  the cost of all intermediate states.                       \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    returnValue print( int nTop ) const;
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    void copy( const EvaluationProfile& arg );
+
+
+//
+// PROTECTED MEMBERS:
+//
+protected:
+
+    int                  nNodes        ;  /**< Number of profiled nodes.                 */
+    Operator           **node          ;  /**< The nodes (not owned).                    */
+    int                 *nodeEvaluations; /**< Evaluations per function evaluation.      */
+    int                 *nodeReferences;  /**< References to the node.                   */
+    unsigned long long  *nodeCycles    ;  /**< Accumulated cycles of one subtree evaluation. */
+    int                 *nodeSamples   ;  /**< Number of timed subtree evaluations.      */
+    double              *nodeOperations;  /**< Operator evaluations of the subtree.      */
+    int                  nextNode      ;  /**< The node to be timed next.                */
+    double               nOperations   ;  /**< Operator evaluations of the function.     */
+
+    int                  nStates       ;  /**< Number of intermediate states.            */
+    Operator           **state         ;  /**< Their expressions (not owned).            */
+    unsigned long long  *stateCycles   ;  /**< Accumulated cycles of the states.         */
+
+    int                  nEvaluations  ;  /**< Number of profiled function evaluations.  */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/function/evaluation_profile.ipp>
+
+
+#endif  // ACADO_TOOLKIT_EVALUATION_PROFILE_HPP
+
+/*
+ *   end of file
+ */
@@ -0,0 +1,731 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/evaluation_tape.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+#ifndef ACADO_TOOLKIT_EVALUATION_TAPE_HPP
+#define ACADO_TOOLKIT_EVALUATION_TAPE_HPP
+
+
+#include <acado/symbolic_expression/symbolic_expression.hpp>
+#include <acado/function/evaluation_workspace.hpp>
+#include <acado/function/native_tape.hpp>
+#include <acado/function/sparsity_pattern.hpp>
+
+#include <map>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Linear instruction tape for the fast evaluation of symbolic functions.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class EvaluationTape stores a compiled version of a symbolic
+ *  function: the operator trees of the intermediate states and of the
+ *  function components are lowered into a topologically ordered list
+ *  of instructions, which work on a flat register file. The first
+ *  registers coincide with the variable vector x of the function, they
+ *  are followed by the constants and the intermediate results.
+ *
+ *  Evaluation and automatic differentiation in forward and backward
+ *  mode are carried out by a single loop over the instructions. All
+ *  temporaries live in an EvaluationWorkspace: the routines taking a
+ *  work space do not modify the tape and may therefore be called
+ *  concurrently with distinct work spaces. As for the operator trees,
+ *  the routines taking a storage position "number" use a work space
+ *  which is buffered by the tape for every position.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class EvaluationTape : public EvaluationBase{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    EvaluationTape( );
+
+    /** Copy constructor (deep copy). */
+    EvaluationTape( const EvaluationTape& arg );
+
+    /** Destructor. */
+    virtual ~EvaluationTape( );
+
+    /** Assignment operator (deep copy). */
+    EvaluationTape& operator=( const EvaluationTape& arg );
+
+
+    /** Compiles the given operator trees. The i-th intermediate     \n
+     *  expression sub[i] is stored at position lhs[i] of the        \n
+     *  variable vector; all operators have to be symbolic.          \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS             \n
+     */
+    returnValue init( int        nVariables /**< number of variables           */,
+                      int        n          /**< number of intermediate states */,
+                      Operator **sub        /**< intermediate expressions      */,
+                      int       *lhs        /**< their positions in x          */,
+                      int        dim        /**< number of components          */,
+                      Operator **f          /**< the components                */ );
+
+
+    /** Sizes the given work space for the evaluation of the tape. \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     */
+    returnValue initWorkspace( EvaluationWorkspace &ws ) const;
+
+
+    /** Evaluates the tape and stores the intermediate results   \n
+     *  in the work space (needed for AD in backward mode).      \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                     \n
+     */
+    returnValue evaluate( EvaluationWorkspace &ws     /**< the work space       */,
+                          double              *x      /**< the input variable x */,
+                          double              *result /**< the result           */ ) const;
+
+
+    /** Automatic differentiation in forward mode, evaluating the \n
+     *  tape at the same time.                                     \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                      \n
+     */
+    returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space   */,
+                            double              *x    /**< the point x      */,
+                            double              *seed /**< the seed         */,
+                            double              *f    /**< the value at x   */,
+                            double              *df   /**< the derivative   */ ) const;
+
+
+    /** Automatic differentiation in forward mode based on the    \n
+     *  intermediate results in the work space.                    \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                      \n
+     */
+    returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space   */,
+                            double              *seed /**< the seed         */,
+                            double              *df   /**< the derivative   */ ) const;
+
+
+    /** Automatic differentiation in backward mode based on the   \n
+     *  intermediate results in the work space. The derivative is  \n
+     *  added to df.                                               \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                      \n
+     */
+    returnValue AD_backward( EvaluationWorkspace &ws   /**< the work space   */,
+                             double              *seed /**< the seed         */,
+                             double              *df   /**< the derivative   */ ) const;
+
+
+    /** Automatic differentiation in forward mode in nDir directions \n
+     *  at once, based on the intermediate results in the work space.\n
+     *  The k-th seed is stored at seed[k*ld], the k-th derivative   \n
+     *  at df[k*dim] (column-major blocks).                           \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                         \n
+     */
+    returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space            */,
+                            int                  nDir /**< number of directions      */,
+                            int                  ld   /**< leading dimension of seed */,
+                            double              *seed /**< the seeds                 */,
+                            double              *df   /**< the derivatives           */ ) const;
+
+
+    /** Automatic differentiation in backward mode in nDir directions\n
+     *  at once, based on the intermediate results in the work space.\n
+     *  The k-th seed is stored at seed[k*dim], the k-th derivative  \n
+     *  at df[k*ld]; the derivatives are added to df.                 \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                         \n
+     */
+    returnValue AD_backward( EvaluationWorkspace &ws   /**< the work space          */,
+                             int                  nDir /**< number of directions    */,
+                             int                  ld   /**< leading dimension of df */,
+                             double              *seed /**< the seeds               */,
+                             double              *df   /**< the derivatives         */ ) const;
+
+
+    /** Automatic differentiation in forward mode for 2nd order   \n
+     *  derivatives based on the intermediate results and on the   \n
+     *  last forward derivative in the work space.                 \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                      \n
+     */
+    returnValue AD_forward2( EvaluationWorkspace &ws    /**< the work space          */,
+                             double              *seed  /**< the seed                */,
+                             double              *dseed /**< the seed for the first
+                                                              derivative             */,
+                             double              *df    /**< the derivative          */,
+                             double              *ddf   /**< the 2nd derivative      */ ) const;
+
+
+    /** Automatic differentiation in backward mode for 2nd order  \n
+     *  derivatives based on the intermediate results and on the   \n
+     *  last forward derivative in the work space. The derivatives \n
+     *  are added to df and ddf.                                   \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                      \n
+     */
+    returnValue AD_backward2( EvaluationWorkspace &ws    /**< the work space      */,
+                              double              *seed1 /**< the seed1           */,
+                              double              *seed2 /**< the seed2           */,
+                              double              *df    /**< the 1st derivative  */,
+                              double              *ddf   /**< the 2nd derivative  */ ) const;
+
+
+    /** Evaluates the tape at nPoints points at once. The points  \n
+     *  are stored in structure-of-arrays layout, i.e. the i-th     \n
+     *  variable of the p-th point at x[i*nPoints+p] and the j-th   \n
+     *  component at result[j*nPoints+p]. The intermediate results  \n
+     *  are kept in the batch buffers of the work space.            \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                       \n
+     */
+    returnValue evaluateBatch( EvaluationWorkspace &ws      /**< the work space       */,
+                               int                  nPoints /**< number of points     */,
+                               double              *x       /**< the points           */,
+                               double              *result  /**< the results          */ ) const;
+
+
+    /** Automatic differentiation in forward mode at the nPoints  \n
+     *  points of the last batch evaluation (one seed per point,   \n
+     *  stored like x; the derivatives are stored like result).    \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                       \n
+     */
+    returnValue AD_forwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                 int                  nPoints /**< number of points */,
+                                 double              *seed    /**< the seeds        */,
+                                 double              *df      /**< the derivatives  */ ) const;
+
+
+    /** Automatic differentiation in backward mode at the nPoints \n
+     *  points of the last batch evaluation (one seed per point,   \n
+     *  stored like result; the derivatives are stored like x and  \n
+     *  added to df).                                              \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                       \n
+     */
+    returnValue AD_backwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                  int                  nPoints /**< number of points */,
+                                  double              *seed    /**< the seeds        */,
+                                  double              *df      /**< the derivatives  */ ) const;
+
+
+    /** Evaluates the tape at nPoints points in single precision   \n
+     *  (layout as for double precision). As twice as many floats   \n
+     *  fit into a vector register, the loops over the points run   \n
+     *  at twice the width; the accuracy is that of float.          \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                       \n
+     */
+    returnValue evaluateBatch( EvaluationWorkspace &ws      /**< the work space       */,
+                               int                  nPoints /**< number of points     */,
+                               float               *x       /**< the points           */,
+                               float               *result  /**< the results          */ ) const;
+
+
+    /** Automatic differentiation in forward mode in single        \n
+     *  precision at the nPoints points of the last single         \n
+     *  precision batch evaluation.                                 \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_VECTOR_DIMENSION_MISMATCH                       \n
+     */
+    returnValue AD_forwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                 int                  nPoints /**< number of points */,
+                                 float               *seed    /**< the seeds        */,
+                                 float               *df      /**< the derivatives  */ ) const;
+
+
+    /** Evaluates the tape and stores the intermediate results   \n
+     *  in a buffer (needed for AD in backward mode).            \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     */
+    returnValue evaluate( int     number    /**< storage position     */,
+                          double *x         /**< the input variable x */,
+                          double *result    /**< the result           */  );
+
+
+    /** Automatic differentiation in forward mode, evaluating the \n
+     *  tape at the same time.                                     \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int     number  /**< storage position */,
+                            double *x       /**< the point x      */,
+                            double *seed    /**< the seed         */,
+                            double *f       /**< the value at x   */,
+                            double *df      /**< the derivative   */ );
+
+
+    /** Automatic differentiation in forward mode based on the    \n
+     *  intermediate results in the buffer.                        \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward( int     number  /**< storage position */,
+                            double *seed    /**< the seed         */,
+                            double *df      /**< the derivative   */ );
+
+
+    /** Automatic differentiation in backward mode based on the   \n
+     *  intermediate results in the buffer. The derivative is      \n
+     *  added to df.                                               \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_backward( int     number /**< storage position */,
+                             double *seed   /**< the seed         */,
+                             double *df     /**< the derivative   */ );
+
+
+    /** Automatic differentiation in forward mode in nDir      \n
+     *  directions based on the intermediate results in the     \n
+     *  buffer (see above for the storage of the seeds).         \n
+     *  \return SUCCESSFUL_RETURN                                \n
+     */
+    returnValue AD_forward( int     number  /**< storage position          */,
+                            int     nDir    /**< number of directions      */,
+                            int     ld      /**< leading dimension of seed */,
+                            double *seed    /**< the seeds                 */,
+                            double *df      /**< the derivatives           */ );
+
+
+    /** Automatic differentiation in backward mode in nDir     \n
+     *  directions based on the intermediate results in the     \n
+     *  buffer (see above for the storage of the seeds).         \n
+     *  \return SUCCESSFUL_RETURN                                \n
+     */
+    returnValue AD_backward( int     number /**< storage position        */,
+                             int     nDir   /**< number of directions    */,
+                             int     ld     /**< leading dimension of df */,
+                             double *seed   /**< the seeds               */,
+                             double *df     /**< the derivatives         */ );
+
+
+    /** Automatic differentiation in forward mode for 2nd order   \n
+     *  derivatives based on the buffer.                           \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_forward2( int     number /**< storage position              */,
+                             double *seed   /**< the seed                      */,
+                             double *dseed  /**< the seed for the first
+                                                 derivative                    */,
+                             double *df     /**< the derivative                */,
+                             double *ddf    /**< the 2nd derivative            */ );
+
+
+    /** Automatic differentiation in backward mode for 2nd order  \n
+     *  derivatives based on the buffer. The derivatives are added \n
+     *  to df and ddf.                                             \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue AD_backward2( int     number /**< storage position   */,
+                              double *seed1  /**< the seed1          */,
+                              double *seed2  /**< the seed2          */,
+                              double *df     /**< the 1st derivative */,
+                              double *ddf    /**< the 2nd derivative */ );
+
+
+    /** Evaluates the tape at nPoints points (see above) and       \n
+     *  stores the intermediate results of the p-th point at the    \n
+     *  storage position number+p.                                   \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     */
+    returnValue evaluateBatch( int     number  /**< first storage position */,
+                               int     nPoints /**< number of points       */,
+                               double *x       /**< the points             */,
+                               double *result  /**< the results            */ );
+
+
+    /** Automatic differentiation in forward mode based on the     \n
+     *  storage positions number,...,number+nPoints-1.              \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     */
+    returnValue AD_forwardBatch( int     number  /**< first storage position */,
+                                 int     nPoints /**< number of points       */,
+                                 double *seed    /**< the seeds              */,
+                                 double *df      /**< the derivatives        */ );
+
+
+    /** Automatic differentiation in backward mode based on the    \n
+     *  storage positions number,...,number+nPoints-1.              \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     */
+    returnValue AD_backwardBatch( int     number  /**< first storage position */,
+                                  int     nPoints /**< number of points       */,
+                                  double *seed    /**< the seeds              */,
+                                  double *df      /**< the derivatives        */ );
+
+
+    /** Evaluates the tape at nPoints points in single precision   \n
+     *  (see above). The intermediate results are not buffered     \n
+     *  per storage position; they are only kept for the next      \n
+     *  call of AD_forwardBatch in single precision.                \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    returnValue evaluateBatch( int    nPoints /**< number of points */,
+                               float *x       /**< the points       */,
+                               float *result  /**< the results      */ );
+
+
+    /** Automatic differentiation in forward mode in single        \n
+     *  precision based on the last single precision evaluation.    \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    returnValue AD_forwardBatch( int    nPoints /**< number of points */,
+                                 float *seed    /**< the seeds        */,
+                                 float *df      /**< the derivatives  */ );
+
+
+    /** Evaluates the given components only (result[k] is the      \n
+     *  component comp[k]). The instructions which do not contribute \n
+     *  to them are skipped; the reduced tape is kept until other    \n
+     *  components are selected.                                     \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *          RET_INDEX_OUT_OF_BOUNDS                              \n
+     */
+    returnValue evaluate( int        number /**< storage position          */,
+                          double    *x      /**< the input variable x      */,
+                          double    *result /**< the selected results      */,
+                          int        nComp  /**< number of components      */,
+                          const int *comp   /**< the selected components   */ );
+
+
+    /** Automatic differentiation in forward mode of the given     \n
+     *  components only (see above).                                \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_INDEX_OUT_OF_BOUNDS                             \n
+     */
+    returnValue AD_forward( int        number /**< storage position          */,
+                            double    *seed   /**< the seed                  */,
+                            double    *df     /**< the selected derivatives  */,
+                            int        nComp  /**< number of components      */,
+                            const int *comp   /**< the selected components   */ );
+
+
+    /** Automatic differentiation in backward mode of the given    \n
+     *  components only (seed[k] belongs to comp[k]); the           \n
+     *  derivative is added to df.                                  \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_INDEX_OUT_OF_BOUNDS                             \n
+     */
+    returnValue AD_backward( int        number /**< storage position          */,
+                             double    *seed   /**< the selected seeds        */,
+                             double    *df     /**< the derivative            */,
+                             int        nComp  /**< number of components      */,
+                             const int *comp   /**< the selected components   */ );
+
+
+    /** Clears the buffer and resets the buffer size. \n
+     *  \return SUCCESSFUL_RETURN                     \n
+     */
+    returnValue clearBuffer();
+
+
+    /** Determines the structural sparsity pattern of the Jacobian of \n
+     *  the components w.r.t. the first nCols entries of x by a single \n
+     *  sweep over the tape, propagating bitsets of dependencies.      \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     */
+    returnValue getSparsityPattern( SparsityPattern &pattern, int nCols ) const;
+
+    /** Determines the (symmetric) structural sparsity pattern of the  \n
+     *  Hessian of any weighted sum of the components w.r.t. the first \n
+     *  nCols entries of x: every non-linear instruction couples the    \n
+     *  dependencies of its arguments.                                   \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     */
+    returnValue getHessianSparsityPattern( SparsityPattern &pattern, int nCols ) const;
+
+
+    /** Compiles the tape into native code with the system C compiler \n
+     *  (see NativeTape), which is used for evaluation and first order \n
+     *  automatic differentiation from then on.                        \n
+     *  \return SUCCESSFUL_RETURN                                      \n
+     *          RET_UNABLE_TO_COMPILE_FUNCTION                         \n
+     *          RET_UNABLE_TO_LOAD_COMPILED_FUNCTION                   \n
+     */
+    returnValue compileNative();
+
+    /** Returns BT_TRUE if the tape runs as native code. */
+    inline BooleanType isNative() const;
+
+
+    /** Exports the sweeps of the tape as C code, which is compiled \n
+     *  by NativeTape.                                               \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     */
+    returnValue exportCode( FILE *file ) const;
+
+    /** Returns a (64 bit FNV-1a) hash of the instructions of the tape. */
+    uint64_t getHash() const;
+
+    /** Returns the instructions (four entries per instruction). */
+    inline const int* getCode() const;
+
+    /** Returns the number of constant registers. */
+    inline int getNumberOfConstants() const;
+
+    /** Returns the indices of the constant registers. */
+    inline const int* getConstantIndex() const;
+
+
+    /** Returns the number of instructions on the tape. */
+    inline int getNumberOfInstructions() const;
+
+    /** Returns the size of the register file. */
+    inline int getNumberOfRegisters() const;
+
+    /** Returns the number of entries of x used by the tape. */
+    inline int getNumberOfVariables() const;
+
+
+
+//
+// RECORDING (IMPLEMENTATION OF THE EVALUATION BASE):
+//
+public:
+
+    virtual void addition   ( Operator &arg1, Operator &arg2 );
+    virtual void subtraction( Operator &arg1, Operator &arg2 );
+    virtual void product    ( Operator &arg1, Operator &arg2 );
+    virtual void quotient   ( Operator &arg1, Operator &arg2 );
+    virtual void power      ( Operator &arg1, Operator &arg2 );
+    virtual void powerInt   ( Operator &arg1, int      &arg2 );
+    virtual void negation   ( Operator &arg );
+
+    virtual void project    ( int      &idx );
+    virtual void set        ( double   &arg );
+    virtual void Acos       ( Operator &arg );
+    virtual void Asin       ( Operator &arg );
+    virtual void Atan       ( Operator &arg );
+    virtual void Cos        ( Operator &arg );
+    virtual void Exp        ( Operator &arg );
+    virtual void Log        ( Operator &arg );
+    virtual void Sin        ( Operator &arg );
+    virtual void Tan        ( Operator &arg );
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Instructions of the tape. */
+    enum TapeOperation{
+
+        TO_ASSIGN,
+        TO_ADDITION,
+        TO_SUBTRACTION,
+        TO_PRODUCT,
+        TO_QUOTIENT,
+        TO_POWER,
+        TO_POWER_INT,
+        TO_ACOS,
+        TO_ASIN,
+        TO_ATAN,
+        TO_COS,
+        TO_EXP,
+        TO_LOG,
+        TO_SIN,
+        TO_TAN,
+        TO_NEGATION
+    };
+
+    void copy( const EvaluationTape& arg );
+    void deleteAll();
+
+    /** Reduces the tape to the given components (unless they are  \n
+     *  selected already).                                           \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *          RET_INDEX_OUT_OF_BOUNDS                              \n
+     */
+    returnValue select( int nComp, const int *comp );
+
+    /** Initializes the tape with the instructions of arg which the \n
+     *  given components depend on (the registers are kept).         \n
+     */
+    void initSelection( const EvaluationTape &arg, int nComp, const int *comp );
+
+    /** Returns the register holding the value of the given node. */
+    int record( Operator *arg );
+
+    /** Appends an instruction and returns its result register. */
+    int append( TapeOperation op, int arg1, int arg2 );
+
+    /** Appends an instruction with the given result register. */
+    void emit( TapeOperation op, int result, int arg1, int arg2 );
+
+    /** Exports the derivative of one instruction as C code. */
+    void exportDerivative( FILE *file, const int *c ) const;
+
+    /** Adds the bitset b to the rows of the bit matrix hess \n
+     *  which are marked in the bitset a.                     \n
+     */
+    static void couple( unsigned long *hess, const unsigned long *a,
+                        const unsigned long *b, int nWords );
+
+    /** Maps a register of the recording to the register file. */
+    inline int relocate( int idx ) const;
+
+    /** Allocates the buffers for the given storage position. */
+    void allocate( int number );
+
+    /** Gathers the register files of the given storage positions \n
+     *  into the batch work space.                                 \n
+     */
+    void gather( int number, int nPoints );
+
+    /** Checks whether the work space fits to the tape. */
+    inline BooleanType isCompatible( const EvaluationWorkspace &ws ) const;
+
+    /** Runs the instructions (and their derivatives if d != 0). */
+    void forward( double *w, double *d ) const;
+
+    /** Runs the derivatives of the instructions only. */
+    void forwardDerivative( const double *w, double *d ) const;
+
+    /** Runs the instructions backwards. */
+    void backward( const double *w, double *a ) const;
+
+    /** Runs the derivatives of the instructions in nDir directions. */
+    returnValue forwardBlock( const double *w, double *d, int nDir ) const;
+
+    /** Runs the instructions backwards in nDir directions. */
+    returnValue backwardBlock( const double *w, double *a, int nDir ) const;
+
+    /** Runs the 1st and 2nd order derivatives of the instructions  \n
+     *  in the direction e (and ee), where d holds the derivatives   \n
+     *  of the last forward sweep.                                    \n
+     */
+    returnValue forward2( const double *w, const double *d, double *e, double *ee ) const;
+
+    /** Runs the 1st and 2nd order adjoints a (and aa) backwards,    \n
+     *  where d holds the derivatives of the last forward sweep.      \n
+     */
+    returnValue backward2( const double *w, const double *d, double *a, double *aa ) const;
+
+    /** Loads nPoints points into the register files w, runs the  \n
+     *  instructions and stores the states and the results.        \n
+     */
+    template <typename T> void sweepBatch( T *w, int nPoints, T *x, T *result ) const;
+
+    /** Loads nPoints seeds into d, runs the derivatives of the     \n
+     *  instructions and stores the derivatives.                    \n
+     */
+    template <typename T> returnValue sweepDerivativeBatch( const T *w, T *d, int nPoints,
+                                                            T *seed, T *df ) const;
+
+    /** Runs the instructions for nPoints points stored in  \n
+     *  structure-of-arrays layout.                           \n
+     */
+    template <typename T> void forwardBatch( T *w, int nPoints ) const;
+
+    /** Runs the derivatives of the instructions for nPoints points. */
+    template <typename T> returnValue forwardDerivativeBatch( const T *w, T *d, int nPoints ) const;
+
+    /** Runs the instructions backwards for nPoints points. */
+    returnValue backwardBatch( const double *w, double *a, int nPoints ) const;
+
+    /** Adds the four bytes of an integer to a 64 bit FNV-1a hash. */
+    static inline uint64_t hashWord( uint64_t hash, int word );
+
+    /** Computes the partial derivatives of an instruction and   \n
+     *  returns its number of (differentiable) arguments. The    \n
+     *  register r is read from w[r*stride]. For an unknown      \n
+     *  instruction, g1 and g2 are set to zero and 0 is returned. \n
+     */
+    template <typename T> inline int partials( const int *c, const T *w, int stride,
+                                               T &g1, T &g2 ) const;
+
+    /** Computes the second partial derivatives of an instruction  \n
+     *  with respect to its arguments (h12 and h22 are only set for \n
+     *  binary instructions).                                        \n
+     */
+    inline void secondPartials( const int *c, const double *w,
+                                double &h11, double &h12, double &h22 ) const;
+
+
+
+//
+// PROTECTED MEMBERS:
+//
+protected:
+
+    int      nInstructions;   /**< Number of instructions.                      */
+    int      maxInstructions; /**< Number of allocated instructions.            */
+    int     *code         ;   /**< Instructions (operation,result,arg1,arg2).   */
+
+    int      nRegisters   ;   /**< Size of the register file.                   */
+    int      nSlots       ;   /**< Number of registers shared with x.           */
+
+    int      nConstants   ;   /**< Number of constant registers.                */
+    int     *constantIndex;   /**< The constant registers.                      */
+    double  *constant     ;   /**< Values of the constant registers.            */
+
+    int      dim          ;   /**< Number of components.                        */
+    int     *output       ;   /**< Registers holding the components.            */
+
+    int      nStates      ;   /**< Number of intermediate states.               */
+    int     *state        ;   /**< Registers of the intermediate states.        */
+
+    int      bufferSize   ;   /**< Number of buffered storage positions.        */
+    EvaluationWorkspace **buffer; /**< Work spaces of the storage positions.    */
+    EvaluationWorkspace   batch ; /**< Work space for batches of positions.     */
+
+    NativeTape *native    ;   /**< Native code of the tape (if compiled).       */
+
+    EvaluationTape *selected; /**< The tape reduced to the selected components. */
+    int     *selection    ;   /**< The selected components.                     */
+    int      nSelected    ;   /**< Their number (-1 if none).                   */
+
+    int      current      ;   /**< Register of the node recorded last.          */
+    std::map< Operator*, int >  registers;   /**< Recorded nodes (only used by init). */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/function/evaluation_tape.ipp>
+
+
+#endif  // ACADO_TOOLKIT_EVALUATION_TAPE_HPP
+
+/*
+ *   end of file
+ */
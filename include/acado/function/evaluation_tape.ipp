@@ -0,0 +1,187 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+/**
+*    \file include/acado/function/evaluation_tape.ipp
+*    \author Boris Houska, Hans Joachim Ferreau
+*    \date 2026
+*/
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+inline int EvaluationTape::getNumberOfInstructions() const{
+
+    return nInstructions;
+}
+
+inline int EvaluationTape::getNumberOfRegisters() const{
+
+    return nRegisters;
+}
+
+inline int EvaluationTape::getNumberOfVariables() const{
+
+    return nSlots;
+}
+
+
+inline BooleanType EvaluationTape::isNative() const{
+
+    if( native != 0 ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+inline BooleanType EvaluationTape::isCompatible( const EvaluationWorkspace &ws ) const{
+
+    if( ws.nRegisters == nRegisters ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+inline const int* EvaluationTape::getCode() const{
+
+    return code;
+}
+
+
+inline int EvaluationTape::getNumberOfConstants() const{
+
+    return nConstants;
+}
+
+
+inline const int* EvaluationTape::getConstantIndex() const{
+
+    return constantIndex;
+}
+
+
+inline uint64_t EvaluationTape::hashWord( uint64_t hash, int word ){
+
+    int run1;
+    unsigned int w = (unsigned int)word;
+
+    for( run1 = 0; run1 < 4; run1++ ){
+        hash = NativeTape::hashByte( hash, (unsigned char)(w & 0xffu) );
+        w >>= 8;
+    }
+    return hash;
+}
+
+
+template <typename T>
+inline int EvaluationTape::partials( const int *c, const T *w, int stride,
+                                     T &g1, T &g2 ) const{
+
+    // register r is stored at w[r*stride]:
+    const T a   = w[c[2]*stride];
+    const T r   = w[c[1]*stride];
+    const T one = (T)1;
+
+    switch( c[0] ){
+
+        case TO_ASSIGN     : g1 = one;                                       return 1;
+        case TO_ADDITION   : g1 = one; g2 =  one;                            return 2;
+        case TO_SUBTRACTION: g1 = one; g2 = -one;                            return 2;
+        case TO_POWER_INT  : g1 = (T)c[3]*(T)pow( a, c[3]-1 );               return 1;
+        case TO_ACOS       : g1 = -one/sqrt(one-a*a);                        return 1;
+        case TO_ASIN       : g1 =  one/sqrt(one-a*a);                        return 1;
+        case TO_ATAN       : g1 =  one/(one+a*a);                            return 1;
+        case TO_COS        : g1 = -sin( a );                                 return 1;
+        case TO_EXP        : g1 =  r;                                        return 1;
+        case TO_LOG        : g1 =  one/a;                                    return 1;
+        case TO_SIN        : g1 =  cos( a );                                 return 1;
+        case TO_TAN        : g1 =  one+r*r;                                  return 1;
+        case TO_NEGATION   : g1 = -one;                                      return 1;
+    }
+
+    // binary operations (c[3] is a register):
+    const T b = w[c[3]*stride];
+
+    switch( c[0] ){
+
+        case TO_PRODUCT    : g1 = b; g2 = a;                                 return 2;
+        case TO_QUOTIENT   : g1 = one/b; g2 = -a/(b*b);                      return 2;
+        case TO_POWER      : g1 = b*pow( a, b-one ); g2 = r*log( a );        return 2;
+    }
+
+    // unknown instruction (the callers treat this as an error):
+    g1 = (T)0;
+    g2 = (T)0;
+    return 0;
+}
+
+
+inline void EvaluationTape::secondPartials( const int *c, const double *w,
+                                            double &h11, double &h12, double &h22 ) const{
+
+    const double a = w[c[2]];
+    const double r = w[c[1]];
+
+    h11 = 0.0;
+    h12 = 0.0;
+    h22 = 0.0;
+
+    switch( c[0] ){
+
+        case TO_POWER_INT  : h11 = c[3]*(c[3]-1.0)*pow( a, c[3]-2 );              return;
+        case TO_ACOS       : h11 = -a/pow( 1.0-a*a, 1.5 );                         return;
+        case TO_ASIN       : h11 =  a/pow( 1.0-a*a, 1.5 );                         return;
+        case TO_ATAN       : h11 = -2.0*a/((1.0+a*a)*(1.0+a*a));                   return;
+        case TO_COS        : h11 = -cos( a );                                      return;
+        case TO_EXP        : h11 =  r;                                             return;
+        case TO_LOG        : h11 = -1.0/(a*a);                                     return;
+        case TO_SIN        : h11 = -sin( a );                                      return;
+        case TO_TAN        : h11 =  2.0*r*(1.0+r*r);                               return;
+    }
+
+    // binary operations (c[3] is a register):
+    const double b = w[c[3]];
+
+    switch( c[0] ){
+
+        case TO_PRODUCT    : h12 = 1.0;                                            return;
+        case TO_QUOTIENT   : h12 = -1.0/(b*b); h22 = 2.0*a/(b*b*b);               return;
+        case TO_POWER      : h11 = b*(b-1.0)*pow( a, b-2.0 );
+                             h12 = pow( a, b-1.0 )*(b*log( a ) + 1.0);
+                             h22 = r*log( a )*log( a );                            return;
+    }
+}
+
+
+inline int EvaluationTape::relocate( int idx ) const{
+
+    // during the recording, the entries of x are numbered -1,-2,...
+    if( idx < 0 ) return -idx-1;
+    return idx + nSlots;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
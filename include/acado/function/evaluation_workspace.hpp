@@ -0,0 +1,173 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/evaluation_workspace.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_EVALUATION_WORKSPACE_HPP
+#define ACADO_TOOLKIT_EVALUATION_WORKSPACE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+class EvaluationTape;
+
+
+/**
+ *	\brief Caller-owned work space for the re-entrant evaluation of compiled functions.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class EvaluationWorkspace holds all temporaries which are needed
+ *  to evaluate and differentiate a compiled function (see the class
+ *  EvaluationTape), i.e. the register file with the intermediate
+ *  results as well as the buffers for the derivatives in forward and
+ *  backward mode.
+ *
+ *  A work space is sized once by Function::initWorkspace(); only the
+ *  buffers for the vector mode and for batched evaluations grow with
+ *  the number of directions or points that are requested from them.
+ *  Afterwards,
+ *  the function is only read by the evaluation routines taking a work
+ *  space, such that calls with distinct work spaces can safely be
+ *  carried out in parallel (e.g. one work space per thread).
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class EvaluationWorkspace{
+
+friend class EvaluationTape;
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    EvaluationWorkspace( );
+
+    /** Copy constructor (deep copy). */
+    EvaluationWorkspace( const EvaluationWorkspace& arg );
+
+    /** Destructor. */
+    ~EvaluationWorkspace( );
+
+    /** Assignment operator (deep copy). */
+    EvaluationWorkspace& operator=( const EvaluationWorkspace& arg );
+
+
+    /** Releases the memory of the work space. \n
+     *  \return SUCCESSFUL_RETURN               \n
+     */
+    returnValue clear();
+
+
+    /** Returns the number of registers of the work space. */
+    inline int getNumberOfRegisters() const;
+
+    /** Returns BT_TRUE if the work space has not been sized yet. */
+    inline BooleanType isEmpty() const;
+
+    /** Returns BT_TRUE if the work space holds the intermediate \n
+     *  results of an evaluation (needed for AD_forward and      \n
+     *  AD_backward without a point x).                          \n
+     */
+    inline BooleanType isEvaluated() const;
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Allocates the buffers for the given number of registers. */
+    void allocate( int nRegisters_ );
+
+    /** Makes sure that the buffer of the vector mode can hold  \n
+     *  the given number of directions.                          \n
+     */
+    void allocateDirections( int nDirections_ );
+
+    /** Makes sure that the batch buffers can hold the given   \n
+     *  number of points.                                       \n
+     */
+    void allocatePoints( int nPoints_ );
+
+    /** Makes sure that the single precision batch buffers can \n
+     *  hold the given number of points.                         \n
+     */
+    void allocateSinglePoints( int nPoints_ );
+
+    void copy( const EvaluationWorkspace& arg );
+
+
+
+//
+// PROTECTED MEMBERS:
+//
+protected:
+
+    int      nRegisters;   /**< Size of the register file.                       */
+    double  *value     ;   /**< Register file (intermediate results).            */
+    double  *derivative;   /**< Derivatives of the registers (forward mode).     */
+    double  *adjoint   ;   /**< Adjoints of the registers (backward mode).       */
+    int      nDirections;  /**< Number of directions of the vector mode buffer.  */
+    double  *block     ;   /**< Derivatives in several directions, per register. */
+    int      nPoints   ;   /**< Number of points of the batch buffers.           */
+    int      nBatchPoints; /**< Number of points of the last batch evaluation.   */
+    double  *batchValue;   /**< Register files of several points, per register.  */
+    double  *batchDerivative; /**< Derivatives or adjoints of several points.    */
+    int      nSinglePoints;   /**< Number of points of the single precision buffers. */
+    int      nSingleBatchPoints; /**< Number of points of the last one evaluated.     */
+    float   *batchValueSingle;      /**< Register files of several points (float).   */
+    float   *batchDerivativeSingle; /**< Derivatives of several points (float).      */
+    int      status    ;   /**< 0: empty, 1: evaluated, 2: forward sweep done.   */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/function/evaluation_workspace.ipp>
+
+
+#endif  // ACADO_TOOLKIT_EVALUATION_WORKSPACE_HPP
+
+/*
+ *   end of file
+ */
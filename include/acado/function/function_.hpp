@@ -35,6 +35,8 @@
 
 
 #include <acado/function/function_evaluation_tree.hpp>
+#include <acado/function/evaluation_workspace.hpp>
+#include <acado/function/sparsity_pattern.hpp>
 
 
 BEGIN_NAMESPACE_ACADO
@@ -385,6 +387,144 @@ public:
 
 
 
+    /** Automatic Differentiation in forward mode in nDir          \n
+     *  directions at once, based on buffered values. The k-th     \n
+     *  seed starts at seed[k*(getNumberOfVariables()+1)], the     \n
+     *  k-th derivative at df[k*getDim()].                         \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_forward(  int     number  /**< storage position     */,
+                              int     nDir    /**< number of directions */,
+                              double *seed    /**< the seeds            */,
+                              double *df      /**< the derivatives      */ );
+
+
+    /** Automatic Differentiation in backward mode in nDir         \n
+     *  directions at once, based on buffered values. The k-th     \n
+     *  seed starts at seed[k*getDim()], the k-th derivative at    \n
+     *  df[k*(getNumberOfVariables()+1)]; derivatives are added.   \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_backward( int     number  /**< storage position     */,
+                              int     nDir    /**< number of directions */,
+                              double *seed    /**< the seeds            */,
+                              double *df      /**< the derivatives      */ );
+
+
+    /** Evaluates only the nComp components comp[0..nComp-1] of the \n
+     *  function and stores the k-th of them at _result[k]. Only the \n
+     *  intermediate states these components depend on are computed; \n
+     *  they are determined once and kept until another selection    \n
+     *  is made.                                                     \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_INDEX_OUT_OF_BOUNDS                             \n
+     */
+     returnValue evaluate( int        number  /**< storage position      */,
+                           double    *x       /**< the input variable x  */,
+                           double    *_result /**< the selected results  */,
+                           int        nComp   /**< number of components  */,
+                           const int *comp    /**< the components        */ );
+
+
+    /** Automatic Differentiation in forward mode of the selected   \n
+     *  components only, based on buffered values (cf. evaluate).    \n
+     *  The derivative of comp[k] is stored at df[k].                \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_INDEX_OUT_OF_BOUNDS                             \n
+     */
+     returnValue AD_forward(  int        number /**< storage position     */,
+                              double    *seed   /**< the seed             */,
+                              double    *df     /**< the derivatives      */,
+                              int        nComp  /**< number of components */,
+                              const int *comp   /**< the components       */ );
+
+
+    /** Automatic Differentiation in backward mode of the selected  \n
+     *  components only, based on buffered values (cf. evaluate).    \n
+     *  seed[k] is the seed of comp[k]; derivatives are added to df. \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_INDEX_OUT_OF_BOUNDS                             \n
+     */
+     returnValue AD_backward( int        number /**< storage position     */,
+                              double    *seed   /**< the seeds            */,
+                              double    *df     /**< the derivatives      */,
+                              int        nComp  /**< number of components */,
+                              const int *comp   /**< the components       */ );
+
+
+
+    /** Evaluates the function at nPoints points at once. The points \n
+     *  are stored in structure-of-arrays layout, i.e. the i-th      \n
+     *  variable of the p-th point at x[i*nPoints+p] with            \n
+     *  i < getNumberOfVariables()+1, the j-th component of the      \n
+     *  result at _result[j*nPoints+p]. The intermediate results of  \n
+     *  the p-th point are stored at the position number+p. For      \n
+     *  compiled functions, every instruction is carried out for all \n
+     *  points in one loop.                                          \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_NAN                                             \n
+     */
+     returnValue evaluateBatch( int     number   /**< first storage position */,
+                                int     nPoints  /**< number of points       */,
+                                double *x        /**< the points             */,
+                                double *_result  /**< the results            */ );
+
+
+    /** Automatic Differentiation in forward mode at nPoints points \n
+     *  based on buffered values (one seed per point, stored like   \n
+     *  x; the derivatives are stored like the result).             \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_NAN                                             \n
+     */
+     returnValue AD_forwardBatch( int     number  /**< first storage position */,
+                                  int     nPoints /**< number of points       */,
+                                  double *seed    /**< the seeds              */,
+                                  double *df      /**< the derivatives        */ );
+
+
+    /** Automatic Differentiation in backward mode at nPoints       \n
+     *  points based on buffered values (one seed per point, stored \n
+     *  like the result; the derivatives are stored like x and are  \n
+     *  added to df).                                               \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_NAN                                             \n
+     */
+     returnValue AD_backwardBatch( int     number  /**< first storage position */,
+                                   int     nPoints /**< number of points       */,
+                                   double *seed    /**< the seeds              */,
+                                   double *df      /**< the derivatives        */ );
+
+
+    /** Evaluates the function at nPoints points in single          \n
+     *  precision (storage as above). For compiled functions all     \n
+     *  instructions are carried out in float, which doubles the     \n
+     *  number of points processed per vector instruction; other     \n
+     *  functions are evaluated in double precision at the storage   \n
+     *  positions number,...,number+nPoints-1 and rounded.           \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_NAN                                             \n
+     */
+     returnValue evaluateBatch( int    number   /**< first storage position */,
+                                int    nPoints  /**< number of points       */,
+                                float *x        /**< the points             */,
+                                float *_result  /**< the results            */ );
+
+
+    /** Automatic Differentiation in forward mode at nPoints points \n
+     *  in single precision, based on the last single precision     \n
+     *  batch evaluation (storage as above).                         \n
+     *  \return SUCCESFUL_RETURN                                    \n
+     *          RET_NAN                                             \n
+     */
+     returnValue AD_forwardBatch( int    number  /**< first storage position */,
+                                  int    nPoints /**< number of points       */,
+                                  float *seed    /**< the seeds              */,
+                                  float *df      /**< the derivatives        */ );
+
+
+
     /** Automatic Differentiation in forward mode for             \n
      *  2nd derivatives.                                          \n
      *  This function uses intermediate                           \n
@@ -425,6 +565,10 @@ public:
     *
     * Calculates the matrix diff(fun(x,u,v,p,q,w),x)
     *
+    * Only the directions of a colouring of the sparsity pattern
+    * are seeded (in forward or backward mode, whichever needs
+    * less directions) and the result is decompressed.
+    *
     * \param x will be assigned jacobian(fun,differential states)
     */
     returnValue jacobian(Matrix &x);
@@ -509,10 +653,271 @@ public:
      inline BooleanType ADisSupported() const;
 
 
+     /** Compiles the function into a linear instruction tape, which  \n
+      *  is used for evaluation and first order automatic             \n
+      *  differentiation from now on (only for symbolic functions).   \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS             \n
+      */
+     returnValue compile( );
+
+
+     /** Returns whether the function has been compiled. */
+     BooleanType isCompiled( ) const;
+
+
+     /** Determines the structural sparsity pattern of the Jacobian   \n
+      *  of the function w.r.t. all variables, stored in the same      \n
+      *  order as the seeds for AD_forward, i.e. the pattern has       \n
+      *  getNumberOfVariables()+1 columns. The colourings of the       \n
+      *  pattern allow to compute sparse Jacobians with only a few     \n
+      *  directions in forward or backward mode.                       \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      */
+     returnValue getSparsityPattern( SparsityPattern &pattern );
+
+
+     /** Determines the structural sparsity pattern of the Hessian of \n
+      *  any weighted sum of the components w.r.t. all variables      \n
+      *  (ordered as for getSparsityPattern). As the Hessian is        \n
+      *  symmetric, only the lower triangle (including the diagonal)   \n
+      *  is returned.                                                  \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      */
+     returnValue getHessianSparsityPattern( SparsityPattern &pattern );
+
+
+    /** Automatic Differentiation of the Hessian of the weighted     \n
+     *  sum seed^T f in forward-over-backward mode, based on the      \n
+     *  buffered evaluation. Only one AD_forward/AD_backward2 pair   \n
+     *  is run per colour of a star colouring of the Hessian pattern  \n
+     *  (determined once per function), and the non-zeros of the     \n
+     *  lower triangle are recovered from the compressed products.   \n
+     *  H has to hold getHessianSparsityPattern().                    \n
+     *  getNumberOfNonzeros() entries; they are stored row by row    \n
+     *  with the sign convention of AD_backward2.                    \n
+     *  \return SUCCESFUL_RETURN                                     \n
+     *          RET_NAN                                              \n
+     */
+     returnValue AD_hessian( int    number  /**< the buffer position   */,
+                             double *seed   /**< the backward seed     */,
+                             double *H      /**< the lower triangle of
+                                                 the Hessian           */ );
+
+
+     /** Rewrites the polynomial parts of the function (sums,         \n
+      *  products and integer powers) in multivariate Horner form,     \n
+      *  wherever this saves operations. The Horner form is used for   \n
+      *  the evaluation, the derivatives and the exported code.        \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS              \n
+      */
+     returnValue convertToHornerForm( );
+
+
+     /** Compiles the function (if necessary) and translates its      \n
+      *  instruction tape into C code, which is compiled by the       \n
+      *  system C compiler and loaded at runtime. The shared objects  \n
+      *  are cached in the directory ACADO_JIT_DIR (default: the      \n
+      *  per-user directory /tmp/acado_jit_<uid>), keyed by a hash of \n
+      *  the tape, and only reused if they belong to the current user \n
+      *  and embed the same instruction stream; the compiler can be   \n
+      *  chosen by ACADO_JIT_CC (default: cc).                        \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS             \n
+      *          RET_UNABLE_TO_COMPILE_FUNCTION                        \n
+      *          RET_UNABLE_TO_LOAD_COMPILED_FUNCTION                  \n
+      */
+     returnValue compileNative( );
+
+
+     /** Returns whether the function runs as native code. */
+     BooleanType isNative( ) const;
+
+
+     /** Switches the profiling of the evaluation on or off. While     \n
+      *  profiling, the symbolic operators are evaluated (even if the  \n
+      *  function is compiled) and the processor cycles spent in every \n
+      *  intermediate state and every subtree are recorded. The        \n
+      *  subtrees are timed in turns, such that timing them costs      \n
+      *  about one more evaluation per profiled evaluation.            \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      */
+     returnValue setProfiling( BooleanType doProfiling );
+
+
+     /** Prints the nTop most expensive subtrees of the profiled       \n
+      *  evaluations, including how often each subtree is referenced.  \n
+      *  \return SUCCESSFUL_RETURN                                     \n
+      *          RET_MEMBER_NOT_INITIALISED (if not profiling)          \n
+      */
+     returnValue printProfile( int nTop = 10 ) const;
+
+
+     /** Writes the set-up function in a compact binary form to a   \n
+      *  file, such that it can be restored by read() without        \n
+      *  building its expressions once more (e.g. at the start of    \n
+      *  a controller process).                                      \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS            \n
+      *          RET_CAN_NOT_WRITE_INTO_FILE                          \n
+      */
+     returnValue write( FILE *file ) const;
+
+
+     /** Replaces the function by one written by write().           \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_FILE_HAS_NO_VALID_ENTRIES                        \n
+      */
+     returnValue read( FILE *file );
+
+
+     /** Sizes the given work space for the evaluation of the       \n
+      *  function, compiling the function if necessary. Afterwards,  \n
+      *  the routines taking a work space only read the function,    \n
+      *  i.e. they can be called concurrently with distinct work     \n
+      *  spaces (e.g. one per thread).                               \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS            \n
+      */
+     returnValue initWorkspace( EvaluationWorkspace &ws );
+
+
+     /** Evaluates the function using the given work space, which   \n
+      *  keeps the intermediate results for automatic               \n
+      *  differentiation.                                           \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue evaluate( EvaluationWorkspace &ws      /**< the work space       */,
+                           double              *x       /**< the input variable x */,
+                           double              *_result /**< the result           */ ) const;
+
+
+     /** Automatic Differentiation in forward mode based on the     \n
+      *  intermediate results in the given work space.              \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space   */,
+                             double              *seed /**< the seed         */,
+                             double              *df   /**< the derivative   */ ) const;
+
+
+     /** Automatic Differentiation in backward mode based on the    \n
+      *  intermediate results in the given work space.              \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_backward( EvaluationWorkspace &ws   /**< the work space   */,
+                              double              *seed /**< the seed         */,
+                              double              *df   /**< the derivative   */ ) const;
+
+
+     /** Automatic Differentiation in forward mode in nDir          \n
+      *  directions based on the intermediate results in the given  \n
+      *  work space (storage of the seeds as for the buffered call). \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space       */,
+                             int                  nDir /**< number of directions */,
+                             double              *seed /**< the seeds            */,
+                             double              *df   /**< the derivatives      */ ) const;
+
+
+     /** Automatic Differentiation in backward mode in nDir         \n
+      *  directions based on the intermediate results in the given  \n
+      *  work space (storage of the seeds as for the buffered call). \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_backward( EvaluationWorkspace &ws   /**< the work space       */,
+                              int                  nDir /**< number of directions */,
+                              double              *seed /**< the seeds            */,
+                              double              *df   /**< the derivatives      */ ) const;
+
+
+     /** Evaluates the function at nPoints points using the given   \n
+      *  work space (storage as for the buffered batch evaluation).  \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue evaluateBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                int                  nPoints /**< number of points */,
+                                double              *x       /**< the points       */,
+                                double              *_result /**< the results      */ ) const;
+
+
+     /** Forward mode AD at the points of the last batch evaluation \n
+      *  with the given work space.                                  \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                  int                  nPoints /**< number of points */,
+                                  double              *seed    /**< the seeds        */,
+                                  double              *df      /**< the derivatives  */ ) const;
+
+
+     /** Backward mode AD at the points of the last batch           \n
+      *  evaluation with the given work space.                       \n
+      *  \return SUCCESFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_backwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                   int                  nPoints /**< number of points */,
+                                   double              *seed    /**< the seeds        */,
+                                   double              *df      /**< the derivatives  */ ) const;
+
+
+     /** Evaluates the compiled function at nPoints points in single \n
+      *  precision using the given work space only.                   \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                            \n
+      */
+     returnValue evaluateBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                int                  nPoints /**< number of points */,
+                                float               *x       /**< the points       */,
+                                float               *_result /**< the results      */ ) const;
+
+
+     /** Forward mode AD in single precision at the points of the    \n
+      *  last single precision batch evaluation with the work space.  \n
+      *  \return SUCCESSFUL_RETURN                                    \n
+      *          RET_MEMBER_NOT_INITIALISED                            \n
+      */
+     returnValue AD_forwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                  int                  nPoints /**< number of points */,
+                                  float               *seed    /**< the seeds        */,
+                                  float               *df      /**< the derivatives  */ ) const;
+
+
      inline returnValue setMemoryOffset( int memoryOffset_ );
 
 
 
+// PROTECTED MEMBER FUNCTIONS:
+// ---------------------------
+
+protected:
+
+    /** Determines the Hessian pattern and its star colouring. */
+    returnValue initHessianColoring( );
+
+    /** Discards the Hessian pattern and its colouring. */
+    void clearHessianColoring( );
+
+
+
 // PROTECTED MEMBERS:
 // ------------------
 
@@ -522,6 +927,10 @@ protected:
     int                    memoryOffset  ;
 	
 	double* result;
+
+    SparsityPattern        hessianPattern;   /**< symmetric Hessian pattern     */
+    int                   *hessianColor  ;   /**< star colouring of the pattern */
+    int                    nHessianColors;   /**< number of colours (-1: none)  */
 };
 
 
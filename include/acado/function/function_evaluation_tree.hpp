@@ -43,6 +43,10 @@ BEGIN_NAMESPACE_ACADO
 
 
 class ExportVariable;
+class EvaluationTape;
+class EvaluationWorkspace;
+class EvaluationProfile;
+class SparsityPattern;
 
 
 /** 
@@ -199,11 +203,33 @@ public:
                                   double *result    /**< the result           */  );
 
 
+    /** Evaluates only the components comp[0],...,comp[nComp-1]  \n
+     *  (stored in this order in result), i.e. only the           \n
+     *  intermediate states they depend on are computed. The set  \n
+     *  of these states is determined once and kept until another \n
+     *  selection is requested. AD based on the buffer number has \n
+     *  to use the same selection afterwards.                     \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_INDEX_OUT_OF_BOUNDS                           \n
+     */
+    returnValue evaluate( int        number /**< storage position     */,
+                          double    *x      /**< the input variable x */,
+                          double    *result /**< the selected results */,
+                          int        nComp  /**< number of components */,
+                          const int *comp   /**< the components       */ );
+
+
 
     /** Returns the derivative of the expression with respect     \n
-     *  to the variable var(index).                               \n
-     *  \return The symbolic expression for the derivative.       \n
-     *
+     *  to the variable var(index). Derivatives of all nodes are  \n
+     *  cached as long as the tree exists, such that repeated     \n
+     *  calls are mainly look-ups.                                \n
+     *  \return The symbolic expression for the derivative, which \n
+     *          is owned by this tree (it must not be deleted by  \n
+     *          the caller and is valid until this tree is        \n
+     *          modified or destroyed), or NULL if the expression \n
+     *          contains operators which cannot be differentiated \n
+     *          symbolically (e.g. C functions).                  \n
      */
      FunctionEvaluationTree* differentiate( int index /**< diff. index    */ );
 
@@ -358,6 +384,125 @@ public:
                                                          the expression   */);
 
 
+    /** Automatic Differentiation in forward mode of the selected  \n
+     *  components only (see the selective evaluate), based on     \n
+     *  buffered values. df holds nComp entries.                   \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_INDEX_OUT_OF_BOUNDS                            \n
+     */
+     returnValue AD_forward( int        number /**< storage position     */,
+                             double    *seed   /**< the seed             */,
+                             double    *df     /**< the derivatives      */,
+                             int        nComp  /**< number of components */,
+                             const int *comp   /**< the components       */ );
+
+
+    /** Automatic Differentiation in backward mode of the selected \n
+     *  components only (see the selective evaluate), based on     \n
+     *  buffered values. seed holds nComp entries.                 \n
+     *  \return SUCCESFUL_RETURN                                   \n
+     *          RET_INDEX_OUT_OF_BOUNDS                            \n
+     */
+     returnValue AD_backward( int        number /**< storage position     */,
+                              double    *seed   /**< the seeds            */,
+                              double    *df     /**< the derivative       */,
+                              int        nComp  /**< number of components */,
+                              const int *comp   /**< the components       */ );
+
+
+
+    /** Automatic Differentiation in forward mode in nDir          \n
+     *  directions at once, based on buffered values. The k-th     \n
+     *  seed starts at seed[k*(getNumberOfVariables()+1)], the     \n
+     *  k-th derivative at df[k*getDim()].                         \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forward( int     number  /**< storage position     */,
+                                     int     nDir    /**< number of directions */,
+                                     double *seed    /**< the seeds            */,
+                                     double *df      /**< the derivatives      */ );
+
+
+    /** Automatic Differentiation in backward mode in nDir         \n
+     *  directions at once, based on buffered values. The k-th     \n
+     *  seed starts at seed[k*getDim()], the k-th derivative at    \n
+     *  df[k*(getNumberOfVariables()+1)].                          \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backward( int     number /**< storage position     */,
+                                      int     nDir   /**< number of directions */,
+                                      double *seed   /**< the seeds            */,
+                                      double *df     /**< the derivatives      */ );
+
+
+
+    /** Evaluates the function at nPoints points, which are stored \n
+     *  in structure-of-arrays layout: the i-th variable of the    \n
+     *  p-th point at x[i*nPoints+p], the j-th component at        \n
+     *  result[j*nPoints+p] (i < getNumberOfVariables()+1). The    \n
+     *  intermediate results of the p-th point are stored at the   \n
+     *  position number+p. Compiled expressions evaluate all      \n
+     *  points by one sweep of the tape (see compile), otherwise   \n
+     *  the points are evaluated one after the other.              \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue evaluateBatch( int     number  /**< first storage position */,
+                                        int     nPoints /**< number of points       */,
+                                        double *x       /**< the points             */,
+                                        double *result  /**< the results            */ );
+
+
+    /** Automatic Differentiation in forward mode at nPoints       \n
+     *  points based on buffered values (seeds stored like x,      \n
+     *  derivatives like result).                                  \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_forwardBatch( int     number  /**< first storage position */,
+                                          int     nPoints /**< number of points       */,
+                                          double *seed    /**< the seeds              */,
+                                          double *df      /**< the derivatives        */ );
+
+
+    /** Automatic Differentiation in backward mode at nPoints      \n
+     *  points based on buffered values (seeds stored like result, \n
+     *  derivatives like x; the derivatives are added to df).      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     virtual returnValue AD_backwardBatch( int     number  /**< first storage position */,
+                                           int     nPoints /**< number of points       */,
+                                           double *seed    /**< the seeds              */,
+                                           double *df      /**< the derivatives        */ );
+
+
+    /** Evaluates the expression at nPoints points in single      \n
+     *  precision. Compiled expressions run the tape in float;     \n
+     *  otherwise the double precision batch evaluation is used    \n
+     *  and the results are rounded.                               \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue evaluateBatch( int    number  /**< first storage position */,
+                                int    nPoints /**< number of points       */,
+                                float *x       /**< the points             */,
+                                float *result  /**< the results            */ );
+
+
+    /** Automatic Differentiation in forward mode at nPoints      \n
+     *  points in single precision (cf. evaluateBatch above).      \n
+     *  \return SUCCESFUL_RETURN                                  \n
+     *          RET_NAN                                           \n
+     */
+     returnValue AD_forwardBatch( int    number  /**< first storage position */,
+                                  int    nPoints /**< number of points       */,
+                                  float *seed    /**< the seeds              */,
+                                  float *df      /**< the derivatives        */ );
+
+
 
 
     /** Automatic Differentiation in forward mode for             \n
@@ -461,6 +606,256 @@ public:
      virtual BooleanType isSymbolic() const;
 
 
+     /** Compiles the expression into a linear instruction tape,     \n
+      *  which is used for evaluation and first order automatic     \n
+      *  differentiation from now on. The tape is kept up to date   \n
+      *  if further components are added.                           \n
+      *  \return SUCCESSFUL_RETURN                                  \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS           \n
+      */
+     returnValue compile( );
+
+
+     /** Returns whether the expression has been compiled. */
+     BooleanType isCompiled( ) const;
+
+
+     /** Rewrites the polynomial parts of the expression (including  \n
+      *  its intermediate states) in multivariate Horner form, which \n
+      *  is used by the evaluation, the automatic differentiation    \n
+      *  and the code export from now on (see                        \n
+      *  OperatorTable::convertToHornerForm). The components are     \n
+      *  imported once more and converted before their shared nodes  \n
+      *  become intermediate states, such that the polynomials are   \n
+      *  not split up at these nodes. Components added afterwards    \n
+      *  are converted as well.                                      \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS            \n
+      */
+     returnValue convertToHornerForm( );
+
+
+     /** Determines the structural sparsity pattern of the Jacobian  \n
+      *  of the expression w.r.t. all variables, i.e. the pattern     \n
+      *  has getNumberOfVariables()+1 columns. The pattern is         \n
+      *  obtained from a bitset sweep over the instruction tape; for  \n
+      *  expressions which can not be compiled (e.g. containing C     \n
+      *  functions), the dense pattern is returned.                   \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      */
+     returnValue getSparsityPattern( SparsityPattern &pattern );
+
+
+     /** Determines the symmetric structural sparsity pattern of the \n
+      *  Hessian of any weighted sum of the components w.r.t. all     \n
+      *  variables (stored like the Jacobian pattern).                \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      */
+     returnValue getHessianSparsityPattern( SparsityPattern &pattern );
+
+
+     /** Compiles the expression (if necessary) and translates the   \n
+      *  tape into native code using the system C compiler. The      \n
+      *  shared objects are cached, i.e. later runs with the same    \n
+      *  expression do not compile again.                            \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS            \n
+      *          RET_UNABLE_TO_COMPILE_FUNCTION                       \n
+      *          RET_UNABLE_TO_LOAD_COMPILED_FUNCTION                 \n
+      */
+     returnValue compileNative( );
+
+
+     /** Returns whether the expression runs as native code. */
+     BooleanType isNative( ) const;
+
+
+     /** Switches the profiling of the evaluation on or off. While   \n
+      *  profiling, the operators are evaluated (even if compiled)   \n
+      *  and the cycles spent in every intermediate state and in the \n
+      *  subtree below every node are recorded; the latter are       \n
+      *  measured by evaluating the subtrees once more on their own, \n
+      *  a share of them per evaluation (such that timing them costs \n
+      *  about one more evaluation per profiled evaluation).         \n
+      *  Switching profiling off discards the records.               \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      */
+     returnValue setProfiling( BooleanType doProfiling );
+
+
+     /** Prints the nTop most expensive subtrees (together with the  \n
+      *  number of references to them) and the cost of the           \n
+      *  intermediate states recorded since profiling was switched on.\n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED (if not profiling)        \n
+      */
+     returnValue printProfile( int nTop = 10 ) const;
+
+
+     /** Writes the set-up expression (the shared DAG including its   \n
+      *  intermediate states and memoized derivatives) in a compact  \n
+      *  binary form to a file, after a header with the version of   \n
+      *  the format, the sizes of int and double and the byte order. \n
+      *  Whether the expression has been compiled is stored, too.    \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS            \n
+      *          RET_CAN_NOT_WRITE_INTO_FILE                          \n
+      */
+     returnValue write( FILE *file ) const;
+
+
+     /** Replaces the expression by one written by write(). No       \n
+      *  Expression is built and nothing is imported, i.e. only the  \n
+      *  index list is set up again (and the tape compiled if the    \n
+      *  written expression was compiled).                           \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_FILE_HAS_NO_VALID_ENTRIES (also if the file has  \n
+      *          been written on a machine with another format)      \n
+      */
+     returnValue read( FILE *file );
+
+
+     /** Sizes the given work space for the evaluation of the      \n
+      *  compiled expression.                                       \n
+      *  \return SUCCESSFUL_RETURN                                  \n
+      *          RET_MEMBER_NOT_INITIALISED (if not compiled)        \n
+      */
+     returnValue initWorkspace( EvaluationWorkspace &ws ) const;
+
+
+     /** Evaluates the compiled expression using the given work     \n
+      *  space only, i.e. the routine is re-entrant.                 \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue evaluate( EvaluationWorkspace &ws     /**< the work space       */,
+                           double              *x      /**< the input variable x */,
+                           double              *result /**< the result           */ ) const;
+
+
+     /** Automatic differentiation in forward mode using the given  \n
+      *  work space only, evaluating the expression at the same time.\n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space   */,
+                             double              *x    /**< the point x      */,
+                             double              *seed /**< the seed         */,
+                             double              *result /**< the value at x */,
+                             double              *df   /**< the derivative   */ ) const;
+
+
+     /** Automatic differentiation in forward mode based on the     \n
+      *  intermediate results in the given work space.              \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space   */,
+                             double              *seed /**< the seed         */,
+                             double              *df   /**< the derivative   */ ) const;
+
+
+     /** Automatic differentiation in backward mode based on the    \n
+      *  intermediate results in the given work space.              \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_backward( EvaluationWorkspace &ws   /**< the work space   */,
+                              double              *seed /**< the seed         */,
+                              double              *df   /**< the derivative   */ ) const;
+
+
+     /** Automatic differentiation in forward mode in nDir          \n
+      *  directions based on the intermediate results in the given  \n
+      *  work space (storage of the seeds as for the buffered call). \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forward( EvaluationWorkspace &ws   /**< the work space       */,
+                             int                  nDir /**< number of directions */,
+                             double              *seed /**< the seeds            */,
+                             double              *df   /**< the derivatives      */ ) const;
+
+
+     /** Automatic differentiation in backward mode in nDir         \n
+      *  directions based on the intermediate results in the given  \n
+      *  work space (storage of the seeds as for the buffered call). \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_backward( EvaluationWorkspace &ws   /**< the work space       */,
+                              int                  nDir /**< number of directions */,
+                              double              *seed /**< the seeds            */,
+                              double              *df   /**< the derivatives      */ ) const;
+
+
+     /** Evaluates the compiled expression at nPoints points using  \n
+      *  the given work space only (storage as for the buffered     \n
+      *  batch evaluation).                                          \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue evaluateBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                int                  nPoints /**< number of points */,
+                                double              *x       /**< the points       */,
+                                double              *result  /**< the results      */ ) const;
+
+
+     /** Forward mode AD at the points of the last batch evaluation \n
+      *  with the given work space.                                  \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                  int                  nPoints /**< number of points */,
+                                  double              *seed    /**< the seeds        */,
+                                  double              *df      /**< the derivatives  */ ) const;
+
+
+     /** Backward mode AD at the points of the last batch           \n
+      *  evaluation with the given work space.                       \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_backwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                   int                  nPoints /**< number of points */,
+                                   double              *seed    /**< the seeds        */,
+                                   double              *df      /**< the derivatives  */ ) const;
+
+
+     /** Evaluates the compiled expression at nPoints points in      \n
+      *  single precision using the given work space only.           \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue evaluateBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                int                  nPoints /**< number of points */,
+                                float               *x       /**< the points       */,
+                                float               *result  /**< the results      */ ) const;
+
+
+     /** Forward mode AD in single precision at the points of the   \n
+      *  last single precision batch evaluation with the work space. \n
+      *  \return SUCCESSFUL_RETURN                                   \n
+      *          RET_MEMBER_NOT_INITIALISED                           \n
+      *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+      */
+     returnValue AD_forwardBatch( EvaluationWorkspace &ws      /**< the work space   */,
+                                  int                  nPoints /**< number of points */,
+                                  float               *seed    /**< the seeds        */,
+                                  float               *df      /**< the derivatives  */ ) const;
+
+
      /** Defines scalings for the variables. */
      virtual returnValue setScale( double *scale_ );
 
@@ -493,6 +888,89 @@ public:
 
     String				auxVariableName;
     String				auxVariableStructName;
+
+    OperatorTable       *table    ;   /**< The shared nodes of the tree.   */
+    EvaluationTape      *tape     ;   /**< The compiled tree (or NULL).    */
+    BooleanType          hornerForm;  /**< Whether the components are
+                                        *  converted to Horner form.       */
+
+    int                 *selection;   /**< The selected components.        */
+    int                  nSelected;   /**< Their number (-1 if none).      */
+    int                 *needed   ;   /**< The intermediate states needed
+                                        *  by the selection (in order).    */
+    int                  nNeeded  ;   /**< The number of needed states.    */
+    BooleanType         *extra    ;   /**< Flags of the components evaluated
+                                        *  first, as they evaluate C
+                                        *  functions read by the selection. */
+    int                  nExtra   ;   /**< The number of these components. */
+
+    EvaluationProfile   *profile  ;   /**< The evaluation profile (or NULL). */
+
+    FunctionEvaluationTree **derivative;   /**< The derivative trees handed out
+                                             *  by differentiate (or NULL).     */
+    int                  nDerivatives;     /**< The size of derivative.         */
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+    void copy( const FunctionEvaluationTree& arg );
+    void deleteAll( );
+
+    /** Moves the intermediate states from position nOld on, such   \n
+     *  that every state directly follows the last state it depends  \n
+     *  on (if it is not already behind). This restores the order of \n
+     *  evaluation after nodes of previous components have been      \n
+     *  turned into intermediate states.                             \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    returnValue sortIntermediateStates( int nOld );
+
+    /** Sets up the index list for the given number of new        \n
+     *  components, which have been appended to f.                 \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue enumerateComponents( int nComponents );
+
+    /** Releases all components and intermediate states. */
+    void clearComponents( );
+
+    /** Returns the largest index of an intermediate state plus one. */
+    int getNumberOfIntermediateStateIndices( ) const;
+
+    /** Determines the intermediate states needed by the given      \n
+     *  components and the components evaluating the C functions    \n
+     *  they read (unless they are selected already).               \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_INDEX_OUT_OF_BOUNDS                            \n
+     */
+    returnValue select( int nComp, const int *comp );
+
+    /** Discards the selection of components. */
+    void clearSelection( );
+
+    /** Deletes the derivative trees handed out by differentiate. */
+    void clearDerivatives( );
+
+    /** Evaluates the C functions in the given node (which are not \n
+     *  hidden behind intermediate states) at nPoints points at     \n
+     *  once; the p-th point is stored at x[p*nv].                  \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue batchCFunctions( Operator *node, int number, int nPoints, int nv, double *x );
+
+    /** Evaluates the operators and records the cycles spent in    \n
+     *  the profile (which is set up at the first call).           \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue evaluateProfiled( int number, double *x, double *result );
+
+    /** Adds the nodes and intermediate states of the expression   \n
+     *  to the (empty) profile.                                    \n
+     */
+    void setUpProfile( );
 };
 
 
@@ -0,0 +1,215 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/native_tape.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_NATIVE_TAPE_HPP
+#define ACADO_TOOLKIT_NATIVE_TAPE_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+#include <stdint.h>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+class EvaluationTape;
+
+
+/**
+ *	\brief Natively compiled version of an evaluation tape.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class NativeTape translates an EvaluationTape into straight-line
+ *  C code, compiles it with the system C compiler into a shared object
+ *  and loads it into the running process. The compiled sweeps replace
+ *  the interpreter of the tape for evaluation and first order automatic
+ *  differentiation.
+ *
+ *  Shared objects are cached in a directory, keyed by a hash of the
+ *  tape, such that later runs with the same function skip the
+ *  compilation. The directory and the compiler can be chosen by the
+ *  environment variables ACADO_JIT_DIR (default: the per-user directory
+ *  /tmp/acado_jit_<uid> with mode 0700) and ACADO_JIT_CC (default: cc;
+ *  the name of the compiler only, it is run without a shell). The cache
+ *  directory and the shared objects are only used if they belong to the
+ *  current user and are not writable by others. Each shared object is
+ *  accompanied by a file with the digest of its contents, which is
+ *  checked before the object is loaded (i.e. before any of its code
+ *  runs). A cached shared object is only used if its embedded hash,
+ *  signature and instruction stream coincide with the ones of the tape;
+ *  otherwise it is recompiled.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class NativeTape{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    NativeTape( );
+
+    /** Copy constructor (loads the shared object once more). */
+    NativeTape( const NativeTape& arg );
+
+    /** Destructor. */
+    ~NativeTape( );
+
+    /** Assignment operator (loads the shared object once more). */
+    NativeTape& operator=( const NativeTape& arg );
+
+
+    /** Compiles the given tape (or reuses a cached shared object) \n
+     *  and loads the result.                                       \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     *          RET_FILE_CAN_NOT_BE_OPENED                          \n
+     *          RET_UNABLE_TO_COMPILE_FUNCTION                      \n
+     *          RET_UNABLE_TO_LOAD_COMPILED_FUNCTION                \n
+     */
+    returnValue init( const EvaluationTape &tape );
+
+
+    /** Returns BT_TRUE if a compiled tape has been loaded. */
+    inline BooleanType isLoaded() const;
+
+
+    /** Runs the compiled instructions (and their derivatives if d != 0). */
+    inline void forward( double *w, double *d ) const;
+
+    /** Runs the compiled derivatives of the instructions only. */
+    inline void forwardDerivative( const double *w, double *d ) const;
+
+    /** Runs the compiled instructions backwards. */
+    inline void backward( const double *w, double *a ) const;
+
+
+    /** Adds a byte to a 64 bit FNV-1a hash. */
+    static inline uint64_t hashByte( uint64_t hash, unsigned char byte );
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    /** Loads the shared object stored at path and checks that its \n
+     *  signature (registers, instructions, variables, constants),  \n
+     *  its hash and its instruction stream coincide with the given  \n
+     *  ones.                                                        \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *          RET_UNABLE_TO_LOAD_COMPILED_FUNCTION                 \n
+     */
+    returnValue load( const int *signature_, uint64_t hash_,
+                      const int *code_, const int *constantIndex_ );
+
+    /** Writes the digest of the given (not yet published) shared  \n
+     *  object next to the shared object stored at path.            \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *          RET_FILE_CAN_NOT_BE_OPENED                           \n
+     */
+    returnValue writeDigest( const char *object, const char *dir ) const;
+
+    /** Returns BT_TRUE if the digest file of the shared object stored \n
+     *  at path is private and matches the contents of the object.      \n
+     */
+    BooleanType hasValidDigest( ) const;
+
+    /** Computes the (64 bit FNV-1a) digest of the contents of a file. \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_FILE_CAN_NOT_BE_OPENED                              \n
+     */
+    static returnValue getDigest( const char *fileName, uint64_t &digest );
+
+    /** Determines the cache directory (and creates the default one). \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_FILE_CAN_NOT_BE_OPENED                              \n
+     */
+    returnValue setupCacheDirectory( char *&dir ) const;
+
+    /** Compiles the tape into a new shared object stored at path.     \n
+     *  \return SUCCESSFUL_RETURN                                       \n
+     *          RET_FILE_CAN_NOT_BE_OPENED                              \n
+     *          RET_UNABLE_TO_COMPILE_FUNCTION                          \n
+     */
+    returnValue compile( const EvaluationTape &tape, const char *dir ) const;
+
+    /** Returns BT_TRUE if the file (or directory) is no symbolic link, \n
+     *  belongs to the current user and is not writable by others.      \n
+     */
+    static BooleanType isPrivate( const char *fileName, BooleanType isDirectory );
+
+    void copy( const NativeTape& arg );
+    void deleteAll();
+
+
+
+//
+// PROTECTED MEMBERS:
+//
+protected:
+
+    typedef void (*EvaluateFcn)( double* );
+    typedef void (*ForwardFcn )( double*, double* );
+    typedef void (*SweepFcn   )( const double*, double* );
+
+    void                 *handle           ;   /**< Handle of the shared object.         */
+    char                 *path             ;   /**< File name of the shared object.      */
+    int                   nRegisters       ;   /**< Size of the register file.           */
+    int                   nInstructions    ;   /**< Number of instructions.              */
+
+    EvaluateFcn           evaluateFcn      ;   /**< The compiled instructions.           */
+    ForwardFcn            forwardFcn       ;   /**< The compiled forward sweep.          */
+    SweepFcn              derivativeFcn    ;   /**< The compiled derivative sweep.       */
+    SweepFcn              backwardFcn      ;   /**< The compiled backward sweep.         */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/function/native_tape.ipp>
+
+
+#endif  // ACADO_TOOLKIT_NATIVE_TAPE_HPP
+
+/*
+ *   end of file
+ */
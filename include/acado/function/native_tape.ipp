@@ -0,0 +1,70 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+/**
+*    \file include/acado/function/native_tape.ipp
+*    \author Boris Houska, Hans Joachim Ferreau
+*    \date 2026
+*/
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+inline BooleanType NativeTape::isLoaded() const{
+
+    if( handle != 0 ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+inline void NativeTape::forward( double *w, double *d ) const{
+
+    if( d == 0 ) evaluateFcn( w    );
+    else         forwardFcn ( w, d );
+}
+
+
+inline void NativeTape::forwardDerivative( const double *w, double *d ) const{
+
+    derivativeFcn( w, d );
+}
+
+
+inline void NativeTape::backward( const double *w, double *a ) const{
+
+    backwardFcn( w, a );
+}
+
+
+inline uint64_t NativeTape::hashByte( uint64_t hash, unsigned char byte ){
+
+    // the FNV prime 2^40 + 0x1b3:
+    return ( hash ^ (uint64_t)byte ) * ( ( (uint64_t)1 << 40 ) + 0x1b3u );
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,216 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/function/sparsity_pattern.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_SPARSITY_PATTERN_HPP
+#define ACADO_TOOLKIT_SPARSITY_PATTERN_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Structural sparsity pattern of a Jacobian.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class SparsityPattern stores the positions of the structurally
+ *  non-zero entries of a (Jacobian) matrix in compressed row format.
+ *  Patterns of symbolic functions are obtained from
+ *  Function::getSparsityPattern().
+ *
+ *  In addition, the class provides greedy colourings of the columns
+ *  and of the rows: columns of the same colour do not share a row,
+ *  such that the Jacobian can be recovered from one forward derivative
+ *  per colour, seeded with the sum of the unit vectors of the columns
+ *  of that colour. Analogously, one backward derivative per row colour
+ *  suffices. For symmetric (Hessian) patterns, a star colouring
+ *  exploits the symmetry.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class SparsityPattern{
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+public:
+
+    /** Default constructor. */
+    SparsityPattern( );
+
+    /** Constructor which takes the dimensions (empty pattern). */
+    SparsityPattern( int nRows_, int nCols_ );
+
+    /** Copy constructor (deep copy). */
+    SparsityPattern( const SparsityPattern& arg );
+
+    /** Destructor. */
+    ~SparsityPattern( );
+
+    /** Assignment operator (deep copy). */
+    SparsityPattern& operator=( const SparsityPattern& arg );
+
+
+    /** Initializes an empty pattern of the given dimensions. \n
+     *  \return SUCCESSFUL_RETURN                              \n
+     */
+    returnValue init( int nRows_, int nCols_ );
+
+    /** Initializes the pattern in compressed row format: the   \n
+     *  column indices of row i are stored in                    \n
+     *  colIndex_[rowStart_[i]], ..., colIndex_[rowStart_[i+1]-1]. \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     *          RET_INDEX_OUT_OF_BOUNDS                           \n
+     */
+    returnValue init( int nRows_, int nCols_, const int *rowStart_, const int *colIndex_ );
+
+    /** Initializes a dense pattern of the given dimensions. \n
+     *  \return SUCCESSFUL_RETURN                             \n
+     */
+    returnValue setDense( int nRows_, int nCols_ );
+
+
+    /** Returns the number of rows. */
+    inline int getNumRows() const;
+
+    /** Returns the number of columns. */
+    inline int getNumCols() const;
+
+    /** Returns the number of structural non-zeros. */
+    inline int getNumberOfNonzeros() const;
+
+    /** Returns the start of the rows in the column index array. */
+    inline const int* getRowStart() const;
+
+    /** Returns the column indices of the non-zeros (row by row). */
+    inline const int* getColIndex() const;
+
+    /** Returns the pattern of the transposed matrix. */
+    SparsityPattern getTranspose() const;
+
+    /** Returns BT_TRUE if the entry (row,col) is a structural non-zero. */
+    BooleanType isNonzero( int row, int col ) const;
+
+    /** Returns the lower triangle (including the diagonal) of the pattern. */
+    SparsityPattern getLowerTriangle() const;
+
+    /** Returns the symmetric pattern whose lower triangle coincides \n
+     *  with the lower triangle of this pattern.                      \n
+     */
+    SparsityPattern getSymmetric() const;
+
+
+    /** Colours the columns such that columns of the same colour   \n
+     *  do not have a non-zero in a common row. The colour of       \n
+     *  column j is stored in color[j].                             \n
+     *  \return the number of colours                               \n
+     */
+    int getColumnColoring( int *color ) const;
+
+    /** Colours the rows such that rows of the same colour do not \n
+     *  have a non-zero in a common column. The colour of row i    \n
+     *  is stored in color[i].                                     \n
+     *  \return the number of colours                              \n
+     */
+    int getRowColoring( int *color ) const;
+
+    /** Computes a star colouring of the columns of a symmetric       \n
+     *  pattern: columns which share a row have different colours and \n
+     *  every path of four columns uses at least three colours. Then   \n
+     *  every non-zero of the (Hessian) matrix can be recovered from   \n
+     *  one product of the matrix with the sum of the unit vectors of  \n
+     *  a colour, which needs less colours than the column colouring.  \n
+     *  The colour of column j is stored in color[j].                  \n
+     *  \return the number of colours                                  \n
+     */
+    int getStarColoring( int *color ) const;
+
+
+    /** Prints the pattern to the standard output. \n
+     *  \return SUCCESSFUL_RETURN                   \n
+     */
+    returnValue print() const;
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+protected:
+
+    void copy( const SparsityPattern& arg );
+    void deleteAll();
+
+    /** Computes the compressed column format of the pattern. */
+    void getTranspose( int *colStart, int *rowIndex ) const;
+
+    /** Greedy distance-2 colouring of n objects: object j is linked  \n
+     *  to the entries link[linkStart[j]],...; two objects conflict   \n
+     *  if they are linked to an entry whose objects are              \n
+     *  object[objectStart[l]],..., object[objectStart[l+1]-1].       \n
+     */
+    static int colorGreedy( int n, const int *linkStart, const int *link,
+                            int nLinks, const int *objectStart, const int *object,
+                            int *color );
+
+
+
+//
+// PROTECTED MEMBERS:
+//
+protected:
+
+    int   nRows   ;   /**< Number of rows.                           */
+    int   nCols   ;   /**< Number of columns.                        */
+    int  *rowStart;   /**< Start of the rows in colIndex (nRows+1).  */
+    int  *colIndex;   /**< Column indices of the non-zeros.          */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#include <acado/function/sparsity_pattern.ipp>
+
+
+#endif  // ACADO_TOOLKIT_SPARSITY_PATTERN_HPP
+
+/*
+ *   end of file
+ */
@@ -375,24 +375,43 @@ protected:
     void printRKIntermediateResults();
 
 
-    /** Decomposes the Jacobian J.               \n
-     *  \return SUCCESSFUL_RETURN                \n
-     *          RET_THE_DAE_INDEX_IS_TOO_LARGE   \n
+    /** Determines the sparsity pattern of the Jacobians M and a    \n
+     *  colouring of its columns.                                     \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     */
+    returnValue determineIterationPattern();
+
+
+    /** Computes the Jacobian J of the implicit right-hand side w.r.t.\n
+     *  the states, where the derivatives are weighted with ddiffSeed \n
+     *  and the differential states with diffSeed. Only one direction \n
+     *  per colour of the columns is seeded.                          \n
+     *  \return SUCCESSFUL_RETURN                                    \n
+     *          RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF            \n
      */
-    returnValue decomposeJacobian( Matrix &J ) const;
+    returnValue computeIterationMatrix( int number, double ddiffSeed, double diffSeed, Matrix &J );
 
 
-    /** applies a newton step                                              \n
+    /** Decomposes the Jacobian M[index]. For the Householder method the   \n
+     *  factorization is stored in (and re-uses the memory of) Mdec[index].\n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_THE_DAE_INDEX_IS_TOO_LARGE                             \n
+     */
+    returnValue decomposeJacobian( int index );
+
+
+    /** applies a newton step with the decomposed Jacobian M[index]        \n
      *  \return the norm of the increment                                  \n
      */
-    double applyNewtonStep( double *etakplus1, const double *etak, const Matrix &J, const double *FFF );
+    double applyNewtonStep( double *etakplus1, const double *etak, int index, const double *FFF );
 
 
-    /** applies the transpose of M (needed for automatic differentiation   \n
-     *  in backward mode)                                                  \n
-     *  \return (void)                                                     \n
+    /** applies the transpose of M[index] (needed for automatic            \n
+     *  differentiation in backward mode)                                  \n
+     *  \return SUCCESSFUL_RETURN                                          \n
+     *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR                     \n
      */
-    void applyMTranspose( double *seed1, Matrix &J, double *seed2 );
+    returnValue applyMTranspose( double *seed1, int index, double *seed2 );
 
 
     /** Initializes a second forward seed. (only for internal use)         \n
@@ -546,10 +565,15 @@ protected:
                                   *   polynom.                                            */
 
     Matrix **M                 ; /**< the Jacobians for Newton's method                   */
+    MatrixFactorization **Mdec ; /**< the factorizations of the Jacobians M               */
     int     *M_index           ; /**< the index of the inverse approximation              */
     int      nOfM              ; /**< number of distinct inverse Jacobian approximations  */
     int      maxNM             ; /**< number of allocated Jacobian storage positions      */
 
+    SparsityPattern iterationPattern; /**< the sparsity pattern of the transposed M      */
+    int     *iterationColor    ; /**< the column colouring of the Jacobians M             */
+    int      nIterationColors  ; /**< number of colours (0 if not yet determined)         */
+
     int     *nOfNewtonSteps    ; /**< the number of newton steps (for each BDF-step)      */
     double **eta               ; /**< the predictor and corrector approximations          */
     double **eta2              ; /**< the predictor and corrector approximations          */
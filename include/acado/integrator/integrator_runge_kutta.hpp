@@ -369,6 +369,14 @@ protected:
     double determineEta45( int number );
 
 
+    /** evaluates the right-hand side at a stage (only for internal   \n
+     *  use); in mixed precision, the evaluation runs in float on the \n
+     *  compiled tape of the right-hand side.                         \n
+     *  \return SUCCESSFUL_RETURN                                     \n
+     */
+    returnValue evaluateStage( double *x_, double *k_ );
+
+
     /** computes etaG in forward direction (only for internal use)         \n
      */
     void determineEtaGForward( int number );
@@ -451,6 +459,9 @@ protected:
     double   t                 ;  /**< the actual time                                    */
     double  *x                 ;  /**< the actual state (only internal use)               */
     double   err_power         ;  /**< root order of the step size control                */
+    BooleanType mixedPrecision ;  /**< whether the stages are evaluated in float          */
+    float   *xSingle           ;  /**< the actual state in single precision               */
+    float   *kSingle           ;  /**< a stage derivative in single precision             */
 
 
     // SENSITIVITIES:
@@ -50,6 +50,15 @@ BEGIN_NAMESPACE_ACADO
  *  and to provide a wrapper for more efficient implementations. It should
  *  not be used for efficiency-critical operations.
  *
+ *  The Matrix objects of all sub-blocks, and their types, are stored in one
+ *  contiguous array. The entries of every dense block are still kept in the
+ *  memory owned by its Matrix object, i.e. there is no common buffer for the
+ *  entries and no strided views into it (Matrix cannot refer to memory it
+ *  does not own). Zero blocks (SBMT_ZERO) are skipped in products and sums,
+ *  identity blocks (SBMT_ONE) are treated as copies or as diagonal updates,
+ *  and the method getBlock() gives read access to a sub-block without
+ *  copying it.
+ *
  *	 \author Boris Houska, Hans Joachim Ferreau,
  */
 class BlockMatrix{
@@ -73,6 +82,11 @@ class BlockMatrix{
 		/** Copy constructor (deep copy). */
         BlockMatrix( const BlockMatrix& rhs	/**< Right-hand side object. */ );
 
+		#ifdef ACADO_HAS_MOVE_SEMANTICS
+		/** Move constructor (takes over the blocks of the right-hand side, which is left empty). */
+        inline BlockMatrix( BlockMatrix&& rhs	/**< Right-hand side object. */ );
+		#endif
+
 
         /** Destructor. */
         virtual ~BlockMatrix( );
@@ -85,6 +99,15 @@ class BlockMatrix{
         /** Assignment operator (deep copy). */
         BlockMatrix& operator=( const BlockMatrix& rhs /**< Right-hand side object. */ );
 
+		#ifdef ACADO_HAS_MOVE_SEMANTICS
+        /** Move assignment operator (takes over the blocks of the right-hand side, which is left empty). */
+        inline BlockMatrix& operator=( BlockMatrix&& rhs /**< Right-hand side object. */ );
+		#endif
+
+		/** Exchanges the contents of two block matrices without copying any block.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue swap( BlockMatrix& rhs /**< Object to be exchanged. */ );
+
 
 		/** Set method that defines the value of a certain component.
 		 *  \return SUCCESSFUL_RETURN */
@@ -92,6 +115,15 @@ class BlockMatrix{
                               uint           colIdx, /**< Column index of the component. */
                               const Matrix&  value );
 
+		#ifdef ACADO_HAS_MOVE_SEMANTICS
+		/** Set method that defines the value of a certain component by taking
+		 *  over the memory of a temporary matrix.
+		 *  \return SUCCESSFUL_RETURN */
+		inline returnValue setDense( uint           rowIdx, /**< Row index of the component.    */
+                                     uint           colIdx, /**< Column index of the component. */
+                                     Matrix&&       value );
+		#endif
+
 
 		/** Add method that adds a matrix to a certain component.
 		 *  \return SUCCESSFUL_RETURN */
@@ -109,6 +141,23 @@ class BlockMatrix{
                                         Matrix &value   )  const;
 
 
+		/** Access method that returns a reference to a certain component, i.e.
+		 *  the sub-block is not copied. The reference stays valid until the
+		 *  block matrix is re-initialized. Note that zero blocks might be
+		 *  empty; use getType() to distinguish the block types.
+		 *  \return Reference to the sub-block. */
+		inline const Matrix& getBlock(	uint rowIdx,	/**< Row index of the component.    */
+										uint colIdx		/**< Column index of the component. */
+										) const;
+
+
+		/** Returns the type (zero, identity or dense) of a certain component.
+		 *  \return Type of the sub-block. */
+		inline SubBlockMatrixType getType(	uint rowIdx,	/**< Row index of the component.    */
+											uint colIdx		/**< Column index of the component. */
+											) const;
+
+
 		/** Access method that returns the value of a certain component and requiring
          *  a given dimension.
 		 *  \return SUCCESSFUL_RETURN
@@ -254,6 +303,24 @@ class BlockMatrix{
     //
     protected:
 
+		/** Allocates a (_nRows x _nCols) array of zero blocks. Any previous
+		 *  memory has to be released before.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue allocateBlocks( uint _nRows, uint _nCols );
+
+		/** Frees the memory of all blocks.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue releaseBlocks( );
+
+		/** Deep copy of all blocks of rhs. The block array is only re-allocated
+		 *  if the dimensions differ.
+		 *  \return SUCCESSFUL_RETURN */
+		returnValue copyBlocks( const BlockMatrix& rhs );
+
+		/** Adds the identity matrix to a square block in place.
+		 *  \return SUCCESSFUL_RETURN */
+		static returnValue addIdentity( Matrix& block );
+
 
 
     //
@@ -264,8 +331,8 @@ class BlockMatrix{
 		uint nRows;			/**< Number of rows. */
 		uint nCols;			/**< Number of columns. */
 
-        Matrix             **elements;
-        SubBlockMatrixType **types   ;
+        Matrix             **elements;  /**< Row pointers into one contiguous array of all block objects. */
+        SubBlockMatrixType **types   ;  /**< Row pointers into one contiguous array of all types.  */
 };
 
 
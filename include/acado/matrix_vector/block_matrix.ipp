@@ -49,6 +49,24 @@ inline returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx, Matrix &v
 }
 
 
+inline const Matrix& BlockMatrix::getBlock( uint rowIdx, uint colIdx ) const{
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    return elements[rowIdx][colIdx];
+}
+
+
+inline SubBlockMatrixType BlockMatrix::getType( uint rowIdx, uint colIdx ) const{
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    return types[rowIdx][colIdx];
+}
+
+
 inline uint BlockMatrix::getNumRows( ) const{
 
 	return nRows;
@@ -104,10 +122,18 @@ inline returnValue BlockMatrix::addRegularisation( uint rowIdx, uint colIdx, dou
     ASSERT( rowIdx < getNumRows( ) );
     ASSERT( colIdx < getNumCols( ) );
 
+    uint run1, run2;
+
     if( types[rowIdx][colIdx] != SBMT_ZERO ){
-        Matrix tmp( elements[rowIdx][colIdx].getNumRows(), elements[rowIdx][colIdx].getNumCols() );
-        tmp.setAll( eps );
-        elements[rowIdx][colIdx] += tmp;
+
+        Matrix &block = elements[rowIdx][colIdx];
+
+        for( run1 = 0; run1 < block.getNumRows(); run1++ )
+            for( run2 = 0; run2 < block.getNumCols(); run2++ )
+                block(run1,run2) += eps;
+
+        // (the arithmetic takes identity blocks for exact identities)
+        types[rowIdx][colIdx] = SBMT_DENSE;
     }
 
     return SUCCESSFUL_RETURN;
@@ -163,6 +189,49 @@ inline BooleanType BlockMatrix::isEmpty() const{
 
 
 
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+inline BlockMatrix::BlockMatrix( BlockMatrix&& rhs ){
+
+	nRows    = rhs.nRows;
+	nCols    = rhs.nCols;
+	elements = rhs.elements;
+	types    = rhs.types;
+
+	rhs.nRows    = 0;
+	rhs.nCols    = 0;
+	rhs.elements = 0;
+	rhs.types    = 0;
+}
+
+
+inline BlockMatrix& BlockMatrix::operator=( BlockMatrix&& rhs ){
+
+    // (the old blocks are released with tmp, such that rhs is left empty)
+    if ( this != &rhs ){
+        BlockMatrix tmp( std::move( rhs ) );
+        swap( tmp );
+    }
+
+    return *this;
+}
+
+
+inline returnValue BlockMatrix::setDense( uint rowIdx, uint colIdx, Matrix&& value ){
+
+	ASSERT( rowIdx < getNumRows( ) );
+	ASSERT( colIdx < getNumCols( ) );
+
+    elements[rowIdx][colIdx] = std::move( value );
+    types   [rowIdx][colIdx] = SBMT_DENSE;
+
+    return SUCCESSFUL_RETURN;
+}
+
+#endif
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 
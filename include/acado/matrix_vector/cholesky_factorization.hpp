@@ -0,0 +1,119 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/cholesky_factorization.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_CHOLESKY_FACTORIZATION_HPP
+#define ACADO_TOOLKIT_CHOLESKY_FACTORIZATION_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Cholesky factorization of dense symmetric positive definite matrices.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class CholeskyFactorization computes  A = L*L^T  with a lower
+ *  triangular matrix L; only the lower triangle of A is referenced. The
+ *  factorization is blocked and right-looking, i.e. the trailing sub-matrix
+ *  is updated by matrix-matrix products once per block of columns. As
+ *  factorize() reports indefinite matrices without an error message, it
+ *  can also be used as a cheap test for positive definiteness.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class CholeskyFactorization : public MatrixFactorization{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        CholeskyFactorization( );
+
+        /** Copy constructor (deep copy). */
+        CholeskyFactorization( const CholeskyFactorization& rhs );
+
+        /** Destructor. */
+        virtual ~CholeskyFactorization( );
+
+        /** Assignment operator (deep copy). */
+        CholeskyFactorization& operator=( const CholeskyFactorization& rhs );
+
+        /** Clone operator (deep copy). */
+        virtual MatrixFactorization* clone( ) const;
+
+
+        /** Computes the factorization  A = L*L^T.        \n
+         *                                                \n
+         *  \return SUCCESSFUL_RETURN                     \n
+         *          RET_MATRIX_NOT_SQUARE                 \n
+         *          RET_MATRIX_NOT_POSITIVE_DEFINITE      \n
+         */
+        virtual returnValue factorize( const Matrix& A /**< Matrix to be factorized. */ );
+
+
+        /** Returns the Cholesky factor L.                \n
+         *                                                \n
+         *  \return SUCCESSFUL_RETURN                     \n
+         *          RET_MEMBER_NOT_INITIALISED            \n
+         */
+        returnValue getL( Matrix& L /**< Output: lower triangular factor. */ ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        virtual returnValue solveInPlace( double *B,
+                                          uint nRhs,
+                                          BooleanType transposed ) const;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_CHOLESKY_FACTORIZATION_HPP
+
+/*
+ *   end of file
+ */
@@ -0,0 +1,120 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/ldl_factorization.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_LDL_FACTORIZATION_HPP
+#define ACADO_TOOLKIT_LDL_FACTORIZATION_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief LDL^T factorization of dense symmetric matrices.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class LDLFactorization computes  A = L*D*L^T  with a unit lower
+ *  triangular matrix L and a diagonal matrix D; only the lower triangle
+ *  of A is referenced. As no pivoting is performed (like in
+ *  Matrix::getCholeskyDecomposition( Vector &D )), the factorization is
+ *  intended for quasi-definite matrices. It is blocked and right-looking
+ *  like the CholeskyFactorization.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class LDLFactorization : public MatrixFactorization{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        LDLFactorization( );
+
+        /** Copy constructor (deep copy). */
+        LDLFactorization( const LDLFactorization& rhs );
+
+        /** Destructor. */
+        virtual ~LDLFactorization( );
+
+        /** Assignment operator (deep copy). */
+        LDLFactorization& operator=( const LDLFactorization& rhs );
+
+        /** Clone operator (deep copy). */
+        virtual MatrixFactorization* clone( ) const;
+
+
+        /** Computes the factorization  A = L*D*L^T.      \n
+         *                                                \n
+         *  \return SUCCESSFUL_RETURN                     \n
+         *          RET_MATRIX_NOT_SQUARE                 \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR\n
+         */
+        virtual returnValue factorize( const Matrix& A /**< Matrix to be factorized. */ );
+
+
+        /** Returns the factors L and D.                  \n
+         *                                                \n
+         *  \return SUCCESSFUL_RETURN                     \n
+         *          RET_MEMBER_NOT_INITIALISED            \n
+         */
+        returnValue getFactors( Matrix& L,  /**< Output: unit lower triangular factor. */
+                                Vector& D   /**< Output: diagonal of D.                */ ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        virtual returnValue solveInPlace( double *B,
+                                          uint nRhs,
+                                          BooleanType transposed ) const;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_LDL_FACTORIZATION_HPP
+
+/*
+ *   end of file
+ */
@@ -179,6 +179,11 @@ class Matrix : public VectorspaceElement{
         /** \brief Copy constructor (deep copy). */
         Matrix( const Matrix& rhs /**< Right-hand side object. */ );
 
+        #ifdef ACADO_HAS_MOVE_SEMANTICS
+        /** \brief Move constructor (takes over the memory of the right-hand side, which is left empty). */
+        inline Matrix( Matrix&& rhs /**< Right-hand side object. */ );
+        #endif
+
         /** \brief Destructor. */
         virtual ~Matrix( );
 
@@ -219,6 +224,18 @@ class Matrix : public VectorspaceElement{
         /** \brief Assignment operator (deep copy). */
         Matrix& operator=( const Matrix& rhs /**< The right-hand side object. */ );
 
+        #ifdef ACADO_HAS_MOVE_SEMANTICS
+        /** \brief Move assignment operator (takes over the memory of the right-hand side, which is left empty). */
+        inline Matrix& operator=( Matrix&& rhs /**< The right-hand side object. */ );
+        #endif
+
+        /** \brief Exchanges the contents (including an attached sparse solver) \n
+         *  of two matrices without copying any components.                 \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+        inline returnValue swap( Matrix& rhs /**< The matrix to be exchanged. */ );
+
 
         /** \brief Assignment operator, which loads a matrix from a file. */
         Matrix& operator=( FILE *rhs /**< A file containing the matrix data. */ );
@@ -341,6 +358,23 @@ class Matrix : public VectorspaceElement{
 									) const;
 
 
+		/** Adds the product A*B to the matrix object (without a temporary
+		 *  for the product, unless A or B is the object itself), i.e.
+		 *  computes A*B + C in place.
+		 *  \return Reference to object after the update. */
+		inline Matrix& addProduct(	const Matrix& A,	/**< Left factor.  */
+									const Matrix& B		/**< Right factor. */
+									);
+
+		/** Adds the product A^T*B to the matrix object (without forming
+		 *  the transpose or, unless A or B is the object itself, a
+		 *  temporary for the product).
+		 *  \return Reference to object after the update. */
+		inline Matrix& addTransposeProduct(	const Matrix& A,	/**< Factor to be transposed. */
+											const Matrix& B		/**< Right factor.            */
+											);
+
+
         inline Matrix transpose() const;
 
         inline Matrix negativeTranspose() const;
@@ -818,6 +852,35 @@ class Matrix : public VectorspaceElement{
 typedef std::tr1::shared_ptr< Matrix > matrixPtr;
 
 
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+/** Adds two matrices, accumulating into the storage of the temporary left summand.
+ *  \return Sum of the matrices. */
+inline Matrix operator+(	Matrix&& lhs,		/**< First summand (temporary).  */
+							const Matrix& rhs	/**< Second summand.             */
+							);
+
+/** Adds two matrices, accumulating into the storage of the temporary right summand.
+ *  \return Sum of the matrices. */
+inline Matrix operator+(	const Matrix& lhs,	/**< First summand.              */
+							Matrix&& rhs		/**< Second summand (temporary). */
+							);
+
+/** Adds two temporary matrices, accumulating into the storage of the left summand.
+ *  \return Sum of the matrices. */
+inline Matrix operator+(	Matrix&& lhs,		/**< First summand (temporary).  */
+							Matrix&& rhs		/**< Second summand (temporary). */
+							);
+
+/** Subtracts a matrix from a temporary one, re-using the storage of the latter.
+ *  \return Difference of the matrices. */
+inline Matrix operator-(	Matrix&& lhs,		/**< Minuend (temporary). */
+							const Matrix& rhs	/**< Subtrahend.          */
+							);
+
+#endif
+
+
 CLOSE_NAMESPACE_ACADO
 
 
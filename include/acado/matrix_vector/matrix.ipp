@@ -184,17 +184,11 @@ inline Matrix Matrix::operator*(	const Matrix& arg
 {
 	ASSERT( getNumCols( ) == arg.getNumRows( ) );
 
-	uint i,j,k;
+	Matrix result( getNumRows( ),arg.getNumCols( ) );
 
-	uint newNumRows = getNumRows( );
-	uint newNumCols = arg.getNumCols( );
-	Matrix result( newNumRows,newNumCols );
-	result.setZero( );
-
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<newNumCols; ++j )
-			for( k=0; k<getNumCols( ); ++k )
-				result( i,j ) += operator()( i,k ) * arg( k,j );
+	acadoGemm(	getNumRows( ),arg.getNumCols( ),getNumCols( ),
+				element,arg.element,result.element
+				);
 
 	return result;
 }
@@ -205,17 +199,11 @@ inline Matrix Matrix::operator^(	const Matrix& arg
 {
 	ASSERT( getNumRows( ) == arg.getNumRows( ) );
 
-	uint i,j,k;
-
-	uint newNumRows = getNumCols( );
-	uint newNumCols = arg.getNumCols( );
-	Matrix result( newNumRows,newNumCols );
-	result.setZero( );
+	Matrix result( getNumCols( ),arg.getNumCols( ) );
 
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<newNumCols; ++j )
-			for( k=0; k<getNumRows( ); ++k )
-				result( i,j ) += operator()( k,i ) * arg( k,j );
+	acadoGemmTN(	getNumCols( ),arg.getNumCols( ),getNumRows( ),
+					element,arg.element,result.element
+					);
 
 	return result;
 }
@@ -226,15 +214,11 @@ inline Vector Matrix::operator*(	const Vector& arg
 {
 	ASSERT( getNumCols( ) == arg.getDim( ) );
 
-	uint i,j;
-
-	uint newNumRows = getNumRows( );
-	Vector result( newNumRows );
-	result.setZero( );
+	Vector result( getNumRows( ) );
 
-	for( i=0; i<newNumRows; ++i )
-		for( j=0; j<getNumCols( ); ++j )
-			result( i ) += operator()( i,j ) * arg( j );
+	acadoGemv(	getNumRows( ),getNumCols( ),
+				element,((Vector&)arg).getDoublePointer( ),result.getDoublePointer( )
+				);
 
 	return result;
 }
@@ -246,20 +230,53 @@ inline Vector Matrix::operator^(	const Vector& arg
 {
 	ASSERT( getNumRows( ) == arg.getDim( ) );
 
-	uint i,j;
-
-	uint newNumRows = getNumCols( );
-	Vector result( newNumRows );
-	result.setZero( );
+	Vector result( getNumCols( ) );
 
-	for( j=0; j<getNumRows( ); ++j )
-		for( i=0; i<newNumRows; ++i )
-			result( i ) += operator()( j,i ) * arg( j );
+	acadoGemvT(	getNumRows( ),getNumCols( ),
+				element,((Vector&)arg).getDoublePointer( ),result.getDoublePointer( )
+				);
 
 	return result;
 }
 
 
+inline Matrix& Matrix::addProduct(	const Matrix& A,
+									const Matrix& B
+									)
+{
+	ASSERT( A.getNumCols( ) == B.getNumRows( ) );
+	ASSERT( ( getNumRows( ) == A.getNumRows( ) ) && ( getNumCols( ) == B.getNumCols( ) ) );
+
+	// the kernel overwrites entries it still reads if a factor is the matrix itself:
+	if ( ( &A == this ) || ( &B == this ) )
+		return operator+=( A*B );
+
+	acadoGemm(	A.getNumRows( ),B.getNumCols( ),A.getNumCols( ),
+				A.element,B.element,element,BT_TRUE
+				);
+
+	return *this;
+}
+
+
+inline Matrix& Matrix::addTransposeProduct(	const Matrix& A,
+											const Matrix& B
+											)
+{
+	ASSERT( A.getNumRows( ) == B.getNumRows( ) );
+	ASSERT( ( getNumRows( ) == A.getNumCols( ) ) && ( getNumCols( ) == B.getNumCols( ) ) );
+
+	if ( ( &A == this ) || ( &B == this ) )
+		return operator+=( A^B );
+
+	acadoGemmTN(	A.getNumCols( ),B.getNumCols( ),A.getNumRows( ),
+					A.element,B.element,element,BT_TRUE
+					);
+
+	return *this;
+}
+
+
 inline Matrix Matrix::transpose() const{
 
      Matrix result( getNumCols(), getNumRows() );
@@ -532,6 +549,89 @@ inline Vector sumCol(const Matrix& arg) {
 	return arg*result;
 }
 
+
+inline returnValue Matrix::swap( Matrix& rhs ){
+
+    uint          tmpRows   = nRows;
+    uint          tmpCols   = nCols;
+    SparseSolver *tmpSolver = solver;
+
+    VectorspaceElement::swap( rhs );
+
+    nRows      = rhs.nRows;
+    nCols      = rhs.nCols;
+    solver     = rhs.solver;
+    rhs.nRows  = tmpRows;
+    rhs.nCols  = tmpCols;
+    rhs.solver = tmpSolver;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+inline Matrix::Matrix( Matrix&& rhs ) : VectorspaceElement( )
+{
+	nRows  = 0;
+	nCols  = 0;
+	solver = 0;
+
+	swap( rhs );
+}
+
+
+inline Matrix& Matrix::operator=( Matrix&& rhs ){
+
+    // (the old contents are released with tmp, such that rhs is left empty)
+    if ( this != &rhs ){
+        Matrix tmp( std::move( rhs ) );
+        swap( tmp );
+    }
+
+    return *this;
+}
+
+
+inline Matrix operator+(	Matrix&& lhs,
+							const Matrix& rhs
+							)
+{
+	lhs += rhs;
+	return std::move( lhs );
+}
+
+
+inline Matrix operator+(	const Matrix& lhs,
+							Matrix&& rhs
+							)
+{
+	rhs += lhs;
+	return std::move( rhs );
+}
+
+
+inline Matrix operator+(	Matrix&& lhs,
+							Matrix&& rhs
+							)
+{
+	lhs += rhs;
+	return std::move( lhs );
+}
+
+
+inline Matrix operator-(	Matrix&& lhs,
+							const Matrix& rhs
+							)
+{
+	lhs -= rhs;
+	return std::move( lhs );
+}
+
+#endif
+
+
+
 CLOSE_NAMESPACE_ACADO
 
 
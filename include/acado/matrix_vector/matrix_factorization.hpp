@@ -0,0 +1,226 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/matrix_factorization.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_MATRIX_FACTORIZATION_HPP
+#define ACADO_TOOLKIT_MATRIX_FACTORIZATION_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+/** Number of columns eliminated per step of the blocked factorizations;  \n
+ *  the trailing sub-matrix is updated by one matrix-matrix product per    \n
+ *  block of columns.                                                      \n
+ */
+#define FACTORIZATION_BLOCK_SIZE 32
+
+/** Alignment (in bytes) of the workspace owned by the factorizations. */
+#define FACTORIZATION_ALIGNMENT 64
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Base class for reusable factorizations of dense square matrices.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class MatrixFactorization is the common interface of the dense
+ *  factorizations LUFactorization, QRFactorization, CholeskyFactorization
+ *  and LDLFactorization. In contrast to the decompositions provided by
+ *  the Matrix class, a factorization object owns the factors together
+ *  with an aligned workspace, which are re-used whenever a matrix of the
+ *  same (or a smaller) size is factorized again. Once a matrix A has been
+ *  factorized, the systems  A*x = b  and  A^T*x = b  can be solved for an
+ *  arbitrary number of right-hand sides, which may also be passed as the
+ *  columns of a matrix.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class MatrixFactorization{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        MatrixFactorization( );
+
+        /** Copy constructor (deep copy). */
+        MatrixFactorization( const MatrixFactorization& rhs );
+
+        /** Destructor. */
+        virtual ~MatrixFactorization( );
+
+        /** Assignment operator (deep copy). */
+        MatrixFactorization& operator=( const MatrixFactorization& rhs );
+
+        /** Clone operator (deep copy). */
+        virtual MatrixFactorization* clone( ) const = 0;
+
+
+        /** Factorizes the given square matrix, re-using the memory of  \n
+         *  previous factorizations if possible. A failure due to a      \n
+         *  (numerically) singular or indefinite matrix is returned      \n
+         *  without issuing an error message, such that the caller can   \n
+         *  react on it.                                                 \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_MATRIX_NOT_SQUARE                                \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR               \n
+         *          RET_MATRIX_NOT_POSITIVE_DEFINITE                     \n
+         */
+        virtual returnValue factorize( const Matrix& A /**< Matrix to be factorized. */ ) = 0;
+
+
+        /** Overwrites b with the solution x of  A*x = b.  \n
+         *                                                 \n
+         *  \return SUCCESSFUL_RETURN                      \n
+         *          RET_MEMBER_NOT_INITIALISED             \n
+         *          RET_VECTOR_DIMENSION_MISMATCH          \n
+         */
+        returnValue solve( Vector& b /**< Right-hand side / solution. */ ) const;
+
+        /** Overwrites each column of B with the solution of  A*x = b \n
+         *  for the corresponding column b of B.                       \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         *          RET_MEMBER_NOT_INITIALISED                         \n
+         *          RET_VECTOR_DIMENSION_MISMATCH                      \n
+         */
+        returnValue solve( Matrix& B /**< Right-hand sides / solutions. */ ) const;
+
+        /** Overwrites the row-major (dim x nRhs) array B with the      \n
+         *  solutions of  A*x = b  for its nRhs columns.                \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         *          RET_MEMBER_NOT_INITIALISED                          \n
+         */
+        returnValue solve( double *B,       /**< Right-hand sides / solutions. */
+                           uint nRhs = 1    /**< Number of right-hand sides.   */ ) const;
+
+
+        /** Overwrites b with the solution x of  A^T*x = b. \n
+         *                                                  \n
+         *  \return SUCCESSFUL_RETURN                       \n
+         *          RET_MEMBER_NOT_INITIALISED              \n
+         *          RET_VECTOR_DIMENSION_MISMATCH           \n
+         */
+        returnValue solveTranspose( Vector& b /**< Right-hand side / solution. */ ) const;
+
+        /** Overwrites each column of B with the solution of  A^T*x = b \n
+         *  for the corresponding column b of B.                         \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_MEMBER_NOT_INITIALISED                           \n
+         *          RET_VECTOR_DIMENSION_MISMATCH                        \n
+         */
+        returnValue solveTranspose( Matrix& B /**< Right-hand sides / solutions. */ ) const;
+
+        /** Overwrites the row-major (dim x nRhs) array B with the      \n
+         *  solutions of  A^T*x = b  for its nRhs columns.              \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         *          RET_MEMBER_NOT_INITIALISED                          \n
+         */
+        returnValue solveTranspose( double *B,       /**< Right-hand sides / solutions. */
+                                    uint nRhs = 1    /**< Number of right-hand sides.   */ ) const;
+
+
+        /** Returns the dimension of the factorized matrix. */
+        inline uint getDim( ) const;
+
+        /** Returns whether a matrix has been factorized successfully. */
+        inline BooleanType isFactorized( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Solves  A*x = b  (or  A^T*x = b  if transposed is BT_TRUE) \n
+         *  in place for the nRhs columns of the row-major array B.    \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         */
+        virtual returnValue solveInPlace( double *B,
+                                          uint nRhs,
+                                          BooleanType transposed ) const = 0;
+
+
+        /** Copies the matrix A into the factor storage, after making   \n
+         *  sure that the storage holds a (dim x dim) factor followed by \n
+         *  nWork entries of workspace. Memory is only re-allocated if   \n
+         *  the current capacity is not sufficient.                      \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_MATRIX_NOT_SQUARE                                \n
+         */
+        returnValue setUpFactor( const Matrix& A,    /**< Matrix to be factorized.        */
+                                 uint nWork          /**< Number of workspace entries.    */ );
+
+
+        /** Frees all memory. */
+        void clear( );
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        uint         dim;          /**< Dimension of the factorized matrix.                   */
+        BooleanType  factorized;   /**< Whether the factor is valid.                          */
+
+        double      *factor;       /**< Row-major (dim x dim) factor (aligned).               */
+        double      *work;         /**< Workspace following the factor (aligned).             */
+        uint         capacity;     /**< Number of doubles available at factor.                */
+        uint         workSize;     /**< Number of doubles available at work.                  */
+        void        *memory;       /**< Unaligned memory block holding factor and workspace.  */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_MATRIX_FACTORIZATION_HPP
+
+/*
+ *   end of file
+ */
@@ -0,0 +1,167 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/matrix_kernels.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_MATRIX_KERNELS_HPP
+#define ACADO_TOOLKIT_MATRIX_KERNELS_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/*
+ *  Dense matrix-matrix and matrix-vector products on row-major double
+ *  arrays. The kernels are register-blocked and cache-tiled and use
+ *  SSE2 or AVX instructions if the library is built with them (see
+ *  cmake/CompilerOptionsSSE.cmake). Every entry of the result is
+ *  accumulated in the same order as by the plain triple loop, i.e.
+ *  the results do not depend on the instruction set. The sparse kernels
+ *  for matrices in compressed row format and the kernels for symmetric
+ *  matrices in packed storage are declared at the end; the SIMD variants
+ *  of the sparse and symmetric dot products split them into partial sums.
+ */
+
+
+/** Computes C = A*B (or C += A*B if addToC is BT_TRUE), where A is
+ *  an m x k and B a k x n matrix. */
+void acadoGemm(	uint m, uint n, uint k,
+				const double *A, const double *B, double *C,
+				BooleanType addToC = BT_FALSE
+				);
+
+
+/** Computes C = A^T*B (or C += A^T*B if addToC is BT_TRUE), where A
+ *  is a k x m and B a k x n matrix; A is not transposed explicitly. */
+void acadoGemmTN(	uint m, uint n, uint k,
+					const double *A, const double *B, double *C,
+					BooleanType addToC = BT_FALSE
+					);
+
+
+/** Computes C = A*B (or C += A*B if addToC is BT_TRUE) on sub-blocks of
+ *  larger row-major arrays: A is an m x k, B a k x n and C an m x n block
+ *  whose consecutive rows are lda, ldb and ldc entries apart. */
+void acadoGemmStrided(	uint m, uint n, uint k,
+						const double *A, uint lda,
+						const double *B, uint ldb,
+						double *C, uint ldc,
+						BooleanType addToC = BT_FALSE
+						);
+
+
+/** Computes y = A*x (or y += A*x if addToY is BT_TRUE), where A is
+ *  an m x n matrix. */
+void acadoGemv(	uint m, uint n,
+				const double *A, const double *x, double *y,
+				BooleanType addToY = BT_FALSE
+				);
+
+
+/** Computes y = A^T*x (or y += A^T*x if addToY is BT_TRUE), where A
+ *  is an m x n matrix (i.e. x has m and y has n entries). */
+void acadoGemvT(	uint m, uint n,
+					const double *A, const double *x, double *y,
+					BooleanType addToY = BT_FALSE
+					);
+
+
+/** Computes y = A*x (or y += A*x if addToY is BT_TRUE) for an m x n
+ *  matrix A in compressed row format: the column indices and values of
+ *  row i are stored in index[start[i]],...,index[start[i+1]-1] and
+ *  value[start[i]],...,value[start[i+1]-1]. */
+void acadoCsrGemv(	uint m,
+					const int *start, const int *index, const double *value,
+					const double *x, double *y,
+					BooleanType addToY = BT_FALSE
+					);
+
+
+/** Computes y = A^T*x (or y += A^T*x if addToY is BT_TRUE) for an m x n
+ *  matrix A in compressed row format (i.e. x has m and y has n entries). */
+void acadoCsrGemvT(	uint m, uint n,
+					const int *start, const int *index, const double *value,
+					const double *x, double *y,
+					BooleanType addToY = BT_FALSE
+					);
+
+
+/** Computes C = A*B (or C += A*B if addToC is BT_TRUE) for a matrix A
+ *  with m rows in compressed row format and a dense row-major matrix B
+ *  with n columns. */
+void acadoCsrGemm(	uint m, uint n,
+					const int *start, const int *index, const double *value,
+					const double *B, double *C,
+					BooleanType addToC = BT_FALSE
+					);
+
+
+/** Computes P = A^T*A (or P += A^T*A if addToP is BT_TRUE), where A is a
+ *  k x n matrix and P the lower triangle of a symmetric n x n matrix in
+ *  packed row-wise storage, i.e. P(i,j) with j <= i is stored at
+ *  P[i*(i+1)/2+j]. Each entry is accumulated over the rows of A in their
+ *  natural order, as by the plain triple loop. */
+void acadoSyrkPacked(	uint n, uint k,
+						const double *A, double *P,
+						BooleanType addToP = BT_FALSE
+						);
+
+
+/** Computes y = P*x (or y += P*x if addToY is BT_TRUE) for a symmetric
+ *  n x n matrix P in packed lower triangular storage. */
+void acadoSpmv(	uint n,
+				const double *P, const double *x, double *y,
+				BooleanType addToY = BT_FALSE
+				);
+
+
+/** Computes C = P*B (or C += P*B if addToC is BT_TRUE) for a symmetric
+ *  n x n matrix P in packed lower triangular storage and a dense n x m
+ *  matrix B. */
+void acadoSpmm(	uint n, uint m,
+				const double *P, const double *B, double *C,
+				BooleanType addToC = BT_FALSE
+				);
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_MATRIX_KERNELS_HPP
+
+/*
+ *   end of file
+ */
@@ -37,15 +37,26 @@
 #include <acado/utils/acado_utils.hpp>
 
 #include <acado/matrix_vector/vectorspace_element.hpp>
+#include <acado/matrix_vector/matrix_kernels.hpp>
 
 #include <acado/matrix_vector/vector.hpp>
 #include <acado/matrix_vector/matrix.hpp>
 #include <acado/matrix_vector/t_matrix.hpp>
 #include <acado/matrix_vector/block_matrix.hpp>
+#include <acado/matrix_vector/matrix_factorization.hpp>
+#include <acado/matrix_vector/lu_factorization.hpp>
+#include <acado/matrix_vector/qr_factorization.hpp>
+#include <acado/matrix_vector/cholesky_factorization.hpp>
+#include <acado/matrix_vector/ldl_factorization.hpp>
+#include <acado/matrix_vector/sparse_matrix.hpp>
+#include <acado/matrix_vector/symmetric_matrix.hpp>
 
 #include <acado/matrix_vector/vector.ipp>
 #include <acado/matrix_vector/matrix.ipp>
 #include <acado/matrix_vector/block_matrix.ipp>
+#include <acado/matrix_vector/matrix_factorization.ipp>
+#include <acado/matrix_vector/sparse_matrix.ipp>
+#include <acado/matrix_vector/symmetric_matrix.ipp>
 
 
 BEGIN_NAMESPACE_ACADO
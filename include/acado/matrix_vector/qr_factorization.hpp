@@ -0,0 +1,111 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/qr_factorization.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_QR_FACTORIZATION_HPP
+#define ACADO_TOOLKIT_QR_FACTORIZATION_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Householder QR factorization of dense square matrices.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class QRFactorization computes  A = Q*R  by Householder reflections,
+ *  performing the same arithmetic operations as Matrix::computeQRdecomposition()
+ *  and Matrix::solveQR(), such that the results coincide. The reflections
+ *  are applied to the trailing matrix row by row, the squared norms of the
+ *  Householder vectors are stored with the factor and the matrix itself is
+ *  not modified.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class QRFactorization : public MatrixFactorization{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        QRFactorization( );
+
+        /** Copy constructor (deep copy). */
+        QRFactorization( const QRFactorization& rhs );
+
+        /** Destructor. */
+        virtual ~QRFactorization( );
+
+        /** Assignment operator (deep copy). */
+        QRFactorization& operator=( const QRFactorization& rhs );
+
+        /** Clone operator (deep copy). */
+        virtual MatrixFactorization* clone( ) const;
+
+
+        /** Computes the factorization  A = Q*R.          \n
+         *                                                \n
+         *  \return SUCCESSFUL_RETURN                     \n
+         *          RET_MATRIX_NOT_SQUARE                 \n
+         *          RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR\n
+         */
+        virtual returnValue factorize( const Matrix& A /**< Matrix to be factorized. */ );
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        virtual returnValue solveInPlace( double *B,
+                                          uint nRhs,
+                                          BooleanType transposed ) const;
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_QR_FACTORIZATION_HPP
+
+/*
+ *   end of file
+ */
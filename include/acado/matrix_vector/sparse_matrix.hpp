@@ -0,0 +1,305 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/sparse_matrix.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+
+
+#ifndef ACADO_TOOLKIT_SPARSE_MATRIX_HPP
+#define ACADO_TOOLKIT_SPARSE_MATRIX_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+class SparseSolver;
+class SparsityPattern;
+
+
+/**
+ *	\brief Sparse matrix in compressed row (CSR) or compressed column (CSC) format.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class SparseMatrix stores the non-zero entries of a (possibly large)
+ *  matrix in compressed row or compressed column format. In CSR format, the
+ *  column indices and values of row i are stored in
+ *
+ *     index[ start[i] ], ..., index[ start[i+1]-1 ]  and
+ *     value[ start[i] ], ..., value[ start[i+1]-1 ],
+ *
+ *  respectively; the CSC format stores the columns in the same way. Sparse
+ *  matrices can be set up from dense matrices, from block matrices and from
+ *  the structural sparsity pattern of a Jacobian. Once the pattern is fixed,
+ *  new values can be set without changing it, such that a sparse solver
+ *  can be re-initialized with the new values only.
+ *
+ *  Products with vectors and dense matrices are evaluated by the sparse
+ *  kernels declared in matrix_kernels.hpp.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class SparseMatrix{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        SparseMatrix( );
+
+        /** Constructor which takes the dimensions (all entries zero). */
+        SparseMatrix(	uint _nRows,								/**< Number of rows.    */
+						uint _nCols,								/**< Number of columns. */
+						SparseStorageFormat _format = SSF_CSR		/**< Storage format.    */
+						);
+
+        /** Constructor which stores all entries of a dense matrix whose  \n
+         *  absolute value is larger than the given tolerance.            \n
+         */
+        SparseMatrix(	const Matrix& A,							/**< Dense matrix.      */
+						SparseStorageFormat _format = SSF_CSR,		/**< Storage format.    */
+						double tol = 0.0							/**< Zero tolerance.    */
+						);
+
+        /** Constructor which stores the diagonals of all identity      \n
+         *  blocks of a block matrix and all entries of its dense blocks \n
+         *  whose absolute value is larger than the given tolerance (the \n
+         *  default tolerance drops the exact zeros only). The dimensions\n
+         *  of the block rows and block columns are taken from their     \n
+         *  non-empty blocks.                                            \n
+         */
+        SparseMatrix(	const BlockMatrix& A,						/**< Block matrix.      */
+						SparseStorageFormat _format = SSF_CSR,		/**< Storage format.    */
+						double tol = 0.0							/**< Drop tolerance.    */
+						);
+
+        /** Constructor which sets up the given structural sparsity      \n
+         *  pattern; all structural non-zeros are initialized with zero. \n
+         */
+        SparseMatrix(	const SparsityPattern& pattern,				/**< Sparsity pattern.  */
+						SparseStorageFormat _format = SSF_CSR		/**< Storage format.    */
+						);
+
+        /** Copy constructor (deep copy). */
+        SparseMatrix( const SparseMatrix& rhs );
+
+        /** Destructor. */
+        virtual ~SparseMatrix( );
+
+        /** Assignment operator (deep copy). */
+        SparseMatrix& operator=( const SparseMatrix& rhs );
+
+
+        /** Initializes the matrix from compressed arrays in the given format; \n
+         *  start has (nRows+1) resp. (nCols+1) entries. If _value is a null   \n
+         *  pointer, all entries are set to zero.                              \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         *          RET_INDEX_OUT_OF_BOUNDS                                    \n
+         */
+        returnValue init(	uint _nRows,
+							uint _nCols,
+							SparseStorageFormat _format,
+							const int *_start,
+							const int *_index,
+							const double *_value = 0
+							);
+
+
+        /** Overwrites the values of the stored entries by the corresponding \n
+         *  entries of a dense matrix. Entries of A outside of the pattern   \n
+         *  are ignored, i.e. the pattern does not change.                   \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         *          RET_VECTOR_DIMENSION_MISMATCH                            \n
+         */
+        returnValue setValues( const Matrix& A );
+
+        /** Overwrites the values of the stored entries (in storage order). \n
+         *                                                                  \n
+         *  \return SUCCESSFUL_RETURN                                       \n
+         */
+        returnValue setValues( const double *_value );
+
+
+        /** Returns the matrix in the requested storage format. */
+        SparseMatrix convert( SparseStorageFormat _format ) const;
+
+        /** Returns the transpose of the matrix (in the same format). */
+        SparseMatrix transpose( ) const;
+
+        /** Returns the matrix as a dense matrix. */
+        Matrix getDense( ) const;
+
+
+        /** Computes y = A*x (or y += A*x if addToY is BT_TRUE). \n
+         *  \return SUCCESSFUL_RETURN                             \n
+         */
+        returnValue multiply(	const double *x,				/**< Factor (nCols entries). */
+								double *y,						/**< Result (nRows entries). */
+								BooleanType addToY = BT_FALSE
+								) const;
+
+        /** Computes y = A^T*x (or y += A^T*x if addToY is BT_TRUE). \n
+         *  \return SUCCESSFUL_RETURN                                 \n
+         */
+        returnValue multiplyTranspose(	const double *x,			/**< Factor (nRows entries). */
+										double *y,					/**< Result (nCols entries). */
+										BooleanType addToY = BT_FALSE
+										) const;
+
+        /** Multiplies the matrix with a vector.              \n
+         *  \return Temporary object containing the product.  \n
+         */
+        Vector operator*( const Vector& x /**< Vector factor. */ ) const;
+
+        /** Multiplies the transposed matrix with a vector.   \n
+         *  \return Temporary object containing the product.  \n
+         */
+        Vector operator^( const Vector& x /**< Vector factor. */ ) const;
+
+        /** Multiplies the matrix with a dense matrix.        \n
+         *  \return Temporary object containing the product.  \n
+         */
+        Matrix operator*( const Matrix& B /**< Matrix factor. */ ) const;
+
+
+        /** Passes the dimension, the pattern and the values of the matrix   \n
+         *  to a sparse solver (which factorizes it). The index lists are    \n
+         *  taken from the compressed storage, i.e. the matrix is not        \n
+         *  scanned for its non-zeros. The conjugate gradient methods need   \n
+         *  the entries row by row with increasing column indices, i.e. the  \n
+         *  CSR format with sorted rows (as set up from dense matrices).     \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         *          RET_MATRIX_NOT_SQUARE                                    \n
+         */
+        returnValue setupSolver( SparseSolver& solver /**< Solver to be set up. */ ) const;
+
+        /** Passes only the values of the matrix to a sparse solver that     \n
+         *  has been set up with the same pattern before (see setupSolver).  \n
+         *                                                                   \n
+         *  \return SUCCESSFUL_RETURN                                        \n
+         */
+        returnValue updateSolver( SparseSolver& solver /**< Solver to be updated. */ ) const;
+
+
+        /** Returns the number of rows. */
+        inline uint getNumRows( ) const;
+
+        /** Returns the number of columns. */
+        inline uint getNumCols( ) const;
+
+        /** Returns the number of stored entries. */
+        inline uint getNumberOfNonzeros( ) const;
+
+        /** Returns the storage format. */
+        inline SparseStorageFormat getFormat( ) const;
+
+        /** Returns the start of the rows (CSR) or columns (CSC). */
+        inline const int* getStart( ) const;
+
+        /** Returns the column (CSR) or row (CSC) indices of the entries. */
+        inline const int* getIndex( ) const;
+
+        /** Returns the values of the entries. */
+        inline const double* getValues( ) const;
+
+        /** Returns the values of the entries (for in-place updates). */
+        inline double* getValues( );
+
+
+        /** Prints the entries as (row,column) value triplets. \n
+         *  \return SUCCESSFUL_RETURN                          \n
+         */
+        returnValue print( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Allocates the arrays for the given dimensions and number of \n
+         *  entries, start is initialized with zeros.                   \n
+         */
+        void allocate( uint _nRows, uint _nCols, uint _nnz, SparseStorageFormat _format );
+
+        /** Frees all memory. */
+        void deleteAll( );
+
+        /** Copies all data of rhs (the memory must have been freed before). */
+        void copy( const SparseMatrix& rhs );
+
+        /** Expands start into the row (CSR) resp. column (CSC) index of \n
+         *  each entry, which is needed by the triplet interface of the  \n
+         *  sparse solvers.                                              \n
+         */
+        void setupMajorIndex( );
+
+        /** Returns the number of rows (CSR) resp. columns (CSC). */
+        inline uint getNumMajor( ) const;
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        uint                 nRows     ;   /**< Number of rows.                                  */
+        uint                 nCols     ;   /**< Number of columns.                               */
+        uint                 nnz       ;   /**< Number of stored entries.                        */
+        SparseStorageFormat  format    ;   /**< Storage format.                                  */
+
+        int                 *start     ;   /**< Start of the rows/columns in index and value.    */
+        int                 *index     ;   /**< Column (CSR) or row (CSC) indices of the entries. */
+        int                 *majorIndex;   /**< Row (CSR) or column (CSC) indices of the entries. */
+        double              *value     ;   /**< Values of the entries.                           */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_SPARSE_MATRIX_HPP
+
+/*
+ *	end of file
+ */
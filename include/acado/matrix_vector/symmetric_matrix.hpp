@@ -0,0 +1,254 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/symmetric_matrix.hpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+
+
+#ifndef ACADO_TOOLKIT_SYMMETRIC_MATRIX_HPP
+#define ACADO_TOOLKIT_SYMMETRIC_MATRIX_HPP
+
+
+#include <acado/utils/acado_types.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Symmetric matrix in packed lower triangular storage.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class SymmetricMatrix stores only the lower triangle of a symmetric
+ *  matrix, row by row, i.e. the entry (i,j) with j <= i is stored at
+ *
+ *     element[ i*(i+1)/2 + j ],
+ *
+ *  which needs n*(n+1)/2 instead of n*n doubles. Hessians, covariance
+ *  matrices and Gauss-Newton approximations J^T*J can be accumulated in this
+ *  format by symmetric rank-one and rank-k updates, which compute every
+ *  off-diagonal entry only once. Products with vectors and dense matrices
+ *  are evaluated by the packed kernels declared in matrix_kernels.hpp. The
+ *  matrix can be factorized in place by a Cholesky decomposition.
+ *
+ *  Within the toolkit, the class is used for the blocks J^T*J which LSQTerm
+ *  accumulates (BFGSupdate only exploits the symmetry of its outer products
+ *  block-wise). The following symmetric matrices are still stored densely:
+ *  the Hessian of a BandedCP, since the condensing and the QP solvers need
+ *  dense blocks; the variance-covariance matrix, which qpOASES computes on
+ *  dense arrays; and the matrix propagated by IntegratorLYAPUNOV, whose
+ *  entries are part of the (symbolic) differential state.
+ *
+ *	\author Hans Joachim Ferreau, Boris Houska
+ */
+class SymmetricMatrix{
+
+    //
+    // PUBLIC MEMBER FUNCTIONS:
+    //
+    public:
+
+        /** Default constructor. */
+        SymmetricMatrix( );
+
+        /** Constructor which takes the dimension (all entries zero). */
+        SymmetricMatrix( uint _dim /**< Number of rows and columns. */ );
+
+        /** Constructor which takes the lower triangle of a square matrix. */
+        SymmetricMatrix( const Matrix& A /**< Square matrix. */ );
+
+        /** Copy constructor (deep copy). */
+        SymmetricMatrix( const SymmetricMatrix& rhs );
+
+        /** Destructor. */
+        virtual ~SymmetricMatrix( );
+
+        /** Assignment operator (deep copy). */
+        SymmetricMatrix& operator=( const SymmetricMatrix& rhs );
+
+
+        /** Initializes the matrix with the given dimension; all entries \n
+         *  are set to zero.                                             \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         */
+        returnValue init( uint _dim );
+
+        /** Sets all entries to zero. \n
+         *  \return SUCCESSFUL_RETURN \n
+         */
+        returnValue setZero( );
+
+
+        /** Returns a reference to the entry (i,j), which is the same \n
+         *  as the entry (j,i).                                       \n
+         */
+        inline double& operator()( uint i, uint j );
+
+        /** Returns the entry (i,j), which is the same as the entry (j,i). */
+        inline double operator()( uint i, uint j ) const;
+
+
+        /** Adds alpha*x*x^T to the matrix.  \n
+         *  \return SUCCESSFUL_RETURN        \n
+         */
+        returnValue addRankOneUpdate(	const double *x,			/**< Vector (dim entries). */
+										double alpha = 1.0			/**< Scaling factor.       */
+										);
+
+        /** Adds A^T*A to the matrix, where A has dim columns. The        \n
+         *  entries are accumulated over the rows of A in their natural   \n
+         *  order, i.e. each of them is rounded exactly as the            \n
+         *  corresponding entry of the dense product A^T*A.               \n
+         *                                                                \n
+         *  \return SUCCESSFUL_RETURN                                     \n
+         *          RET_VECTOR_DIMENSION_MISMATCH                         \n
+         */
+        returnValue addRankKUpdate( const Matrix& A /**< Factor (k x dim). */ );
+
+
+        /** Computes y = A*x (or y += A*x if addToY is BT_TRUE). \n
+         *  \return SUCCESSFUL_RETURN                             \n
+         */
+        returnValue multiply(	const double *x,				/**< Factor (dim entries). */
+								double *y,						/**< Result (dim entries). */
+								BooleanType addToY = BT_FALSE
+								) const;
+
+        /** Multiplies the matrix with a vector.              \n
+         *  \return Temporary object containing the product.  \n
+         */
+        Vector operator*( const Vector& x /**< Vector factor. */ ) const;
+
+        /** Multiplies the matrix with a dense matrix.        \n
+         *  \return Temporary object containing the product.  \n
+         */
+        Matrix operator*( const Matrix& B /**< Matrix factor. */ ) const;
+
+
+        /** Returns the matrix as a dense (symmetric) matrix. */
+        Matrix getDense( ) const;
+
+        /** Copies the block of the given dimensions whose upper left  \n
+         *  corner is (rowIdx,colIdx) into a dense matrix. The block   \n
+         *  may cross the diagonal.                                    \n
+         *                                                             \n
+         *  \return SUCCESSFUL_RETURN                                  \n
+         *          RET_INDEX_OUT_OF_BOUNDS                            \n
+         */
+        returnValue getSubBlock(	uint rowIdx,				/**< First row.          */
+									uint colIdx,				/**< First column.       */
+									uint nR,					/**< Number of rows.     */
+									uint nC,					/**< Number of columns.  */
+									Matrix& block				/**< Output: the block.  */
+									) const;
+
+
+        /** Overwrites the lower triangle by its Cholesky factor L with  \n
+         *  A = L*L^T (also in packed storage). Afterwards, linear       \n
+         *  systems can be solved by solveCholesky. If the matrix is not \n
+         *  positive definite, its leading rows already hold the factor, \n
+         *  i.e. the matrix has to be set up again.                      \n
+         *                                                               \n
+         *  \return SUCCESSFUL_RETURN                                    \n
+         *          RET_MATRIX_NOT_POSITIVE_DEFINITE                     \n
+         */
+        returnValue computeCholeskyDecomposition( );
+
+        /** Solves L*L^T*x = b in place, where L is the packed Cholesky \n
+         *  factor computed by computeCholeskyDecomposition.            \n
+         *                                                              \n
+         *  \return SUCCESSFUL_RETURN                                   \n
+         *          RET_MEMBER_NOT_INITIALISED                          \n
+         */
+        returnValue solveCholesky( double *b /**< Input: rhs, output: solution. */ ) const;
+
+        /** Solves L*L^T*x = b with the packed Cholesky factor.         \n
+         *  \return Temporary object containing the solution.          \n
+         */
+        Vector solveCholesky( const Vector& b /**< Right-hand side. */ ) const;
+
+
+        /** Returns the number of rows and columns. */
+        inline uint getDim( ) const;
+
+        /** Returns the number of stored entries, i.e. dim*(dim+1)/2. */
+        inline uint getNumberOfEntries( ) const;
+
+        /** Returns BT_TRUE if the matrix holds its Cholesky factor. */
+        inline BooleanType isFactorized( ) const;
+
+        /** Returns the packed lower triangle. */
+        inline const double* getPackedPointer( ) const;
+
+        /** Returns the packed lower triangle (for in-place updates). */
+        inline double* getPackedPointer( );
+
+
+        /** Prints the matrix in dense form. \n
+         *  \return SUCCESSFUL_RETURN        \n
+         */
+        returnValue print( ) const;
+
+
+
+    //
+    // PROTECTED MEMBER FUNCTIONS:
+    //
+    protected:
+
+        /** Returns the position of the entry (i,j), j <= i, in element. */
+        inline uint getIndex( uint i, uint j ) const;
+
+
+
+    //
+    // DATA MEMBERS:
+    //
+    protected:
+
+        uint         dim       ;   /**< Number of rows and columns.                  */
+        double      *element   ;   /**< Packed lower triangle (row by row).          */
+        BooleanType  factorized;   /**< Whether element holds the Cholesky factor.   */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+#endif  // ACADO_TOOLKIT_SYMMETRIC_MATRIX_HPP
+
+/*
+ *	end of file
+ */
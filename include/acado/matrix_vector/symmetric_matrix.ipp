@@ -0,0 +1,101 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/matrix_vector/symmetric_matrix.ipp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+inline double& SymmetricMatrix::operator()( uint i, uint j ){
+
+    ASSERT( ( i < dim ) && ( j < dim ) );
+    return element[ getIndex(i,j) ];
+}
+
+
+inline double SymmetricMatrix::operator()( uint i, uint j ) const{
+
+    ASSERT( ( i < dim ) && ( j < dim ) );
+    return element[ getIndex(i,j) ];
+}
+
+
+inline uint SymmetricMatrix::getDim( ) const{
+
+    return dim;
+}
+
+
+inline uint SymmetricMatrix::getNumberOfEntries( ) const{
+
+    return dim*(dim+1)/2;
+}
+
+
+inline BooleanType SymmetricMatrix::isFactorized( ) const{
+
+    return factorized;
+}
+
+
+inline const double* SymmetricMatrix::getPackedPointer( ) const{
+
+    return element;
+}
+
+
+inline double* SymmetricMatrix::getPackedPointer( ){
+
+    return element;
+}
+
+
+inline uint SymmetricMatrix::getIndex( uint i, uint j ) const{
+
+    if( j > i ) return j*(j+1)/2 + i;
+    return i*(i+1)/2 + j;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
@@ -33,6 +33,10 @@
 #define ACADO_TOOLKIT_T_MATRIX_HPP
 
 
+#include <vector>
+#include <algorithm>
+
+
 BEGIN_NAMESPACE_ACADO
 
 /**
@@ -43,6 +47,11 @@ BEGIN_NAMESPACE_ACADO
  *  Implements a templated matrix class.                          \n
  *  The class can be used to represent, e.g., interval matrices,  \n
  *  matrices of symbolic functions, etc..                         \n
+ *                                                                \n
+ *  The elements are stored contiguously (column-wise) in a       \n
+ *  single std::vector<T>. The rows and columns returned by row() \n
+ *  and col() are views into this storage, which address their    \n
+ *  elements through a row and a column stride.                   \n
  *
  *  \author Boris Houska
  */
@@ -87,60 +96,78 @@ public:
    */
   //! @brief Default constructor
   Tmatrix():
-    _nr(0), _nc(0), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(0), _nc(0), _pdata(0), _rstride(1), _cstride(0), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
     {}
-  //! @brief Constructor doing size assignment
+  //! @brief Constructor doing size assignment (a view without storage if alloc is false)
   Tmatrix
     ( const unsigned int nr, const unsigned int nc=1, const bool alloc=true ):
-    _nr(nr), _nc(nc), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
+    _nr(nr), _nc(nc), _pdata(0), _rstride(1), _cstride(nr), _sub(!alloc),
+    _pcol(0), _prow(0), _pblock(0)
     {
-      unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T: 0 );
-        _data.push_back( pvall );
-      }
+      if( alloc ) _data.resize( nr*nc );
+      _attach();
     }
   //! @brief Constructor doing size assignment and element initialization
   template <typename U> Tmatrix
     ( const unsigned int nr, const unsigned int nc, const U&v,
       const bool alloc=true ):
-    _nr(nr), _nc(nc), _sub(!alloc), _pcol(0), _prow(0), _pblock(0)
+    _nr(nr), _nc(nc), _pdata(0), _rstride(1), _cstride(nr), _sub(!alloc),
+    _pcol(0), _prow(0), _pblock(0)
     {
-      unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T(v): 0 );
-        _data.push_back( pvall );
-      }
+      if( alloc ) _data.resize( nr*nc, T(v) );
+      _attach();
     }
   //! @brief Copy Constructor
   Tmatrix
     ( const Tmatrix<T>&M ):
-    _nr(M._nr), _nc(M._nc), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(M._nr), _nc(M._nc), _pdata(0), _rstride(1), _cstride(M._nr), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
     {
-      typename std::vector<T*>::const_iterator it = M._data.begin();
-      for( ; it!=M._data.end(); it++ ){
-        T*pvall = new T(**it);
-        _data.push_back( pvall );
+      if( !M._sub ) _data = M._data;
+      else{
+        _data.reserve( _nr*_nc );
+        for( unsigned int ie=0; ie<_nr*_nc; ie++ )
+          _data.push_back( M._val(ie) );
       }
+      _attach();
     }
   //! @brief Copy Constructor doing type conversion
   template <typename U> Tmatrix
     ( const Tmatrix<U>&M ):
-    _nr(M._nr), _nc(M._nc), _sub(false), _pcol(0), _prow(0), _pblock(0)
+    _nr(M._nr), _nc(M._nc), _pdata(0), _rstride(1), _cstride(M._nr), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
     {
-      typename std::vector<U*>::const_iterator it = M._data.begin();
-      for( ; it!=M._data.end(); it++ ){
-        T*pvall = new T(**it);
-        _data.push_back( pvall );
+      _data.reserve( _nr*_nc );
+      for( unsigned int ie=0; ie<_nr*_nc; ie++ )
+        _data.push_back( T(M._val(ie)) );
+      _attach();
+    }
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+  //! @brief Move Constructor (takes over the storage of M, copies submatrices)
+  Tmatrix
+    ( Tmatrix<T>&&M ):
+    _nr(0), _nc(0), _pdata(0), _rstride(1), _cstride(0), _sub(false),
+    _pcol(0), _prow(0), _pblock(0)
+    {
+      if( !M._sub ){
+        swap( M );
+        return;
       }
+      // submatrices are owned by their parent, i.e. they are copied
+      _nr = M._nr; _nc = M._nc; _cstride = M._nr;
+      _data.reserve( _nr*_nc );
+      for( unsigned int ie=0; ie<_nr*_nc; ie++ )
+        _data.push_back( M._val(ie) );
+      _attach();
     }
+#endif
   //! @brief Destructor
   ~Tmatrix()
     {
       delete _pcol;
       delete _prow;
       delete _pblock;
-      if( !_sub ) _reset();
     }
 
   //! @brief Resets the dimension of a Tmatrix objects
@@ -150,14 +177,27 @@ public:
       delete _pcol;
       delete _prow;
       delete _pblock;
-      if( !_sub ) _reset();
       _nr = nr; _nc = nc; _sub = !alloc;
+      _rstride = 1; _cstride = nr;
       _pcol = _prow = _pblock = 0;
-      unsigned int ne = nr*nc;
-      for( unsigned int ie=0; ie<ne; ie++ ){
-        T*pvall = ( alloc? new T: 0 );
-        _data.push_back( pvall );
-      }
+      _data.clear();
+      if( alloc ) _data.resize( nr*nc );
+      _attach();
+    }
+  //! @brief Exchanges the contents (including the storage) of two matrices
+  void swap
+    ( Tmatrix<T>&M )
+    {
+      std::swap( _nr, M._nr );
+      std::swap( _nc, M._nc );
+      _data.swap( M._data );
+      std::swap( _pdata, M._pdata );
+      std::swap( _rstride, M._rstride );
+      std::swap( _cstride, M._cstride );
+      std::swap( _sub, M._sub );
+      std::swap( _pcol, M._pcol );
+      std::swap( _prow, M._prow );
+      std::swap( _pblock, M._pblock );
     }
   //! @brief Sets/retrieves value of column ic
   Tmatrix<T>& col
@@ -165,8 +205,8 @@ public:
   //! @brief Sets/retrieves value of row ir
   Tmatrix<T>& row
     ( const unsigned int ir );
-  //! @brief Sets/retrieves pointer to entry (ir,ic)
-  T*& pval
+  //! @brief Retrieves pointer to entry (ir,ic)
+  T* pval
     ( const unsigned int ir, const unsigned int ic );
   //! @brief Retrieves number of columns
   unsigned int col() const
@@ -197,6 +237,10 @@ public:
     ( const unsigned int ie ) const;
   Tmatrix<T>& operator=
   ( const Tmatrix<T>&M );
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+  Tmatrix<T>& operator=
+  ( Tmatrix<T>&&M );
+#endif
   Tmatrix<T>& operator=
   ( const T&m );
   template <typename U> Tmatrix<T>& operator+=
@@ -220,8 +264,14 @@ private:
   unsigned int _nr;
   //! @brief Number of columns
   unsigned int _nc;
-  //! @brief Vector of pointers to elements (column-wise storage)
-  std::vector<T*> _data;
+  //! @brief Elements (contiguous column-wise storage, empty for submatrices)
+  std::vector<T> _data;
+  //! @brief Pointer to entry (0,0), either into _data or into the storage of the parent
+  T* _pdata;
+  //! @brief Distance between the entries (ir,ic) and (ir+1,ic)
+  unsigned int _rstride;
+  //! @brief Distance between the entries (ir,ic) and (ir,ic+1)
+  unsigned int _cstride;
   //! @brief Flag indicating whether the current object is a submatrix
   bool _sub;
   //! @brief Pointer to Tmatrix<T> container storing column
@@ -240,11 +290,8 @@ private:
     ( const unsigned int ie );
   const T& _val
     ( const unsigned int ie ) const;
-  //! @brief Returns a pointer to actual value at position ie
-  T*& _pval
-    ( const unsigned int ie );
-  //! @brief Resets the entries in vector _data
-  void _reset();
+  //! @brief Points _pdata to the own storage (unless a submatrix)
+  void _attach();
   //! @brief Returns the number of digits of an unsigned int value
   static unsigned int _digits
     ( unsigned int n );
@@ -256,14 +303,14 @@ template <typename T> inline T&
 Tmatrix<T>::operator()
 ( const unsigned int ir, const unsigned int ic )
 {
-  return _val(ic*_nr+ir);
+  return _val(ir,ic);
 }
 
 template <typename T> inline const T&
 Tmatrix<T>::operator()
 ( const unsigned int ir, const unsigned int ic ) const
 {
-  return _val(ic*_nr+ir);
+  return _val(ir,ic);
 }
 
 template <typename T> inline T&
@@ -284,14 +331,16 @@ template <typename T> inline T&
 Tmatrix<T>::_val
 ( const unsigned int ir, const unsigned int ic )
 {
-  return _val(ic*_nr+ir);
+  ASSERT( ir<_nr && ic<_nc );
+  return _pdata[ir*_rstride+ic*_cstride];
 }
 
 template <typename T> inline const T&
 Tmatrix<T>::_val
 ( const unsigned int ir, const unsigned int ic ) const
 {
-  return _val(ic*_nr+ir);
+  ASSERT( ir<_nr && ic<_nc );
+  return _pdata[ir*_rstride+ic*_cstride];
 }
 
 template <typename T> inline T&
@@ -299,7 +348,8 @@ Tmatrix<T>::_val
 ( const unsigned int ie )
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return *(_data[ie]);
+  if( !_sub ) return _pdata[ie];
+  return _pdata[(ie%_nr)*_rstride+(ie/_nr)*_cstride];
 }
 
 template <typename T> inline const T&
@@ -307,29 +357,21 @@ Tmatrix<T>::_val
 ( const unsigned int ie ) const
 {
   ASSERT( ie<_nr*_nc && ie>=0 );
-  return *(_data[ie]);
+  if( !_sub ) return _pdata[ie];
+  return _pdata[(ie%_nr)*_rstride+(ie/_nr)*_cstride];
 }
 
-template <typename T> inline T*&
+template <typename T> inline T*
 Tmatrix<T>::pval
 ( const unsigned int ir, const unsigned int ic )
 {
-  return _pval(ic*_nr+ir);
-}
-
-template <typename T> inline T*&
-Tmatrix<T>::_pval
-( const unsigned int ie )
-{
-  ASSERT( ie<_nr*_nc && ie>=0 );
-  return _data[ie];
+  return &_val(ir,ic);
 }
 
 template <typename T> inline void
-Tmatrix<T>::_reset()
+Tmatrix<T>::_attach()
 {
-  typename std::vector<T*>::iterator it = _data.begin();
-  for( ; it!=_data.end(); it++ ) delete *it;
+  if( !_sub ) _pdata = ( _data.empty()? 0: &_data[0] );
 }
 
 template <typename T> inline Tmatrix<T>&
@@ -338,15 +380,11 @@ Tmatrix<T>::col
 {
   ASSERT( ic<_nc && ic>=0 );
   if( !_pcol ) _pcol = new Tmatrix<T>( _nr, 1, false );
-  for( unsigned int ir=0; ir<_nr; ir++ ){
-    _pcol->pval(ir,0) = pval(ir,ic);
+  _pcol->_pdata   = _pdata + ic*_cstride;
+  _pcol->_rstride = _rstride;
+  _pcol->_cstride = _cstride;
 #ifdef DEBUG__MATRIX_COL
-    std::cout << ir << " , 0 : " << pval(ir,ic) << " "
-              << _pcol->pval(ir,0) << std::endl;
-#endif
-  }
-#ifdef DEBUG__MATRIX_COL
-  std::cout << std::endl;
+  std::cout << "col " << ic << " : " << _pcol->_pdata << std::endl;
 #endif
   return *_pcol;
 }
@@ -357,15 +395,11 @@ Tmatrix<T>::row
 {
   ASSERT( ir<_nr && ir>=0 );
   if( !_prow ) _prow = new Tmatrix<T>( 1, _nc, false );
-  for( unsigned int ic=0; ic<_nc; ic++ ){
-    _prow->pval(0,ic) = pval(ir,ic);
-#ifdef DEBUG__MATRIX_ROW
-    std::cout << "0 , " << ic << " : " << pval(ir,ic) << " "
-              << _prow->pval(0,ic) << std::endl;
-#endif
-  }
+  _prow->_pdata   = _pdata + ir*_rstride;
+  _prow->_rstride = _rstride;
+  _prow->_cstride = _cstride;
 #ifdef DEBUG__MATRIX_ROW
-  std::cout << std::endl;
+  std::cout << "row " << ir << " : " << _prow->_pdata << std::endl;
 #endif
   return *_prow;
 }
@@ -374,14 +408,31 @@ template <typename T> inline Tmatrix<T>&
 Tmatrix<T>::operator=
 ( const Tmatrix<T>&M )
 {
+  if( this == &M ) return *this;
   if( M._nr!=_nr || M._nc!=_nc )
     resize( M._nr, M._nc );
+  if( !_sub && !M._sub ){
+    std::copy( M._data.begin(), M._data.end(), _data.begin() );
+    return *this;
+  }
   for( unsigned int ie=0; ie!=_nr*_nc; ie++ ){
     _val(ie) = M._val(ie);
   }
   return *this;
 }
 
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+template <typename T> inline Tmatrix<T>&
+Tmatrix<T>::operator=
+( Tmatrix<T>&&M )
+{
+  // submatrices write through to their parent, i.e. they are assigned by copy
+  if( _sub || M._sub ) return operator=( static_cast<const Tmatrix<T>&>( M ) );
+  swap( M );
+  return *this;
+}
+#endif
+
 template <typename T> inline Tmatrix<T>&
 Tmatrix<T>::operator=
 ( const T&m )
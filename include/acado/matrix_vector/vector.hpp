@@ -85,6 +85,12 @@ class Vector : public VectorspaceElement{
         Vector(	const Vector& rhs	/**< Right-hand side object. */
 				);
 
+		#ifdef ACADO_HAS_MOVE_SEMANTICS
+        /** Move constructor (takes over the memory of the right-hand side, which is left empty). */
+        inline Vector(	Vector&& rhs	/**< Right-hand side object. */
+				);
+		#endif
+
         /** Copy constructor (deep copy). */
         Vector(	const VectorspaceElement& rhs	/**< Right-hand side object. */
 				);
@@ -97,6 +103,12 @@ class Vector : public VectorspaceElement{
 		Vector& operator=(	const Vector& rhs	/**< Right-hand side object. */
 							);
 
+		#ifdef ACADO_HAS_MOVE_SEMANTICS
+        /** Move assignment operator (takes over the memory of the right-hand side, which is left empty). */
+		inline Vector& operator=(	Vector&& rhs	/**< Right-hand side object. */
+							);
+		#endif
+
 		Vector& operator=(	FILE *rhs	/**< Right-hand side object. */
 							);
 
@@ -185,6 +197,35 @@ class Vector : public VectorspaceElement{
 };
 
 
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+/** Adds two vectors, accumulating into the storage of the temporary left summand.
+ *  \return Sum of the vectors. */
+inline Vector operator+(	Vector&& lhs,		/**< First summand (temporary).  */
+							const Vector& rhs	/**< Second summand.             */
+							);
+
+/** Adds two vectors, accumulating into the storage of the temporary right summand.
+ *  \return Sum of the vectors. */
+inline Vector operator+(	const Vector& lhs,	/**< First summand.              */
+							Vector&& rhs		/**< Second summand (temporary). */
+							);
+
+/** Adds two temporary vectors, accumulating into the storage of the left summand.
+ *  \return Sum of the vectors. */
+inline Vector operator+(	Vector&& lhs,		/**< First summand (temporary).  */
+							Vector&& rhs		/**< Second summand (temporary). */
+							);
+
+/** Subtracts a vector from a temporary one, re-using the storage of the latter.
+ *  \return Difference of the vectors. */
+inline Vector operator-(	Vector&& lhs,		/**< Minuend (temporary). */
+							const Vector& rhs	/**< Subtrahend.          */
+							);
+
+#endif
+
+
 CLOSE_NAMESPACE_ACADO
 
 
@@ -129,13 +129,11 @@ inline Vector Vector::operator*(	const Matrix& arg
 {
 	ASSERT( getDim( ) == arg.getNumRows( ) );
 
-	uint i,j;
 	Vector result( arg.getNumCols( ) );
-	result.setZero( );
 
-	for( i=0; i<arg.getNumCols( ); ++i )
-		for( j=0; j<arg.getNumRows( ); ++j )
-			result( i ) += operator()( j ) * arg( j,i );
+	acadoGemvT(	arg.getNumRows( ),arg.getNumCols( ),
+				((Matrix&)arg).getDoublePointer( ),element,result.element
+				);
 
 	return result;
 }
@@ -205,6 +203,65 @@ inline Vector Vector::getAbsolute() const {
 }
 
 
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+// (VectorspaceElement( std::move( rhs ) ) would pick the copy constructor
+//  taking a const Vector&, which matches better than the base class)
+inline Vector::Vector( Vector&& rhs ) : VectorspaceElement( )
+{
+	swap( rhs );
+}
+
+
+inline Vector& Vector::operator=( Vector&& rhs )
+{
+    // (the old contents are released with tmp, such that rhs is left empty)
+    if ( this != &rhs ){
+		Vector tmp( std::move( rhs ) );
+		swap( tmp );
+    }
+
+    return *this;
+}
+
+
+inline Vector operator+(	Vector&& lhs,
+							const Vector& rhs
+							)
+{
+	lhs += rhs;
+	return std::move( lhs );
+}
+
+
+inline Vector operator+(	const Vector& lhs,
+							Vector&& rhs
+							)
+{
+	rhs += lhs;
+	return std::move( rhs );
+}
+
+
+inline Vector operator+(	Vector&& lhs,
+							Vector&& rhs
+							)
+{
+	lhs += rhs;
+	return std::move( lhs );
+}
+
+
+inline Vector operator-(	Vector&& lhs,
+							const Vector& rhs
+							)
+{
+	lhs -= rhs;
+	return std::move( lhs );
+}
+
+#endif
+
 
 
 CLOSE_NAMESPACE_ACADO
@@ -35,6 +35,10 @@
 
 #include <acado/utils/acado_utils.hpp>
 
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+#include <utility>
+#endif
+
 
 BEGIN_NAMESPACE_ACADO
 
@@ -91,10 +95,27 @@ class VectorspaceElement
         /** Destructor. */
         virtual ~VectorspaceElement( );
 
-        /** Assignment operator (deep copy). */
+        /** Assignment operator (deep copy). The internal memory is
+		 *  re-used if both objects have the same dimension. */
         VectorspaceElement& operator=(	const VectorspaceElement& rhs	/**< Right-hand side object. */
 										);
 
+		#ifdef ACADO_HAS_MOVE_SEMANTICS
+        /** Move constructor (takes over the memory of the right-hand side, which is left empty). */
+        inline VectorspaceElement(	VectorspaceElement&& rhs	/**< Right-hand side object. */
+							);
+
+        /** Move assignment operator (takes over the memory of the right-hand side, which is left empty). */
+        inline VectorspaceElement& operator=(	VectorspaceElement&& rhs	/**< Right-hand side object. */
+										);
+		#endif
+
+		/** Exchanges the contents of two vector space elements without copying
+		 *  any components.
+		 *  \return SUCCESSFUL_RETURN */
+		inline returnValue swap(	VectorspaceElement& rhs	/**< Object to be exchanged. */
+									);
+
         /** Assignment operator (deep copy). */
         VectorspaceElement& operator<<( double *rhs );
 
@@ -458,6 +479,9 @@ class VectorspaceElement
 
 		double* getDoublePointer( );
 
+		/** Returns a read-only pointer to the components. */
+		const double* getDoublePointer( ) const;
+
 
 
     //
@@ -331,6 +331,46 @@ inline returnValue VectorspaceElement::convert( double *lhs ) const{
 }
 
 
+inline returnValue VectorspaceElement::swap( VectorspaceElement& rhs ){
+
+    uint    tmpDim     = dim;
+    double* tmpElement = element;
+
+    dim         = rhs.dim;
+    element     = rhs.element;
+    rhs.dim     = tmpDim;
+    rhs.element = tmpElement;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+#ifdef ACADO_HAS_MOVE_SEMANTICS
+
+inline VectorspaceElement::VectorspaceElement( VectorspaceElement&& rhs )
+{
+	dim     = rhs.dim;
+	element = rhs.element;
+
+	rhs.dim     = 0;
+	rhs.element = 0;
+}
+
+
+inline VectorspaceElement& VectorspaceElement::operator=( VectorspaceElement&& rhs )
+{
+	// (the old contents are released with tmp, such that rhs is left empty)
+	if ( this != &rhs ){
+		VectorspaceElement tmp( std::move( rhs ) );
+		swap( tmp );
+	}
+
+	return *this;
+}
+
+#endif
+
+
 
 
 CLOSE_NAMESPACE_ACADO
@@ -169,6 +169,17 @@ class BFGSupdate : public ConstantHessian
 
 
 
+        /** Computes the symmetric outer product vv = v*v^T of a block column \n
+         *  vector. Only the blocks on and below the diagonal are multiplied; \n
+         *  the upper blocks are copied as their transposes.                   \n
+         *                                                                     \n
+         *  \return SUCCESSFUL_RETURN                                          \n
+         */
+        returnValue computeSymmetricOuterProduct(	const BlockMatrix &v,	/**< block column vector */
+													BlockMatrix &vv			/**< output: v*v^T       */
+													) const;
+
+
         returnValue getSubBlockLine( const int         &N     ,
                                      const int         &line1 ,
                                      const int         &line2 ,
@@ -79,8 +79,14 @@ class SymmetricConjugateGradientMethod : public ConjugateGradientMethod{
         virtual SparseSolver* clone() const;
 
 
-        /** Sets an index list containing the positions of the \n
-         *  non-zero elements in the matrix  A.
+        /** Sets the row and column indices of the non-zero     \n
+         *  elements in the matrix  A. The elements have to be  \n
+         *  ordered row by row with increasing column indices   \n
+         *  (as stored by a SparseMatrix in CSR format).        \n
+         *                                                      \n
+         *  \return SUCCESSFUL_RETURN                           \n
+         *          RET_MEMBER_NOT_INITIALISED                  \n
+         *          RET_INVALID_ARGUMENTS                       \n
          */
         virtual returnValue setIndices( const int *rowIdx_,
                                         const int *colIdx_  );
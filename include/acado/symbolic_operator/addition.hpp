@@ -293,6 +293,13 @@ public:
      virtual Operator* clone() const;
 
 
+     /** Imports the expression into the given operator table, an \n
+      *  addition of zero is imported as the other argument.       \n
+      *  \return a new reference on the imported node.             \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
      /** Asks the expression for its name.   \n
       *  \return the name of the expression. \n
       */
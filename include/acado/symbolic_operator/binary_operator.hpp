@@ -401,6 +401,38 @@ public:
 
 
 
+     /** Returns the number of arguments of the operator. */
+     virtual int getNumberOfArguments() const;
+
+
+     /** Returns a pointer to the argument with index idx. */
+     virtual Operator* getArgumentPointer( int idx ) const;
+
+
+     /** Replaces the argument with index idx (the operator \n
+      *  takes over the reference on _argument).             \n
+      *  \return SUCCESSFUL_RETURN                           \n
+      *          RET_INDEX_OUT_OF_RANGE                      \n
+      */
+     virtual returnValue setArgumentPointer( int idx, Operator *_argument );
+
+
+
+     /** Imports the expression into the given operator table \n
+      *  (see OperatorTable).                                 \n
+      *  \return a new reference on the imported node.        \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
+     /** Returns the payload which identifies the node in the table of \n
+      *  expression nodes (see Operator::getHashKey()).                \n
+      *  \return BT_TRUE                                              \n
+      */
+     virtual BooleanType getHashKey( int &type, int &index, double &value ) const;
+
+
+
 	/** Sets the name of the variable that is used for code export.   \n
 	 *  \return SUCCESSFUL_RETURN                                     \n
 	 */
@@ -430,12 +462,6 @@ protected:
     Operator *argument2 ;       /**< The second summand.        */
 
 
-    Operator *dargument1;       /**< The derivative of the
-                                   *   first summand.             */
-    Operator *dargument2;       /**< The derivative of the
-                                   *   second summand.            */
-
-
     double *  argument1_result;   /**< The results for the
                                    *   first summand.             */
     double *  argument2_result;   /**< The results for the
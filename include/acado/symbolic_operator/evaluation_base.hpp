@@ -63,6 +63,7 @@ public:
 	virtual void quotient   ( Operator &arg1, Operator &arg2 ) = 0;
 	virtual void power      ( Operator &arg1, Operator &arg2 ) = 0;
 	virtual void powerInt   ( Operator &arg1, int      &arg2 ) = 0;
+	virtual void negation   ( Operator &arg ) = 0;
 
 	virtual void project    ( int      &idx ) = 0;
 	virtual void set        ( double   &arg ) = 0;
@@ -63,6 +63,7 @@ public:
 	virtual void quotient   ( Operator &arg1, Operator &arg2 );
 	virtual void power      ( Operator &arg1, Operator &arg2 );
 	virtual void powerInt   ( Operator &arg1, int      &arg2 );
+	virtual void negation   ( Operator &arg );
 
 	virtual void project    ( int      &idx );
 	virtual void set        ( double   &arg );
@@ -141,6 +142,12 @@ template <typename T> void EvaluationTemplate<T>::powerInt( Operator &arg1, int
 	res = pow( res, arg2 );
 }
 
+template <typename T> void EvaluationTemplate<T>::negation( Operator &arg ){
+
+	arg.evaluate( this );
+	res = -res;
+}
+
 
 template <typename T> void EvaluationTemplate<T>::project( int &idx ){
 
@@ -0,0 +1,183 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file include/acado/symbolic_operator/negation.hpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*    \date 2026
+*/
+
+
+#ifndef ACADO_TOOLKIT_NEGATION_HPP
+#define ACADO_TOOLKIT_NEGATION_HPP
+
+
+#include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Implements the scalar unary minus operator within the symbolic operators family.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *	The class Negation implements the scalar unary minus operator within
+ *	the symbolic operators family. It is created by the simplification
+ *	of the operator table for products with -1 and subtractions from 0.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class Negation : public UnaryOperator{
+
+public:
+
+    /** Default constructor. */
+    Negation();
+
+    /** Default constructor. */
+    Negation( Operator *_argument );
+
+    /** Copy constructor (deep copy). */
+    Negation( const Negation &arg );
+
+    /** Default destructor. */
+    ~Negation();
+
+    /** Assignment Operator (deep copy). */
+    Negation& operator=( const Negation &arg );
+
+	/** Evaluates the expression (templated version) */
+	virtual returnValue evaluate( EvaluationBase *x );
+
+    /** Returns the derivative of the expression with respect     \n
+     *  to the variable var(index).                               \n
+     *  \return The expression for the derivative.                \n
+     *
+     */
+     virtual Operator* differentiate( int index  /**< diff. index    */ );
+
+    /** Substitutes var(index) with the expression sub.           \n
+     *  \return The substituted expression.                       \n
+     *
+     */
+     virtual Operator* substitute( int   index           /**< subst. index    */,
+                                     const Operator *sub /**< the substitution*/);
+
+     /** Provides a deep copy of the expression. \n
+      *  \return a clone of the expression.      \n
+      */
+     virtual Operator* clone() const;
+
+    /** Checks whether the expression is linear in                \n
+     *  (or not depending on) a variable                          \n
+     *  \return BT_FALSE if no linearity is                       \n
+     *                detected                                    \n
+     *          BT_TRUE  otherwise                                \n
+     */
+    virtual BooleanType isLinearIn( int           dim      ,    /**< number of directions  */
+                                    VariableType *varType  ,    /**< the variable types    */
+                                    int          *component,    /**< and their components  */
+                                    BooleanType  *implicit_dep  /**< implicit dependencies */ );
+
+    /** Checks whether the expression is polynomial in            \n
+     *  the specified variables                                   \n
+     *  \return BT_FALSE if the expression is not  polynomial     \n
+     *          BT_TRUE  otherwise                                \n
+     */
+    virtual BooleanType isPolynomialIn( int           dim      ,    /**< number of directions  */
+                                        VariableType *varType  ,    /**< the variable types    */
+                                        int          *component,    /**< and their components  */
+                                        BooleanType  *implicit_dep  /**< implicit dependencies */ );
+
+    /** Checks whether the expression is rational in              \n
+     *  the specified variables                                   \n
+     *  \return BT_FALSE if the expression is not rational        \n
+     *          BT_TRUE  otherwise                                \n
+     */
+    virtual BooleanType isRationalIn( int           dim      ,    /**< number of directions  */
+                                      VariableType *varType  ,    /**< the variable types    */
+                                      int          *component,    /**< and their components  */
+                                      BooleanType  *implicit_dep  /**< implicit dependencies */ );
+
+    /** Returns the monotonicity of the expression.               \n
+     *  \return MT_NONDECREASING                                  \n
+     *          MT_NONINCREASING                                  \n
+     *          MT_NONMONOTONIC                                   \n
+     */
+    virtual MonotonicityType getMonotonicity( );
+
+    /** Returns the curvature of the expression                   \n
+     *  \return CT_CONSTANT                                       \n
+     *          CT_AFFINE                                         \n
+     *          CT_CONVEX                                         \n
+     *          CT_CONCAVE                                        \n
+     *
+     */
+     virtual CurvatureType getCurvature( );
+
+
+//
+//  PROTECTED FUNCTIONS:
+//
+protected:
+
+
+    /** Automatic Differentiation in forward mode on the symbolic \n
+     *  level. This function generates an expression for a        \n
+     *  forward derivative                                        \n
+     *  \return SUCCESSFUL_RETURN                                 \n
+     */
+     virtual Operator* ADforwardProtected( int                dim      , /**< dimension of the seed */
+                                             VariableType      *varType  , /**< the variable types    */
+                                             int               *component, /**< and their components  */
+                                             Operator       **seed     , /**< the forward seed      */
+                                             int                &nNewIS  , /**< the number of new IS  */
+                                             TreeProjection ***newIS    /**< the new IS-pointer    */ );
+
+
+
+    /** Automatic Differentiation in backward mode on the symbolic \n
+     *  level. This function generates an expression for a         \n
+     *  backward derivative                                        \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+     virtual returnValue ADbackwardProtected( int           dim      , /**< number of directions  */
+                                              VariableType *varType  , /**< the variable types    */
+                                              int          *component, /**< and their components  */
+                                              Operator   *seed     , /**< the backward seed     */
+                                              Operator  **df         /**< the result            */ );
+
+
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#endif
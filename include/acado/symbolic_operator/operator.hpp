@@ -66,6 +66,13 @@ public:
     virtual ~Operator();
 
 
+    /** Allocates operators from the OperatorPool. */
+    static void* operator new( size_t size );
+
+    /** Returns operators to the OperatorPool. */
+    static void operator delete( void *ptr, size_t size );
+
+
     /** Sets the argument (note that arg should have dimension 1). */
 
     virtual TreeProjection& operator=( const double      & arg );
@@ -450,8 +457,10 @@ public:
 
 
 
-     /** Provides a deep copy of the expression. \n
-      *  \return a clone of the expression.      \n
+     /** Provides a copy of the expression. The arguments of  \n
+      *  the copy are shared with the original (see share()), \n
+      *  such that cloning is cheap also for large trees.      \n
+      *  \return a clone of the expression.                   \n
       */
      virtual Operator* clone() const = 0;
 
@@ -536,6 +545,73 @@ public:
      virtual Operator* passArgument() const;
 
 
+
+     /** Returns the number of arguments of the operator,    \n
+      *  e.g. 2 for a binary operator and 0 for a variable.  \n
+      *  Intermediate states do not expose their argument.   \n
+      */
+     virtual int getNumberOfArguments() const;
+
+
+     /** Returns a pointer to the argument with index idx    \n
+      *  (without passing ownership).                        \n
+      *  \return the argument or NULL if idx is out of range \n
+      */
+     virtual Operator* getArgumentPointer( int idx ) const;
+
+
+     /** Replaces the argument with index idx. The operator \n
+      *  takes over the reference on _argument and releases  \n
+      *  the argument it held before.                        \n
+      *                                                      \n
+      *  THIS FUNCTION IS FOR INTERNAL USE ONLY.             \n
+      *                                                      \n
+      *  \return SUCCESSFUL_RETURN                           \n
+      *          RET_INDEX_OUT_OF_RANGE                      \n
+      */
+     virtual returnValue setArgumentPointer( int idx, Operator *_argument );
+
+
+     /** Imports the expression into the given operator table, \n
+      *  such that structurally identical sub-expressions are   \n
+      *  represented by one shared node (hash-consing).         \n
+      *  \return a new reference on the imported node.          \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
+     /** Returns a new reference on the node of the process-wide table \n
+      *  of expression nodes which is structurally equal to this node;  \n
+      *  this node and its arguments are registered if necessary. The   \n
+      *  Expression operators build their operators from such nodes,    \n
+      *  such that a sub-expression which is built twice is represented \n
+      *  by one shared node (hash-consing at construction). Nodes which \n
+      *  cannot be shared (e.g. operators with a C function) are cloned.\n
+      */
+     Operator* shareUnique() const;
+
+
+     /** Returns the payload which identifies the node together with   \n
+      *  its name and its arguments in the table of expression nodes    \n
+      *  (see shareUnique()).                                           \n
+      *  \return BT_TRUE  if structurally equal nodes may be shared,    \n
+      *          BT_FALSE otherwise (default).                          \n
+      */
+     virtual BooleanType getHashKey( int &type, int &index, double &value ) const;
+
+
+     /** Registers an additional owner of this node.  \n
+      *  \return this                                 \n
+      */
+     Operator* share();
+
+
+     /** Releases a reference on the node arg, i.e. the node \n
+      *  is deleted if no other owner is left.               \n
+      */
+     static void release( Operator *arg );
+
+
     /** Asks whether all elements are purely symbolic.                \n
       *                                                               \n
       * \return BT_TRUE  if the complete tree is symbolic.            \n
@@ -544,7 +620,10 @@ public:
     virtual BooleanType isSymbolic() const = 0;
 
 
-    int nCount;
+    int nCount;     /**< Number of additional owners of this node (see share()). */
+
+    BooleanType isUnique;   /**< BT_TRUE if the node belongs to the table of  \n
+                             *   expression nodes (see shareUnique()).        */
 
 
 
@@ -0,0 +1,116 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file include/acado/symbolic_operator/operator_pool.hpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_POOL_HPP
+#define ACADO_TOOLKIT_OPERATOR_POOL_HPP
+
+
+#include <acado/utils/acado_utils.hpp>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Pool of fixed size memory blocks for symbolic operators.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  Building expressions creates and destroys a large number of small
+ *  operator objects. The class OperatorPool serves these allocations
+ *  from large chunks, which are cut into blocks of a few size classes
+ *  (multiples of 16 bytes). Released blocks are kept in a free list per
+ *  size class and reused by the next allocation of the same class, i.e.
+ *  allocating and releasing an operator is a pointer swap in most cases.
+ *  Objects larger than the largest size class are allocated by malloc.
+ *
+ *  The pool is shared by all threads and guarded by a lock. The chunks
+ *  are freed at the end of the program, or as soon as the last block
+ *  has been released if operators are still destroyed afterwards.
+ *
+ *  The pool is used by Operator::operator new and Operator::operator
+ *  delete and is not meant to be used directly.
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class OperatorPool{
+
+public:
+
+    /** Returns a block of at least the given size. */
+    static void* allocate( size_t size );
+
+    /** Returns a block obtained by allocate( size ) to the pool. */
+    static void release( void *ptr, size_t size );
+
+    /** Returns the number of blocks which are currently in use. */
+    static int getNumberOfBlocks();
+
+    /** Frees the chunks as soon as no block is in use anymore    \n
+     *  (called at the end of the program).                       \n
+     */
+    static void finish();
+
+
+protected:
+
+    enum{
+        OP_GRANULARITY = 16,      /**< Size classes are multiples of this. */
+        OP_CLASSES     = 16,      /**< Number of size classes.             */
+        OP_CHUNK_SIZE  = 65536    /**< Size of the chunks cut into blocks. */
+    };
+
+    /** Cuts a new chunk into blocks of the given size class. */
+    static void grow( int sizeClass );
+
+    /** Frees all chunks (no block may be in use). */
+    static void freeChunks();
+
+    static void *freeList[OP_CLASSES];  /**< First free block per size class.   */
+    static int   nBlocks;               /**< Number of blocks in use.           */
+    static char **chunk;                /**< The chunks allocated by grow().    */
+    static int   nChunks;               /**< Number of chunks.                  */
+    static BooleanType isFinished;      /**< Whether finish() has been called.  */
+    static volatile long lock;          /**< Guards all members of the pool.    */
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#endif  // ACADO_TOOLKIT_OPERATOR_POOL_HPP
+
+// end of file.
@@ -0,0 +1,428 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+
+/**
+*    \file include/acado/symbolic_operator/operator_table.hpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*    \date 2026
+*/
+
+
+#ifndef ACADO_TOOLKIT_OPERATOR_TABLE_HPP
+#define ACADO_TOOLKIT_OPERATOR_TABLE_HPP
+
+
+#include <acado/symbolic_operator/symbolic_operator_fwd.hpp>
+
+#include <map>
+#include <vector>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/**
+ *	\brief Unique table for the hash-consed representation of symbolic operators.
+ *
+ *	\ingroup BasicDataStructures
+ *
+ *  The class OperatorTable stores one shared node for every structurally
+ *  different sub-expression that has been imported. Operators are
+ *  identified by their name, their (already shared) arguments and a small
+ *  payload (e.g. the exponent of a Power_Int or the value of a constant).
+ *  Consequently, comparing two arguments boils down to comparing pointers.
+ *
+ *  Moreover, the table can promote nodes that are referenced more than
+ *  once to intermediate states, such that a FunctionEvaluationTree
+ *  evaluates, differentiates and exports every shared node only once.
+ *
+ *  All nodes handed out by the table are reference counted (see
+ *  Operator::share() and Operator::release()).
+ *
+ *	\author Boris Houska, Hans Joachim Ferreau
+ */
+class OperatorTable{
+
+public:
+
+    /** Default constructor. */
+    OperatorTable();
+
+    /** Default destructor, releases all nodes of the table. */
+    ~OperatorTable();
+
+
+//
+//  PUBLIC MEMBER FUNCTIONS:
+//  ------------------------
+
+    /** Imports the given expression into the table. Nodes that   \n
+     *  are visited several times during one import are converted \n
+     *  only once, nodes of the table are returned as they are.   \n
+     *  \return a new reference on the shared node.               \n
+     */
+    Operator* import( const Operator *arg );
+
+
+    /** Looks up a node with the same structure as the given one.  \n
+     *  The arguments of the node must already belong to the table. \n
+     *  Before, the node is simplified (see simplify()).            \n
+     *  The table takes over the reference on node.                 \n
+     *  \return a new reference on either node or the equivalent    \n
+     *          node which has been registered before.              \n
+     */
+    Operator* unique( Operator *node        /**< the node to be registered       */,
+                      int       type  = 0   /**< an integer valued payload       */,
+                      int       index = 0   /**< a second integer valued payload */,
+                      double    value = 0.0 /**< a real valued payload           */ );
+
+
+    /** Registers an intermediate state, such that further        \n
+     *  occurrences of its argument can be replaced by the state.  \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue addIntermediateState( TreeProjection *arg );
+
+
+    /** Replaces all nodes which are referenced more than once by  \n
+     *  the given roots by intermediate states. Nodes of previous   \n
+     *  imports (i.e. before the last call of endImport()) which    \n
+     *  are referenced by the given roots are shared with previous  \n
+     *  roots and replaced as well; their previous parents are      \n
+     *  redirected to the new states. Previous roots which have     \n
+     *  become intermediate states can be replaced by               \n
+     *  substituteIntermediateStates().                             \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue promote( int dim, Operator **root );
+
+
+    /** Replaces all given roots which have an intermediate state  \n
+     *  by (a new reference on) this state.                         \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue substituteIntermediateStates( int dim, Operator **root ) const;
+
+
+    /** Rewrites the polynomial parts of the given roots, i.e. the  \n
+     *  sums, products and non-negative integer powers of constants, \n
+     *  variables and non-polynomial sub-expressions, in multivariate \n
+     *  Horner form. The coefficients are collected first; a part is \n
+     *  only replaced if its Horner form needs fewer operations. The \n
+     *  roots are replaced by new references, the old ones released. \n
+     *  \return SUCCESSFUL_RETURN                                   \n
+     */
+    returnValue convertToHornerForm( int dim, Operator **root );
+
+
+    /** Returns BT_TRUE if the given roots reference a node of a   \n
+     *  previous import which is neither a leaf nor an intermediate \n
+     *  state yet. Such nodes are shared with previously imported   \n
+     *  expressions and are promoted by promote().                  \n
+     */
+    BooleanType isSharingPreviousNodes( int dim, Operator **root ) const;
+
+
+    /** Differentiates the given node of the table with respect  \n
+     *  to the variable with the given index. Derivatives are      \n
+     *  stored in the table, such that derivatives of shared       \n
+     *  nodes, as well as repeated requests, are looked up rather  \n
+     *  than rebuilt.                                              \n
+     *  \return a new reference on the derivative (a node of the   \n
+     *          table) or NULL if the node depends on an operator  \n
+     *          which cannot be differentiated symbolically (this  \n
+     *          is not reported, such that the caller can report   \n
+     *          it once).                                          \n
+     */
+    Operator* differentiate( Operator *node, int index );
+
+
+    /** Writes the DAG below the given roots in binary form to a  \n
+     *  file: one record per node (operator name, payload and the  \n
+     *  numbers of its arguments), such that the DAG can be set up \n
+     *  again by read() without building any expression. The       \n
+     *  memoized derivatives of these nodes are written as well.   \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS           \n
+     *          RET_CAN_NOT_WRITE_INTO_FILE                         \n
+     */
+    returnValue write( FILE *file, int dim, Operator **root ) const;
+
+
+    /** Reads a DAG written by write() into the table. The roots   \n
+     *  are returned in a newly allocated array (to be freed by    \n
+     *  the caller), intermediate states get new indices. The      \n
+     *  derivatives are memoized by restoreDerivatives().          \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     *          RET_FILE_HAS_NO_VALID_ENTRIES                       \n
+     */
+    returnValue read( FILE *file, int &dim, Operator **&root );
+
+
+    /** Memoizes the derivatives of the last read(), which refer to \n
+     *  their variables by index; to be called after the variables \n
+     *  of the roots have been enumerated.                         \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue restoreDerivatives();
+
+
+    /** Finishes an import: nodes imported so far are frozen and  \n
+     *  the look-up of source nodes is cleared.                    \n
+     *  \return SUCCESSFUL_RETURN                                  \n
+     */
+    returnValue endImport();
+
+
+    /** Releases all nodes of the table.  \n
+     *  \return SUCCESSFUL_RETURN          \n
+     */
+    returnValue clear();
+
+
+    /** Returns the number of shared nodes in the table. */
+    int getNumberOfNodes() const;
+
+
+
+//
+//  PUBLIC STATIC MEMBER FUNCTIONS:
+//  -------------------------------
+
+    /** Returns a new reference on the node of the process-wide table  \n
+     *  of expression nodes which is structurally equal to arg (see    \n
+     *  Operator::shareUnique()). Unlike the nodes of an OperatorTable, \n
+     *  the nodes of this table are not simplified and are removed     \n
+     *  from the table as soon as their last owner releases them.       \n
+     */
+    static Operator* shareExpression( const Operator *arg );
+
+    /** Registers an additional owner of a node of the expression table. */
+    static void shareExpressionNode( Operator *arg );
+
+    /** Releases a reference on a node of the expression table. If no   \n
+     *  other owner is left, the node is removed from the table.         \n
+     *  \return BT_TRUE if the node has to be deleted by the caller.     \n
+     */
+    static BooleanType releaseExpressionNode( Operator *arg );
+
+    /** Returns the number of nodes in the table of expression nodes. */
+    static int getNumberOfExpressionNodes();
+
+
+
+//
+//  PROTECTED MEMBERS:
+//  ------------------
+
+protected:
+
+    /** Structural key of a shared node. */
+    struct OperatorKey{
+
+        OperatorKey( OperatorName name_, int type_, int index_, double value_,
+                     const Operator *argument1_, const Operator *argument2_ );
+
+        bool operator<( const OperatorKey &arg ) const;
+
+        OperatorName    name     ;
+        int             type     ;
+        int             index    ;
+        double          value    ;
+        const Operator *argument1;
+        const Operator *argument2;
+    };
+
+    typedef std::map< OperatorKey, Operator* >              NodeMap;
+    typedef std::map< const Operator*, Operator* >          MemoMap;
+    typedef std::map< const Operator*, TreeProjection* >    StateMap;
+    typedef std::map< const Operator*, int >                CountMap;
+    typedef std::multimap< const Operator*, Operator* >     ParentMap;
+    typedef std::pair< const Operator*, int >               DerivativeKey;
+    typedef std::map< DerivativeKey, Operator* >            DerivativeMap;
+    typedef std::map< std::vector<int>, double >            Polynomial;
+    typedef std::map< const Operator*, Polynomial >         PolynomialMap;
+
+
+    /** Counts the references on all nodes below arg. */
+    void countReferences( Operator *arg, CountMap &counter, std::vector<Operator*> &order );
+
+    /** Searches the fresh nodes below arg for a shared node of a \n
+     *  previous import (see isSharingPreviousNodes).             \n
+     */
+    BooleanType findPreviousNode( Operator *arg, CountMap &visited ) const;
+
+    /** Rewrites the given node, whose arguments already belong to  \n
+     *  the table: operators with constant arguments are folded,    \n
+     *  identities like x*1, 0+x, x/1, pow(x,1) and -(-x) are       \n
+     *  removed, 0-x and -1*x become the unary negation -x,         \n
+     *  negations are moved towards the root and the arguments of   \n
+     *  additions and products are sorted (constants first, then  \n
+     *  in the order of import).                                    \n
+     *  Only rewrites that do not change the value in floating      \n
+     *  point arithmetic are applied.                               \n
+     *  \return a new reference on the simplified node (the table   \n
+     *          takes over the reference on node in this case) or   \n
+     *          NULL if the node should be registered as it is.     \n
+     */
+    Operator* simplify( Operator *node, int type );
+
+    /** Differentiates a single node by means of the chain rule, \n
+     *  where the derivatives of the arguments are obtained by    \n
+     *  differentiate().                                          \n
+     *  \return a new reference on the derivative or NULL if the \n
+     *          node cannot be differentiated symbolically.       \n
+     */
+    Operator* applyChainRule( Operator *node, int index );
+
+    /** Returns a new reference on the product a*b or on the    \n
+     *  constant 0 if one factor is zero. The table takes over  \n
+     *  the references on a and b.                              \n
+     */
+    Operator* multiply( Operator *a, Operator *b );
+
+    /** Returns a new reference on the quotient a/b or on the   \n
+     *  constant 0 if a is zero. The table takes over the       \n
+     *  references on a and b.                                  \n
+     */
+    Operator* divide( Operator *a, Operator *b );
+
+    /** Returns a new reference on the shared constant value. */
+    Operator* constant( double value );
+
+    /** Registers the given node and returns a new reference on \n
+     *  the negation -node. The table takes over node.           \n
+     */
+    Operator* negate( Operator *node );
+
+    /** Returns BT_TRUE if arg is a DoubleConstant. */
+    BooleanType isConstant( Operator *arg ) const;
+
+    /** Returns BT_TRUE if arg is a Negation -x. */
+    BooleanType isNegation( Operator *arg ) const;
+
+    /** Returns BT_TRUE if the commutative arguments a and b are \n
+     *  in canonical order.                                      \n
+     */
+    BooleanType isOrdered( Operator *a, Operator *b ) const;
+
+    /** Numbers the nodes below arg in topological order. */
+    returnValue collect( Operator *arg, CountMap &id, std::vector<Operator*> &order ) const;
+
+    /** Creates the node for a record of read(); the table takes \n
+     *  over the references on the arguments a and b.            \n
+     *  \return a new reference on the node or NULL if the record \n
+     *          is invalid.                                      \n
+     */
+    Operator* create( const int *record, double value, Operator *a, Operator *b );
+
+    /** Returns the Horner form of the given node (see              \n
+     *  convertToHornerForm()); converted nodes are kept in        \n
+     *  hornerMemo.                                                  \n
+     *  \return a new reference on the converted node.               \n
+     */
+    Operator* hornerize( Operator *node, MemoMap &hornerMemo );
+
+    /** Returns the node with its arguments converted by hornerize(). */
+    Operator* hornerizeArguments( Operator *node, MemoMap &hornerMemo );
+
+    /** Returns the exponent of a power with a constant, non-negative \n
+     *  integer exponent or -1 for any other node.                    \n
+     */
+    int getPolynomialExponent( Operator *node ) const;
+
+    /** Returns BT_TRUE if node is a sum, difference, product or     \n
+     *  integer power of its arguments. Quotients are kept as leaves, \n
+     *  such that the results of divisions are not changed.           \n
+     */
+    BooleanType isPolynomialNode( Operator *node ) const;
+
+    /** Collects the non-constant leaves of the polynomial part below \n
+     *  node and returns the cost of its operations.                  \n
+     */
+    int collectMonomials( Operator *node, CountMap &atom, std::vector<Operator*> &order,
+                          CountMap &visited ) const;
+
+    /** Expands the polynomial part below node in the given leaves; \n
+     *  the expansions of shared nodes are kept in expandMemo.       \n
+     *  \return BT_FALSE if the expansion gets too large.            \n
+     */
+    BooleanType expand( Operator *node, const CountMap &atom, int nAtoms,
+                        Polynomial &p, PolynomialMap &expandMemo ) const;
+
+    /** Multiplies a by b; returns BT_FALSE if the product gets too large. */
+    static BooleanType multiply( const Polynomial &a, const Polynomial &b,
+                                 Polynomial &result );
+
+    /** Builds the Horner form of p in the given leaves (choosing the  \n
+     *  leaf which occurs in most terms first) and adds its cost.      \n
+     *  If atom is NULL, only the cost is determined.                  \n
+     *  \return a new reference on the Horner form (or NULL).         \n
+     */
+    Operator* buildHorner( const Polynomial &p, Operator **atom, int &cost );
+
+    /** Returns the intermediate state for arg or NULL. */
+    TreeProjection* getIntermediateState( const Operator *arg ) const;
+
+    /** Registers arg and its arguments in the table of expression nodes \n
+     *  (see shareExpression()); the nodes already converted during this \n
+     *  call are kept in expressionMemo.                                 \n
+     */
+    static Operator* shareExpression( const Operator *arg, MemoMap &expressionMemo );
+
+
+    NodeMap                nodes   ;   /**< The shared nodes (one reference each).        */
+    MemoMap                memo    ;   /**< Source node -> imported node (current import). */
+    StateMap               states  ;   /**< Argument -> intermediate state.               */
+    CountMap               members ;   /**< All nodes of the table -> order of creation.  */
+    CountMap               fresh   ;   /**< Nodes created since the last endImport().     */
+    ParentMap              parents ;   /**< Argument -> nodes created with this argument. */
+    DerivativeMap          derivatives;/**< (Node, variable index) -> derivative.         */
+
+    std::vector<Operator*> importedDerivatives; /**< (Node, variable, derivative) of the
+                                                 *   last read(), see restoreDerivatives(). */
+
+    static NodeMap        *expressionNodes; /**< The table of expression nodes (see shareExpression()). */
+    static volatile long   expressionLock ; /**< Guards the table of expression nodes.                  */
+
+
+
+private:
+
+    OperatorTable( const OperatorTable &arg );
+    OperatorTable& operator=( const OperatorTable &arg );
+};
+
+
+CLOSE_NAMESPACE_ACADO
+
+
+
+#endif
+
+
+// end of file.
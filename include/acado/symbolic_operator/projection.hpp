@@ -437,6 +437,21 @@ public:
     virtual BooleanType isSymbolic() const;
 
 
+
+     /** Imports the expression into the given operator table \n
+      *  (see OperatorTable).                                 \n
+      *  \return a new reference on the imported node.        \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
+     /** Returns the payload which identifies the node in the table of \n
+      *  expression nodes (see Operator::getHashKey()).                \n
+      *  \return BT_TRUE                                              \n
+      */
+     virtual BooleanType getHashKey( int &type, int &index, double &value ) const;
+
+
 	/** Sets the name of the variable that is used for code export.   \n
 	 *  \return SUCCESSFUL_RETURN                                     \n
 	 */
@@ -36,6 +36,7 @@
     #include <acado/symbolic_operator/evaluation_base.hpp>
     #include <acado/symbolic_operator/evaluation_template.hpp>
     
+    #include <acado/symbolic_operator/operator_pool.hpp>
     #include <acado/symbolic_operator/operator.hpp>
     #include <acado/symbolic_operator/smooth_operator.hpp>
 	#include <acado/symbolic_operator/nonsmooth_operator.hpp>
@@ -50,6 +51,7 @@
     #include <acado/symbolic_operator/cos.hpp>
     #include <acado/symbolic_operator/doubleconstant.hpp>
     #include <acado/symbolic_operator/exp.hpp>
+    #include <acado/symbolic_operator/negation.hpp>
     #include <acado/symbolic_operator/logarithm.hpp>
     #include <acado/symbolic_operator/power.hpp>
     #include <acado/symbolic_operator/powerint.hpp>
@@ -61,6 +63,7 @@
     #include <acado/symbolic_operator/tan.hpp>
     #include <acado/symbolic_operator/projection.hpp>
     #include <acado/symbolic_operator/tree_projection.hpp>
+    #include <acado/symbolic_operator/operator_table.hpp>
 
 
     // -------------------------------------------------------
@@ -64,6 +64,7 @@ BEGIN_NAMESPACE_ACADO
    class Acos                        ;
    class Atan                        ;
    class Exp                         ;
+   class Negation                    ;
    class Power                       ;
    class Logarithm                   ;
 
@@ -71,6 +72,8 @@ BEGIN_NAMESPACE_ACADO
    class Projection                  ;
    class TreeProjection              ;
 
+   class OperatorTable               ;
+
 
 CLOSE_NAMESPACE_ACADO
 
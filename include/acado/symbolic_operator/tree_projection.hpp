@@ -64,6 +64,14 @@ public:
     /** Default constructor */
     TreeProjection( const String &name_ );
 
+    /** Constructor which takes over the reference on the given \n
+     *  argument and assigns a new index to the state (which is  \n
+     *  marked as introduced by an OperatorTable unless          \n
+     *  _hoisted is BT_FALSE).                                   \n
+     */
+    explicit TreeProjection( Operator    *_argument             ,
+                             BooleanType  _hoisted   = BT_TRUE   );
+
     /** Copy constructor (deep copy). */
     TreeProjection( const TreeProjection &arg );
 
@@ -92,6 +100,21 @@ public:
      virtual TreeProjection* cloneTreeProjection() const;
 
 
+     /** Imports the expression into the given operator table \n
+      *  (see OperatorTable).                                 \n
+      *  \return a new reference on the imported node.        \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
+     /** Returns the payload which identifies the node in the table of \n
+      *  expression nodes (see Operator::getHashKey()).                \n
+      *  \return BT_TRUE  if the state has been assigned,             \n
+      *          BT_FALSE otherwise.                                   \n
+      */
+     virtual BooleanType getHashKey( int &type, int &index, double &value ) const;
+
+
 
      /** The function loadIndices passes an IndexList through    \n
       *  the whole expression tree. Whenever a variable gets the \n
@@ -117,6 +140,9 @@ public:
 
 
     /** Checks whether the expression is depending on a variable  \n
+     *  (the entries 2*i and 2*i+1 of implicit_dep contain the      \n
+     *  queried property and the dependency of the state with index \n
+     *  i, respectively; the same holds for the other queries).     \n
      *  \return BT_FALSE if no dependence is detected             \n
      *          BT_TRUE  otherwise                                \n
      *
@@ -197,6 +223,12 @@ public:
      /** Returns the argument or NULL if no intermediate argument available */
      virtual Operator* passArgument() const;
 
+
+     /** Returns BT_TRUE if the state has been introduced by an \n
+      *  OperatorTable rather than by the user.                \n
+      */
+     BooleanType isHoisted() const;
+
 //
 //  PROTECTED FUNCTIONS:
 //
@@ -249,6 +281,7 @@ protected:
         Operator   *argument;
         static int  count   ;
         NeutralElement    ne;
+        BooleanType  hoisted;   /**< BT_TRUE for states introduced by an OperatorTable */
 };
 
 
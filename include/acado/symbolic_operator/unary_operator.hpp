@@ -358,6 +358,38 @@ public:
     virtual BooleanType isSymbolic() const;
 
 
+
+     /** Returns the number of arguments of the operator. */
+     virtual int getNumberOfArguments() const;
+
+
+     /** Returns a pointer to the argument with index idx. */
+     virtual Operator* getArgumentPointer( int idx ) const;
+
+
+     /** Replaces the argument with index idx (the operator \n
+      *  takes over the reference on _argument).             \n
+      *  \return SUCCESSFUL_RETURN                           \n
+      *          RET_INDEX_OUT_OF_RANGE                      \n
+      */
+     virtual returnValue setArgumentPointer( int idx, Operator *_argument );
+
+
+
+     /** Imports the expression into the given operator table \n
+      *  (see OperatorTable).                                 \n
+      *  \return a new reference on the imported node.        \n
+      */
+     virtual Operator* hashCons( OperatorTable *table ) const;
+
+
+     /** Returns the payload which identifies the node in the table of \n
+      *  expression nodes (see Operator::getHashKey()).                \n
+      *  \return BT_TRUE                                              \n
+      */
+     virtual BooleanType getHashKey( int &type, int &index, double &value ) const;
+
+
 //
 //  PROTECTED FUNCTIONS:
 //
@@ -402,7 +434,6 @@ protected:
   protected:
 
     Operator *argument        ;     /**< The argument                         */
-    Operator *dargument       ;     /**< The derivative                       */
     double   *argument_result ;     /**< The results for the argument.        */
     double   *dargument_result;     /**< The results for the first derivative */
     int       bufferSize      ;     /**< The size of the buffer               */
@@ -91,6 +91,7 @@ const int 		defaultLinearAlgebraSolver = HOUSEHOLDER_METHOD;			/**< Default valu
 const int 		defaultAlgebraicRelaxation = ART_ADAPTIVE_POLYNOMIAL;		/**< Default value for specifying how algebraic equations are relaxed within the integrator (possible values: ART_EXPONENTIAL, ART_ADAPTIVE_POLYNOMIAL). */
 const double	defaultRelaxationParameter = 0.5;							/**< Default value for the amount algebraic equations are relaxed within the integrator (possible values: any positive real number). */
 const int       defaultprintIntegratorProfile = BT_FALSE;					/**< Default value for specifying whether a runtime profile of the integrator shall be printed (possible values: BT_TRUE, BT_FALSE). */
+const int       defaultIntegratorMixedPrecision = BT_FALSE;				/**< Default value for specifying whether Runge-Kutta stages are evaluated in single precision, which requires a compiled right-hand side (possible values: BT_TRUE, BT_FALSE). */
 
 // MultiObjectiveAlgorithm
 const int 		defaultParetoFrontDiscretization = 21;						/**< Default value for the number of points of the pareto front (possible values: any postive integer). */
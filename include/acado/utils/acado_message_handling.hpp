@@ -106,6 +106,7 @@ RET_PARAMETER_DIMENSION_MISMATCH,				/**< Incompatible parameter vector dimensio
 RET_DISTURBANCE_DIMENSION_MISMATCH,				/**< Incompatible disturbance vector dimensions. */
 RET_OUTPUT_DIMENSION_MISMATCH,					/**< Incompatible output vector dimensions. */
 RET_MATRIX_NOT_SQUARE,							/**< Operation requires square matrix. */
+RET_MATRIX_NOT_POSITIVE_DEFINITE,				/**< Operation requires positive definite matrix. */
 
 /* Sparse Solver */
 RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR,			/**< Linear system could not be solved with required accuracy. Check whether the system is singular or ill-conditioned. */
@@ -213,6 +214,8 @@ RET_INFEASIBLE_CONSTRAINT,						/**< Infeasible Constraints detected. */
 RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS,		/**< This routine is for symbolic functions only. */
 RET_INFEASIBLE_ALGEBRAIC_CONSTRAINT,			/**< Infeasible algebraic constraints are not allowed and will be ignored. */
 RET_ILLFORMED_ODE,								/**< ODE needs to depend on all differential states. */
+RET_UNABLE_TO_COMPILE_FUNCTION,					/**< The generated code of the function could not be compiled. */
+RET_UNABLE_TO_LOAD_COMPILED_FUNCTION,			/**< The compiled code of the function could not be loaded. */
 
 /* Expression */
 RET_PRECISION_OUT_OF_RANGE,						/**< the requested precision is out of range. */
@@ -39,6 +39,15 @@
 #include <acado/utils/acado_namespace_macros.hpp>
 
 
+/** Defined whenever the compiler supports rvalue references (C++11 or newer). \n
+ *  The dense matrix/vector classes then provide move constructors, move      \n
+ *  assignments and arithmetic operators reusing the storage of temporaries.  \n
+ */
+#if __cplusplus >= 201103L
+    #define ACADO_HAS_MOVE_SEMANTICS
+#endif
+
+
 BEGIN_NAMESPACE_ACADO
 
 
@@ -56,6 +65,12 @@ typedef void (*cFcnPtr)( double* x, double* f, void *userData );
 /** Function pointer type for derivatives given as C source code. */
 typedef void (*cFcnDPtr)( int number, double* x, double* seed, double* f, double* df, void *userData );
 
+/** Function pointer type for functions given as C source code, evaluating nPoints  \n
+ *  points per call. The i-th input of the p-th point is x[i*nPoints+p], the j-th  \n
+ *  result f[j*nPoints+p].                                                           \n
+ */
+typedef void (*cFcnBatchPtr)( int nPoints, double* x, double* f, void *userData );
+
 /** Summarises all possible logical values. */
 enum BooleanType{
 
@@ -99,7 +114,8 @@ enum OperatorName{
     ON_VARIABLE,
     ON_DOUBLE_CONSTANT,
     ON_DIFFERENTIAL_STATE,
-    ON_CEXPRESSION
+    ON_CEXPRESSION,
+    ON_NEGATION
 };
 
 
@@ -143,6 +159,14 @@ enum SubBlockMatrixType{
 };
 
 
+/** Defines the storage formats of sparse matrices. */
+enum SparseStorageFormat{
+
+    SSF_CSR,                /**< Compressed row storage.    */
+    SSF_CSC                 /**< Compressed column storage. */
+};
+
+
 /** Defines all possible relaxation type used in DAE integration routines */
 enum AlgebraicRelaxationType{
 
@@ -433,7 +457,8 @@ enum OptionsName
 	GENERATE_SIMULINK_INTERFACE,
 	GENERATE_MATLAB_INTERFACE,
 	OPERATING_SYSTEM,
-	USE_SINGLE_PRECISION
+	USE_SINGLE_PRECISION,
+	INTEGRATOR_MIXED_PRECISION					/**< This option of the boolean type determines whether the stages of explicit Runge-Kutta integrators are evaluated in single precision (error control and accumulation stay in double precision). It requires a compiled right-hand side (see Function::compile()), otherwise the integration fails with RET_INVALID_OPTION. */
 };
 
 
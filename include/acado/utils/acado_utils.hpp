@@ -81,6 +81,24 @@ returnValue acadoPrintAutoGenerationNotice(	FILE* file,
 double acadoGetTime( );
 
 
+/** Returns a time stamp in processor cycles (in nanoseconds on platforms
+ *  without an accessible cycle counter), e.g. for profiling short code sections.
+ * \return current time stamp */
+unsigned long long acadoGetCycles( );
+
+
+/** Acquires a lock for a short critical section, e.g. the update of a
+ *  process-wide table. The lock variable has to be zero-initialized and
+ *  is spun on, i.e. the critical section must not block or re-enter.
+ *  The lock is implemented for Windows and GNU compatible compilers only;
+ *  other compilers stop with an error instead of building an unsafe lock. */
+void acadoLock( volatile long *lock );
+
+
+/** Releases a lock acquired by acadoLock. */
+void acadoUnlock( volatile long *lock );
+
+
 /** Returns if x is integer-valued.
  */
 BooleanType acadoIsInteger( double x );
@@ -1168,13 +1168,13 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
         for( run1 = 0; run1 < (uint)cp.constraintGradient.getNumRows(); run1++ ){
             for( run2 = 0; run2 < N; run2++ ){
-                cp.constraintGradient.getSubBlock( run1, run2, tmp );
-                for( run3 = 0; run3 < (uint)tmp.getNumRows(); run3++ ){
+                const Matrix &Ci = cp.constraintGradient.getBlock( run1, run2 );
+                for( run3 = 0; run3 < (uint)Ci.getNumRows(); run3++ ){
                     for( run4 = 0; run4 < getNX(); run4++ ){
-                        aux2(run2*getNX()+run4) += denseDualSolution(nF+run+run3)*tmp(run3,run4);
+                        aux2(run2*getNX()+run4) += denseDualSolution(nF+run+run3)*Ci(run3,run4);
                     }
                 }
-                run += tmp.getNumRows();
+                run += Ci.getNumRows();
             }
         }
 
@@ -1207,15 +1207,12 @@ returnValue CondensingBasedCPsolver::expand(	BandedCP& cp
 
         // aux4[...] = x^T denseCP.H + denseCP.g - lambda^T denseCP.A - lambda_bound
 
-        Matrix Gx;
         Vector *lambdaDyn;
         lambdaDyn = new Vector[N-1];
         lambdaDyn[N-2] = aux4[N-2];
 
-        for( run1 = N-2; run1 >= 1; run1-- ){
-            cp.dynGradient.getSubBlock( run1, 0,  Gx );
-            lambdaDyn[run1-1] = (Gx^lambdaDyn[run1]) + aux4[run1-1];
-        }
+        for( run1 = N-2; run1 >= 1; run1-- )
+            lambdaDyn[run1-1] = (cp.dynGradient.getBlock( run1, 0 )^lambdaDyn[run1]) + aux4[run1-1];
 
         cp.lambdaDynamic.init( N-1, 1 );
 
@@ -1378,81 +1375,74 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 	uint run1, run2;
 	uint N = getNumPoints();
 
-	Matrix  Gx;
-	Matrix   G;
 	Matrix tmp;
 
 	for( run1 = 0; run1 < N-1; run1++ )
 	{
 			// DIFFERENTIAL STATES:
 			// --------------------
-			cp.dynGradient.getSubBlock( run1, 0,  Gx );   // Get the sensitivity G_x^i with respect to x
-			
+			const Matrix &Gx = cp.dynGradient.getBlock( run1, 0 );   // Get the sensitivity G_x^i with respect to x
+
 		if ( condensingStatus != COS_FROZEN )
 		{
-			T             .getSubBlock( run1, 0, tmp );   // get the corresponding  C_i .
+			const Matrix &C = T.getBlock( run1, 0 );   // get the corresponding  C_i .
 
-			T.setDense( run1+1, 0, Gx*tmp );		   // compute C_{i+1} := G_x^i * C_i
+			T.setDense( run1+1, 0, Gx*C );		   // compute C_{i+1} := G_x^i * C_i
 
 			// ALGEBRAIC STATES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 1, G );
-
-			for( run2 = 0; run2 <= run1; run2++ ){
-
-				T.getSubBlock( run1, run2+1, tmp );
+			const Matrix &Gxa = cp.dynGradient.getBlock( run1, 1 );
 
-				if( G.getDim() != 0 ){
+			if( Gxa.getDim() != 0 ){
+				for( run2 = 0; run2 <= run1; run2++ ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1, G      );
-					else               T.setDense( run1+1, run2+1, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+1, Gxa );
+					else               T.setDense( run1+1, run2+1, Gx*T.getBlock( run1, run2+1 ) );
 				}
 			}
 
 			// PARAMETERS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 2  ,  G  ); // Get the sensitivity G_p^i with respect to p
-			T             .getSubBlock( run1, N+1, tmp ); // get the corresponding  D_p^i.
+			const Matrix &Gp = cp.dynGradient.getBlock( run1, 2   ); // Get the sensitivity G_p^i with respect to p
+			const Matrix &Dp = T             .getBlock( run1, N+1 ); // get the corresponding  D_p^i.
 
-			if( tmp.getDim() != 0 ){
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1, Gx*tmp + G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+			if( Dp.getDim() != 0 ){
+				if( Gp.getDim() != 0 ){
+					tmp  = Gx*Dp;                           // accumulate in place to avoid
+					tmp += Gp;                              // a temporary for the sum
+					T.setDense( run1+1, N+1, tmp );         // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+				}
 			}
 			else{
-				if( G.getDim() != 0 )
-					T.setDense( run1+1, N+1,          G );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
+				if( Gp.getDim() != 0 )
+					T.setDense( run1+1, N+1,         Gp );   // compute  D_p^{i+1} := G_x^i D_p^i + G_p^i
 			}
 
 			// CONTROLS:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 3, G );
-			for( run2 = 0; run2 <= run1; run2++ ){
-
-				T.getSubBlock( run1, run2+2+N, tmp );
+			const Matrix &Gu = cp.dynGradient.getBlock( run1, 3 );
 
-				if( G.getDim() != 0 ){
+			if( Gu.getDim() != 0 ){
+				for( run2 = 0; run2 <= run1; run2++ ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, G      );
-					else               T.setDense( run1+1, run2+2+N, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+2+N, Gu );
+					else               T.setDense( run1+1, run2+2+N, Gx*T.getBlock( run1, run2+2+N ) );
 				}
 			}
 
 			// DISTURBANCES:
 			// --------------------
 
-			cp.dynGradient.getSubBlock( run1, 4, G );
-
-			for( run2 = 0; run2 <= run1; run2++ ){
-
-				T.getSubBlock( run1, run2+1+2*N, tmp );
+			const Matrix &Gw = cp.dynGradient.getBlock( run1, 4 );
 
-				if( G.getDim() != 0 ){
+			if( Gw.getDim() != 0 ){
+				for( run2 = 0; run2 <= run1; run2++ ){
 
-					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, G      );
-					else               T.setDense( run1+1, run2+1+2*N, Gx*tmp );
+					if( run1 == run2 ) T.setDense( run1+1, run2+1+2*N, Gw );
+					else               T.setDense( run1+1, run2+1+2*N, Gx*T.getBlock( run1, run2+1+2*N ) );
 				}
 			}
 		}
@@ -1460,16 +1450,16 @@ returnValue CondensingBasedCPsolver::computeCondensingOperator(	BandedCP& cp
 		// RESIDUUM:
 		// --------------------
 
-		cp.dynResiduum.getSubBlock( run1, 0,  G  );   // Get the residuum  b^i
-		d             .getSubBlock( run1, 0, tmp );   // get the corresponding  d^i.
+		const Matrix &b  = cp.dynResiduum.getBlock( run1, 0 );   // Get the residuum  b^i
+		const Matrix &di = d             .getBlock( run1, 0 );   // get the corresponding  d^i.
 
-		if( tmp.getDim() != 0 ){
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, Gx*tmp + G );   // compute  d^{i+1} := G_x^i d^i + b^i
+		if( di.getDim() != 0 ){
+			if( b.getDim() != 0 )
+				d.setDense( run1+1, 0, Gx*di + b );   // compute  d^{i+1} := G_x^i d^i + b^i
 		}
 		else{
-			if( G.getDim() != 0 )
-				d.setDense( run1+1, 0, G );   // compute  d^{i+1} := b^i
+			if( b.getDim() != 0 )
+				d.setDense( run1+1, 0, b );   // compute  d^{i+1} := b^i
 		}
 	}
 
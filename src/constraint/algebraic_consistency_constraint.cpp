@@ -327,7 +327,7 @@ returnValue AlgebraicConsistencyConstraint::evaluateSensitivities( int &count,
                                                                    const BlockMatrix &seed_,
                                                                    BlockMatrix &hessian ){
 
-    int run3;
+    int run1, run3;
     const int N  = grid.getNumPoints();
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
     if( numberOfStages != counter ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
@@ -347,256 +347,27 @@ returnValue AlgebraicConsistencyConstraint::evaluateSensitivities( int &count,
         // EVALUATION OF THE SENSITIVITIES:
         // --------------------------------
 
-        int run1, run2;
+        // only the last nc components are the consistency conditions:
+        const int nf = fcn[stageIdx].getDim();
 
-        double *bseed1 = new double[fcn[stageIdx].getDim()];
-        double *bseed2 = new double[fcn[stageIdx].getDim()];
-        double *R      = new double[fcn[stageIdx].getDim()];
-        double *J      = new double[fcn[stageIdx].getNumberOfVariables() +1];
-        double *H      = new double[fcn[stageIdx].getNumberOfVariables() +1];
-        double *fseed  = new double[fcn[stageIdx].getNumberOfVariables() +1];
+        double *bseed = new double[nf];
 
-        for( run1 = 0; run1 < fcn[stageIdx].getDim()-nc; run1++ ){
-            bseed1[run1] = 0.0;
-            bseed2[run1] = 0.0;
-        }
-
-        for( run1 = 0; run1 < nc; run1++ ){
-            bseed1[fcn[stageIdx].getDim() - nc + run1] = seed(run1,0);
-            bseed2[fcn[stageIdx].getDim() - nc + run1] = 0.0;
-        }
-
-        for( run1 = 0; run1 < fcn[stageIdx].getNumberOfVariables()+1; run1++ )
-            fseed[run1] = 0.0;
-
-        Matrix Dx ( nc, nx );
-        Matrix Dxa( nc, na );
-        Matrix Dp ( nc, np );
-        Matrix Du ( nc, nu );
-        Matrix Dw ( nc, nw );
-
-        Matrix Hx ( nx, nx );
-        Matrix Hxa( nx, na );
-        Matrix Hp ( nx, np );
-        Matrix Hu ( nx, nu );
-        Matrix Hw ( nx, nw );
-
-        for( run2 = 0; run2 < nx; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dx( run1, run2 ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( nx > 0 ){
-
-            dBackward.setDense( run3, run3, Dx );
-
-            if( nx > 0 ) hessian.addDense( run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( na, nx );
-        Hxa.init( na, na );
-        Hp.init ( na, np );
-        Hu.init ( na, nu );
-        Hw.init ( na, nw );
-
-        for( run2 = nx; run2 < nx+na; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dxa( run1, run2-nx ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( na > 0 ){
-
-            dBackward.setDense( run3, N+run3, Dxa );
-
-            if( nx > 0 ) hessian.addDense( N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( np, nx );
-        Hxa.init( np, na );
-        Hp.init ( np, np );
-        Hu.init ( np, nu );
-        Hw.init ( np, nw );
-
-        for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dp( run1, run2-nx-na ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
+        for( run1 = 0; run1 < nf-nc; run1++ )
+            bseed[run1] = 0.0;
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( np > 0 ){
-
-            dBackward.setDense( run3, 2*N+run3, Dp );
-
-            if( nx > 0 ) hessian.addDense( 2*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 2*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 2*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 2*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 2*N+run3, 4*N + run3, Hw  );
-        }
-
-
-        Hx.init ( nu, nx );
-        Hxa.init( nu, na );
-        Hp.init ( nu, np );
-        Hu.init ( nu, nu );
-        Hw.init ( nu, nw );
-
-        for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Du( run1, run2-nx-na-np ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
+        for( run1 = 0; run1 < nc; run1++ )
+            bseed[nf - nc + run1] = seed(run1,0);
 
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( nu > 0 ){
-
-            dBackward.setDense( run3, 3*N+run3, Du );
-
-            if( nx > 0 ) hessian.addDense( 3*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 3*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 3*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 3*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 3*N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( nw, nx );
-        Hxa.init( nw, na );
-        Hp.init ( nw, np );
-        Hu.init ( nw, nu );
-        Hw.init ( nw, nw );
-
-        for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[stageIdx][run2]] = 1.0;
-            fcn[stageIdx].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dw( run1, run2-nx-na-np-nu ) = R[fcn[stageIdx].getDim() - nc + run1];
-            fseed[y_index[stageIdx][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[stageIdx].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[stageIdx].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[stageIdx][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[stageIdx][run1]];
-        }
-
-        if( nw > 0 ){
+        Matrix D, H;
 
-            dBackward.setDense( run3, 4*N+run3, Dw );
+        returnValue returnvalue = computeSecondOrderDerivatives( fcn[stageIdx], run3, y_index[stageIdx],
+                                                                 bseed, nf-nc, nc, D, H );
+        delete[] bseed;
 
-            if( nx > 0 ) hessian.addDense( 4*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 4*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 4*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 4*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
-        }
+        if( returnvalue != SUCCESSFUL_RETURN )
+            return ACADOERROR(returnvalue);
 
-        delete[] bseed1;
-        delete[] bseed2;
-        delete[] R     ;
-        delete[] J     ;
-        delete[] H     ;
-        delete[] fseed ;
+        setSecondOrderBlocks( D, H, run3, run3, N, hessian );
 
         if( run3 == breakPoints[stageIdx+1] ) stageIdx++;
     }
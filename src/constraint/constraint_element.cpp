@@ -749,6 +749,144 @@ returnValue ConstraintElement::initializeEvaluationPoints( const OCPiterate& ite
 	return SUCCESSFUL_RETURN;
 }
 
+returnValue ConstraintElement::computeSecondOrderDerivatives( Function &function,
+                                                              int       number,
+                                                              const int *index,
+                                                              double   *bseed,
+                                                              int       firstRow,
+                                                              int       nc,
+                                                              Matrix   &D,
+                                                              Matrix   &H ){
+
+    int run1, run2, run3;
+
+    const int n = function.getDim();
+    const int N = function.getNumberOfVariables()+1;
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    D.init( nc, ny );
+    H.init( ny, ny );
+    D.setAll( 0.0 );
+    H.setAll( 0.0 );
+
+    // FIRST ORDER DERIVATIVES:
+    // ------------------------
+    if( nc < ny ){
+
+        double *seed = (double*)calloc(n+1,sizeof(double));
+        double *J    = (double*)calloc(N  ,sizeof(double));
+
+        for( run1 = 0; run1 < nc && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+
+            for( run2 = 0; run2 < N; run2++ )
+                J[run2] = 0.0;
+
+            seed[firstRow+run1] = 1.0;
+            returnvalue = function.AD_backward( number, seed, J );
+            seed[firstRow+run1] = 0.0;
+
+            for( run2 = 0; run2 < ny; run2++ )
+                D( run1, run2 ) = J[index[run2]];
+        }
+        free( seed );
+        free( J    );
+    }
+    else{
+
+        double *seed = (double*)calloc(N  ,sizeof(double));
+        double *R    = (double*)calloc(n+1,sizeof(double));
+
+        for( run2 = 0; run2 < ny && returnvalue == SUCCESSFUL_RETURN; run2++ ){
+
+            seed[index[run2]] = 1.0;
+            returnvalue = function.AD_forward( number, seed, R );
+            seed[index[run2]] = 0.0;
+
+            for( run1 = 0; run1 < nc; run1++ )
+                D( run1, run2 ) = R[firstRow+run1];
+        }
+        free( seed );
+        free( R    );
+    }
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+
+    // SECOND ORDER DERIVATIVES:
+    // -------------------------
+    SparsityPattern pattern;
+
+    returnvalue = function.getHessianSparsityPattern( pattern );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    double *values = (double*)calloc(pattern.getNumberOfNonzeros()+1,sizeof(double));
+
+    returnvalue = function.AD_hessian( number, bseed, values );
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        const int *rowStart = pattern.getRowStart();
+        const int *colIndex = pattern.getColIndex();
+
+        int *position = (int*)calloc(N,sizeof(int));
+
+        for( run1 = 0; run1 < N; run1++ )
+            position[run1] = -1;
+        for( run1 = 0; run1 < ny; run1++ )
+            position[index[run1]] = run1;
+
+        for( run1 = 0; run1 < N; run1++ ){
+
+            if( position[run1] < 0 ) continue;
+
+            for( run3 = rowStart[run1]; run3 < rowStart[run1+1]; run3++ ){
+
+                const int i = position[run1];
+                const int j = position[colIndex[run3]];
+
+                if( j < 0 ) continue;
+
+                H( i, j ) = -values[run3];
+                H( j, i ) = -values[run3];
+            }
+        }
+        free( position );
+    }
+    free( values );
+
+    return returnvalue;
+}
+
+
+void ConstraintElement::setSecondOrderBlocks( const Matrix &D, const Matrix &H,
+                                              int dRow, int pos, int N, BlockMatrix &hessian ){
+
+    int run1, run2;
+
+    // the variables are ordered as x, xa, p, u, w:
+    const int size[5] = { nx, na, np, nu, nw };
+    int offset[5];
+
+    offset[0] = 0;
+    for( run1 = 1; run1 < 5; run1++ )
+        offset[run1] = offset[run1-1] + size[run1-1];
+
+    for( run1 = 0; run1 < 5; run1++ ){
+
+        if( size[run1] == 0 ) continue;
+
+        dBackward.setDense( dRow, run1*N+pos, D.getCols( offset[run1], offset[run1]+size[run1]-1 ) );
+
+        const Matrix Hrow = H.getRows( offset[run1], offset[run1]+size[run1]-1 );
+
+        for( run2 = 0; run2 < 5; run2++ )
+            if( size[run2] > 0 )
+                hessian.addDense( run1*N+pos, run2*N+pos,
+                                  Hrow.getCols( offset[run2], offset[run2]+size[run2]-1 ) );
+    }
+}
+
+
 returnValue ConstraintElement::get(Function& function_, Matrix& lb_, Matrix& ub_)
 {
 	if ( fcn == NULL )
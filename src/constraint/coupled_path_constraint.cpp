@@ -231,277 +231,36 @@ returnValue CoupledPathConstraint::evaluateSensitivities( const Matrix &seed, Bl
     // EVALUATION OF THE SENSITIVITIES:
     // --------------------------------
 
-    int run1, run2, run3;
+    int run1, run3;
 
     const int nc = getNC();
     const int N  = grid.getNumPoints();
 
     ASSERT( (int) seed.getNumRows() == nc );
 
-    for( run3 = 0; run3 < N; run3++ ){
-   // printf("Test: ,%d \n",fcn[run3].getNumberOfVariables() +1);
-
-    }
-
     dBackward.init( 1, 5*N );
 
-    for( run3 = 0; run3 < N; run3++ ){
-
-    double *bseed1 = new double[nc];
-    double *bseed2 = new double[nc];
-    double *R      = new double[nc];
-
-    double *J1      = new double[fcn[run3].getNumberOfVariables() +1];
-    double *H1      = new double[fcn[run3].getNumberOfVariables() +1];
-    double *fseed1  = new double[fcn[run3].getNumberOfVariables() +1];
-
-    for( run1 = 0; run1 < nc; run1++ ){
-        bseed1[run1] = seed(run1,0);
-        bseed2[run1] = 0.0;
-    }
-    for( run1 = 0; run1 < fcn[run3].getNumberOfVariables()+1; run1++ )
-        fseed1[run1] = 0.0;
-
-    Matrix Dx ( nc, nx );
-    Matrix Dxa( nc, na );
-    Matrix Dp ( nc, np );
-    Matrix Du ( nc, nu );
-    Matrix Dw ( nc, nw );
-   
-    Matrix Hx ( nx, nx );
-    Matrix Hxa( nx, na );
-    Matrix Hp ( nx, np );
-    Matrix Hu ( nx, nu );
-    Matrix Hw ( nx, nw );
-     
-    // DERIVATIVES W.R.T. STATES
-    for( run2 = 0; run2 < nx; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed1[y_index[0][run2]] = 1.0;
-		fcn[run3].AD_forward( 0, fseed1, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dx( run1, run2 ) = R[run1];
-        fseed1[y_index[0][run2]] = 0.0;
-
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[run3].getNumberOfVariables(); run1++ ){
-            J1[run1] = 0.0;
-            H1[run1] = 0.0;
-        }
-
-        fcn[run3].AD_backward2( 0, bseed1, bseed2, J1, H1 );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H1[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H1[y_index[0][run1]];
-    }
-
-    if( nx > 0 ){
-
-        dBackward.setDense( 0, run3, Dx );
-
-            if( nx > 0 ) hessian.addDense( run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( run3, 4*N + run3, Hw  );
-    }
-
-    Hx.init ( na, nx );
-    Hxa.init( na, na );
-    Hp.init ( na, np );
-    Hu.init ( na, nu );
-    Hw.init ( na, nw );
-
-    // DERIVATIVES W.R.T. ALGEBRAIC STATES
-
-    for( run2 = nx; run2 < nx+na; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed1[y_index[0][run2]] = 1.0;
-        fcn[run3].AD_forward( 0, fseed1, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dxa( run1, run2-nx ) = R[run1];
-        fseed1[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[run3].getNumberOfVariables(); run1++ ){
-            J1[run1] = 0.0;
-            H1[run1] = 0.0;
-        }
-
-        fcn[run3].AD_backward2( 0, bseed1, bseed2, J1, H1 );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H1[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H1[y_index[0][run1]];
-    }
-
-    if( na > 0 ){
-
-         dBackward.setDense( 0, N+run3, Dxa );
+    double *bseed = new double[nc];
 
-            if( nx > 0 ) hessian.addDense( N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( N+run3, 4*N + run3, Hw  );
-    }
-
-
-    Hx.init ( np, nx );
-    Hxa.init( np, na );
-    Hp.init ( np, np );
-    Hu.init ( np, nu );
-    Hw.init ( np, nw );
-    
-    //DERIVATIVES W.R.T. THE PARAMETERS
-
-    for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed1[y_index[0][run2]] = 1.0;
-        fcn[run3].AD_forward( 0, fseed1, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dp( run1, run2-nx-na ) = R[run1];
-        fseed1[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[run3].getNumberOfVariables(); run1++ ){
-            J1[run1] = 0.0;
-            H1[run1] = 0.0;
-        }
-
-        fcn[run3].AD_backward2( 0, bseed1, bseed2, J1, H1 );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H1[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H1[y_index[0][run1]];
-    }
-
-    if( np > 0 ){
-            dBackward.setDense( 0, 2*N+run3, Dp );
-            if( nx > 0 ) hessian.addDense( 2*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 2*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 2*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 2*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 2*N+run3, 4*N + run3, Hw  );
-    }
-
-    Hx.init ( nu, nx );
-    Hxa.init( nu, na );
-    Hp.init ( nu, np );
-    Hu.init ( nu, nu );
-    Hw.init ( nu, nw );
-
-    //DERIVATIVES W.R.T. THE CONTROLS 
-
-    for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed1[y_index[0][run2]] = 1.0;
-        fcn[run3].AD_forward( 0, fseed1, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Du( run1, run2-nx-na-np ) = R[run1];
-        fseed1[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[run3].getNumberOfVariables(); run1++ ){
-            J1[run1] = 0.0;
-            H1[run1] = 0.0;
-        }
-
-        fcn[run3].AD_backward2( 0, bseed1, bseed2, J1, H1 );
+    for( run1 = 0; run1 < nc; run1++ )
+        bseed[run1] = seed(run1,0);
 
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H1[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H1[y_index[0][run1]];
-    }
-
-    if( nu > 0 ){
+    for( run3 = 0; run3 < N; run3++ ){
 
-        dBackward.setDense( 0, 3*N+run3, Du );
+        Matrix D, H;
 
-            if( nx > 0 ) hessian.addDense( 3*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 3*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 3*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 3*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 3*N+run3, 4*N + run3, Hw  );
-    }
+        returnValue returnvalue = computeSecondOrderDerivatives( fcn[run3], 0, y_index[0], bseed, 0, nc, D, H );
 
-    
-    Hx.init ( nw, nx );
-    Hxa.init( nw, na );
-    Hp.init ( nw, np );
-    Hu.init ( nw, nu );
-    Hw.init ( nw, nw );
-
-
-    for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-        // FIRST ORDER DERIVATIVES:
-        // ------------------------
-        fseed1[y_index[0][run2]] = 1.0;
-        fcn[run3].AD_forward( 0, fseed1, R );
-        for( run1 = 0; run1 < nc; run1++ )
-            Dw( run1, run2-nx-na-np-nu ) = R[run1];
-        fseed1[y_index[0][run2]] = 0.0;
-
-        // SECOND ORDER DERIVATIVES:
-        // -------------------------
-        for( run1 = 0; run1 <= fcn[run3].getNumberOfVariables(); run1++ ){
-            J1[run1] = 0.0;
-            H1[run1] = 0.0;
+        if( returnvalue != SUCCESSFUL_RETURN ){
+            delete[] bseed;
+            return ACADOERROR(returnvalue);
         }
 
-        fcn[run3].AD_backward2( 0, bseed1, bseed2, J1, H1 );
-
-        for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H1[y_index[0][run1]];
-        for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H1[y_index[0][run1]];
-        for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H1[y_index[0][run1]];
+        setSecondOrderBlocks( D, H, 0, run3, N, hessian );
     }
 
-    if( nw > 0 ){
+    delete[] bseed;
 
-         dBackward.setDense( 0, 4*N+run3, Dw );
-
-            if( nx > 0 ) hessian.addDense( 4*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 4*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 4*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 4*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
-    }
-
-
-    delete[] bseed1;
-    delete[] bseed2;
-    delete[] R     ;
-    delete[] J1    ;
-    delete[] H1    ;
-    delete[] fseed1;
-
-    }
-   
     return SUCCESSFUL_RETURN;
 }
 
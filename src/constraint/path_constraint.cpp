@@ -86,17 +86,47 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
     residuumL.init(T+1,1);
     residuumU.init(T+1,1);
 
+    // EVALUATE THE FUNCTION AT ALL GRID POINTS AT ONCE:
+    // -------------------------------------------------
+    const int nv = fcn[0].getNumberOfVariables()+1;
+
+    // (symbolic functions are compiled, such that all points are
+    //  evaluated by one sweep of the tape)
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    if( fcn[0].isSymbolic() == BT_TRUE && fcn[0].isCompiled() == BT_FALSE )
+        returnvalue = fcn[0].compile();
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return ACADOERROR(returnvalue);
+
+    double *x      = new double[nv*(T+1)];
+    double *result = new double[nc*(T+1)];
+
+    for( run1 = 0; run1 <= T && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+
+		z[0].setZ( run1, iter );
+
+        returnvalue = z[0].copyToBatch( x, nv, T+1, run1 );
+    }
+
+    if( returnvalue == SUCCESSFUL_RETURN )
+        returnvalue = fcn[0].evaluateBatch( 0, T+1, x, result );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        delete[] x;
+        delete[] result;
+        return ACADOERROR(returnvalue);
+    }
+
     for( run1 = 0; run1 <= T; run1++ ){
 
         Matrix resL( nc, 1 );
         Matrix resU( nc, 1 );
 
-		z[0].setZ( run1, iter );
-		Vector result = fcn[0].evaluate( z[0],run1 );
-
         for( run2 = 0; run2 < nc; run2++ ){
-             resL( run2, 0 ) = lb[run1][run2] - result(run2);
-             resU( run2, 0 ) = ub[run1][run2] - result(run2);
+             resL( run2, 0 ) = lb[run1][run2] - result[run2*(T+1)+run1];
+             resU( run2, 0 ) = ub[run1][run2] - result[run2*(T+1)+run1];
         }
 
         // STORE THE RESULTS:
@@ -105,6 +135,9 @@ returnValue PathConstraint::evaluate( const OCPiterate& iter ){
         residuumU.setDense( run1, 0, resU );
     }
 
+    delete[] x;
+    delete[] result;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -189,7 +222,7 @@ returnValue PathConstraint::evaluateSensitivities(){
 
 returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix &seed_, BlockMatrix &hessian ){
 
-    int run3;
+    int run1, run3;
     const int N  = grid.getNumPoints();
     if( fcn == 0 ) return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
 
@@ -197,6 +230,8 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
 
     dBackward.init( N, 5*N );
 
+    double *bseed = new double[nc];
+
     for( run3 = 0; run3 < N; run3++ ){
 
         Matrix seed;
@@ -206,253 +241,22 @@ returnValue PathConstraint::evaluateSensitivities( int &count, const BlockMatrix
         // EVALUATION OF THE SENSITIVITIES:
         // --------------------------------
 
-        int run1, run2;
-
-        double *bseed1 = new double[nc];
-        double *bseed2 = new double[nc];
-        double *R      = new double[nc];
-        double *J      = new double[fcn[0].getNumberOfVariables() +1];
-        double *H      = new double[fcn[0].getNumberOfVariables() +1];
-        double *fseed  = new double[fcn[0].getNumberOfVariables() +1];
-
-        for( run1 = 0; run1 < nc; run1++ ){
-            bseed1[run1] = seed(run1,0);
-            bseed2[run1] = 0.0;
-        }
-
-        for( run1 = 0; run1 < fcn[0].getNumberOfVariables()+1; run1++ )
-            fseed[run1] = 0.0;
-
-        Matrix Dx ( nc, nx );
-        Matrix Dxa( nc, na );
-        Matrix Dp ( nc, np );
-        Matrix Du ( nc, nu );
-        Matrix Dw ( nc, nw );
-
-        Matrix Hx ( nx, nx );
-        Matrix Hxa( nx, na );
-        Matrix Hp ( nx, np );
-        Matrix Hu ( nx, nu );
-        Matrix Hw ( nx, nw );
-
-        for( run2 = 0; run2 < nx; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dx( run1, run2 ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( nx > 0 ){
-
-            dBackward.setDense( run3, run3, Dx );
-
-            if( nx > 0 ) hessian.addDense( run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( na, nx );
-        Hxa.init( na, na );
-        Hp.init ( na, np );
-        Hu.init ( na, nu );
-        Hw.init ( na, nw );
-
-        for( run2 = nx; run2 < nx+na; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dxa( run1, run2-nx ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( na > 0 ){
-
-            dBackward.setDense( run3, N+run3, Dxa );
-
-            if( nx > 0 ) hessian.addDense( N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( np, nx );
-        Hxa.init( np, na );
-        Hp.init ( np, np );
-        Hu.init ( np, nu );
-        Hw.init ( np, nw );
-
-        for( run2 = nx+na; run2 < nx+na+np; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dp( run1, run2-nx-na ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( np > 0 ){
-
-            dBackward.setDense( run3, 2*N+run3, Dp );
-
-            if( nx > 0 ) hessian.addDense( 2*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 2*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 2*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 2*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 2*N+run3, 4*N + run3, Hw  );
-        }
-
-
-        Hx.init ( nu, nx );
-        Hxa.init( nu, na );
-        Hp.init ( nu, np );
-        Hu.init ( nu, nu );
-        Hw.init ( nu, nw );
-
-        for( run2 = nx+na+np; run2 < nx+na+np+nu; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Du( run1, run2-nx-na-np ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
-
-        if( nu > 0 ){
-
-            dBackward.setDense( run3, 3*N+run3, Du );
-
-            if( nx > 0 ) hessian.addDense( 3*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 3*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 3*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 3*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 3*N+run3, 4*N + run3, Hw  );
-        }
-
-        Hx.init ( nw, nx );
-        Hxa.init( nw, na );
-        Hp.init ( nw, np );
-        Hu.init ( nw, nu );
-        Hw.init ( nw, nw );
-
-        for( run2 = nx+na+np+nu; run2 < nx+na+np+nu+nw; run2++ ){
-
-            // FIRST ORDER DERIVATIVES:
-            // ------------------------
-            fseed[y_index[0][run2]] = 1.0;
-            fcn[0].AD_forward( run3, fseed, R );
-            for( run1 = 0; run1 < nc; run1++ )
-                Dw( run1, run2-nx-na-np-nu ) = R[run1];
-            fseed[y_index[0][run2]] = 0.0;
-
-            // SECOND ORDER DERIVATIVES:
-            // -------------------------
-            for( run1 = 0; run1 <= fcn[0].getNumberOfVariables(); run1++ ){
-                J[run1] = 0.0;
-                H[run1] = 0.0;
-            }
-
-            fcn[0].AD_backward2( run3, bseed1, bseed2, J, H );
-
-            for( run1 = 0          ; run1 < nx            ; run1++ ) Hx ( run2-nx-na-np-nu, run1             ) = -H[y_index[0][run1]];
-            for( run1 = nx         ; run1 < nx+na         ; run1++ ) Hxa( run2-nx-na-np-nu, run1-nx          ) = -H[y_index[0][run1]];
-            for( run1 = nx+na      ; run1 < nx+na+np      ; run1++ ) Hp ( run2-nx-na-np-nu, run1-nx-na       ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np   ; run1 < nx+na+np+nu   ; run1++ ) Hu ( run2-nx-na-np-nu, run1-nx-na-np    ) = -H[y_index[0][run1]];
-            for( run1 = nx+na+np+nu; run1 < nx+na+np+nu+nw; run1++ ) Hw ( run2-nx-na-np-nu, run1-nx-na-np-nu ) = -H[y_index[0][run1]];
-        }
+        for( run1 = 0; run1 < nc; run1++ )
+            bseed[run1] = seed(run1,0);
 
-        if( nw > 0 ){
+        Matrix D, H;
 
-            dBackward.setDense( run3, 4*N+run3, Dw );
+        returnValue returnvalue = computeSecondOrderDerivatives( fcn[0], run3, y_index[0], bseed, 0, nc, D, H );
 
-            if( nx > 0 ) hessian.addDense( 4*N+run3,       run3, Hx  );
-            if( na > 0 ) hessian.addDense( 4*N+run3,   N + run3, Hxa );
-            if( np > 0 ) hessian.addDense( 4*N+run3, 2*N + run3, Hp  );
-            if( nu > 0 ) hessian.addDense( 4*N+run3, 3*N + run3, Hu  );
-            if( nw > 0 ) hessian.addDense( 4*N+run3, 4*N + run3, Hw  );
+        if( returnvalue != SUCCESSFUL_RETURN ){
+            delete[] bseed;
+            return ACADOERROR(returnvalue);
         }
 
-        delete[] bseed1;
-        delete[] bseed2;
-        delete[] R     ;
-        delete[] J     ;
-        delete[] H     ;
-        delete[] fseed ;
+        setSecondOrderBlocks( D, H, run3, run3, N, hessian );
     }
 
+    delete[] bseed;
 
     return SUCCESSFUL_RETURN;
 }
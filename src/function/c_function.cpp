@@ -35,10 +35,19 @@
 #include <acado/function/c_function.hpp>
 #include <acado/function/c_operator.hpp>
 
+#include <string.h>
+
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Number of points at which detectSparsityPattern() probes the Jacobian. */
+#define CF_SPARSITY_PROBES 3
+
+/** Relative distance of the random probe points from the given point. */
+#define CF_SPARSITY_RADIUS 1e-2
+
+
 
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -110,6 +119,15 @@ returnValue CFunction::initialize(){
     xStore   [0]  = 0;
     seedStore[0]  = 0;
 
+    cFcnBatch       = NULL;
+    jacobianColor   = 0;
+    nJacobianColors = 0;
+    nJacobians      = 0;
+    jacobianX       = 0;
+    jacobianF       = 0;
+    jacobianValues  = 0;
+    jacobianValid   = 0;
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -129,6 +147,23 @@ void CFunction::copy( const CFunction &arg ){
     nn  = arg.nn ;
 
     user_data = arg.user_data;
+    cFcnBatch = arg.cFcnBatch;
+
+    jacobianPattern = arg.jacobianPattern;
+    nJacobianColors = arg.nJacobianColors;
+
+    if( arg.jacobianColor != 0 ){
+        jacobianColor = (int*)calloc(jacobianPattern.getNumCols()+1,sizeof(int));
+        memcpy( jacobianColor, arg.jacobianColor, jacobianPattern.getNumCols()*sizeof(int) );
+    }
+    else jacobianColor = 0;
+
+    // the Jacobians are computed again when needed:
+    nJacobians     = 0;
+    jacobianX      = 0;
+    jacobianF      = 0;
+    jacobianValues = 0;
+    jacobianValid  = 0;
 
     maxAlloc = arg.maxAlloc;
 
@@ -162,6 +197,9 @@ void CFunction::deleteAll(){
     }
     if( xStore    != 0 ) free(xStore   );
     if( seedStore != 0 ) free(seedStore);
+
+    if( jacobianColor != 0 ) free(jacobianColor);
+    clearJacobian();
 }
 
 
@@ -237,27 +275,8 @@ returnValue CFunction::evaluate( double *x, double *result, PrintLevel printL ){
 
 returnValue CFunction::evaluate( int number, double *x, double *result ){
 
-    uint run1;
-    uint run2;
-
     evaluate(x,result);
-
-    if( number >= (int) maxAlloc ){
-
-        xStore= (double**)realloc(xStore, (number+1)*sizeof(double*));
-        for( run1 = maxAlloc; (int) run1 < number+1; run1++ ){
-           xStore[run1] = new double[nn];
-        }
-        seedStore = (double**)realloc(seedStore, (number+1)*sizeof(double*));
-        for( run1 = maxAlloc; (int) run1 < number+1; run1++ ){
-           seedStore[run1] = new double[nn];
-        }
-        maxAlloc = number+1;
-    }
-
-    for( run2 = 0; run2 < nn; run2++ ){
-        xStore[number][run2] = x[run2];
-    }
+    storePoint( number, x );
 
     return SUCCESSFUL_RETURN;
 }
@@ -269,6 +288,9 @@ returnValue CFunction::AD_forward( double *x, double *seed, double *f, double *d
         cFcnDForward( 0, x, seed, f, df, user_data );
         return SUCCESSFUL_RETURN;
     }
+    else if( hasCompressedJacobian() == BT_TRUE ){
+        forwardJacobian( 0, x, seed, f, df );
+    }
     else{
 
         uint run1;
@@ -324,6 +346,17 @@ returnValue CFunction::AD_forward( int number, double *x, double *seed, double *
         return SUCCESSFUL_RETURN;
     }
 
+    if( hasCompressedJacobian() == BT_TRUE ){
+
+        for( run1 = 0; run1 < nn; run1++ ){
+
+            xStore[number][run1]    = x   [run1];
+            seedStore[number][run1] = seed[run1];
+        }
+        forwardJacobian( number, x, seed, f, df );
+        return SUCCESSFUL_RETURN;
+    }
+
     if( cFcn != 0 )
         cFcn( x, f, user_data );
     else evaluateCFunction( x, f );
@@ -365,6 +398,17 @@ returnValue CFunction::AD_forward( int number, double *seed, double *df ){
         return SUCCESSFUL_RETURN;
     }
 
+    if( hasCompressedJacobian() == BT_TRUE ){
+
+        forwardJacobian( number, xStore[number], seed, f, df );
+
+        for( run1 = 0; run1 < nn; run1++ )
+            seedStore[number][run1] = seed[run1];
+
+        delete[] f;
+        return SUCCESSFUL_RETURN;
+    }
+
     if( cFcn != 0 )
         cFcn( xStore[number], f, user_data );
     else evaluateCFunction( xStore[number], f );
@@ -418,6 +462,29 @@ returnValue CFunction::AD_backward( int number, double *seed, double  *df ){
         delete[] f;
         return SUCCESSFUL_RETURN;
     }
+
+    if( hasCompressedJacobian() == BT_TRUE ){
+
+        int run2;
+
+        updateJacobian( number, xStore[number] );
+
+        const int *rowStart = jacobianPattern.getRowStart();
+        const int *colIndex = jacobianPattern.getColIndex();
+        const double *J     = jacobianValues[number];
+
+        for( run1 = 0; run1 < nn; run1++ )
+            df[run1] = 0.0;
+
+        for( run1 = 0; run1 < dim; run1++ )
+            for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ )
+                df[colIndex[run2]] += J[run2]*seed[run1];
+
+        for( run1 = 0; run1 < nn; run1++ )
+            seedStore[number][run1] = seed[run1];
+
+        return SUCCESSFUL_RETURN;
+    }
     return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
 }
 
@@ -531,18 +598,351 @@ returnValue CFunction::clearBuffer(){
         seedStore = (double**)realloc( seedStore, maxAlloc*sizeof(double*) );
     }
 
+    clearJacobian();
+
     return SUCCESSFUL_RETURN;
 }
 
 
 returnValue CFunction::setUserData( void * user_data_){
 
+  uint run1;
+
   user_data = user_data_;
 
+  for( run1 = 0; run1 < nJacobians; run1++ )
+      jacobianValid[run1] = BT_FALSE;
+
   return SUCCESSFUL_RETURN;
 }
 
 
+returnValue CFunction::setBatchFunction( cFcnBatchPtr cFcnBatch_ ){
+
+    cFcnBatch = cFcnBatch_;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::evaluateBatch( int nPoints, double *x, double *result ){
+
+    if( nPoints > 0 )
+        evaluatePoints( nn, nPoints, x, result );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::evaluateBatch( int number, int nPoints, double *x, double *result ){
+
+    uint run1;
+    int  run2;
+
+    if( nPoints <= 0 )
+        return SUCCESSFUL_RETURN;
+
+    evaluatePoints( nn, nPoints, x, result );
+
+    double *xp = (double*)calloc(nn+1,sizeof(double));
+
+    for( run2 = 0; run2 < nPoints; run2++ ){
+
+        for( run1 = 0; run1 < nn; run1++ )
+            xp[run1] = x[run1*nPoints+run2];
+
+        storePoint( number+run2, xp );
+    }
+
+    free( xp );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::setSparsityPattern( const SparsityPattern &pattern ){
+
+    if( pattern.getNumRows() != (int) dim )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    clearJacobian();
+
+    jacobianPattern = pattern;
+
+    if( jacobianColor != 0 ) free( jacobianColor );
+    jacobianColor   = (int*)calloc(jacobianPattern.getNumCols()+1,sizeof(int));
+    nJacobianColors = jacobianPattern.getColumnColoring( jacobianColor );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::detectSparsityPattern( uint nInputs, double *x ){
+
+    uint run1, run2, run3;
+
+    // the probe points are x and CF_SPARSITY_PROBES-1 random points
+    // near x; each probe point p is followed by nInputs points which
+    // perturb one input each:
+    const int nPoints = CF_SPARSITY_PROBES*(nInputs+1);
+
+    double *xp = (double*)calloc(nInputs*nPoints+1,sizeof(double));
+    double *fp = (double*)calloc(dim    *nPoints+1,sizeof(double));
+
+    // a fixed linear congruential generator, such that the pattern
+    // is reproducible and the state of rand() is not touched:
+    unsigned long seed = 12345;
+
+    for( run3 = 0; run3 < CF_SPARSITY_PROBES; run3++ ){
+
+        const int first = run3*(nInputs+1);
+
+        for( run1 = 0; run1 < nInputs; run1++ ){
+
+            double value = x[run1];
+
+            if( run3 > 0 ){
+                seed   = ( 1103515245*seed + 12345 ) % 2147483648UL;
+                value += CF_SPARSITY_RADIUS*( 2.0*seed/2147483648.0 - 1.0 )*( 1.0+fabs(x[run1]) );
+            }
+
+            for( run2 = 0; run2 <= nInputs; run2++ )
+                xp[run1*nPoints+first+run2] = value;
+            xp[run1*nPoints+first+run1+1] += SQRT_EPS*(1.0+fabs(value));
+        }
+    }
+
+    evaluatePoints( nInputs, nPoints, xp, fp );
+
+    // an entry belongs to the pattern if it is detected at any probe point;
+    // the results are compared bitwise, since any change of the output,
+    // however small, means that it depends on the perturbed input:
+    int *rowStart = (int*)calloc(dim+1,sizeof(int));
+    int *colIndex = (int*)calloc(dim*nInputs+1,sizeof(int));
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        rowStart[run1+1] = rowStart[run1];
+        for( run2 = 0; run2 < nInputs; run2++ ){
+            for( run3 = 0; run3 < CF_SPARSITY_PROBES; run3++ ){
+                const int first = run3*(nInputs+1);
+                if( memcmp( &fp[run1*nPoints+first+run2+1], &fp[run1*nPoints+first], sizeof(double) ) != 0 ){
+                    colIndex[rowStart[run1+1]++] = run2;
+                    break;
+                }
+            }
+        }
+    }
+
+    SparsityPattern pattern;
+    pattern.init( dim, nInputs, rowStart, colIndex );
+
+    free( xp );
+    free( fp );
+    free( rowStart );
+    free( colIndex );
+
+    return setSparsityPattern( pattern );
+}
+
+
+returnValue CFunction::getSparsityPattern( SparsityPattern &pattern ) const{
+
+    pattern = jacobianPattern;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue CFunction::jacobian( double *x, double *J ){
+
+    if( jacobianColor == 0 )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    updateJacobian( 0, x );
+
+    memcpy( J, jacobianValues[0], jacobianPattern.getNumberOfNonzeros()*sizeof(double) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void CFunction::storePoint( int number, const double *x ){
+
+    uint run1;
+
+    if( number >= (int) maxAlloc ){
+
+        xStore= (double**)realloc(xStore, (number+1)*sizeof(double*));
+        for( run1 = maxAlloc; (int) run1 < number+1; run1++ ){
+           xStore[run1] = new double[nn];
+        }
+        seedStore = (double**)realloc(seedStore, (number+1)*sizeof(double*));
+        for( run1 = maxAlloc; (int) run1 < number+1; run1++ ){
+           seedStore[run1] = new double[nn];
+        }
+        maxAlloc = number+1;
+    }
+
+    for( run1 = 0; run1 < nn; run1++ ){
+        xStore[number][run1] = x[run1];
+    }
+}
+
+
+void CFunction::evaluatePoints( uint nInputs, int nPoints, double *x, double *result ){
+
+    uint run1;
+    int  run2;
+
+    if( cFcnBatch != 0 ){
+        cFcnBatch( nPoints, x, result, user_data );
+        return;
+    }
+
+    double *xp = (double*)calloc(nInputs+1,sizeof(double));
+    double *rp = (double*)calloc(dim    +1,sizeof(double));
+
+    for( run2 = 0; run2 < nPoints; run2++ ){
+
+        for( run1 = 0; run1 < nInputs; run1++ )
+            xp[run1] = x[run1*nPoints+run2];
+
+        evaluate( xp, rp );
+
+        for( run1 = 0; run1 < dim; run1++ )
+            result[run1*nPoints+run2] = rp[run1];
+    }
+
+    free( xp );
+    free( rp );
+}
+
+
+BooleanType CFunction::hasCompressedJacobian() const{
+
+    if( jacobianColor != 0 && nn > 0 && jacobianPattern.getNumCols() == (int) nn )
+        return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+void CFunction::updateJacobian( int number, double *x ){
+
+    uint run1;
+    int  run2;
+
+    const uint nInputs = jacobianPattern.getNumCols();
+
+    if( number < (int) nJacobians && jacobianValid[number] == BT_TRUE &&
+        memcmp( jacobianX[number], x, nInputs*sizeof(double) ) == 0 )
+        return;
+
+    if( number >= (int) nJacobians ){
+
+        jacobianX      = (double**)    realloc(jacobianX     , (number+1)*sizeof(double*));
+        jacobianF      = (double**)    realloc(jacobianF     , (number+1)*sizeof(double*));
+        jacobianValues = (double**)    realloc(jacobianValues, (number+1)*sizeof(double*));
+        jacobianValid  = (BooleanType*)realloc(jacobianValid , (number+1)*sizeof(BooleanType));
+
+        for( run1 = nJacobians; (int) run1 < number+1; run1++ ){
+            jacobianX     [run1] = (double*)calloc(nInputs+1,sizeof(double));
+            jacobianF     [run1] = (double*)calloc(dim    +1,sizeof(double));
+            jacobianValues[run1] = (double*)calloc(jacobianPattern.getNumberOfNonzeros()+1,sizeof(double));
+            jacobianValid [run1] = BT_FALSE;
+        }
+        nJacobians = number+1;
+    }
+
+    // the point 0 is x, the point c+1 perturbs all inputs of colour c:
+    const int nPoints = nJacobianColors+1;
+
+    double *xp = (double*)calloc(nInputs*nPoints+1,sizeof(double));
+    double *fp = (double*)calloc(dim    *nPoints+1,sizeof(double));
+    double *h  = (double*)calloc(nInputs+1,sizeof(double));
+
+    for( run1 = 0; run1 < nInputs; run1++ ){
+
+        // use the step which is exactly representable:
+        h[run1] = ( x[run1] + SQRT_EPS*(1.0+fabs(x[run1])) ) - x[run1];
+
+        for( run2 = 0; run2 < nPoints; run2++ )
+            xp[run1*nPoints+run2] = x[run1];
+        xp[run1*nPoints+jacobianColor[run1]+1] += h[run1];
+    }
+
+    evaluatePoints( nInputs, nPoints, xp, fp );
+
+    const int *rowStart = jacobianPattern.getRowStart();
+    const int *colIndex = jacobianPattern.getColIndex();
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        jacobianF[number][run1] = fp[run1*nPoints];
+
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
+            const int col = colIndex[run2];
+            jacobianValues[number][run2] = ( fp[run1*nPoints+jacobianColor[col]+1] - fp[run1*nPoints] )/h[col];
+        }
+    }
+
+    memcpy( jacobianX[number], x, nInputs*sizeof(double) );
+    jacobianValid[number] = BT_TRUE;
+
+    free( xp );
+    free( fp );
+    free( h  );
+}
+
+
+void CFunction::forwardJacobian( int number, double *x, double *seed, double *f, double *df ){
+
+    uint run1;
+    int  run2;
+
+    updateJacobian( number, x );
+
+    const int *rowStart = jacobianPattern.getRowStart();
+    const int *colIndex = jacobianPattern.getColIndex();
+    const double *J     = jacobianValues[number];
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        f [run1] = jacobianF[number][run1];
+        df[run1] = 0.0;
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ )
+            df[run1] += J[run2]*seed[colIndex[run2]];
+    }
+}
+
+
+void CFunction::clearJacobian(){
+
+    uint run1;
+
+    for( run1 = 0; run1 < nJacobians; run1++ ){
+        free( jacobianX     [run1] );
+        free( jacobianF     [run1] );
+        free( jacobianValues[run1] );
+    }
+
+    if( jacobianX      != 0 ) free( jacobianX      );
+    if( jacobianF      != 0 ) free( jacobianF      );
+    if( jacobianValues != 0 ) free( jacobianValues );
+    if( jacobianValid  != 0 ) free( jacobianValid  );
+
+    nJacobians     = 0;
+    jacobianX      = 0;
+    jacobianF      = 0;
+    jacobianValues = 0;
+    jacobianValid  = 0;
+}
+
+
 
 CLOSE_NAMESPACE_ACADO
 
@@ -55,6 +55,9 @@ COperator::COperator( ) :SmoothOperator( )
     first        = BT_FALSE;
     globalTypeID = counter ;
 
+    batchBegin   = 0;
+    batchEnd     = 0;
+
     nCount = 0;
 }
 
@@ -72,6 +75,9 @@ COperator::COperator( const CFunction &fcn, const Expression &arg, int component
     first         = BT_FALSE;
     globalTypeID  =  counter;
 
+    batchBegin    = 0;
+    batchEnd      = 0;
+
     idx =  new int[cFunction.getDim()];
 
     bufferSize = 1;
@@ -115,6 +121,13 @@ COperator& COperator::operator=( const COperator &arg ){
 int COperator::increaseID(){ return counter++; }
 
 
+BooleanType COperator::isFirstComponent() const{ return first; }
+
+int COperator::getTypeID() const{ return globalTypeID; }
+
+const Expression& COperator::getArgument() const{ return argument; }
+
+
 void COperator::copy( const COperator &arg ){
 
     uint run1, run2;
@@ -127,6 +140,9 @@ void COperator::copy( const COperator &arg ){
     first          = arg.first        ;
     globalTypeID   = arg.globalTypeID ;
 
+    batchBegin     = 0;
+    batchEnd       = 0;
+
     idx = new int[cFunction.getDim()];
     for( run1 = 0; run1 < cFunction.getDim(); run1++ )
          idx[run1] = arg.idx[run1];
@@ -198,26 +214,20 @@ returnValue COperator::evaluate( int number, double *x, double *result_ ){
     }
     else{
 
-        if( number >= (int) bufferSize ){
-
-            int oldSize = bufferSize;
-            bufferSize += number;
-            result    = (double**)realloc(result   ,bufferSize*sizeof(double*));
-            d_result  = (double**)realloc(d_result ,bufferSize*sizeof(double*));
-            cresult   = (double**)realloc(cresult  ,bufferSize*sizeof(double*));
-            d_cresult = (double**)realloc(d_cresult,bufferSize*sizeof(double*));
-
-            for( run1 = oldSize; run1 < bufferSize; run1++ ){
-                result   [run1] = new double[argument.getDim() ];
-                d_result [run1] = new double[argument.getDim() ];
-                cresult  [run1] = new double[cFunction.getDim()];
-                d_cresult[run1] = new double[cFunction.getDim()];
-            }
+        allocateBuffer( number );
+
+        if( number >= batchBegin && number < batchEnd ){
+
+            // the point has already been evaluated by evaluateBatch:
+            if( number == batchEnd-1 )
+                batchBegin = batchEnd = 0;
         }
+        else{
 
-        for( run1 = 0; run1 < argument.getDim(); run1++ )
-            argument.element[run1]->evaluate( number, x , &result[number][run1] );
-        cFunction.evaluate( number, result[number], cresult[number] );
+            for( run1 = 0; run1 < argument.getDim(); run1++ )
+                argument.element[run1]->evaluate( number, x , &result[number][run1] );
+            cFunction.evaluate( number, result[number], cresult[number] );
+        }
         result_[0] = cresult[number][component];
         for( run1 = 0; run1 < cFunction.getDim(); run1++ )
             x[idx[run1]] = cresult[number][run1];
@@ -226,6 +236,45 @@ returnValue COperator::evaluate( int number, double *x, double *result_ ){
 }
 
 
+returnValue COperator::evaluateBatch( int number, int nPoints, int nv, double *x ){
+
+    int  run1;
+    uint run2;
+
+    if( first == BT_FALSE || nPoints <= 0 )
+        return SUCCESSFUL_RETURN;
+
+    allocateBuffer( number+nPoints-1 );
+
+    const uint nArg = argument.getDim ();
+    const uint nRes = cFunction.getDim();
+
+    double *xb = (double*)calloc(nArg*nPoints+1,sizeof(double));
+    double *rb = (double*)calloc(nRes*nPoints+1,sizeof(double));
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        for( run2 = 0; run2 < nArg; run2++ ){
+            argument.element[run2]->evaluate( number+run1, &x[run1*nv], &result[number+run1][run2] );
+            xb[run2*nPoints+run1] = result[number+run1][run2];
+        }
+    }
+
+    cFunction.evaluateBatch( number, nPoints, xb, rb );
+
+    for( run1 = 0; run1 < nPoints; run1++ )
+        for( run2 = 0; run2 < nRes; run2++ )
+            cresult[number+run1][run2] = rb[run2*nPoints+run1];
+
+    free( xb );
+    free( rb );
+
+    batchBegin = number;
+    batchEnd   = number+nPoints;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue COperator::evaluate( EvaluationBase *x ){
  
     ASSERT( 1 == 0 );
@@ -371,22 +420,7 @@ returnValue COperator::AD_forward( int number, double *x, double *seed,
     }
     else{
 
-        if( number >= (int) bufferSize ){
-
-            int oldSize = bufferSize;
-            bufferSize += number;
-            result    = (double**)realloc(result   ,bufferSize*sizeof(double*));
-            d_result  = (double**)realloc(d_result ,bufferSize*sizeof(double*));
-            cresult   = (double**)realloc(cresult  ,bufferSize*sizeof(double*));
-            d_cresult = (double**)realloc(d_cresult,bufferSize*sizeof(double*));
-
-            for( run1 = oldSize; run1 < bufferSize; run1++ ){
-                result   [run1] = new double[argument.getDim() ];
-                d_result [run1] = new double[argument.getDim() ];
-                cresult  [run1] = new double[cFunction.getDim()];
-                d_cresult[run1] = new double[cFunction.getDim()];
-            }
-        }
+        allocateBuffer( number );
 
         for( run1 = 0; run1 < argument.getDim(); run1++ )
             argument.element[run1]->AD_forward( number, x, seed, &result[number][run1], &d_result[number][run1] );
@@ -493,6 +527,9 @@ Operator* COperator::clone() const{
 
 returnValue COperator::clearBuffer(){
 
+    batchBegin = 0;
+    batchEnd   = 0;
+
     if( bufferSize > 1 ){
         bufferSize = 1;
         result    = (double**)realloc(result   ,bufferSize*sizeof(double*));
@@ -553,6 +590,46 @@ BooleanType COperator::isSymbolic() const{
 }
 
 
+Operator* COperator::hashCons( OperatorTable *table ) const{
+
+    uint run1;
+
+    COperator *tmp = new COperator( *this );
+
+    for( run1 = 0; run1 < argument.getDim(); run1++ ){
+
+        Operator *imported = table->import( argument.element[run1] );
+        release( tmp->argument.element[run1] );
+        tmp->argument.element[run1] = imported;
+    }
+
+    return tmp;
+}
+
+
+void COperator::allocateBuffer( int number ){
+
+    uint run1;
+
+    if( number >= (int) bufferSize ){
+
+        int oldSize = bufferSize;
+        bufferSize += number;
+        result    = (double**)realloc(result   ,bufferSize*sizeof(double*));
+        d_result  = (double**)realloc(d_result ,bufferSize*sizeof(double*));
+        cresult   = (double**)realloc(cresult  ,bufferSize*sizeof(double*));
+        d_cresult = (double**)realloc(d_cresult,bufferSize*sizeof(double*));
+
+        for( run1 = oldSize; run1 < bufferSize; run1++ ){
+            result   [run1] = new double[argument.getDim() ];
+            d_result [run1] = new double[argument.getDim() ];
+            cresult  [run1] = new double[cFunction.getDim()];
+            d_cresult[run1] = new double[cFunction.getDim()];
+        }
+    }
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
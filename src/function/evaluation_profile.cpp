@@ -0,0 +1,289 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/function/evaluation_profile.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/evaluation_profile.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+EvaluationProfile::EvaluationProfile( ){
+
+    nNodes          = 0;
+    node            = 0;
+    nodeEvaluations = 0;
+    nodeReferences  = 0;
+    nodeCycles      = 0;
+    nodeSamples     = 0;
+    nodeOperations  = 0;
+    nextNode        = 0;
+    nOperations     = 0.0;
+
+    nStates     = 0;
+    state       = 0;
+    stateCycles = 0;
+
+    nEvaluations = 0;
+}
+
+
+EvaluationProfile::EvaluationProfile( const EvaluationProfile& arg ){
+
+    copy( arg );
+}
+
+
+EvaluationProfile::~EvaluationProfile( ){
+
+    clear();
+}
+
+
+EvaluationProfile& EvaluationProfile::operator=( const EvaluationProfile& arg ){
+
+    if( this != &arg ){
+
+        clear();
+        copy( arg );
+    }
+    return *this;
+}
+
+
+returnValue EvaluationProfile::clear(){
+
+    free( node            );
+    free( nodeEvaluations );
+    free( nodeReferences  );
+    free( nodeCycles      );
+    free( nodeSamples     );
+    free( nodeOperations  );
+    free( state           );
+    free( stateCycles     );
+
+    nNodes          = 0;
+    node            = 0;
+    nodeEvaluations = 0;
+    nodeReferences  = 0;
+    nodeCycles      = 0;
+    nodeSamples     = 0;
+    nodeOperations  = 0;
+    nextNode        = 0;
+    nOperations     = 0.0;
+
+    nStates     = 0;
+    state       = 0;
+    stateCycles = 0;
+
+    nEvaluations = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int EvaluationProfile::addNode( Operator *node_, int nEvaluations_, int nReferences_,
+                                double nOperations_ ){
+
+    node            = (Operator**)realloc(node,(nNodes+1)*sizeof(Operator*));
+    nodeEvaluations = (int*)realloc(nodeEvaluations,(nNodes+1)*sizeof(int));
+    nodeReferences  = (int*)realloc(nodeReferences ,(nNodes+1)*sizeof(int));
+    nodeCycles      = (unsigned long long*)realloc(nodeCycles,(nNodes+1)*sizeof(unsigned long long));
+    nodeSamples     = (int*)realloc(nodeSamples,(nNodes+1)*sizeof(int));
+    nodeOperations  = (double*)realloc(nodeOperations,(nNodes+1)*sizeof(double));
+
+    node           [nNodes] = node_;
+    nodeEvaluations[nNodes] = nEvaluations_;
+    nodeReferences [nNodes] = nReferences_;
+    nodeCycles     [nNodes] = 0;
+    nodeSamples    [nNodes] = 0;
+    nodeOperations [nNodes] = nOperations_;
+
+    return nNodes++;
+}
+
+
+int EvaluationProfile::selectNodes( int &nSelected ){
+
+    const int first = nextNode;
+    double    total = 0.0;
+
+    nSelected = 0;
+
+    // (at least one node, but never a node twice)
+    while( nSelected < nNodes && ( nSelected == 0 || total + nodeOperations[nextNode] <= nOperations ) ){
+
+        total += nodeOperations[nextNode];
+        nSelected++;
+        nextNode = ( nextNode+1 ) % nNodes;
+    }
+
+    return first;
+}
+
+
+int EvaluationProfile::addState( Operator *expression ){
+
+    state       = (Operator**)realloc(state,(nStates+1)*sizeof(Operator*));
+    stateCycles = (unsigned long long*)realloc(stateCycles,(nStates+1)*sizeof(unsigned long long));
+
+    state      [nStates] = expression;
+    stateCycles[nStates] = 0;
+
+    return nStates++;
+}
+
+
+returnValue EvaluationProfile::print( int nTop ) const{
+
+    int run1, run2;
+
+    acadoPrintf("evaluation profile (%d evaluations, cycles per evaluation):\n", nEvaluations );
+
+    if( nEvaluations == 0 )
+        return SUCCESSFUL_RETURN;
+
+    // THE COST OF A SUBTREE IS ITS INCLUSIVE TIME TIMES THE NUMBER
+    // OF TIMES THE SUBTREE IS EVALUATED PER FUNCTION EVALUATION:
+    // ------------------------------------------------------------
+    double *cost = (double*)calloc(nNodes+1,sizeof(double));
+    int    *rank = (int*)calloc(nNodes+1,sizeof(int));
+
+    // (the subtrees take turns in being timed)
+    for( run1 = 0; run1 < nNodes; run1++ ){
+        if( nodeSamples[run1] > 0 )
+            cost[run1] = ((double)nodeCycles[run1]/nodeSamples[run1])*nodeEvaluations[run1];
+        rank[run1] = run1;
+    }
+
+    if( nTop > nNodes ) nTop = nNodes;
+
+    for( run1 = 0; run1 < nTop; run1++ ){
+        for( run2 = run1+1; run2 < nNodes; run2++ ){
+            if( cost[rank[run2]] > cost[rank[run1]] ){
+                int tmp    = rank[run1];
+                rank[run1] = rank[run2];
+                rank[run2] = tmp;
+            }
+        }
+    }
+
+    acadoPrintf("  %12s %12s %6s %6s  %s\n", "total", "per call", "calls", "refs", "expression" );
+
+    for( run1 = 0; run1 < nTop; run1++ ){
+
+        int idx = rank[run1];
+
+        Stream expression;
+        node[idx]->print( expression );
+
+        const char *name = expression.getName();
+        if( name == 0 ) name = "";
+
+        char text[64];
+        strncpy( text, name, 63 );
+        text[63] = '\0';
+        if( strlen(name) > 63 )
+            strcpy( text+59, " ..." );
+
+        acadoPrintf("  %12.0f %12.0f %6d %6d  %s\n", cost[idx],
+                    cost[idx]/nodeEvaluations[idx], nodeEvaluations[idx],
+                    nodeReferences[idx], text );
+    }
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        acadoPrintf("  intermediate state %d: %12.0f\n", run1,
+                    (double)stateCycles[run1]/nEvaluations );
+
+    free( cost );
+    free( rank );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void EvaluationProfile::copy( const EvaluationProfile& arg ){
+
+    nNodes          = arg.nNodes;
+    node            = (Operator**)calloc(nNodes+1,sizeof(Operator*));
+    nodeEvaluations = (int*)calloc(nNodes+1,sizeof(int));
+    nodeReferences  = (int*)calloc(nNodes+1,sizeof(int));
+    nodeCycles      = (unsigned long long*)calloc(nNodes+1,sizeof(unsigned long long));
+    nodeSamples     = (int*)calloc(nNodes+1,sizeof(int));
+    nodeOperations  = (double*)calloc(nNodes+1,sizeof(double));
+
+    if( nNodes > 0 ){
+        memcpy( node           , arg.node           , nNodes*sizeof(Operator*)           );
+        memcpy( nodeEvaluations, arg.nodeEvaluations, nNodes*sizeof(int)                 );
+        memcpy( nodeReferences , arg.nodeReferences , nNodes*sizeof(int)                 );
+        memcpy( nodeCycles     , arg.nodeCycles     , nNodes*sizeof(unsigned long long)  );
+        memcpy( nodeSamples    , arg.nodeSamples    , nNodes*sizeof(int)                 );
+        memcpy( nodeOperations , arg.nodeOperations , nNodes*sizeof(double)              );
+    }
+
+    nextNode    = arg.nextNode;
+    nOperations = arg.nOperations;
+
+    nStates     = arg.nStates;
+    state       = (Operator**)calloc(nStates+1,sizeof(Operator*));
+    stateCycles = (unsigned long long*)calloc(nStates+1,sizeof(unsigned long long));
+
+    if( nStates > 0 ){
+        memcpy( state      , arg.state      , nStates*sizeof(Operator*)          );
+        memcpy( stateCycles, arg.stateCycles, nStates*sizeof(unsigned long long) );
+    }
+
+    nEvaluations = arg.nEvaluations;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,2301 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/function/evaluation_tape.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/evaluation_tape.hpp>
+
+#include <string.h>
+
+
+#if defined(__AVX__)
+
+    #include <immintrin.h>
+
+    typedef __m256d BatchVector;
+
+    #define BV_WIDTH            4
+    #define BV_LOAD( p )        _mm256_loadu_pd( p )
+    #define BV_STORE( p, v )    _mm256_storeu_pd( p, v )
+    #define BV_SET( a )         _mm256_set1_pd( a )
+    #define BV_ADD( a, b )      _mm256_add_pd( a, b )
+    #define BV_SUB( a, b )      _mm256_sub_pd( a, b )
+    #define BV_MUL( a, b )      _mm256_mul_pd( a, b )
+    #define BV_DIV( a, b )      _mm256_div_pd( a, b )
+    #define BV_NEG( a )         _mm256_xor_pd( a, _mm256_set1_pd( -0.0 ) )
+
+#elif defined(__SSE2__)
+
+    #include <emmintrin.h>
+
+    typedef __m128d BatchVector;
+
+    #define BV_WIDTH            2
+    #define BV_LOAD( p )        _mm_loadu_pd( p )
+    #define BV_STORE( p, v )    _mm_storeu_pd( p, v )
+    #define BV_SET( a )         _mm_set1_pd( a )
+    #define BV_ADD( a, b )      _mm_add_pd( a, b )
+    #define BV_SUB( a, b )      _mm_sub_pd( a, b )
+    #define BV_MUL( a, b )      _mm_mul_pd( a, b )
+    #define BV_DIV( a, b )      _mm_div_pd( a, b )
+    #define BV_NEG( a )         _mm_xor_pd( a, _mm_set1_pd( -0.0 ) )
+
+#else
+
+    typedef double BatchVector;
+
+    #define BV_WIDTH            1
+    #define BV_LOAD( p )        (*(p))
+    #define BV_STORE( p, v )    (*(p) = (v))
+    #define BV_SET( a )         (a)
+    #define BV_ADD( a, b )      ((a)+(b))
+    #define BV_SUB( a, b )      ((a)-(b))
+    #define BV_MUL( a, b )      ((a)*(b))
+    #define BV_DIV( a, b )      ((a)/(b))
+    #define BV_NEG( a )         (-(a))
+
+#endif
+
+
+/** Runs VECTOR for all complete lanes of the nPoints points and SCALAR \n
+ *  for the remaining points, both with the point index i.             \n
+ */
+#define BATCH_LOOP( VECTOR, SCALAR )                                \
+    for( i = 0; i+BV_WIDTH <= nPoints; i += BV_WIDTH ){ VECTOR; }   \
+    for( ; i < nPoints; i++ ){ SCALAR; }
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/*
+ *  Kernels of the batch sweeps for the arithmetic operations. The
+ *  templates are used in single precision, the overloads for double
+ *  precision use the SIMD lanes. They evaluate the same expressions
+ *  as EvaluationTape::forwardDerivative and EvaluationTape::backward,
+ *  such that the results do not depend on the number of points.
+ */
+template <typename T>
+static void batchAdd( T *r, const T *a, const T *b, int nPoints ){
+
+    int i;
+    for( i = 0; i < nPoints; i++ ) r[i] = a[i] + b[i];
+}
+
+static void batchAdd( double *r, const double *a, const double *b, int nPoints ){
+
+    int i;
+    BATCH_LOOP( BV_STORE( r+i, BV_ADD( BV_LOAD( a+i ), BV_LOAD( b+i ) ) ),
+                r[i] = a[i] + b[i] );
+}
+
+
+template <typename T>
+static void batchSubtract( T *r, const T *a, const T *b, int nPoints ){
+
+    int i;
+    for( i = 0; i < nPoints; i++ ) r[i] = a[i] - b[i];
+}
+
+static void batchSubtract( double *r, const double *a, const double *b, int nPoints ){
+
+    int i;
+    BATCH_LOOP( BV_STORE( r+i, BV_SUB( BV_LOAD( a+i ), BV_LOAD( b+i ) ) ),
+                r[i] = a[i] - b[i] );
+}
+
+
+template <typename T>
+static void batchMultiply( T *r, const T *a, const T *b, int nPoints ){
+
+    int i;
+    for( i = 0; i < nPoints; i++ ) r[i] = a[i] * b[i];
+}
+
+static void batchMultiply( double *r, const double *a, const double *b, int nPoints ){
+
+    int i;
+    BATCH_LOOP( BV_STORE( r+i, BV_MUL( BV_LOAD( a+i ), BV_LOAD( b+i ) ) ),
+                r[i] = a[i] * b[i] );
+}
+
+
+template <typename T>
+static void batchDivide( T *r, const T *a, const T *b, int nPoints ){
+
+    int i;
+    for( i = 0; i < nPoints; i++ ) r[i] = a[i] / b[i];
+}
+
+static void batchDivide( double *r, const double *a, const double *b, int nPoints ){
+
+    int i;
+    BATCH_LOOP( BV_STORE( r+i, BV_DIV( BV_LOAD( a+i ), BV_LOAD( b+i ) ) ),
+                r[i] = a[i] / b[i] );
+}
+
+
+/* d = b*da + a*db, the derivative of the product a*b: */
+template <typename T>
+static void batchProductDerivative( T *d, const T *a, const T *b,
+                                    const T *da, const T *db, int nPoints ){
+
+    int i;
+    for( i = 0; i < nPoints; i++ ) d[i] = b[i]*da[i] + a[i]*db[i];
+}
+
+static void batchProductDerivative( double *d, const double *a, const double *b,
+                                    const double *da, const double *db, int nPoints ){
+
+    int i;
+    BATCH_LOOP( BV_STORE( d+i, BV_ADD( BV_MUL( BV_LOAD( b+i ), BV_LOAD( da+i ) ),
+                                       BV_MUL( BV_LOAD( a+i ), BV_LOAD( db+i ) ) ) ),
+                d[i] = b[i]*da[i] + a[i]*db[i] );
+}
+
+
+/* d = da/b - (a*db)/(b*b), the derivative of the quotient a/b: */
+template <typename T>
+static void batchQuotientDerivative( T *d, const T *a, const T *b,
+                                     const T *da, const T *db, int nPoints ){
+
+    int i;
+    for( i = 0; i < nPoints; i++ )
+        d[i] = da[i]/b[i] - (a[i]*db[i])/(b[i]*b[i]);
+}
+
+static void batchQuotientDerivative( double *d, const double *a, const double *b,
+                                     const double *da, const double *db, int nPoints ){
+
+    int i;
+
+    BATCH_LOOP( const BatchVector bi = BV_LOAD( b+i );
+                BV_STORE( d+i, BV_SUB( BV_DIV( BV_LOAD( da+i ), bi ),
+                                       BV_DIV( BV_MUL( BV_LOAD( a+i ), BV_LOAD( db+i ) ), BV_MUL( bi, bi ) ) ) ),
+                d[i] = da[i]/b[i] - (a[i]*db[i])/(b[i]*b[i]) );
+}
+
+
+/* da += b*s and db += a*s, the adjoints of the product a*b: */
+static void batchProductAdjoint( double *da, double *db, const double *a, const double *b,
+                                 const double *s, int nPoints ){
+
+    int i;
+
+    // da and db are the same for a product of a register with itself:
+    BATCH_LOOP( BV_STORE( da+i, BV_ADD( BV_LOAD( da+i ), BV_MUL( BV_LOAD( b+i ), BV_LOAD( s+i ) ) ) );
+                BV_STORE( db+i, BV_ADD( BV_LOAD( db+i ), BV_MUL( BV_LOAD( a+i ), BV_LOAD( s+i ) ) ) ),
+                da[i] += b[i]*s[i];
+                db[i] += a[i]*s[i] );
+}
+
+
+/* da += s/b and db -= s*a/(b*b), the adjoints of the quotient a/b: */
+static void batchQuotientAdjoint( double *da, double *db, const double *a, const double *b,
+                                  const double *s, int nPoints ){
+
+    int i;
+
+    BATCH_LOOP( const BatchVector bi = BV_LOAD( b+i );
+                const BatchVector si = BV_LOAD( s+i );
+                BV_STORE( da+i, BV_ADD( BV_LOAD( da+i ), BV_DIV( si, bi ) ) );
+                BV_STORE( db+i, BV_SUB( BV_LOAD( db+i ),
+                                        BV_DIV( BV_MUL( si, BV_LOAD( a+i ) ), BV_MUL( bi, bi ) ) ) ),
+                da[i] += s[i]/b[i];
+                db[i] -= s[i]*a[i]/(b[i]*b[i]) );
+}
+
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+EvaluationTape::EvaluationTape( ){
+
+    nInstructions   = 0;
+    maxInstructions = 0;
+    code            = 0;
+
+    nRegisters      = 0;
+    nSlots          = 0;
+
+    nConstants      = 0;
+    constantIndex   = 0;
+    constant        = 0;
+
+    dim             = 0;
+    output          = 0;
+
+    nStates         = 0;
+    state           = 0;
+
+    bufferSize      = 0;
+    buffer          = 0;
+
+    native          = 0;
+    current         = 0;
+
+    selected        = 0;
+    selection       = 0;
+    nSelected       = -1;
+}
+
+
+EvaluationTape::EvaluationTape( const EvaluationTape& arg ){
+
+    copy( arg );
+}
+
+
+EvaluationTape::~EvaluationTape( ){
+
+    deleteAll();
+}
+
+
+EvaluationTape& EvaluationTape::operator=( const EvaluationTape& arg ){
+
+    if( this != &arg ){
+
+        deleteAll();
+        copy( arg );
+    }
+    return *this;
+}
+
+
+
+returnValue EvaluationTape::init( int nVariables, int n, Operator **sub, int *lhs,
+                                  int dim_, Operator **f ){
+
+    int run1;
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( sub[run1]->isSymbolic() == BT_FALSE )
+            return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+
+    for( run1 = 0; run1 < dim_; run1++ )
+        if( f[run1]->isSymbolic() == BT_FALSE )
+            return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+
+    if( ( n < 0 ) || ( dim_ < 0 ) || ( nVariables < 0 ) )
+        return ACADOERROR(RET_INVALID_ARGUMENTS);
+
+    deleteAll();
+
+    nSlots  = nVariables;
+    nStates = n;
+    dim     = dim_;
+
+    state  = (int*)calloc((size_t)nStates,sizeof(int));
+    output = (int*)calloc((size_t)dim    ,sizeof(int));
+
+
+    // RECORD THE INTERMEDIATE STATES AND THE COMPONENTS:
+    // --------------------------------------------------
+    for( run1 = 0; run1 < n; run1++ ){
+
+        int tmp = record( sub[run1] );
+
+        if( lhs[run1]+1 > nSlots )
+            nSlots = lhs[run1]+1;
+
+        state[run1] = -lhs[run1]-1;
+        emit( TO_ASSIGN, state[run1], tmp, 0 );
+    }
+
+    for( run1 = 0; run1 < dim; run1++ )
+        output[run1] = record( f[run1] );
+
+    registers.clear();
+
+
+    // PLACE THE REGISTERS BEHIND THE VARIABLES:
+    // -----------------------------------------
+    for( run1 = 0; run1 < nInstructions; run1++ ){
+
+        code[4*run1+1] = relocate( code[4*run1+1] );
+        code[4*run1+2] = relocate( code[4*run1+2] );
+
+        if( code[4*run1] != TO_POWER_INT )
+            code[4*run1+3] = relocate( code[4*run1+3] );
+    }
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        state[run1] = relocate( state[run1] );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        output[run1] = relocate( output[run1] );
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        constantIndex[run1] = relocate( constantIndex[run1] );
+
+    nRegisters += nSlots;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::initWorkspace( EvaluationWorkspace &ws ) const{
+
+    int run1;
+
+    ws.allocate( nRegisters );
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        ws.value[constantIndex[run1]] = constant[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::evaluate( EvaluationWorkspace &ws, double *x, double *result ) const{
+
+    int run1;
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    double *w = ws.value;
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        w[run1] = x[run1];
+
+    forward( w, 0 );
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        x[state[run1]] = w[state[run1]];
+
+    for( run1 = 0; run1 < dim; run1++ )
+        result[run1] = w[output[run1]];
+
+    ws.status = 1;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forward( EvaluationWorkspace &ws, double *x, double *seed,
+                                        double *f, double *df ) const{
+
+    int run1;
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    double *w = ws.value     ;
+    double *d = ws.derivative;
+
+    for( run1 = 0; run1 < nSlots; run1++ ){
+        w[run1] = x   [run1];
+        d[run1] = seed[run1];
+    }
+
+    forward( w, d );
+
+    for( run1 = 0; run1 < nStates; run1++ ){
+        x   [state[run1]] = w[state[run1]];
+        seed[state[run1]] = d[state[run1]];
+    }
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        f [run1] = w[output[run1]];
+        df[run1] = d[output[run1]];
+    }
+
+    ws.status = 2;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forward( EvaluationWorkspace &ws, double *seed, double *df ) const{
+
+    int run1;
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    double *d = ws.derivative;
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        d[run1] = seed[run1];
+
+    forwardDerivative( ws.value, d );
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        seed[state[run1]] = d[state[run1]];
+
+    for( run1 = 0; run1 < dim; run1++ )
+        df[run1] = d[output[run1]];
+
+    ws.status = 2;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_backward( EvaluationWorkspace &ws, double *seed, double *df ) const{
+
+    int run1;
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    double *a = ws.adjoint;
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        a[run1] = df[run1];
+
+    for( run1 = nSlots; run1 < nRegisters; run1++ )
+        a[run1] = 0.0;
+
+    for( run1 = dim-1; run1 >= 0; run1-- )
+        a[output[run1]] += seed[run1];
+
+    backward( ws.value, a );
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        df[run1] = a[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forward( EvaluationWorkspace &ws, int nDir, int ld,
+                                        double *seed, double *df ) const{
+
+    int run1, run2;
+
+    if( isCompatible( ws ) == BT_FALSE || ld < nSlots )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    if( nDir <= 0 ) return SUCCESSFUL_RETURN;
+
+    ws.allocateDirections( nDir );
+    double *d = ws.block;
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            d[run1*nDir+run2] = seed[run2*ld+run1];
+
+    if( forwardBlock( ws.value, d, nDir ) != SUCCESSFUL_RETURN )
+        return RET_UNKNOWN_BUG;
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            seed[run2*ld+state[run1]] = d[state[run1]*nDir+run2];
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            df[run2*dim+run1] = d[output[run1]*nDir+run2];
+
+    // keep the last direction for 2nd order AD:
+    for( run1 = 0; run1 < nRegisters; run1++ )
+        ws.derivative[run1] = d[run1*nDir+nDir-1];
+
+    ws.status = 2;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_backward( EvaluationWorkspace &ws, int nDir, int ld,
+                                         double *seed, double *df ) const{
+
+    int run1, run2;
+
+    if( isCompatible( ws ) == BT_FALSE || ld < nSlots )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    if( nDir <= 0 ) return SUCCESSFUL_RETURN;
+
+    ws.allocateDirections( nDir );
+    double *a = ws.block;
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            a[run1*nDir+run2] = df[run2*ld+run1];
+
+    for( run1 = nSlots*nDir; run1 < nRegisters*nDir; run1++ )
+        a[run1] = 0.0;
+
+    for( run1 = dim-1; run1 >= 0; run1-- )
+        for( run2 = 0; run2 < nDir; run2++ )
+            a[output[run1]*nDir+run2] += seed[run2*dim+run1];
+
+    if( backwardBlock( ws.value, a, nDir ) != SUCCESSFUL_RETURN )
+        return RET_UNKNOWN_BUG;
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            df[run2*ld+run1] = a[run1*nDir+run2];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forward2( EvaluationWorkspace &ws, double *seed, double *dseed,
+                                         double *df, double *ddf ) const{
+
+    int run1;
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    ws.allocateDirections( 2 );
+
+    double *e  = ws.block;
+    double *ee = ws.block + nRegisters;
+
+    for( run1 = 0; run1 < nSlots; run1++ ){
+        e [run1] = seed [run1];
+        ee[run1] = dseed[run1];
+    }
+
+    if( forward2( ws.value, ws.derivative, e, ee ) != SUCCESSFUL_RETURN )
+        return RET_UNKNOWN_BUG;
+
+    for( run1 = 0; run1 < nStates; run1++ ){
+        seed [state[run1]] = e [state[run1]];
+        dseed[state[run1]] = ee[state[run1]];
+    }
+
+    for( run1 = 0; run1 < dim; run1++ ){
+         df[run1] = e [output[run1]];
+        ddf[run1] = ee[output[run1]];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_backward2( EvaluationWorkspace &ws, double *seed1, double *seed2,
+                                          double *df, double *ddf ) const{
+
+    int run1;
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    ws.allocateDirections( 1 );
+
+    double *a  = ws.adjoint;
+    double *aa = ws.block;
+
+    for( run1 = 0; run1 < nSlots; run1++ ){
+        a [run1] = df [run1];
+        aa[run1] = ddf[run1];
+    }
+
+    for( run1 = nSlots; run1 < nRegisters; run1++ ){
+        a [run1] = 0.0;
+        aa[run1] = 0.0;
+    }
+
+    for( run1 = dim-1; run1 >= 0; run1-- ){
+        a [output[run1]] += seed1[run1];
+        aa[output[run1]] += seed2[run1];
+    }
+
+    if( backward2( ws.value, ws.derivative, a, aa ) != SUCCESSFUL_RETURN )
+        return RET_UNKNOWN_BUG;
+
+    for( run1 = 0; run1 < nSlots; run1++ ){
+         df[run1] = a [run1];
+        ddf[run1] = aa[run1];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::evaluateBatch( EvaluationWorkspace &ws, int nPoints,
+                                           double *x, double *result ) const{
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    ws.allocatePoints( nPoints );
+    ws.nBatchPoints = nPoints;
+    sweepBatch( ws.batchValue, nPoints, x, result );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forwardBatch( EvaluationWorkspace &ws, int nPoints,
+                                             double *seed, double *df ) const{
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    // (the registers of the points are stored with the stride of
+    //  the last batch evaluation)
+    if( isCompatible( ws ) == BT_FALSE || nPoints != ws.nBatchPoints )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    return sweepDerivativeBatch( ws.batchValue, ws.batchDerivative, nPoints, seed, df );
+}
+
+
+
+returnValue EvaluationTape::AD_backwardBatch( EvaluationWorkspace &ws, int nPoints,
+                                              double *seed, double *df ) const{
+
+    int run1, run2;
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    if( isCompatible( ws ) == BT_FALSE || nPoints != ws.nBatchPoints )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    double *a = ws.batchDerivative;
+
+    for( run1 = 0; run1 < nSlots*nPoints; run1++ )
+        a[run1] = df[run1];
+
+    for( run1 = nSlots*nPoints; run1 < nRegisters*nPoints; run1++ )
+        a[run1] = 0.0;
+
+    for( run1 = dim-1; run1 >= 0; run1-- )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            a[output[run1]*nPoints+run2] += seed[run1*nPoints+run2];
+
+    if( backwardBatch( ws.batchValue, a, nPoints ) != SUCCESSFUL_RETURN )
+        return RET_UNKNOWN_BUG;
+
+    for( run1 = 0; run1 < nSlots*nPoints; run1++ )
+        df[run1] = a[run1];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::evaluate( int number, double *x, double *result ){
+
+    allocate( number );
+    return evaluate( *buffer[number], x, result );
+}
+
+
+
+returnValue EvaluationTape::AD_forward( int number, double *x, double *seed,
+                                        double *f, double *df ){
+
+    allocate( number );
+    return AD_forward( *buffer[number], x, seed, f, df );
+}
+
+
+
+returnValue EvaluationTape::AD_forward( int number, double *seed, double *df ){
+
+    allocate( number );
+    return AD_forward( *buffer[number], seed, df );
+}
+
+
+
+returnValue EvaluationTape::AD_backward( int number, double *seed, double *df ){
+
+    allocate( number );
+    return AD_backward( *buffer[number], seed, df );
+}
+
+
+
+returnValue EvaluationTape::AD_forward( int number, int nDir, int ld, double *seed, double *df ){
+
+    allocate( number );
+    return AD_forward( *buffer[number], nDir, ld, seed, df );
+}
+
+
+
+returnValue EvaluationTape::AD_backward( int number, int nDir, int ld, double *seed, double *df ){
+
+    allocate( number );
+    return AD_backward( *buffer[number], nDir, ld, seed, df );
+}
+
+
+
+returnValue EvaluationTape::AD_forward2( int number, double *seed, double *dseed,
+                                         double *df, double *ddf ){
+
+    allocate( number );
+    return AD_forward2( *buffer[number], seed, dseed, df, ddf );
+}
+
+
+
+returnValue EvaluationTape::AD_backward2( int number, double *seed1, double *seed2,
+                                          double *df, double *ddf ){
+
+    allocate( number );
+    return AD_backward2( *buffer[number], seed1, seed2, df, ddf );
+}
+
+
+
+returnValue EvaluationTape::evaluateBatch( int number, int nPoints, double *x, double *result ){
+
+    int run1, run2;
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    allocate( number+nPoints-1 );
+
+    if( isCompatible( batch ) == BT_FALSE )
+        initWorkspace( batch );
+
+    returnValue returnvalue = evaluateBatch( batch, nPoints, x, result );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    // scatter the register files to the storage positions:
+    for( run2 = 0; run2 < nPoints; run2++ ){
+
+        double *w = buffer[number+run2]->value;
+
+        for( run1 = 0; run1 < nRegisters; run1++ )
+            w[run1] = batch.batchValue[run1*nPoints+run2];
+
+        buffer[number+run2]->status = 1;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forwardBatch( int number, int nPoints, double *seed, double *df ){
+
+    int run1, run2;
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    gather( number, nPoints );
+
+    returnValue returnvalue = AD_forwardBatch( batch, nPoints, seed, df );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    // keep the derivatives for 2nd order AD:
+    for( run2 = 0; run2 < nPoints; run2++ ){
+
+        double *d = buffer[number+run2]->derivative;
+
+        for( run1 = 0; run1 < nRegisters; run1++ )
+            d[run1] = batch.batchDerivative[run1*nPoints+run2];
+
+        buffer[number+run2]->status = 2;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_backwardBatch( int number, int nPoints, double *seed, double *df ){
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    gather( number, nPoints );
+
+    return AD_backwardBatch( batch, nPoints, seed, df );
+}
+
+
+
+returnValue EvaluationTape::evaluateBatch( EvaluationWorkspace &ws, int nPoints,
+                                           float *x, float *result ) const{
+
+    if( isCompatible( ws ) == BT_FALSE )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    ws.allocateSinglePoints( nPoints );
+    ws.nSingleBatchPoints = nPoints;
+    sweepBatch( ws.batchValueSingle, nPoints, x, result );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue EvaluationTape::AD_forwardBatch( EvaluationWorkspace &ws, int nPoints,
+                                             float *seed, float *df ) const{
+
+    if( nPoints <= 0 ) return SUCCESSFUL_RETURN;
+
+    if( isCompatible( ws ) == BT_FALSE || nPoints != ws.nSingleBatchPoints )
+        return ACADOERROR(RET_VECTOR_DIMENSION_MISMATCH);
+
+    return sweepDerivativeBatch( ws.batchValueSingle, ws.batchDerivativeSingle, nPoints, seed, df );
+}
+
+
+
+returnValue EvaluationTape::evaluateBatch( int nPoints, float *x, float *result ){
+
+    if( isCompatible( batch ) == BT_FALSE )
+        initWorkspace( batch );
+
+    return evaluateBatch( batch, nPoints, x, result );
+}
+
+
+
+returnValue EvaluationTape::AD_forwardBatch( int nPoints, float *seed, float *df ){
+
+    return AD_forwardBatch( batch, nPoints, seed, df );
+}
+
+
+
+returnValue EvaluationTape::getSparsityPattern( SparsityPattern &pattern, int nCols ) const{
+
+    int run1, run2;
+
+    // every register holds the set of entries of x it depends on:
+    const int wordSize = 8*sizeof(unsigned long);
+    const int nWords   = nSlots/wordSize + 1;
+
+    unsigned long *bits = (unsigned long*)calloc(nRegisters*nWords,sizeof(unsigned long));
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        bits[run1*nWords + run1/wordSize] = 1UL << (run1%wordSize);
+
+    const int *c = code;
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        unsigned long       *r = bits + c[1]*nWords;
+        const unsigned long *a = bits + c[2]*nWords;
+
+        switch( c[0] ){
+
+            case TO_ADDITION:
+            case TO_SUBTRACTION:
+            case TO_PRODUCT:
+            case TO_QUOTIENT:
+            case TO_POWER:
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     r[run2] = a[run2] | bits[c[3]*nWords+run2];
+                 break;
+
+            default:
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     r[run2] = a[run2];
+                 break;
+        }
+    }
+
+    // collect the rows of the components:
+    int *rowStart = (int*)calloc(dim+1,sizeof(int));
+    int *colIndex = 0;
+    int  nnz      = 0;
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        const unsigned long *r = bits + output[run1]*nWords;
+
+        for( run2 = 0; run2 < nSlots && run2 < nCols; run2++ ){
+
+            if( ( r[run2/wordSize] >> (run2%wordSize) ) & 1UL ){
+
+                if( nnz % 64 == 0 )
+                    colIndex = (int*)realloc(colIndex,(nnz+64)*sizeof(int));
+                colIndex[nnz++] = run2;
+            }
+        }
+        rowStart[run1+1] = nnz;
+    }
+
+    returnValue returnvalue = pattern.init( dim, nCols, rowStart, colIndex );
+
+    free( bits     );
+    free( rowStart );
+    free( colIndex );
+
+    return returnvalue;
+}
+
+
+returnValue EvaluationTape::getHessianSparsityPattern( SparsityPattern &pattern, int nCols ) const{
+
+    int run1, run2;
+
+    const int wordSize = 8*sizeof(unsigned long);
+    const int nWords   = nSlots/wordSize + 1;
+
+    // dependencies of the registers and rows of the Hessian:
+    unsigned long *bits = (unsigned long*)calloc(nRegisters*nWords,sizeof(unsigned long));
+    unsigned long *hess = (unsigned long*)calloc(nSlots    *nWords,sizeof(unsigned long));
+    unsigned long *tmp  = (unsigned long*)calloc(           nWords,sizeof(unsigned long));
+
+    for( run1 = 0; run1 < nSlots; run1++ )
+        bits[run1*nWords + run1/wordSize] = 1UL << (run1%wordSize);
+
+    const int *c = code;
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        unsigned long       *r = bits + c[1]*nWords;
+        const unsigned long *a = bits + c[2]*nWords;
+        const unsigned long *b = bits;
+
+        if( c[0] != TO_POWER_INT )
+            b += c[3]*nWords;
+
+        switch( c[0] ){
+
+            case TO_ADDITION:
+            case TO_SUBTRACTION:
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2] | b[run2];
+                 break;
+
+            case TO_PRODUCT:
+                 couple( hess, a, b, nWords );
+                 couple( hess, b, a, nWords );
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2] | b[run2];
+                 break;
+
+            case TO_QUOTIENT:
+                 couple( hess, a, b, nWords );
+                 couple( hess, b, a, nWords );
+                 couple( hess, b, b, nWords );
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2] | b[run2];
+                 break;
+
+            case TO_POWER:
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2] | b[run2];
+                 couple( hess, tmp, tmp, nWords );
+                 break;
+
+            case TO_ASSIGN:
+            case TO_NEGATION:
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2];
+                 break;
+
+            case TO_POWER_INT:
+                 if( c[3] != 0 && c[3] != 1 )
+                     couple( hess, a, a, nWords );
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2];
+                 break;
+
+            default:
+                 couple( hess, a, a, nWords );
+                 for( run2 = 0; run2 < nWords; run2++ )
+                     tmp[run2] = a[run2];
+                 break;
+        }
+
+        // (the result register may coincide with an argument)
+        for( run2 = 0; run2 < nWords; run2++ )
+            r[run2] = tmp[run2];
+    }
+
+    const int n = acadoMin( nSlots, nCols );
+
+    int *rowStart = (int*)calloc(nCols+1,sizeof(int));
+    int *colIndex = 0;
+    int  nnz      = 0;
+
+    for( run1 = 0; run1 < nCols; run1++ ){
+
+        if( run1 < n ){
+
+            const unsigned long *h = hess + run1*nWords;
+
+            for( run2 = 0; run2 < n; run2++ ){
+
+                if( ( h[run2/wordSize] >> (run2%wordSize) ) & 1UL ){
+
+                    if( nnz % 64 == 0 )
+                        colIndex = (int*)realloc(colIndex,(nnz+64)*sizeof(int));
+                    colIndex[nnz++] = run2;
+                }
+            }
+        }
+        rowStart[run1+1] = nnz;
+    }
+
+    returnValue returnvalue = pattern.init( nCols, nCols, rowStart, colIndex );
+
+    free( bits     );
+    free( hess     );
+    free( tmp      );
+    free( rowStart );
+    free( colIndex );
+
+    return returnvalue;
+}
+
+
+returnValue EvaluationTape::compileNative(){
+
+    if( native != 0 )
+        return SUCCESSFUL_RETURN;
+
+    NativeTape *tmp = new NativeTape();
+    returnValue returnvalue = tmp->init( *this );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        delete tmp;
+        return ACADOERROR( returnvalue );
+    }
+
+    native = tmp;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::exportCode( FILE *file ) const{
+
+    int run1;
+    const int *c;
+    const uint64_t hash = getHash();
+
+    acadoFPrintf( file, "/* generated by ACADO Toolkit: %d registers, %d instructions */\n\n",
+                  nRegisters, nInstructions );
+    acadoFPrintf( file, "#include <math.h>\n#include <stdint.h>\n\n" );
+
+    // everything NativeTape compares before it uses the compiled code:
+    acadoFPrintf( file, "const int acado_tape_signature[4] = { %d, %d, %d, %d };\n\n",
+                  nRegisters, nInstructions, nSlots, nConstants );
+    acadoFPrintf( file, "const uint64_t acado_tape_hash = UINT64_C(0x%08lx%08lx);\n\n",
+                  (unsigned long)( hash >> 32 ), (unsigned long)( hash & 0xffffffffu ) );
+
+    acadoFPrintf( file, "const int acado_tape_code[%d] = {", 4*nInstructions+1 );
+    for( run1 = 0; run1 < 4*nInstructions; run1++ )
+        acadoFPrintf( file, "%s%d,", (run1%16 == 0) ? "\n" : " ", code[run1] );
+    acadoFPrintf( file, " 0 };\n\n" );
+
+    acadoFPrintf( file, "const int acado_tape_constants[%d] = {", nConstants+1 );
+    for( run1 = 0; run1 < nConstants; run1++ )
+        acadoFPrintf( file, "%s%d,", (run1%16 == 0) ? "\n" : " ", constantIndex[run1] );
+    acadoFPrintf( file, " 0 };\n\n" );
+
+    // the instructions:
+    acadoFPrintf( file, "void acado_tape_evaluate( double *w ){\n\n" );
+    for( run1 = 0, c = code; run1 < nInstructions; run1++, c += 4 ){
+
+        switch( c[0] ){
+
+            case TO_ASSIGN     : acadoFPrintf( file, "w[%d] = w[%d];\n"           , c[1], c[2]       ); break;
+            case TO_ADDITION   : acadoFPrintf( file, "w[%d] = w[%d] + w[%d];\n"   , c[1], c[2], c[3] ); break;
+            case TO_SUBTRACTION: acadoFPrintf( file, "w[%d] = w[%d] - w[%d];\n"   , c[1], c[2], c[3] ); break;
+            case TO_PRODUCT    : acadoFPrintf( file, "w[%d] = w[%d] * w[%d];\n"   , c[1], c[2], c[3] ); break;
+            case TO_QUOTIENT   : acadoFPrintf( file, "w[%d] = w[%d] / w[%d];\n"   , c[1], c[2], c[3] ); break;
+            case TO_POWER      : acadoFPrintf( file, "w[%d] = pow(w[%d],w[%d]);\n", c[1], c[2], c[3] ); break;
+            case TO_POWER_INT  : acadoFPrintf( file, "w[%d] = pow(w[%d],%d.0);\n" , c[1], c[2], c[3] ); break;
+            case TO_ACOS       : acadoFPrintf( file, "w[%d] = acos(w[%d]);\n"     , c[1], c[2]       ); break;
+            case TO_ASIN       : acadoFPrintf( file, "w[%d] = asin(w[%d]);\n"     , c[1], c[2]       ); break;
+            case TO_ATAN       : acadoFPrintf( file, "w[%d] = atan(w[%d]);\n"     , c[1], c[2]       ); break;
+            case TO_COS        : acadoFPrintf( file, "w[%d] = cos(w[%d]);\n"      , c[1], c[2]       ); break;
+            case TO_EXP        : acadoFPrintf( file, "w[%d] = exp(w[%d]);\n"      , c[1], c[2]       ); break;
+            case TO_LOG        : acadoFPrintf( file, "w[%d] = log(w[%d]);\n"      , c[1], c[2]       ); break;
+            case TO_SIN        : acadoFPrintf( file, "w[%d] = sin(w[%d]);\n"      , c[1], c[2]       ); break;
+            case TO_TAN        : acadoFPrintf( file, "w[%d] = tan(w[%d]);\n"      , c[1], c[2]       ); break;
+            case TO_NEGATION   : acadoFPrintf( file, "w[%d] = -w[%d];\n"          , c[1], c[2]       ); break;
+        }
+    }
+    acadoFPrintf( file, "}\n\n" );
+
+    // the instructions and their derivatives:
+    acadoFPrintf( file, "void acado_tape_forward( double *w, double *d ){\n\n" );
+    for( run1 = 0; run1 < nConstants; run1++ )
+        acadoFPrintf( file, "d[%d] = 0.0;\n", constantIndex[run1] );
+    acadoFPrintf( file, "acado_tape_evaluate( w );\n" );
+    for( run1 = 0, c = code; run1 < nInstructions; run1++, c += 4 )
+        exportDerivative( file, c );
+    acadoFPrintf( file, "}\n\n" );
+
+    // the derivatives only:
+    acadoFPrintf( file, "void acado_tape_derivative( const double *w, double *d ){\n\n" );
+    for( run1 = 0; run1 < nConstants; run1++ )
+        acadoFPrintf( file, "d[%d] = 0.0;\n", constantIndex[run1] );
+    for( run1 = 0, c = code; run1 < nInstructions; run1++, c += 4 )
+        exportDerivative( file, c );
+    acadoFPrintf( file, "}\n\n" );
+
+    // the backward sweep:
+    acadoFPrintf( file, "void acado_tape_backward( const double *w, double *a ){\n\n" );
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        c = code + 4*run1;
+
+        switch( c[0] ){
+
+            case TO_ASSIGN     : acadoFPrintf( file, "a[%d] += a[%d];\n", c[2], c[1] ); break;
+            case TO_ADDITION   : acadoFPrintf( file, "a[%d] += a[%d]; a[%d] += a[%d];\n", c[2], c[1], c[3], c[1] ); break;
+            case TO_SUBTRACTION: acadoFPrintf( file, "a[%d] += a[%d]; a[%d] -= a[%d];\n", c[2], c[1], c[3], c[1] ); break;
+
+            case TO_PRODUCT:
+                 acadoFPrintf( file, "a[%d] += a[%d]*w[%d]; a[%d] += a[%d]*w[%d];\n",
+                               c[2], c[1], c[3], c[3], c[1], c[2] );
+                 break;
+
+            case TO_QUOTIENT:
+                 acadoFPrintf( file, "a[%d] += a[%d]/w[%d]; a[%d] -= a[%d]*w[%d]/(w[%d]*w[%d]);\n",
+                               c[2], c[1], c[3], c[3], c[1], c[2], c[3], c[3] );
+                 break;
+
+            case TO_POWER:
+                 acadoFPrintf( file, "a[%d] += w[%d]*pow(w[%d],w[%d]-1.0)*a[%d]; a[%d] += w[%d]*log(w[%d])*a[%d];\n",
+                               c[2], c[3], c[2], c[3], c[1], c[3], c[1], c[2], c[1] );
+                 break;
+
+            case TO_POWER_INT:
+                 acadoFPrintf( file, "a[%d] += %d.0*pow(w[%d],%d.0)*a[%d];\n", c[2], c[3], c[2], c[3]-1, c[1] );
+                 break;
+
+            case TO_ACOS: acadoFPrintf( file, "a[%d] += -1.0/sqrt(1.0-w[%d]*w[%d])*a[%d];\n", c[2], c[2], c[2], c[1] ); break;
+            case TO_ASIN: acadoFPrintf( file, "a[%d] +=  1.0/sqrt(1.0-w[%d]*w[%d])*a[%d];\n", c[2], c[2], c[2], c[1] ); break;
+            case TO_ATAN: acadoFPrintf( file, "a[%d] +=  1.0/(1.0+w[%d]*w[%d])*a[%d];\n"    , c[2], c[2], c[2], c[1] ); break;
+            case TO_COS : acadoFPrintf( file, "a[%d] += -sin(w[%d])*a[%d];\n"               , c[2], c[2], c[1]       ); break;
+            case TO_EXP : acadoFPrintf( file, "a[%d] +=  w[%d]*a[%d];\n"                    , c[2], c[1], c[1]       ); break;
+            case TO_LOG : acadoFPrintf( file, "a[%d] +=  1.0/w[%d]*a[%d];\n"                , c[2], c[2], c[1]       ); break;
+            case TO_SIN : acadoFPrintf( file, "a[%d] +=  cos(w[%d])*a[%d];\n"               , c[2], c[2], c[1]       ); break;
+            case TO_TAN : acadoFPrintf( file, "a[%d] += (1.0+w[%d]*w[%d])*a[%d];\n"         , c[2], c[1], c[1], c[1] ); break;
+            case TO_NEGATION: acadoFPrintf( file, "a[%d] -= a[%d];\n"                      , c[2], c[1]             ); break;
+        }
+    }
+    acadoFPrintf( file, "}\n\n" );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+uint64_t EvaluationTape::getHash() const{
+
+    int run1;
+
+    // 64 bit FNV-1a hash of everything that enters the exported code,
+    // starting from the offset basis 0xcbf29ce484222325:
+    uint64_t hash = ( (uint64_t)0xcbf29ce4u << 32 ) | 0x84222325u;
+
+    const int header[4] = { nRegisters, nInstructions, nSlots, nConstants };
+
+    for( run1 = 0; run1 < 4; run1++ )
+        hash = hashWord( hash, header[run1] );
+
+    for( run1 = 0; run1 < 4*nInstructions; run1++ )
+        hash = hashWord( hash, code[run1] );
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        hash = hashWord( hash, constantIndex[run1] );
+
+    return hash;
+}
+
+
+returnValue EvaluationTape::evaluate( int number, double *x, double *result,
+                                      int nComp, const int *comp ){
+
+    returnValue returnvalue = select( nComp, comp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    allocate( number );
+    return selected->evaluate( *buffer[number], x, result );
+}
+
+
+
+returnValue EvaluationTape::AD_forward( int number, double *seed, double *df,
+                                        int nComp, const int *comp ){
+
+    returnValue returnvalue = select( nComp, comp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    allocate( number );
+    return selected->AD_forward( *buffer[number], seed, df );
+}
+
+
+
+returnValue EvaluationTape::AD_backward( int number, double *seed, double *df,
+                                         int nComp, const int *comp ){
+
+    returnValue returnvalue = select( nComp, comp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    allocate( number );
+    return selected->AD_backward( *buffer[number], seed, df );
+}
+
+
+
+returnValue EvaluationTape::clearBuffer(){
+
+    int run1;
+
+    for( run1 = 0; run1 < bufferSize; run1++ )
+        delete buffer[run1];
+
+    free( buffer );
+
+    bufferSize = 0;
+    buffer     = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+
+//
+// RECORDING:
+//
+
+void EvaluationTape::addition( Operator &arg1, Operator &arg2 ){
+
+    int tmp = record( &arg1 );
+    current = append( TO_ADDITION, tmp, record( &arg2 ) );
+}
+
+
+void EvaluationTape::subtraction( Operator &arg1, Operator &arg2 ){
+
+    int tmp = record( &arg1 );
+    current = append( TO_SUBTRACTION, tmp, record( &arg2 ) );
+}
+
+
+void EvaluationTape::product( Operator &arg1, Operator &arg2 ){
+
+    int tmp = record( &arg1 );
+    current = append( TO_PRODUCT, tmp, record( &arg2 ) );
+}
+
+
+void EvaluationTape::quotient( Operator &arg1, Operator &arg2 ){
+
+    int tmp = record( &arg1 );
+    current = append( TO_QUOTIENT, tmp, record( &arg2 ) );
+}
+
+
+void EvaluationTape::power( Operator &arg1, Operator &arg2 ){
+
+    int tmp = record( &arg1 );
+    current = append( TO_POWER, tmp, record( &arg2 ) );
+}
+
+
+void EvaluationTape::powerInt( Operator &arg1, int &arg2 ){
+
+    current = append( TO_POWER_INT, record( &arg1 ), arg2 );
+}
+
+
+void EvaluationTape::project( int &idx ){
+
+    if( idx+1 > nSlots )
+        nSlots = idx+1;
+
+    current = -idx-1;
+}
+
+
+void EvaluationTape::set( double &arg ){
+
+    constantIndex = (int*   )realloc(constantIndex,(nConstants+1)*sizeof(int   ));
+    constant      = (double*)realloc(constant     ,(nConstants+1)*sizeof(double));
+
+    constantIndex[nConstants] = nRegisters++;
+    constant     [nConstants] = arg;
+
+    current = constantIndex[nConstants];
+    nConstants++;
+}
+
+
+void EvaluationTape::Acos( Operator &arg ){ current = append( TO_ACOS, record( &arg ), 0 ); }
+void EvaluationTape::Asin( Operator &arg ){ current = append( TO_ASIN, record( &arg ), 0 ); }
+void EvaluationTape::Atan( Operator &arg ){ current = append( TO_ATAN, record( &arg ), 0 ); }
+void EvaluationTape::Cos ( Operator &arg ){ current = append( TO_COS , record( &arg ), 0 ); }
+void EvaluationTape::Exp ( Operator &arg ){ current = append( TO_EXP , record( &arg ), 0 ); }
+void EvaluationTape::Log ( Operator &arg ){ current = append( TO_LOG , record( &arg ), 0 ); }
+void EvaluationTape::Sin ( Operator &arg ){ current = append( TO_SIN , record( &arg ), 0 ); }
+void EvaluationTape::Tan ( Operator &arg ){ current = append( TO_TAN , record( &arg ), 0 ); }
+
+void EvaluationTape::negation( Operator &arg ){ current = append( TO_NEGATION, record( &arg ), 0 ); }
+
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void EvaluationTape::copy( const EvaluationTape& arg ){
+
+    int run1;
+
+    nInstructions   = arg.nInstructions;
+    maxInstructions = arg.nInstructions;
+    nRegisters      = arg.nRegisters   ;
+    nSlots          = arg.nSlots       ;
+    nConstants      = arg.nConstants   ;
+    dim             = arg.dim          ;
+    nStates         = arg.nStates      ;
+    bufferSize      = arg.bufferSize   ;
+    current         = 0                ;
+
+    code          = (int*   )calloc(4*nInstructions,sizeof(int   ));
+    constantIndex = (int*   )calloc(nConstants     ,sizeof(int   ));
+    constant      = (double*)calloc(nConstants     ,sizeof(double));
+    output        = (int*   )calloc(dim            ,sizeof(int   ));
+    state         = (int*   )calloc(nStates        ,sizeof(int   ));
+
+    memcpy( code         , arg.code         , 4*nInstructions*sizeof(int   ) );
+    memcpy( constantIndex, arg.constantIndex, nConstants     *sizeof(int   ) );
+    memcpy( constant     , arg.constant     , nConstants     *sizeof(double) );
+    memcpy( output       , arg.output       , dim            *sizeof(int   ) );
+    memcpy( state        , arg.state        , nStates        *sizeof(int   ) );
+
+    buffer = (EvaluationWorkspace**)calloc(bufferSize,sizeof(EvaluationWorkspace*));
+
+    for( run1 = 0; run1 < bufferSize; run1++ )
+        buffer[run1] = new EvaluationWorkspace( *arg.buffer[run1] );
+
+    if( arg.native != 0 ) native = new NativeTape( *arg.native );
+    else                  native = 0;
+
+    // the selection is reduced again when needed:
+    selected  = 0;
+    selection = 0;
+    nSelected = -1;
+}
+
+
+void EvaluationTape::deleteAll(){
+
+    clearBuffer();
+
+    free( code          );
+    free( constantIndex );
+    free( constant      );
+    free( output        );
+    free( state         );
+
+    batch.clear();
+
+    if( native != 0 )
+        delete native;
+
+    if( selected != 0 )
+        delete selected;
+
+    free( selection );
+
+    native          = 0;
+    selected        = 0;
+    selection       = 0;
+    nSelected       = -1;
+    nInstructions   = 0;
+    maxInstructions = 0;
+    code            = 0;
+    nRegisters      = 0;
+    nSlots          = 0;
+    nConstants      = 0;
+    constantIndex   = 0;
+    constant        = 0;
+    dim             = 0;
+    output          = 0;
+    nStates         = 0;
+    state           = 0;
+    current         = 0;
+}
+
+
+returnValue EvaluationTape::select( int nComp, const int *comp ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nComp; run1++ )
+        if( comp[run1] < 0 || comp[run1] >= dim )
+            return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    if( nSelected == nComp && ( nComp == 0 || memcmp( selection, comp, nComp*sizeof(int) ) == 0 ) )
+        return SUCCESSFUL_RETURN;
+
+    if( selected != 0 )
+        delete selected;
+
+    free( selection );
+
+    nSelected = nComp;
+    selection = (int*)calloc(nComp+1,sizeof(int));
+
+    if( nComp > 0 )
+        memcpy( selection, comp, nComp*sizeof(int) );
+
+    selected = new EvaluationTape();
+    selected->initSelection( *this, nComp, comp );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void EvaluationTape::initSelection( const EvaluationTape &arg, int nComp, const int *comp ){
+
+    int run1;
+
+    deleteAll();
+
+    nRegisters = arg.nRegisters;
+    nSlots     = arg.nSlots    ;
+    nConstants = arg.nConstants;
+    dim        = nComp         ;
+
+    constantIndex = (int*   )calloc(nConstants+1,sizeof(int   ));
+    constant      = (double*)calloc(nConstants+1,sizeof(double));
+    output        = (int*   )calloc(dim       +1,sizeof(int   ));
+
+    if( nConstants > 0 ){
+        memcpy( constantIndex, arg.constantIndex, nConstants*sizeof(int   ) );
+        memcpy( constant     , arg.constant     , nConstants*sizeof(double) );
+    }
+
+    // mark the instructions the components depend on; as every
+    // register is written once, one backward pass suffices:
+    BooleanType *isLive = (BooleanType*)calloc(nRegisters       +1,sizeof(BooleanType));
+    BooleanType *isKept = (BooleanType*)calloc(arg.nInstructions+1,sizeof(BooleanType));
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        output[run1] = arg.output[comp[run1]];
+        isLive[output[run1]] = BT_TRUE;
+    }
+
+    for( run1 = arg.nInstructions-1; run1 >= 0; run1-- ){
+
+        const int *c = arg.code + 4*run1;
+
+        if( isLive[c[1]] == BT_FALSE ) continue;
+
+        isKept[run1]  = BT_TRUE;
+        isLive[c[1]]  = BT_FALSE;
+        isLive[c[2]]  = BT_TRUE;
+        nInstructions++;
+
+        switch( c[0] ){
+
+            case TO_ADDITION:
+            case TO_SUBTRACTION:
+            case TO_PRODUCT:
+            case TO_QUOTIENT:
+            case TO_POWER:
+                 isLive[c[3]] = BT_TRUE;
+                 break;
+
+            default:
+                 break;
+        }
+    }
+
+    maxInstructions = nInstructions;
+    code = (int*)calloc(4*nInstructions+1,sizeof(int));
+
+    nInstructions = 0;
+
+    for( run1 = 0; run1 < arg.nInstructions; run1++ ){
+        if( isKept[run1] == BT_TRUE ){
+            memcpy( code + 4*nInstructions, arg.code + 4*run1, 4*sizeof(int) );
+            nInstructions++;
+        }
+    }
+
+    // only the intermediate states which are assigned are written back:
+    for( run1 = 0; run1 < nRegisters; run1++ )
+        isLive[run1] = BT_FALSE;
+
+    for( run1 = 0; run1 < nInstructions; run1++ )
+        isLive[code[4*run1+1]] = BT_TRUE;
+
+    state = (int*)calloc(arg.nStates+1,sizeof(int));
+
+    for( run1 = 0; run1 < arg.nStates; run1++ )
+        if( isLive[arg.state[run1]] == BT_TRUE )
+            state[nStates++] = arg.state[run1];
+
+    free( isLive );
+    free( isKept );
+}
+
+
+int EvaluationTape::record( Operator *arg ){
+
+    std::map< Operator*, int >::iterator it = registers.find( arg );
+
+    if( it != registers.end() )
+        return it->second;
+
+    arg->evaluate( this );
+    registers[arg] = current;
+
+    return current;
+}
+
+
+int EvaluationTape::append( TapeOperation op, int arg1, int arg2 ){
+
+    int result = nRegisters++;
+    emit( op, result, arg1, arg2 );
+
+    return result;
+}
+
+
+void EvaluationTape::emit( TapeOperation op, int result, int arg1, int arg2 ){
+
+    if( nInstructions >= maxInstructions ){
+        maxInstructions = 2*maxInstructions + 16;
+        code = (int*)realloc(code,4*maxInstructions*sizeof(int));
+    }
+
+    code[4*nInstructions  ] = op    ;
+    code[4*nInstructions+1] = result;
+    code[4*nInstructions+2] = arg1  ;
+    code[4*nInstructions+3] = arg2  ;
+
+    nInstructions++;
+}
+
+
+void EvaluationTape::exportDerivative( FILE *file, const int *c ) const{
+
+    switch( c[0] ){
+
+        case TO_ASSIGN     : acadoFPrintf( file, "d[%d] = d[%d];\n"        , c[1], c[2]       ); break;
+        case TO_ADDITION   : acadoFPrintf( file, "d[%d] = d[%d] + d[%d];\n", c[1], c[2], c[3] ); break;
+        case TO_SUBTRACTION: acadoFPrintf( file, "d[%d] = d[%d] - d[%d];\n", c[1], c[2], c[3] ); break;
+
+        case TO_PRODUCT:
+             acadoFPrintf( file, "d[%d] = d[%d]*w[%d] + w[%d]*d[%d];\n", c[1], c[2], c[3], c[2], c[3] );
+             break;
+
+        case TO_QUOTIENT:
+             acadoFPrintf( file, "d[%d] = d[%d]/w[%d] - (w[%d]*d[%d])/(w[%d]*w[%d]);\n",
+                           c[1], c[2], c[3], c[2], c[3], c[3], c[3] );
+             break;
+
+        case TO_POWER:
+             acadoFPrintf( file, "d[%d] = w[%d]*pow(w[%d],w[%d]-1.0)*d[%d] + w[%d]*log(w[%d])*d[%d];\n",
+                           c[1], c[3], c[2], c[3], c[2], c[1], c[2], c[3] );
+             break;
+
+        case TO_POWER_INT:
+             acadoFPrintf( file, "d[%d] = %d.0*pow(w[%d],%d.0)*d[%d];\n", c[1], c[3], c[2], c[3]-1, c[2] );
+             break;
+
+        case TO_ACOS: acadoFPrintf( file, "d[%d] = -1.0/sqrt(1.0-w[%d]*w[%d])*d[%d];\n", c[1], c[2], c[2], c[2] ); break;
+        case TO_ASIN: acadoFPrintf( file, "d[%d] =  1.0/sqrt(1.0-w[%d]*w[%d])*d[%d];\n", c[1], c[2], c[2], c[2] ); break;
+        case TO_ATAN: acadoFPrintf( file, "d[%d] =  1.0/(1.0+w[%d]*w[%d])*d[%d];\n"    , c[1], c[2], c[2], c[2] ); break;
+        case TO_COS : acadoFPrintf( file, "d[%d] = -sin(w[%d])*d[%d];\n"               , c[1], c[2], c[2]       ); break;
+        case TO_EXP : acadoFPrintf( file, "d[%d] =  w[%d]*d[%d];\n"                    , c[1], c[1], c[2]       ); break;
+        case TO_LOG : acadoFPrintf( file, "d[%d] =  1.0/w[%d]*d[%d];\n"                , c[1], c[2], c[2]       ); break;
+        case TO_SIN : acadoFPrintf( file, "d[%d] =  cos(w[%d])*d[%d];\n"               , c[1], c[2], c[2]       ); break;
+        case TO_TAN : acadoFPrintf( file, "d[%d] = (1.0+w[%d]*w[%d])*d[%d];\n"         , c[1], c[1], c[1], c[2] ); break;
+        case TO_NEGATION: acadoFPrintf( file, "d[%d] = -d[%d];\n"                      , c[1], c[2]             ); break;
+    }
+}
+
+
+void EvaluationTape::allocate( int number ){
+
+    int run1;
+
+    if( number < bufferSize ) return;
+
+    int oldSize = bufferSize;
+    bufferSize  = number+1;
+
+    buffer = (EvaluationWorkspace**)realloc(buffer,bufferSize*sizeof(EvaluationWorkspace*));
+
+    for( run1 = oldSize; run1 < bufferSize; run1++ ){
+
+        buffer[run1] = new EvaluationWorkspace();
+        initWorkspace( *buffer[run1] );
+    }
+}
+
+
+void EvaluationTape::gather( int number, int nPoints ){
+
+    int run1, run2;
+
+    allocate( number+nPoints-1 );
+
+    if( isCompatible( batch ) == BT_FALSE )
+        initWorkspace( batch );
+
+    batch.allocatePoints( nPoints );
+    batch.nBatchPoints = nPoints;
+
+    for( run2 = 0; run2 < nPoints; run2++ ){
+
+        const double *w = buffer[number+run2]->value;
+
+        for( run1 = 0; run1 < nRegisters; run1++ )
+            batch.batchValue[run1*nPoints+run2] = w[run1];
+    }
+}
+
+
+void EvaluationTape::couple( unsigned long *hess, const unsigned long *a,
+                            const unsigned long *b, int nWords ){
+
+    int run1, run2;
+
+    const int wordSize = 8*sizeof(unsigned long);
+
+    for( run1 = 0; run1 < nWords*wordSize; run1++ ){
+
+        if( ( a[run1/wordSize] >> (run1%wordSize) ) & 1UL ){
+
+            unsigned long *h = hess + run1*nWords;
+
+            for( run2 = 0; run2 < nWords; run2++ )
+                h[run2] |= b[run2];
+        }
+    }
+}
+
+
+void EvaluationTape::forward( double *w, double *d ) const{
+
+    if( native != 0 ){
+        native->forward( w, d );
+        return;
+    }
+
+    int run1;
+    const int *c = code;
+
+    if( d == 0 ){
+
+        for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+            switch( c[0] ){
+
+                case TO_ASSIGN     : w[c[1]] = w[c[2]];                  break;
+                case TO_ADDITION   : w[c[1]] = w[c[2]] + w[c[3]];        break;
+                case TO_SUBTRACTION: w[c[1]] = w[c[2]] - w[c[3]];        break;
+                case TO_PRODUCT    : w[c[1]] = w[c[2]] * w[c[3]];        break;
+                case TO_QUOTIENT   : w[c[1]] = w[c[2]] / w[c[3]];        break;
+                case TO_POWER      : w[c[1]] = pow( w[c[2]], w[c[3]] );  break;
+                case TO_POWER_INT  : w[c[1]] = pow( w[c[2]], c[3] );     break;
+                case TO_ACOS       : w[c[1]] = acos( w[c[2]] );          break;
+                case TO_ASIN       : w[c[1]] = asin( w[c[2]] );          break;
+                case TO_ATAN       : w[c[1]] = atan( w[c[2]] );          break;
+                case TO_COS        : w[c[1]] = cos ( w[c[2]] );          break;
+                case TO_EXP        : w[c[1]] = exp ( w[c[2]] );          break;
+                case TO_LOG        : w[c[1]] = log ( w[c[2]] );          break;
+                case TO_SIN        : w[c[1]] = sin ( w[c[2]] );          break;
+                case TO_TAN        : w[c[1]] = tan ( w[c[2]] );          break;
+                case TO_NEGATION   : w[c[1]] = -w[c[2]];                 break;
+            }
+        }
+        return;
+    }
+
+    // constants have a zero derivative:
+    for( run1 = 0; run1 < nConstants; run1++ )
+        d[constantIndex[run1]] = 0.0;
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        const double a = w[c[2]];
+
+        switch( c[0] ){
+
+            case TO_ASSIGN:
+                 w[c[1]] = a;
+                 d[c[1]] = d[c[2]];
+                 break;
+
+            case TO_ADDITION:
+                 w[c[1]] = a + w[c[3]];
+                 d[c[1]] = d[c[2]] + d[c[3]];
+                 break;
+
+            case TO_SUBTRACTION:
+                 w[c[1]] = a - w[c[3]];
+                 d[c[1]] = d[c[2]] - d[c[3]];
+                 break;
+
+            case TO_PRODUCT:
+                 w[c[1]] = a * w[c[3]];
+                 d[c[1]] = d[c[2]]*w[c[3]] + a*d[c[3]];
+                 break;
+
+            case TO_QUOTIENT:
+                 w[c[1]] = a / w[c[3]];
+                 d[c[1]] = d[c[2]]/w[c[3]] - (a*d[c[3]])/(w[c[3]]*w[c[3]]);
+                 break;
+
+            case TO_POWER:
+                 w[c[1]] = pow( a, w[c[3]] );
+                 d[c[1]] = w[c[3]]*pow( a, w[c[3]]-1.0 )*d[c[2]] + w[c[1]]*log( a )*d[c[3]];
+                 break;
+
+            case TO_POWER_INT:
+                 w[c[1]] = pow( a, c[3] );
+                 d[c[1]] = c[3]*pow( a, c[3]-1 )*d[c[2]];
+                 break;
+
+            case TO_ACOS: w[c[1]] = acos( a ); d[c[1]] = -1.0/sqrt(1.0-a*a)*d[c[2]];  break;
+            case TO_ASIN: w[c[1]] = asin( a ); d[c[1]] =  1.0/sqrt(1.0-a*a)*d[c[2]];  break;
+            case TO_ATAN: w[c[1]] = atan( a ); d[c[1]] =  1.0/(1.0+a*a)*d[c[2]];      break;
+            case TO_COS : w[c[1]] = cos ( a ); d[c[1]] = -sin( a )*d[c[2]];            break;
+            case TO_EXP : w[c[1]] = exp ( a ); d[c[1]] =  w[c[1]]*d[c[2]];             break;
+            case TO_LOG : w[c[1]] = log ( a ); d[c[1]] =  1.0/a*d[c[2]];               break;
+            case TO_SIN : w[c[1]] = sin ( a ); d[c[1]] =  cos( a )*d[c[2]];            break;
+            case TO_TAN : w[c[1]] = tan ( a ); d[c[1]] = (1.0+w[c[1]]*w[c[1]])*d[c[2]]; break;
+            case TO_NEGATION: w[c[1]] = -a;    d[c[1]] = -d[c[2]];                      break;
+        }
+    }
+}
+
+
+void EvaluationTape::forwardDerivative( const double *w, double *d ) const{
+
+    if( native != 0 ){
+        native->forwardDerivative( w, d );
+        return;
+    }
+
+    int run1;
+    const int *c = code;
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        d[constantIndex[run1]] = 0.0;
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        const double a = w[c[2]];
+
+        switch( c[0] ){
+
+            case TO_ASSIGN     : d[c[1]] = d[c[2]];                 break;
+            case TO_ADDITION   : d[c[1]] = d[c[2]] + d[c[3]];       break;
+            case TO_SUBTRACTION: d[c[1]] = d[c[2]] - d[c[3]];       break;
+            case TO_PRODUCT    : d[c[1]] = d[c[2]]*w[c[3]] + a*d[c[3]]; break;
+
+            case TO_QUOTIENT:
+                 d[c[1]] = d[c[2]]/w[c[3]] - (a*d[c[3]])/(w[c[3]]*w[c[3]]);
+                 break;
+
+            case TO_POWER:
+                 d[c[1]] = w[c[3]]*pow( a, w[c[3]]-1.0 )*d[c[2]] + w[c[1]]*log( a )*d[c[3]];
+                 break;
+
+            case TO_POWER_INT:
+                 d[c[1]] = c[3]*pow( a, c[3]-1 )*d[c[2]];
+                 break;
+
+            case TO_ACOS: d[c[1]] = -1.0/sqrt(1.0-a*a)*d[c[2]];           break;
+            case TO_ASIN: d[c[1]] =  1.0/sqrt(1.0-a*a)*d[c[2]];           break;
+            case TO_ATAN: d[c[1]] =  1.0/(1.0+a*a)*d[c[2]];               break;
+            case TO_COS : d[c[1]] = -sin( a )*d[c[2]];                     break;
+            case TO_EXP : d[c[1]] =  w[c[1]]*d[c[2]];                      break;
+            case TO_LOG : d[c[1]] =  1.0/a*d[c[2]];                        break;
+            case TO_SIN : d[c[1]] =  cos( a )*d[c[2]];                     break;
+            case TO_TAN : d[c[1]] = (1.0+w[c[1]]*w[c[1]])*d[c[2]];         break;
+            case TO_NEGATION: d[c[1]] = -d[c[2]];                          break;
+        }
+    }
+}
+
+
+void EvaluationTape::backward( const double *w, double *a ) const{
+
+    if( native != 0 ){
+        native->backward( w, a );
+        return;
+    }
+
+    int run1;
+    const int *c = code + 4*nInstructions;
+
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        c -= 4;
+
+        const double s = a[c[1]];
+        const double x = w[c[2]];
+
+        switch( c[0] ){
+
+            case TO_ASSIGN     : a[c[2]] += s;                       break;
+            case TO_ADDITION   : a[c[2]] += s; a[c[3]] += s;         break;
+            case TO_SUBTRACTION: a[c[2]] += s; a[c[3]] -= s;         break;
+            case TO_PRODUCT    : a[c[2]] += s*w[c[3]]; a[c[3]] += s*x; break;
+
+            case TO_QUOTIENT:
+                 a[c[2]] += s/w[c[3]];
+                 a[c[3]] -= s*x/(w[c[3]]*w[c[3]]);
+                 break;
+
+            case TO_POWER:
+                 a[c[2]] += w[c[3]]*pow( x, w[c[3]]-1.0 )*s;
+                 a[c[3]] += w[c[1]]*log( x )*s;
+                 break;
+
+            case TO_POWER_INT:
+                 a[c[2]] += c[3]*pow( x, c[3]-1 )*s;
+                 break;
+
+            case TO_ACOS: a[c[2]] += -1.0/sqrt(1.0-x*x)*s;        break;
+            case TO_ASIN: a[c[2]] +=  1.0/sqrt(1.0-x*x)*s;        break;
+            case TO_ATAN: a[c[2]] +=  1.0/(1.0+x*x)*s;            break;
+            case TO_COS : a[c[2]] += -sin( x )*s;                  break;
+            case TO_EXP : a[c[2]] +=  w[c[1]]*s;                   break;
+            case TO_LOG : a[c[2]] +=  1.0/x*s;                     break;
+            case TO_SIN : a[c[2]] +=  cos( x )*s;                  break;
+            case TO_TAN : a[c[2]] += (1.0+w[c[1]]*w[c[1]])*s;      break;
+            case TO_NEGATION: a[c[2]] -= s;                        break;
+        }
+    }
+}
+
+
+returnValue EvaluationTape::forwardBlock( const double *w, double *d, int nDir ) const{
+
+    int run1, run2, nArgs;
+    const int *c = code;
+    double g1 = 0.0, g2 = 0.0;
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        for( run2 = 0; run2 < nDir; run2++ )
+            d[constantIndex[run1]*nDir+run2] = 0.0;
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        double       *r  = d + c[1]*nDir;
+        const double *a1 = d + c[2]*nDir;
+
+        nArgs = partials( c, w, 1, g1, g2 );
+
+        if( nArgs == 0 )
+            return ACADOERROR(RET_UNKNOWN_BUG);
+
+        if( nArgs == 1 ){
+
+            for( run2 = 0; run2 < nDir; run2++ )
+                r[run2] = g1*a1[run2];
+        }
+        else{
+
+            const double *a2 = d + c[3]*nDir;
+
+            for( run2 = 0; run2 < nDir; run2++ )
+                r[run2] = g1*a1[run2] + g2*a2[run2];
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::backwardBlock( const double *w, double *a, int nDir ) const{
+
+    int run1, run2, nArgs;
+    const int *c = code + 4*nInstructions;
+    double g1 = 0.0, g2 = 0.0;
+
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        c -= 4;
+
+        const double *s  = a + c[1]*nDir;
+        double       *a1 = a + c[2]*nDir;
+
+        nArgs = partials( c, w, 1, g1, g2 );
+
+        if( nArgs == 0 )
+            return ACADOERROR(RET_UNKNOWN_BUG);
+
+        if( nArgs == 1 ){
+
+            for( run2 = 0; run2 < nDir; run2++ )
+                a1[run2] += g1*s[run2];
+        }
+        else{
+
+            double *a2 = a + c[3]*nDir;
+
+            for( run2 = 0; run2 < nDir; run2++ ){
+                a1[run2] += g1*s[run2];
+                a2[run2] += g2*s[run2];
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::forward2( const double *w, const double *d,
+                                      double *e, double *ee ) const{
+
+    int run1, nArgs;
+    const int *c = code;
+    double g1 = 0.0, g2 = 0.0, h11, h12, h22;
+
+    // constants have zero derivatives:
+    for( run1 = 0; run1 < nConstants; run1++ ){
+        e [constantIndex[run1]] = 0.0;
+        ee[constantIndex[run1]] = 0.0;
+    }
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        nArgs = partials( c, w, 1, g1, g2 );
+
+        if( nArgs == 0 )
+            return ACADOERROR(RET_UNKNOWN_BUG);
+
+        secondPartials( c, w, h11, h12, h22 );
+
+        const double ea  = e [c[2]];
+        const double eea = ee[c[2]];
+        const double da  = d [c[2]];
+
+        if( nArgs == 1 ){
+            e [c[1]] = g1*ea;
+            ee[c[1]] = g1*eea + h11*ea*da;
+        }
+        else{
+            const double eb  = e [c[3]];
+            const double eeb = ee[c[3]];
+            const double db  = d [c[3]];
+
+            e [c[1]] = g1*ea + g2*eb;
+            ee[c[1]] = g1*eea + g2*eeb + h11*ea*da + h12*(ea*db + eb*da) + h22*eb*db;
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::backward2( const double *w, const double *d,
+                                       double *a, double *aa ) const{
+
+    int run1, nArgs;
+    const int *c = code + 4*nInstructions;
+    double g1 = 0.0, g2 = 0.0, h11, h12, h22;
+
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        c -= 4;
+
+        nArgs = partials( c, w, 1, g1, g2 );
+
+        if( nArgs == 0 )
+            return ACADOERROR(RET_UNKNOWN_BUG);
+
+        secondPartials( c, w, h11, h12, h22 );
+
+        const double s  = a [c[1]];
+        const double ss = aa[c[1]];
+        const double da = d [c[2]];
+
+        if( nArgs == 1 ){
+            a [c[2]] += g1*s;
+            aa[c[2]] += g1*ss + s*h11*da;
+        }
+        else{
+            const double db = d[c[3]];
+
+            a [c[2]] += g1*s;
+            aa[c[2]] += g1*ss + s*(h11*da + h12*db);
+            a [c[3]] += g2*s;
+            aa[c[3]] += g2*ss + s*(h12*da + h22*db);
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+template <typename T>
+void EvaluationTape::sweepBatch( T *w, int nPoints, T *x, T *result ) const{
+
+    int run1, run2;
+
+    for( run1 = 0; run1 < nSlots*nPoints; run1++ )
+        w[run1] = x[run1];
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            w[constantIndex[run1]*nPoints+run2] = (T)constant[run1];
+
+    forwardBatch( w, nPoints );
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            x[state[run1]*nPoints+run2] = w[state[run1]*nPoints+run2];
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            result[run1*nPoints+run2] = w[output[run1]*nPoints+run2];
+}
+
+
+template <typename T>
+returnValue EvaluationTape::sweepDerivativeBatch( const T *w, T *d, int nPoints,
+                                           T *seed, T *df ) const{
+
+    int run1, run2;
+
+    for( run1 = 0; run1 < nSlots*nPoints; run1++ )
+        d[run1] = seed[run1];
+
+    if( forwardDerivativeBatch( w, d, nPoints ) != SUCCESSFUL_RETURN )
+        return RET_UNKNOWN_BUG;
+
+    for( run1 = 0; run1 < nStates; run1++ )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            seed[state[run1]*nPoints+run2] = d[state[run1]*nPoints+run2];
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            df[run1*nPoints+run2] = d[output[run1]*nPoints+run2];
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+template <typename T>
+void EvaluationTape::forwardBatch( T *w, int nPoints ) const{
+
+    int run1, run2;
+    const int *c = code;
+
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        // the last entry of TO_POWER_INT is the exponent, not a register:
+        const int arg2 = ( c[0] == TO_POWER_INT ) ? 0 : c[3];
+
+        T       *r = w + c[1]*nPoints;
+        const T *a = w + c[2]*nPoints;
+        const T *b = w + arg2*nPoints;
+
+        switch( c[0] ){
+
+            case TO_ASSIGN:
+                 for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = a[run2];
+                 break;
+
+            case TO_ADDITION   : batchAdd     ( r, a, b, nPoints ); break;
+            case TO_SUBTRACTION: batchSubtract( r, a, b, nPoints ); break;
+            case TO_PRODUCT    : batchMultiply( r, a, b, nPoints ); break;
+            case TO_QUOTIENT   : batchDivide  ( r, a, b, nPoints ); break;
+
+            case TO_POWER:
+                 for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = pow( a[run2], b[run2] );
+                 break;
+
+            case TO_POWER_INT:
+                 for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = (T)pow( a[run2], c[3] );
+                 break;
+
+            case TO_ACOS: for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = acos( a[run2] ); break;
+            case TO_ASIN: for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = asin( a[run2] ); break;
+            case TO_ATAN: for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = atan( a[run2] ); break;
+            case TO_COS : for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = cos ( a[run2] ); break;
+            case TO_EXP : for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = exp ( a[run2] ); break;
+            case TO_LOG : for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = log ( a[run2] ); break;
+            case TO_SIN : for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = sin ( a[run2] ); break;
+            case TO_TAN : for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = tan ( a[run2] ); break;
+            case TO_NEGATION: for( run2 = 0; run2 < nPoints; run2++ ) r[run2] = -a[run2];    break;
+        }
+    }
+}
+
+
+template <typename T>
+returnValue EvaluationTape::forwardDerivativeBatch( const T *w, T *d, int nPoints ) const{
+
+    int run1, run2;
+    const int *c = code;
+    const T one = (T)1;
+
+    for( run1 = 0; run1 < nConstants; run1++ )
+        for( run2 = 0; run2 < nPoints; run2++ )
+            d[constantIndex[run1]*nPoints+run2] = 0;
+
+    // the derivatives are evaluated in the loops over the points (see
+    // forwardDerivative), such that the instruction is dispatched only once:
+    for( run1 = 0; run1 < nInstructions; run1++, c += 4 ){
+
+        const int arg2 = ( c[0] == TO_POWER_INT ) ? 0 : c[3];
+
+        T       *dr = d + c[1]*nPoints;
+        const T *da = d + c[2]*nPoints;
+        const T *db = d + arg2*nPoints;
+        const T *r  = w + c[1]*nPoints;
+        const T *a  = w + c[2]*nPoints;
+        const T *b  = w + arg2*nPoints;
+
+        switch( c[0] ){
+
+            case TO_ASSIGN:
+                 for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = da[run2];
+                 break;
+
+            case TO_ADDITION   : batchAdd               ( dr, da, db, nPoints );       break;
+            case TO_SUBTRACTION: batchSubtract          ( dr, da, db, nPoints );       break;
+            case TO_PRODUCT    : batchProductDerivative ( dr, a, b, da, db, nPoints ); break;
+            case TO_QUOTIENT   : batchQuotientDerivative( dr, a, b, da, db, nPoints ); break;
+
+            case TO_POWER:
+                 for( run2 = 0; run2 < nPoints; run2++ )
+                     dr[run2] = ( b[run2]*pow( a[run2], b[run2]-one ) )*da[run2]
+                              + ( r[run2]*log( a[run2] ) )*db[run2];
+                 break;
+
+            case TO_POWER_INT:
+                 for( run2 = 0; run2 < nPoints; run2++ )
+                     dr[run2] = ( (T)c[3]*(T)pow( a[run2], c[3]-1 ) )*da[run2];
+                 break;
+
+            case TO_ACOS: for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = ( -one/sqrt(one-a[run2]*a[run2]) )*da[run2]; break;
+            case TO_ASIN: for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = (  one/sqrt(one-a[run2]*a[run2]) )*da[run2]; break;
+            case TO_ATAN: for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = (  one/(one+a[run2]*a[run2]) )*da[run2];     break;
+            case TO_COS : for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = ( -sin( a[run2] ) )*da[run2];                 break;
+            case TO_EXP : for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = r[run2]*da[run2];                             break;
+            case TO_LOG : for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = ( one/a[run2] )*da[run2];                     break;
+            case TO_SIN : for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = cos( a[run2] )*da[run2];                      break;
+            case TO_TAN : for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = ( one+r[run2]*r[run2] )*da[run2];             break;
+            case TO_NEGATION: for( run2 = 0; run2 < nPoints; run2++ ) dr[run2] = -da[run2];                                 break;
+
+            default: return ACADOERROR(RET_UNKNOWN_BUG);
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue EvaluationTape::backwardBatch( const double *w, double *a, int nPoints ) const{
+
+    int run1, run2;
+    const int *c = code + 4*nInstructions;
+
+    for( run1 = nInstructions-1; run1 >= 0; run1-- ){
+
+        c -= 4;
+
+        const int arg2 = ( c[0] == TO_POWER_INT ) ? 0 : c[3];
+
+        const double *s  = a + c[1]*nPoints;
+        double       *a1 = a + c[2]*nPoints;
+        double       *a2 = a + arg2*nPoints;
+        const double *r  = w + c[1]*nPoints;
+        const double *x1 = w + c[2]*nPoints;
+        const double *x2 = w + arg2*nPoints;
+
+        switch( c[0] ){
+
+            case TO_ASSIGN     : batchAdd( a1, a1, s, nPoints ); break;
+
+            case TO_ADDITION   : batchAdd     ( a1, a1, s, nPoints );
+                                 batchAdd     ( a2, a2, s, nPoints ); break;
+
+            case TO_SUBTRACTION: batchAdd     ( a1, a1, s, nPoints );
+                                 batchSubtract( a2, a2, s, nPoints ); break;
+
+            case TO_PRODUCT    : batchProductAdjoint ( a1, a2, x1, x2, s, nPoints ); break;
+            case TO_QUOTIENT   : batchQuotientAdjoint( a1, a2, x1, x2, s, nPoints ); break;
+
+            case TO_POWER:
+                 for( run2 = 0; run2 < nPoints; run2++ ){
+                     a1[run2] += ( x2[run2]*pow( x1[run2], x2[run2]-1.0 ) )*s[run2];
+                     a2[run2] += ( r[run2]*log( x1[run2] ) )*s[run2];
+                 }
+                 break;
+
+            case TO_POWER_INT:
+                 for( run2 = 0; run2 < nPoints; run2++ )
+                     a1[run2] += ( (double)c[3]*pow( x1[run2], c[3]-1 ) )*s[run2];
+                 break;
+
+            case TO_ACOS: for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += ( -1.0/sqrt(1.0-x1[run2]*x1[run2]) )*s[run2]; break;
+            case TO_ASIN: for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += (  1.0/sqrt(1.0-x1[run2]*x1[run2]) )*s[run2]; break;
+            case TO_ATAN: for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += (  1.0/(1.0+x1[run2]*x1[run2]) )*s[run2];     break;
+            case TO_COS : for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += ( -sin( x1[run2] ) )*s[run2];                 break;
+            case TO_EXP : for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += r[run2]*s[run2];                              break;
+            case TO_LOG : for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += ( 1.0/x1[run2] )*s[run2];                     break;
+            case TO_SIN : for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += cos( x1[run2] )*s[run2];                      break;
+            case TO_TAN : for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] += ( 1.0+r[run2]*r[run2] )*s[run2];              break;
+            case TO_NEGATION: for( run2 = 0; run2 < nPoints; run2++ ) a1[run2] -= s[run2];                                  break;
+
+            default: return ACADOERROR(RET_UNKNOWN_BUG);
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
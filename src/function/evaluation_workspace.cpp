@@ -0,0 +1,218 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/function/evaluation_workspace.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/evaluation_workspace.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+EvaluationWorkspace::EvaluationWorkspace( ){
+
+    nRegisters = 0;
+    value      = 0;
+    derivative = 0;
+    adjoint    = 0;
+    status     = 0;
+
+    nDirections = 0;
+    block       = 0;
+
+    nPoints         = 0;
+    nBatchPoints    = 0;
+    batchValue      = 0;
+    batchDerivative = 0;
+
+    nSinglePoints         = 0;
+    nSingleBatchPoints    = 0;
+    batchValueSingle      = 0;
+    batchDerivativeSingle = 0;
+}
+
+
+EvaluationWorkspace::EvaluationWorkspace( const EvaluationWorkspace& arg ){
+
+    copy( arg );
+}
+
+
+EvaluationWorkspace::~EvaluationWorkspace( ){
+
+    clear();
+}
+
+
+EvaluationWorkspace& EvaluationWorkspace::operator=( const EvaluationWorkspace& arg ){
+
+    if( this != &arg ){
+
+        clear();
+        copy( arg );
+    }
+    return *this;
+}
+
+
+returnValue EvaluationWorkspace::clear(){
+
+    free( value      );
+    free( derivative );
+    free( adjoint    );
+    free( block      );
+    free( batchValue      );
+    free( batchDerivative );
+    free( batchValueSingle      );
+    free( batchDerivativeSingle );
+
+    nRegisters = 0;
+    value      = 0;
+    derivative = 0;
+    adjoint    = 0;
+    status     = 0;
+
+    nDirections = 0;
+    block       = 0;
+
+    nPoints         = 0;
+    nBatchPoints    = 0;
+    batchValue      = 0;
+    batchDerivative = 0;
+
+    nSinglePoints         = 0;
+    nSingleBatchPoints    = 0;
+    batchValueSingle      = 0;
+    batchDerivativeSingle = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void EvaluationWorkspace::allocate( int nRegisters_ ){
+
+    clear();
+
+    nRegisters = nRegisters_;
+
+    value      = (double*)calloc(nRegisters,sizeof(double));
+    derivative = (double*)calloc(nRegisters,sizeof(double));
+    adjoint    = (double*)calloc(nRegisters,sizeof(double));
+}
+
+
+void EvaluationWorkspace::allocateDirections( int nDirections_ ){
+
+    if( nDirections_ <= nDirections ) return;
+
+    nDirections = nDirections_;
+
+    free( block );
+    block = (double*)calloc(nRegisters*nDirections,sizeof(double));
+}
+
+
+void EvaluationWorkspace::allocatePoints( int nPoints_ ){
+
+    if( nPoints_ <= nPoints ) return;
+
+    nPoints = nPoints_;
+
+    free( batchValue      );
+    free( batchDerivative );
+
+    batchValue      = (double*)calloc(nRegisters*nPoints,sizeof(double));
+    batchDerivative = (double*)calloc(nRegisters*nPoints,sizeof(double));
+}
+
+
+void EvaluationWorkspace::allocateSinglePoints( int nPoints_ ){
+
+    if( nPoints_ <= nSinglePoints ) return;
+
+    nSinglePoints = nPoints_;
+
+    free( batchValueSingle      );
+    free( batchDerivativeSingle );
+
+    batchValueSingle      = (float*)calloc(nRegisters*nSinglePoints,sizeof(float));
+    batchDerivativeSingle = (float*)calloc(nRegisters*nSinglePoints,sizeof(float));
+}
+
+
+void EvaluationWorkspace::copy( const EvaluationWorkspace& arg ){
+
+    nRegisters = arg.nRegisters;
+    status     = arg.status    ;
+
+    value      = (double*)calloc(nRegisters,sizeof(double));
+    derivative = (double*)calloc(nRegisters,sizeof(double));
+    adjoint    = (double*)calloc(nRegisters,sizeof(double));
+
+    memcpy( value     , arg.value     , nRegisters*sizeof(double) );
+    memcpy( derivative, arg.derivative, nRegisters*sizeof(double) );
+    memcpy( adjoint   , arg.adjoint   , nRegisters*sizeof(double) );
+
+    // the vector mode and batch buffers only hold temporaries:
+    nDirections = 0;
+    block       = 0;
+
+    nPoints         = 0;
+    nBatchPoints    = 0;
+    batchValue      = 0;
+    batchDerivative = 0;
+
+    nSinglePoints         = 0;
+    nSingleBatchPoints    = 0;
+    batchValueSingle      = 0;
+    batchDerivativeSingle = 0;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -50,6 +50,9 @@ Function::Function(){
 
     memoryOffset = 0;
 	result       = 0;
+
+    hessianColor   =  0;
+    nHessianColors = -1;
 }
 
 
@@ -57,6 +60,10 @@ Function::Function( const Function& arg ){
 
     evaluationTree = arg.evaluationTree;
     memoryOffset   = arg.memoryOffset  ;
+
+    // the colouring is determined again when needed:
+    hessianColor   =  0;
+    nHessianColors = -1;
 	
 	if ( arg.getDim() != 0 )
 	{
@@ -72,6 +79,8 @@ Function::Function( const Function& arg ){
 Function::~Function( ){ 
 	if ( result != 0 )
 		free( result );
+
+    clearHessianColoring();
 }
 
 
@@ -84,6 +93,8 @@ Function& Function::operator=( const Function& arg ){
 
         evaluationTree = arg.evaluationTree;
         memoryOffset   = arg.memoryOffset  ;
+
+        clearHessianColoring();
 		
 		if ( arg.getDim() != 0 )
 		{
@@ -102,6 +113,7 @@ Function& Function::operator=( const Function& arg ){
 Function& Function::operator<<( const Expression& arg ){
 
     evaluationTree.operator<<( arg );
+    clearHessianColoring();
 
 	result = (double*) realloc( result,getDim()*sizeof(double) );
 
@@ -166,6 +178,8 @@ returnValue Function::reset( ){
     evaluationTree = tmp;
     memoryOffset = 0;
 
+    clearHessianColoring();
+
 	if ( result != 0 )
 		free( result );
 
@@ -380,31 +394,195 @@ BooleanType Function::isConcave(){
 }
 
 returnValue Function::jacobian(Matrix &x) {
-    int n=getDim();
-    int N=getNumberOfVariables();
-    returnValue ret;
-
-    x=Matrix(getNX(),n);x.setAll(0);
-    //u=Matrix(getNU(),n);u.setAll(0);
-    //p=Matrix(getNP(),n);p.setAll(0);
-    //w=Matrix(getNW(),n);w.setAll(0);
-    double *Jr=new double[N];
-    double *seed=new double[n];
-    for (int i=0;i<n;i++) seed[i]=0;
-    for (int i=0;i<n;i++) {
-	if (i>0) seed[i-1]=0;
-	seed[i]=1;
-	for (int j=0;j<N;j++) Jr[j]=0;
-    	ret=AD_backward(0,seed,Jr);
-	if (ret != SUCCESSFUL_RETURN) return ret;
-	for (int j=0;j<getNX();j++) x(j,i)=Jr[index(VT_DIFFERENTIAL_STATE,j)];
+
+    int run1, run2;
+
+    const int n  = getDim();
+    const int N  = getNumberOfVariables()+1;
+    const int nx = getNX();
+
+    x = Matrix(nx,n);
+    x.setAll(0);
+
+    // pattern of the Jacobian w.r.t. the differential states:
+    SparsityPattern pattern;
+    returnValue ret = getSparsityPattern( pattern );
+    if( ret != SUCCESSFUL_RETURN ) return ret;
+
+    int *column = (int*)calloc(N,sizeof(int));
+
+    for( run1 = 0; run1 < N; run1++ )
+        column[run1] = -1;
+    for( run1 = 0; run1 < nx; run1++ )
+        column[index(VT_DIFFERENTIAL_STATE,run1)] = run1;
+
+    const int *rowStart = pattern.getRowStart();
+    const int *colIndex = pattern.getColIndex();
+
+    int *Jstart = (int*)calloc(n+1,sizeof(int));
+    int *Jindex = (int*)calloc(pattern.getNumberOfNonzeros()+1,sizeof(int));
+
+    for( run1 = 0; run1 < n; run1++ ){
+        Jstart[run1+1] = Jstart[run1];
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ )
+            if( column[colIndex[run2]] >= 0 )
+                Jindex[Jstart[run1+1]++] = column[colIndex[run2]];
+    }
+
+    SparsityPattern Jx;
+    Jx.init( n, nx, Jstart, Jindex );
+
+    int *colColor = (int*)calloc(nx+1,sizeof(int));
+    int *rowColor = (int*)calloc(n +1,sizeof(int));
+
+    const int nColColors = Jx.getColumnColoring( colColor );
+    const int nRowColors = Jx.getRowColoring   ( rowColor );
+
+    if( nColColors <= nRowColors ){
+
+        // forward mode, one direction per column colour:
+        double *seed = (double*)calloc(nColColors*N+1,sizeof(double));
+        double *Jc   = (double*)calloc(nColColors*n+1,sizeof(double));
+
+        for( run1 = 0; run1 < nx; run1++ )
+            seed[colColor[run1]*N+index(VT_DIFFERENTIAL_STATE,run1)] = 1.0;
+
+        if( nColColors > 0 )
+            ret = AD_forward(0,nColColors,seed,Jc);
+
+        if (ret == SUCCESSFUL_RETURN)
+            for( run1 = 0; run1 < n; run1++ )
+                for( run2 = Jstart[run1]; run2 < Jstart[run1+1]; run2++ )
+                    x(Jindex[run2],run1) = Jc[colColor[Jindex[run2]]*n+run1];
+
+        free( seed );
+        free( Jc   );
+    }
+    else{
+
+        // backward mode, one direction per row colour:
+        double *seed = (double*)calloc(nRowColors*n+1,sizeof(double));
+        double *Jr   = (double*)calloc(nRowColors*N+1,sizeof(double));
+
+        for( run1 = 0; run1 < n; run1++ )
+            seed[rowColor[run1]*n+run1] = 1.0;
+
+        if( nRowColors > 0 )
+            ret = AD_backward(0,nRowColors,seed,Jr);
+
+        if (ret == SUCCESSFUL_RETURN)
+            for( run1 = 0; run1 < n; run1++ )
+                for( run2 = Jstart[run1]; run2 < Jstart[run1+1]; run2++ )
+                    x(Jindex[run2],run1) = Jr[rowColor[run1]*N+index(VT_DIFFERENTIAL_STATE,Jindex[run2])];
+
+        free( seed );
+        free( Jr   );
     }
-    delete[] Jr;
-    delete[] seed;
+
+    free( column   );
+    free( Jstart   );
+    free( Jindex   );
+    free( colColor );
+    free( rowColor );
+
+    return ret;
+}
+
+
+returnValue Function::getSparsityPattern( SparsityPattern &pattern ){
+
+    return evaluationTree.getSparsityPattern( pattern );
+}
+
+
+returnValue Function::getHessianSparsityPattern( SparsityPattern &pattern ){
+
+    returnValue returnvalue = initHessianColoring();
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    pattern = hessianPattern.getLowerTriangle();
+
     return SUCCESSFUL_RETURN;
 }
 
 
+returnValue Function::AD_hessian( int number, double *seed, double *H ){
+
+    int run1, run2, run3;
+
+    returnValue returnvalue = initHessianColoring();
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    const int n  = getDim();
+    const int N  = getNumberOfVariables()+1;
+    const int nC = nHessianColors;
+
+    // compressed Hessian, one column per colour:
+    double *B     = (double*)calloc(nC*N+1,sizeof(double));
+    double *fseed = (double*)calloc(N     ,sizeof(double));
+    double *zero  = (double*)calloc(n+1   ,sizeof(double));
+    double *R     = (double*)calloc(n+1   ,sizeof(double));
+    double *J     = (double*)calloc(N     ,sizeof(double));
+
+    for( run1 = 0; run1 < nC; run1++ ){
+
+        for( run2 = 0; run2 < N; run2++ ){
+            fseed[run2] = 0.0;
+            J    [run2] = 0.0;
+        }
+        for( run2 = 0; run2 < N; run2++ )
+            if( hessianColor[run2] == run1 )
+                fseed[run2] = 1.0;
+
+        returnvalue = AD_forward( number, fseed, R );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+
+        returnvalue = AD_backward2( number, seed, zero, J, &B[run1*N] );
+        if( returnvalue != SUCCESSFUL_RETURN ) break;
+    }
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        const int *rowStart = hessianPattern.getRowStart();
+        const int *colIndex = hessianPattern.getColIndex();
+
+        int nnz = 0;
+
+        for( run1 = 0; run1 < N; run1++ ){
+
+            for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
+
+                if( colIndex[run2] > run1 ) continue;
+
+                const int j = colIndex[run2];
+
+                // H(i,j) is either found in row i of colour(j) ...
+                int unique = 0;
+                for( run3 = rowStart[run1]; run3 < rowStart[run1+1]; run3++ )
+                    if( hessianColor[colIndex[run3]] == hessianColor[j] )
+                        unique++;
+
+                if( unique == 1 ){
+                    H[nnz++] = B[hessianColor[j]*N+run1];
+                    continue;
+                }
+
+                // ... or in row j of colour(i):
+                H[nnz++] = B[hessianColor[run1]*N+j];
+            }
+        }
+    }
+
+    free( B     );
+    free( fseed );
+    free( zero  );
+    free( R     );
+    free( J     );
+
+    return returnvalue;
+}
+
+
 returnValue Function::AD_forward( int number, double *seed, double *df  ){
 
     return evaluationTree.AD_forward( number+memoryOffset, seed, df );
@@ -417,6 +595,69 @@ returnValue Function::AD_backward( int number, double *seed, double  *df ){
 }
 
 
+returnValue Function::AD_forward( int number, int nDir, double *seed, double *df ){
+
+    return evaluationTree.AD_forward( number+memoryOffset, nDir, seed, df );
+}
+
+
+returnValue Function::AD_backward( int number, int nDir, double *seed, double *df ){
+
+    return evaluationTree.AD_backward( number+memoryOffset, nDir, seed, df );
+}
+
+
+returnValue Function::evaluate( int number, double *x, double *_result,
+                                int nComp, const int *comp ){
+
+    return evaluationTree.evaluate( number+memoryOffset, x, _result, nComp, comp );
+}
+
+
+returnValue Function::AD_forward( int number, double *seed, double *df,
+                                  int nComp, const int *comp ){
+
+    return evaluationTree.AD_forward( number+memoryOffset, seed, df, nComp, comp );
+}
+
+
+returnValue Function::AD_backward( int number, double *seed, double *df,
+                                   int nComp, const int *comp ){
+
+    return evaluationTree.AD_backward( number+memoryOffset, seed, df, nComp, comp );
+}
+
+
+returnValue Function::evaluateBatch( int number, int nPoints, double *x, double *_result ){
+
+    return evaluationTree.evaluateBatch( number+memoryOffset, nPoints, x, _result );
+}
+
+
+returnValue Function::AD_forwardBatch( int number, int nPoints, double *seed, double *df ){
+
+    return evaluationTree.AD_forwardBatch( number+memoryOffset, nPoints, seed, df );
+}
+
+
+returnValue Function::AD_backwardBatch( int number, int nPoints, double *seed, double *df ){
+
+    return evaluationTree.AD_backwardBatch( number+memoryOffset, nPoints, seed, df );
+}
+
+
+returnValue Function::evaluateBatch( int number, int nPoints, float *x, float *_result ){
+
+    return evaluationTree.evaluateBatch( number+memoryOffset, nPoints, x, _result );
+}
+
+
+returnValue Function::AD_forwardBatch( int number, int nPoints, float *seed, float *df ){
+
+    return evaluationTree.AD_forwardBatch( number+memoryOffset, nPoints, seed, df );
+}
+
+
 returnValue Function::AD_forward2( int number, double *seed, double *dseed,
                                    double *df, double *ddf ){
 
@@ -498,6 +739,162 @@ returnValue Function::setScale( double *scale_ ){
 }
 
 
+returnValue Function::compile( ){
+
+    return evaluationTree.compile();
+}
+
+
+BooleanType Function::isCompiled( ) const{
+
+    return evaluationTree.isCompiled();
+}
+
+
+returnValue Function::convertToHornerForm( ){
+
+    return evaluationTree.convertToHornerForm();
+}
+
+
+returnValue Function::compileNative( ){
+
+    return evaluationTree.compileNative();
+}
+
+
+BooleanType Function::isNative( ) const{
+
+    return evaluationTree.isNative();
+}
+
+
+returnValue Function::setProfiling( BooleanType doProfiling ){
+
+    return evaluationTree.setProfiling( doProfiling );
+}
+
+
+returnValue Function::printProfile( int nTop ) const{
+
+    return evaluationTree.printProfile( nTop );
+}
+
+
+returnValue Function::initHessianColoring( ){
+
+    if( nHessianColors >= 0 )
+        return SUCCESSFUL_RETURN;
+
+    returnValue returnvalue = evaluationTree.getHessianSparsityPattern( hessianPattern );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    hessianColor   = (int*)calloc(hessianPattern.getNumRows()+1,sizeof(int));
+    nHessianColors = hessianPattern.getStarColoring( hessianColor );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void Function::clearHessianColoring( ){
+
+    if( hessianColor != 0 )
+        free( hessianColor );
+
+    hessianColor   =  0;
+    nHessianColors = -1;
+}
+
+
+returnValue Function::write( FILE *file ) const{
+
+    return evaluationTree.write( file );
+}
+
+
+returnValue Function::read( FILE *file ){
+
+    returnValue returnvalue = evaluationTree.read( file );
+    clearHessianColoring();
+
+    result = (double*) realloc( result,getDim()*sizeof(double) );
+
+    return returnvalue;
+}
+
+
+returnValue Function::initWorkspace( EvaluationWorkspace &ws ){
+
+    if( evaluationTree.isCompiled() == BT_FALSE ){
+
+        returnValue returnvalue = evaluationTree.compile();
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+    }
+
+    return evaluationTree.initWorkspace( ws );
+}
+
+
+returnValue Function::evaluate( EvaluationWorkspace &ws, double *x, double *_result ) const{
+
+    return evaluationTree.evaluate( ws, x, _result );
+}
+
+
+returnValue Function::AD_forward( EvaluationWorkspace &ws, double *seed, double *df ) const{
+
+    return evaluationTree.AD_forward( ws, seed, df );
+}
+
+
+returnValue Function::AD_backward( EvaluationWorkspace &ws, double *seed, double *df ) const{
+
+    return evaluationTree.AD_backward( ws, seed, df );
+}
+
+
+returnValue Function::AD_forward( EvaluationWorkspace &ws, int nDir, double *seed, double *df ) const{
+
+    return evaluationTree.AD_forward( ws, nDir, seed, df );
+}
+
+
+returnValue Function::AD_backward( EvaluationWorkspace &ws, int nDir, double *seed, double *df ) const{
+
+    return evaluationTree.AD_backward( ws, nDir, seed, df );
+}
+
+
+returnValue Function::evaluateBatch( EvaluationWorkspace &ws, int nPoints, double *x, double *_result ) const{
+
+    return evaluationTree.evaluateBatch( ws, nPoints, x, _result );
+}
+
+
+returnValue Function::AD_forwardBatch( EvaluationWorkspace &ws, int nPoints, double *seed, double *df ) const{
+
+    return evaluationTree.AD_forwardBatch( ws, nPoints, seed, df );
+}
+
+
+returnValue Function::AD_backwardBatch( EvaluationWorkspace &ws, int nPoints, double *seed, double *df ) const{
+
+    return evaluationTree.AD_backwardBatch( ws, nPoints, seed, df );
+}
+
+
+returnValue Function::evaluateBatch( EvaluationWorkspace &ws, int nPoints, float *x, float *_result ) const{
+
+    return evaluationTree.evaluateBatch( ws, nPoints, x, _result );
+}
+
+
+returnValue Function::AD_forwardBatch( EvaluationWorkspace &ws, int nPoints, float *seed, float *df ) const{
+
+    return evaluationTree.AD_forwardBatch( ws, nPoints, seed, df );
+}
+
+
 Vector Function::evaluate( const EvaluationPoint &x,
                            const int        &number  ){
 
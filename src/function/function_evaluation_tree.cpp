@@ -33,13 +33,40 @@
 
 #include <acado/utils/acado_utils.hpp>
 #include <acado/function/function_evaluation_tree.hpp>
+#include <acado/function/evaluation_tape.hpp>
+#include <acado/function/evaluation_profile.hpp>
+#include <acado/function/c_operator.hpp>
 #include <acado/code_generation/export_variable.hpp>
 
+#include <string.h>
+#include <map>
+#include <set>
+#include <vector>
+
 
 
 BEGIN_NAMESPACE_ACADO
 
 
+/** Identifies the binary files written by FunctionEvaluationTree::write(). */
+#define FET_FILE_ID "ACADOFET"
+
+/** The version of the file format (stored after FET_FILE_ID). */
+#define FET_FILE_VERSION 2
+
+
+/* the format of the numbers in the files written on this machine: */
+static void getFileFormat( unsigned char format[4] ){
+
+    const int one = 1;
+
+    format[0] = FET_FILE_VERSION;
+    format[1] = (unsigned char) sizeof(int);
+    format[2] = (unsigned char) sizeof(double);
+    format[3] = *(const unsigned char*)&one;   // 1 if little endian
+}
+
+
 
 //
 // PUBLIC MEMBER FUNCTIONS:
@@ -51,169 +78,194 @@ FunctionEvaluationTree::FunctionEvaluationTree( ){
     sub       = NULL;
     lhs_comp  = NULL;
     indexList = new SymbolicIndexList();
+    table     = new OperatorTable();
+    tape      = NULL;
+    hornerForm = BT_FALSE;
     dim       =  0;
     n         =  0;
 
+    selection = NULL;
+    nSelected = -1;
+    needed    = NULL;
+    nNeeded   =  0;
+    extra     = NULL;
+    nExtra    =  0;
+
+    profile   = NULL;
+
+    derivative   = NULL;
+    nDerivatives = 0;
+
     auxVariableName = "acado_aux";
     auxVariableStructName = "acadoWorkspace";
 }
 
 FunctionEvaluationTree::FunctionEvaluationTree( const FunctionEvaluationTree& arg ){
 
-    int run1;
+    copy( arg );
+}
 
-    dim = arg.dim;
-    n   = arg.n  ;
 
-    auxVariableName = arg.auxVariableName;
-    auxVariableStructName = arg.auxVariableStructName;
+FunctionEvaluationTree::~FunctionEvaluationTree( ){
 
-    if( arg.f == NULL ){
-        f = NULL;
-    }
-    else{
-        f = (Operator**)calloc(dim,sizeof(Operator*));
+    deleteAll();
+}
 
-        for( run1 = 0; run1 < dim; run1++ ){
-            f[run1] = arg.f[run1]->clone();
-        }
-    }
 
-    indexList = new SymbolicIndexList(*arg.indexList);
+FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluationTree& arg ){
 
-    if( arg.sub == NULL ){
-        sub       = NULL;
-        lhs_comp  = NULL;
-    }
-    else{
-        sub = (Operator**)calloc(n,sizeof(Operator*));
-        lhs_comp = (int*)calloc(n,sizeof(int));
+    if( this != &arg ){
 
-        for( run1 = 0; run1 < n; run1++ ){
-            sub[run1] = arg.sub[run1]->clone();
-            lhs_comp[run1] = arg.lhs_comp[run1];
-        }
+        deleteAll();
+        copy( arg );
     }
 
-    safeCopy = arg.safeCopy;
+    return *this;
 }
 
 
-FunctionEvaluationTree::~FunctionEvaluationTree( ){
+returnValue FunctionEvaluationTree::getExpression( Expression& expression ) const{
 
-    int run1;
+    expression = safeCopy;
+    return SUCCESSFUL_RETURN;
+}
 
-    for( run1 = 0; run1 < dim; run1++ ){
-         delete f[run1];
-    }
-    if( f != NULL){
-        free(f);
-    }
 
-    for( run1 = 0; run1 < n; run1++ ){
+returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
-         delete sub[run1];
-    }
+    safeCopy << arg;
 
-    if( sub != NULL ){
-        free(sub);
-    }
+    if( arg.getDim() == 0 )
+        return SUCCESSFUL_RETURN;
 
-    if( lhs_comp != NULL ){
-        free(lhs_comp);
-    }
+    uint run1;
 
-    delete indexList;
+    f = (Operator**)realloc(f,(dim+arg.getDim())*sizeof(Operator*));
+
+    // import the new components into the shared DAG and turn all
+    // nodes which are used more than once into intermediate states:
+    for( run1 = 0; run1 < arg.getDim(); run1++ )
+        f[dim+run1] = table->import( arg.element[run1] );
+
+    if( hornerForm == BT_TRUE )
+        table->convertToHornerForm( arg.getDim(), &f[dim] );
+
+    // sub-expressions which also occur in previous components are
+    // promoted as well, the previous components refer to them then:
+    BooleanType isSharing = BT_FALSE;
+    if( dim > 0 ) isSharing = table->isSharingPreviousNodes( arg.getDim(), &f[dim] );
+
+    table->promote( arg.getDim(), &f[dim] );
+    table->substituteIntermediateStates( dim, f );
+    table->endImport();
+
+    int nOld = n;
+    enumerateComponents( arg.getDim() );
+
+    // the new intermediate states are evaluated before their new users:
+    if( isSharing == BT_TRUE )
+        sortIntermediateStates( nOld );
+
+    if( tape != NULL )
+        return compile();
+
+    return SUCCESSFUL_RETURN;
 }
 
 
-FunctionEvaluationTree& FunctionEvaluationTree::operator=( const FunctionEvaluationTree& arg ){
 
-    int run1;
+returnValue FunctionEvaluationTree::write( FILE *file ) const{
 
-    if( this != &arg ){
+    int flags[2] = { 0, 0 };
+    unsigned char format[4];
 
-        for( run1 = 0; run1 < dim; run1++ ){
-             delete f[run1];
-        }
-        if( f != NULL ){
-            free(f);
-        }
+    if( tape != NULL ){
+        flags[0] = 1;
+        if( tape->isNative() == BT_TRUE ) flags[1] = 1;
+    }
 
-        for( run1 = 0; run1 < n; run1++ ){
-             delete sub[run1];
-        }
-        if( sub != 0 ){
-           free(sub);
-        }
+    getFileFormat( format );
 
-        if( lhs_comp != NULL ){
-            free(lhs_comp);
-        }
+    // the numbers are written as they are stored in memory, i.e. the
+    // file can only be read on machines with the same format:
+    if( fwrite( FET_FILE_ID, sizeof(char), 8, file ) != 8 ||
+        fwrite( format, sizeof(unsigned char), 4, file ) != 4 ||
+        fwrite( flags, sizeof(int), 2, file ) != 2 )
+        return ACADOERROR(RET_CAN_NOT_WRITE_INTO_FILE);
 
-        delete indexList;
+    return table->write( file, dim, f );
+}
 
-        dim = arg.dim;
-        n   = arg.n  ;
 
-        auxVariableName = arg.auxVariableName;
-        auxVariableStructName = arg.auxVariableStructName;
+returnValue FunctionEvaluationTree::read( FILE *file ){
 
-        if( arg.f == NULL ){
-            f = NULL;
-        }
-        else{
-            f = (Operator**)calloc(dim,sizeof(Operator*));
+    int  run1;
+    int  flags[2];
+    char id[8];
+    unsigned char format[4], expected[4];
 
-            for( run1 = 0; run1 < dim; run1++ ){
-                f[run1] = arg.f[run1]->clone();
-            }
-        }
+    getFileFormat( expected );
 
-        indexList = new SymbolicIndexList(*arg.indexList);
+    if( fread( id, sizeof(char), 8, file ) != 8 || memcmp( id, FET_FILE_ID, 8 ) != 0 ||
+        fread( format, sizeof(unsigned char), 4, file ) != 4 || memcmp( format, expected, 4 ) != 0 ||
+        fread( flags, sizeof(int), 2, file ) != 2 )
+        return ACADOERROR(RET_FILE_HAS_NO_VALID_ENTRIES);
 
-        if( arg.sub == NULL ){
-            sub = NULL;
-            lhs_comp = NULL;
-        }
-        else{
-            sub = (Operator**)calloc(n,sizeof(Operator*));
-            lhs_comp = (int*)calloc(n,sizeof(int));
+    clearComponents();
 
-            for( run1 = 0; run1 < n; run1++ ){
-                sub[run1] = arg.sub[run1]->clone();
-                lhs_comp[run1] = arg.lhs_comp[run1];
-            }
-        }
-        safeCopy = arg.safeCopy;
+    if( tape != NULL ){
+        delete tape;
+        tape = NULL;
     }
 
-    return *this;
-}
+    // (a converted function is stored in Horner form already)
+    hornerForm = BT_FALSE;
 
+    int       nRoots;
+    Operator **root;
 
-returnValue FunctionEvaluationTree::getExpression( Expression& expression ) const{
+    returnValue returnvalue = table->read( file, nRoots, root );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+
+        for( run1 = 0; run1 < nRoots; run1++ )
+            Operator::release( root[run1] );
+        free( root );
+
+        clearComponents();
+        return returnvalue;
+    }
+
+    // the components are taken over without any further import:
+    f = root;
+    enumerateComponents( nRoots );
+    table->restoreDerivatives();
+
+    for( run1 = 0; run1 < dim; run1++ )
+        safeCopy << Expression( *f[run1] );
+
+    if( flags[1] != 0 ) return compileNative();
+    if( flags[0] != 0 ) return compile();
 
-    expression = safeCopy;
     return SUCCESSFUL_RETURN;
 }
 
 
-returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
-    safeCopy << arg;
+returnValue FunctionEvaluationTree::enumerateComponents( int nComponents ){
 
-    uint run1;
+    int run1;
+
+    clearSelection();
+    clearDerivatives();
+    if( profile != NULL ) profile->clear();
 
-    for( run1 = 0; run1 < arg.getDim(); run1++ ){
+    for( run1 = 0; run1 < nComponents; run1++ ){
 
         int nn;
 
         nn = n;
 
-        f = (Operator**)realloc(f,(dim+1)*sizeof(Operator*));
-
-        f[dim] = arg.element[run1]->clone();
         f[dim]-> loadIndices  ( indexList );
 
         sub       = (Operator**)realloc(sub,
@@ -225,6 +277,16 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         while( nn < n ){
 
+            // use the shared node instead of the copy of the index list:
+            Operator *tmp = sub[nn];
+            sub[nn] = table->import( tmp );
+            Operator::release( tmp );
+
+            if( hornerForm == BT_TRUE )
+                table->convertToHornerForm( 1, &sub[nn] );
+
+            table->endImport();
+
             sub[nn]-> enumerateVariables( indexList );
             nn++;
         }
@@ -233,6 +295,7 @@ returnValue FunctionEvaluationTree::operator<<( const Expression& arg ){
 
         dim++;
     }
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -242,6 +305,12 @@ returnValue FunctionEvaluationTree::evaluate( double *x, double *result ){
 
     int run1;
 
+    if( profile != NULL )
+        return evaluateProfiled( 0, x, result );
+
+    if( tape != NULL )
+        return tape->evaluate( 0, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
 
         sub[run1]->evaluate( 0, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
@@ -294,6 +363,12 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 
     int run1;
 
+    if( profile != NULL )
+        return evaluateProfiled( number, x, result );
+
+    if( tape != NULL )
+        return tape->evaluate( number, x, result );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
                                                              lhs_comp[run1]         ) ] );
@@ -307,11 +382,88 @@ returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *res
 
 
 
+returnValue FunctionEvaluationTree::evaluate( int number, double *x, double *result,
+                                              int nComp, const int *comp ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->evaluate( number, x, result, nComp, comp );
+
+    returnValue returnvalue = select( nComp, comp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nNeeded; run1++ ){
+        sub[needed[run1]]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
+                                                                     lhs_comp[needed[run1]]) ] );
+    }
+
+    // the components evaluating C functions read by the selection:
+    double *tmp = 0;
+
+    if( nExtra > 0 ){
+        tmp = (double*)calloc(dim+1,sizeof(double));
+        for( run1 = 0; run1 < dim; run1++ )
+            if( extra[run1] == BT_TRUE )
+                f[run1]->evaluate( number, x, &tmp[run1] );
+    }
+
+    for( run1 = 0; run1 < nComp; run1++ ){
+        if( nExtra > 0 && extra[comp[run1]] == BT_TRUE )
+            result[run1] = tmp[comp[run1]];
+        else
+            f[comp[run1]]->evaluate( number, x, &result[run1] );
+    }
+
+    if( tmp != 0 ) free( tmp );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
 FunctionEvaluationTree* FunctionEvaluationTree::differentiate( int index_ ){
 
-    ACADOERROR(RET_NOT_IMPLEMENTED_YET);
+    int run1;
+
+    if( index_ < 0 ){
+        ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+        return 0;
+    }
+
+    if( index_ < nDerivatives && derivative[index_] != NULL )
+        return derivative[index_];
+
+    // the derivatives are memoized by the operator table, such that
+    // shared nodes and repeated requests are differentiated only once:
+    Expression tmp( dim );
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        Operator::release( tmp.element[run1] );
+        tmp.element[run1] = table->differentiate( f[run1], index_ );
+
+        // (the table does not report errors itself):
+        if( tmp.element[run1] == 0 ){
+            ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+            return 0;
+        }
+    }
+
+    // the tree keeps the derivative, as the caller does not own it:
+    if( index_ >= nDerivatives ){
 
-    return this;
+        derivative = (FunctionEvaluationTree**)realloc(derivative,(index_+1)*sizeof(FunctionEvaluationTree*));
+
+        for( run1 = nDerivatives; run1 <= index_; run1++ )
+            derivative[run1] = NULL;
+
+        nDerivatives = index_+1;
+    }
+
+    derivative[index_] = new FunctionEvaluationTree();
+    derivative[index_]->operator<<( tmp );
+
+    return derivative[index_];
 }
 
 
@@ -399,6 +551,9 @@ FunctionEvaluationTree FunctionEvaluationTree::substitute( VariableType variable
     delete tmp.indexList;
     tmp.indexList = indexList->substitute(variableType_, index_);
 
+    if( tape != NULL )
+        tmp.compile();
+
     return tmp;
 }
 
@@ -447,7 +602,7 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    BooleanType *implicit_dep = new BooleanType [2*getNumberOfIntermediateStateIndices()];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -476,8 +631,11 @@ BooleanType FunctionEvaluationTree::isDependingOn( const Expression &variable ){
     }
 
 
+    // for every intermediate state, the queried property is stored
+    // in front of its dependency (see TreeProjection):
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]  ] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]+1] = implicit_dep[2*lhs_comp[run1]];
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isDependingOn( 1, varType, component, implicit_dep ) == BT_TRUE  ){
@@ -500,7 +658,7 @@ BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    BooleanType *implicit_dep = new BooleanType [2*getNumberOfIntermediateStateIndices()];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -530,7 +688,8 @@ BooleanType FunctionEvaluationTree::isLinearIn( const Expression &variable ){
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isLinearIn( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]  ] = sub[run1]->isLinearIn   ( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]+1] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isLinearIn( 1, varType, component, implicit_dep ) == BT_FALSE  ){
@@ -553,7 +712,7 @@ BooleanType FunctionEvaluationTree::isPolynomialIn( const Expression &variable )
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    BooleanType *implicit_dep = new BooleanType [2*getNumberOfIntermediateStateIndices()];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -583,7 +742,8 @@ BooleanType FunctionEvaluationTree::isPolynomialIn( const Expression &variable )
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isPolynomialIn( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]  ] = sub[run1]->isPolynomialIn( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]+1] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isPolynomialIn( 1, varType, component, implicit_dep ) == BT_FALSE  ){
@@ -607,7 +767,7 @@ BooleanType FunctionEvaluationTree::isRationalIn( const Expression &variable ){
     int nn = variable.getDim();
 
     int                 run1;
-    BooleanType *implicit_dep = new BooleanType [n ];
+    BooleanType *implicit_dep = new BooleanType [2*getNumberOfIntermediateStateIndices()];
     VariableType *varType     = new VariableType[nn];
     int          *component   = new int         [nn];
 
@@ -637,7 +797,8 @@ BooleanType FunctionEvaluationTree::isRationalIn( const Expression &variable ){
 
 
     for( run1 = 0; run1 < n; run1++ ){
-        implicit_dep[run1] = sub[run1]->isRationalIn( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]  ] = sub[run1]->isRationalIn ( 1, varType, component, implicit_dep );
+        implicit_dep[2*lhs_comp[run1]+1] = sub[run1]->isDependingOn( 1, varType, component, implicit_dep );
     }
     for( run1 = 0; run1 < dim; run1++ ){
         if( f[run1]->isRationalIn( 1, varType, component, implicit_dep ) == BT_FALSE  ){
@@ -723,6 +884,9 @@ returnValue FunctionEvaluationTree::AD_forward( double *x, double *seed, double
 
     int run1;
 
+    if( tape != NULL )
+        return tape->AD_forward( 0, x, seed, ff, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( 0, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -742,6 +906,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *x, double *s
 
     int run1;
 
+    if( tape != NULL )
+        return tape->AD_forward( number, x, seed, ff, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, x, seed,
                          &x   [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
@@ -759,6 +926,9 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 
     int run1;
 
+    if( tape != NULL )
+        return tape->AD_forward( number, seed, df );
+
     for( run1 = 0; run1 < n; run1++ ){
         sub[run1]->AD_forward( number, seed,
                          &seed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
@@ -771,147 +941,460 @@ returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double
 }
 
 
-returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
+returnValue FunctionEvaluationTree::AD_forward( int number, double *seed, double *df,
+                                                int nComp, const int *comp ){
 
     int run1;
 
-    for( run1 = dim-1; run1 >= 0; run1-- ){
-        f[run1]->AD_backward( 0, seed[run1], df );
+    if( tape != NULL )
+        return tape->AD_forward( number, seed, df, nComp, comp );
+
+    returnValue returnvalue = select( nComp, comp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    for( run1 = 0; run1 < nNeeded; run1++ ){
+        sub[needed[run1]]->AD_forward( number, seed, &seed[ indexList->index(VT_INTERMEDIATE_STATE,
+                                                                             lhs_comp[needed[run1]]) ] );
     }
 
+    double *tmp = 0;
 
-    for( run1 = n-1; run1 >= 0; run1-- ){
+    if( nExtra > 0 ){
+        tmp = (double*)calloc(dim+1,sizeof(double));
+        for( run1 = 0; run1 < dim; run1++ )
+            if( extra[run1] == BT_TRUE )
+                f[run1]->AD_forward( number, seed, &tmp[run1] );
+    }
 
-      sub[run1]->AD_backward( 0, df[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
-                              df
-                            );
+    for( run1 = 0; run1 < nComp; run1++ ){
+        if( nExtra > 0 && extra[comp[run1]] == BT_TRUE )
+            df[run1] = tmp[comp[run1]];
+        else
+            f[comp[run1]]->AD_forward( number, seed, &df[run1] );
     }
 
+    if( tmp != 0 ) free( tmp );
+
     return SUCCESSFUL_RETURN;
 }
 
 
-
-returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, double  *df ){
+returnValue FunctionEvaluationTree::AD_forward( int number, int nDir, double *seed, double *df ){
 
     int run1;
+    const int ld = getNumberOfVariables()+1;
 
-    for( run1 = dim-1; run1 >= 0; run1-- ){
-        f[run1]->AD_backward( number, seed[run1], df );
-    }
+    if( tape != NULL )
+        return tape->AD_forward( number, nDir, ld, seed, df );
 
-    for( run1 = n-1; run1 >= 0; run1-- ){
-      sub[run1]->AD_backward( number,
-                              df[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
-                              df );
+    for( run1 = 0; run1 < nDir; run1++ ){
+        returnValue returnvalue = AD_forward( number, &seed[run1*ld], &df[run1*dim] );
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
     }
 
     return SUCCESSFUL_RETURN;
 }
 
 
-returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
-                                             double *dseed, double *df,
-                                             double *ddf ){
+returnValue FunctionEvaluationTree::AD_backward( int number, int nDir, double *seed, double *df ){
 
     int run1;
+    const int ld = getNumberOfVariables()+1;
 
-    for( run1 = 0; run1 < n; run1++ ){
-        sub[run1]->AD_forward2( number, seed, dseed,
-                         &seed [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
-                         &dseed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
-    }
-    for( run1 = 0; run1 < dim; run1++ ){
-        f[run1]->AD_forward2( number, seed, dseed, &df[run1], &ddf[run1] );
+    if( tape != NULL )
+        return tape->AD_backward( number, nDir, ld, seed, df );
+
+    for( run1 = 0; run1 < nDir; run1++ ){
+        returnValue returnvalue = AD_backward( number, &seed[run1*dim], &df[run1*ld] );
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
     }
 
     return SUCCESSFUL_RETURN;
 }
 
 
-returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, double *seed2,
-                                              double *df, double  *ddf ){
+returnValue FunctionEvaluationTree::evaluateBatch( int number, int nPoints, double *x, double *result ){
 
-    int run1;
+    int run1, run2;
 
-    for( run1 = dim-1; run1 >= 0; run1-- ){
-        f[run1]->AD_backward2( number, seed1[run1], seed2[run1], df, ddf );
-    }
+    if( tape != NULL )
+        return tape->evaluateBatch( number, nPoints, x, result );
 
+    const int nv = getNumberOfVariables()+1;
 
-    for( run1 = n-1; run1 >= 0; run1-- ){
-      sub[run1]->AD_backward2( number,
-                              df  [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
-                              ddf [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
-                              df,
-                              ddf
-                            );
-    }
+    if( profile != NULL || isSymbolic() == BT_TRUE ){
 
-    return SUCCESSFUL_RETURN;
-}
+        double *xp = new double[nv ];
+        double *rp = new double[dim];
 
+        for( run1 = 0; run1 < nPoints; run1++ ){
 
+            for( run2 = 0; run2 < nv; run2++ )
+                xp[run2] = x[run2*nPoints+run1];
 
-returnValue FunctionEvaluationTree::C_print( 	FILE       *file     ,
-												const char *fcnName  ,
-												const char *realString,
-												int         precision
-												) const{
+            evaluate( number+run1, xp, rp );
 
-    acadoFPrintf(file,"/*\n");
-    acadoFPrintf(file," *    This file was auto-generated by ACADO Toolkit.\n");
-    acadoFPrintf(file," *\n");
-    acadoFPrintf(file," *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.\n");
-    acadoFPrintf(file," *    Copyright (C) 2008-2011 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.\n");
-    acadoFPrintf(file," *    Developed within the Optimization in Engineering Center (OPTEC) under\n");
-    acadoFPrintf(file," *    supervision of Moritz Diehl. All rights reserved.\n");
-    acadoFPrintf(file," *\n");
-    acadoFPrintf(file," */\n");
+            // the intermediate states are written to x:
+            for( run2 = 0; run2 < nv; run2++ )
+                x[run2*nPoints+run1] = xp[run2];
 
-    exportHeader             ( file,fcnName,realString );
-    exportForwardDeclarations( file,fcnName,realString );
-    exportCode               ( file,fcnName,realString,precision );
+            for( run2 = 0; run2 < dim; run2++ )
+                result[run2*nPoints+run1] = rp[run2];
+        }
 
-    return SUCCESSFUL_RETURN;
-}
+        delete[] xp;
+        delete[] rp;
 
+        return SUCCESSFUL_RETURN;
+    }
 
+    // C functions are linked: the tree is evaluated node by node for
+    // all points, such that every C function is called once per node
+    // with all points (see CFunction::setBatchFunction):
+    double *xa = (double*)calloc(nv *nPoints+1,sizeof(double));
+    double *ra = (double*)calloc(dim*nPoints+1,sizeof(double));
 
+    for( run1 = 0; run1 < nPoints; run1++ )
+        for( run2 = 0; run2 < nv; run2++ )
+            xa[run1*nv+run2] = x[run2*nPoints+run1];
 
-returnValue FunctionEvaluationTree::exportHeader(	FILE *file,
-													const char *fcnName,
-													const char *realString
-													) const{
+    for( run1 = 0; run1 < n; run1++ ){
 
-    if( n > 0 )
-    	acadoFPrintf(file,"%s %s[%d];\n", realString, auxVariableName.getName(), n );
+        const int index = indexList->index( VT_INTERMEDIATE_STATE, lhs_comp[run1] );
 
-    return SUCCESSFUL_RETURN;
-}
+        batchCFunctions( sub[run1], number, nPoints, nv, xa );
+        for( run2 = 0; run2 < nPoints; run2++ )
+            sub[run1]->evaluate( number+run2, &xa[run2*nv], &xa[run2*nv+index] );
+    }
+    for( run1 = 0; run1 < dim; run1++ ){
 
+        batchCFunctions( f[run1], number, nPoints, nv, xa );
+        for( run2 = 0; run2 < nPoints; run2++ )
+            f[run1]->evaluate( number+run2, &xa[run2*nv], &ra[run2*dim+run1] );
+    }
 
-returnValue FunctionEvaluationTree::exportForwardDeclarations(	FILE *file,
-																const char *fcnName,
-																const char *realString
-																) const{
+    for( run1 = 0; run1 < nPoints; run1++ ){
+        for( run2 = 0; run2 < nv; run2++ )
+            x[run2*nPoints+run1] = xa[run1*nv+run2];
+        for( run2 = 0; run2 < dim; run2++ )
+            result[run2*nPoints+run1] = ra[run1*dim+run2];
+    }
 
-    acadoFPrintf(file,"void %s( const %s*, %s* );\n", fcnName,realString,realString );
+    free( xa );
+    free( ra );
 
     return SUCCESSFUL_RETURN;
 }
 
 
-returnValue FunctionEvaluationTree::exportCode(	FILE *file,
-												const char *fcnName,
-												const char *realString,
-												int         precision,
-												uint        _numX,
-												uint		_numXA,
-												uint		_numU
-												) const{
+returnValue FunctionEvaluationTree::AD_forwardBatch( int number, int nPoints, double *seed, double *df ){
 
-    int run1;
+    int run1, run2;
+
+    if( tape != NULL )
+        return tape->AD_forwardBatch( number, nPoints, seed, df );
+
+    const int nv = getNumberOfVariables()+1;
+
+    double *sp = new double[nv ];
+    double *dp = new double[dim];
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        for( run2 = 0; run2 < nv; run2++ )
+            sp[run2] = seed[run2*nPoints+run1];
+
+        AD_forward( number+run1, sp, dp );
+
+        for( run2 = 0; run2 < nv; run2++ )
+            seed[run2*nPoints+run1] = sp[run2];
+
+        for( run2 = 0; run2 < dim; run2++ )
+            df[run2*nPoints+run1] = dp[run2];
+    }
+
+    delete[] sp;
+    delete[] dp;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backwardBatch( int number, int nPoints, double *seed, double *df ){
+
+    int run1, run2;
+
+    if( tape != NULL )
+        return tape->AD_backwardBatch( number, nPoints, seed, df );
+
+    const int nv = getNumberOfVariables()+1;
+
+    double *sp = new double[dim];
+    double *dp = new double[nv ];
+
+    for( run1 = 0; run1 < nPoints; run1++ ){
+
+        for( run2 = 0; run2 < dim; run2++ )
+            sp[run2] = seed[run2*nPoints+run1];
+
+        for( run2 = 0; run2 < nv; run2++ )
+            dp[run2] = df[run2*nPoints+run1];
+
+        AD_backward( number+run1, sp, dp );
+
+        for( run2 = 0; run2 < nv; run2++ )
+            df[run2*nPoints+run1] = dp[run2];
+    }
+
+    delete[] sp;
+    delete[] dp;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::evaluateBatch( int number, int nPoints, float *x, float *result ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->evaluateBatch( nPoints, x, result );
+
+    const int nx = (getNumberOfVariables()+1)*nPoints;
+    const int nr = dim*nPoints;
+
+    double *xd = (double*)calloc(nx+1,sizeof(double));
+    double *rd = (double*)calloc(nr+1,sizeof(double));
+
+    for( run1 = 0; run1 < nx; run1++ )
+        xd[run1] = x[run1];
+
+    returnValue returnvalue = evaluateBatch( number, nPoints, xd, rd );
+
+    for( run1 = 0; run1 < nx; run1++ )
+        x[run1] = (float)xd[run1];
+
+    for( run1 = 0; run1 < nr; run1++ )
+        result[run1] = (float)rd[run1];
+
+    free( xd );
+    free( rd );
+
+    return returnvalue;
+}
+
+
+returnValue FunctionEvaluationTree::AD_forwardBatch( int number, int nPoints, float *seed, float *df ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->AD_forwardBatch( nPoints, seed, df );
+
+    const int ns = (getNumberOfVariables()+1)*nPoints;
+    const int nd = dim*nPoints;
+
+    double *sd = (double*)calloc(ns+1,sizeof(double));
+    double *dd = (double*)calloc(nd+1,sizeof(double));
+
+    for( run1 = 0; run1 < ns; run1++ )
+        sd[run1] = seed[run1];
+
+    returnValue returnvalue = AD_forwardBatch( number, nPoints, sd, dd );
+
+    for( run1 = 0; run1 < ns; run1++ )
+        seed[run1] = (float)sd[run1];
+
+    for( run1 = 0; run1 < nd; run1++ )
+        df[run1] = (float)dd[run1];
+
+    free( sd );
+    free( dd );
+
+    return returnvalue;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward( double *seed, double  *df ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->AD_backward( 0, seed, df );
+
+    for( run1 = dim-1; run1 >= 0; run1-- ){
+        f[run1]->AD_backward( 0, seed[run1], df );
+    }
+
+
+    for( run1 = n-1; run1 >= 0; run1-- ){
+
+      sub[run1]->AD_backward( 0, df[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
+                              df
+                            );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, double  *df ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->AD_backward( number, seed, df );
+
+    for( run1 = dim-1; run1 >= 0; run1-- ){
+        f[run1]->AD_backward( number, seed[run1], df );
+    }
+
+    for( run1 = n-1; run1 >= 0; run1-- ){
+      sub[run1]->AD_backward( number,
+                              df[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
+                              df );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward( int number, double *seed, double *df,
+                                                 int nComp, const int *comp ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->AD_backward( number, seed, df, nComp, comp );
+
+    returnValue returnvalue = select( nComp, comp );
+    if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+    // (C functions have no backward mode, such that the components
+    //  evaluated for them do not have to be swept)
+    for( run1 = nComp-1; run1 >= 0; run1-- ){
+        f[comp[run1]]->AD_backward( number, seed[run1], df );
+    }
+
+    for( run1 = nNeeded-1; run1 >= 0; run1-- ){
+      sub[needed[run1]]->AD_backward( number,
+                                      df[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[needed[run1]])],
+                                      df );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::AD_forward2( int number, double *seed,
+                                             double *dseed, double *df,
+                                             double *ddf ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->AD_forward2( number, seed, dseed, df, ddf );
+
+    for( run1 = 0; run1 < n; run1++ ){
+        sub[run1]->AD_forward2( number, seed, dseed,
+                         &seed [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
+                         &dseed[ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])] );
+    }
+    for( run1 = 0; run1 < dim; run1++ ){
+        f[run1]->AD_forward2( number, seed, dseed, &df[run1], &ddf[run1] );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward2( int number, double *seed1, double *seed2,
+                                              double *df, double  *ddf ){
+
+    int run1;
+
+    if( tape != NULL )
+        return tape->AD_backward2( number, seed1, seed2, df, ddf );
+
+    for( run1 = dim-1; run1 >= 0; run1-- ){
+        f[run1]->AD_backward2( number, seed1[run1], seed2[run1], df, ddf );
+    }
+
+
+    for( run1 = n-1; run1 >= 0; run1-- ){
+      sub[run1]->AD_backward2( number,
+                              df  [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
+                              ddf [ indexList->index(VT_INTERMEDIATE_STATE, lhs_comp[run1])],
+                              df,
+                              ddf
+                            );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+returnValue FunctionEvaluationTree::C_print( 	FILE       *file     ,
+												const char *fcnName  ,
+												const char *realString,
+												int         precision
+												) const{
+
+    acadoFPrintf(file,"/*\n");
+    acadoFPrintf(file," *    This file was auto-generated by ACADO Toolkit.\n");
+    acadoFPrintf(file," *\n");
+    acadoFPrintf(file," *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.\n");
+    acadoFPrintf(file," *    Copyright (C) 2008-2011 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.\n");
+    acadoFPrintf(file," *    Developed within the Optimization in Engineering Center (OPTEC) under\n");
+    acadoFPrintf(file," *    supervision of Moritz Diehl. All rights reserved.\n");
+    acadoFPrintf(file," *\n");
+    acadoFPrintf(file," */\n");
+
+    exportHeader             ( file,fcnName,realString );
+    exportForwardDeclarations( file,fcnName,realString );
+    exportCode               ( file,fcnName,realString,precision );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+
+returnValue FunctionEvaluationTree::exportHeader(	FILE *file,
+													const char *fcnName,
+													const char *realString
+													) const{
+
+    if( n > 0 )
+    	acadoFPrintf(file,"%s %s[%d];\n", realString, auxVariableName.getName(), n );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::exportForwardDeclarations(	FILE *file,
+																const char *fcnName,
+																const char *realString
+																) const{
+
+    acadoFPrintf(file,"void %s( const %s*, %s* );\n", fcnName,realString,realString );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::exportCode(	FILE *file,
+												const char *fcnName,
+												const char *realString,
+												int         precision,
+												uint        _numX,
+												uint		_numXA,
+												uint		_numU
+												) const{
+
+    int run1;
     int nni = 0;
 
     for( run1 = 0; run1 < n; run1++ )
@@ -1055,6 +1538,9 @@ returnValue FunctionEvaluationTree::clearBuffer(){
     int run1;
     returnValue returnvalue;
 
+    if( tape != NULL )
+        tape->clearBuffer();
+
     for( run1 = 0; run1 < n; run1++ ){
         returnvalue = sub[run1]->clearBuffer();
         if( returnvalue != SUCCESSFUL_RETURN ){
@@ -1086,7 +1572,7 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
     for( run1 = 0; run1 < dim_; run1++ ){
 
         Operator *tmp = f[run1]->clone();
-        delete f[run1];
+        Operator::release( f[run1] );
         Projection pp;
         pp.variableType   = VT_DDIFFERENTIAL_STATE;
         pp.vIndex         = run1                  ;
@@ -1096,6 +1582,11 @@ returnValue FunctionEvaluationTree::makeImplicit( int dim_ ){
         delete tmp;
     }
 
+    clearDerivatives();
+
+    if( tape != NULL )
+        return compile();
+
     return SUCCESSFUL_RETURN;
 }
 
@@ -1185,30 +1676,884 @@ returnValue FunctionEvaluationTree::setScale( double *scale_ ){
     return ACADOERROR(RET_INVALID_USE_OF_FUNCTION);
 }
 
-returnValue FunctionEvaluationTree::setAuxVariableName(const String& s)
-{
-	auxVariableName = s;
 
-	return SUCCESSFUL_RETURN;
+returnValue FunctionEvaluationTree::compile( ){
+
+    int run1;
+
+    if( tape == NULL )
+        tape = new EvaluationTape();
+
+    // a recompiled tape has to be translated once more:
+    BooleanType wasNative = tape->isNative();
+
+    int *lhs = (int*)calloc(n,sizeof(int));
+
+    for( run1 = 0; run1 < n; run1++ )
+        lhs[run1] = indexList->index( VT_INTERMEDIATE_STATE, lhs_comp[run1] );
+
+    returnValue returnvalue = tape->init( getNumberOfVariables(), n, sub, lhs, dim, f );
+    free( lhs );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        delete tape;
+        tape = NULL;
+        return returnvalue;
+    }
+
+    if( wasNative == BT_TRUE )
+        return tape->compileNative();
+
+    return SUCCESSFUL_RETURN;
 }
 
-returnValue FunctionEvaluationTree::getAuxVariableName(String& s) const
-{
-	s = auxVariableName;
 
-	return SUCCESSFUL_RETURN;
+returnValue FunctionEvaluationTree::convertToHornerForm( ){
+
+    if( isSymbolic() == BT_FALSE )
+        return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+
+    if( hornerForm == BT_TRUE )
+        return SUCCESSFUL_RETURN;
+
+    // the nodes shared by several terms (e.g. the monomials of a dense
+    // polynomial) have become intermediate states on import, which would
+    // hide the polynomials behind them; so the components are imported
+    // once more and converted before the promotion (a compiled tape is
+    // compiled again by operator<<):
+    Expression components = safeCopy;
+
+    clearComponents();
+    hornerForm = BT_TRUE;
+
+    return operator<<( components );
 }
 
-returnValue FunctionEvaluationTree::setAuxVariableStructName(const String& s)
-{
-	if (s.isEmpty() || s.getLength() == 1)
-		auxVariableStructName = String();
-	else
-		auxVariableStructName = s;
 
-	return SUCCESSFUL_RETURN;
+BooleanType FunctionEvaluationTree::isCompiled( ) const{
+
+    if( tape != NULL ) return BT_TRUE;
+    return BT_FALSE;
 }
 
+
+returnValue FunctionEvaluationTree::getSparsityPattern( SparsityPattern &pattern ){
+
+    const int nCols = getNumberOfVariables()+1;
+
+    if( tape == NULL ){
+
+        if( isSymbolic() == BT_FALSE )
+            return pattern.setDense( dim, nCols );
+
+        // compile temporarily:
+        returnValue returnvalue = compile();
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+        returnvalue = tape->getSparsityPattern( pattern, nCols );
+
+        delete tape;
+        tape = NULL;
+
+        return returnvalue;
+    }
+
+    return tape->getSparsityPattern( pattern, nCols );
+}
+
+
+returnValue FunctionEvaluationTree::getHessianSparsityPattern( SparsityPattern &pattern ){
+
+    const int nCols = getNumberOfVariables()+1;
+
+    if( tape == NULL ){
+
+        if( isSymbolic() == BT_FALSE )
+            return pattern.setDense( nCols, nCols );
+
+        // compile temporarily:
+        returnValue returnvalue = compile();
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+
+        returnvalue = tape->getHessianSparsityPattern( pattern, nCols );
+
+        delete tape;
+        tape = NULL;
+
+        return returnvalue;
+    }
+
+    return tape->getHessianSparsityPattern( pattern, nCols );
+}
+
+
+returnValue FunctionEvaluationTree::compileNative( ){
+
+    if( tape == NULL ){
+
+        returnValue returnvalue = compile();
+        if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+    }
+
+    return tape->compileNative();
+}
+
+
+BooleanType FunctionEvaluationTree::isNative( ) const{
+
+    if( tape != NULL ) return tape->isNative();
+    return BT_FALSE;
+}
+
+
+returnValue FunctionEvaluationTree::setProfiling( BooleanType doProfiling ){
+
+    if( doProfiling == BT_TRUE ){
+        if( profile == NULL ) profile = new EvaluationProfile();
+    }
+    else{
+        delete profile;
+        profile = NULL;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue FunctionEvaluationTree::printProfile( int nTop ) const{
+
+    if( profile == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return profile->print( nTop );
+}
+
+
+returnValue FunctionEvaluationTree::initWorkspace( EvaluationWorkspace &ws ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->initWorkspace( ws );
+}
+
+
+returnValue FunctionEvaluationTree::evaluate( EvaluationWorkspace &ws, double *x, double *result ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->evaluate( ws, x, result );
+}
+
+
+returnValue FunctionEvaluationTree::AD_forward( EvaluationWorkspace &ws, double *x, double *seed,
+                                                double *result, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_forward( ws, x, seed, result, df );
+}
+
+
+returnValue FunctionEvaluationTree::AD_forward( EvaluationWorkspace &ws, double *seed, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_forward( ws, seed, df );
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward( EvaluationWorkspace &ws, double *seed, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_backward( ws, seed, df );
+}
+
+
+returnValue FunctionEvaluationTree::AD_forward( EvaluationWorkspace &ws, int nDir, double *seed, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_forward( ws, nDir, getNumberOfVariables()+1, seed, df );
+}
+
+
+returnValue FunctionEvaluationTree::AD_backward( EvaluationWorkspace &ws, int nDir, double *seed, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_backward( ws, nDir, getNumberOfVariables()+1, seed, df );
+}
+
+
+returnValue FunctionEvaluationTree::evaluateBatch( EvaluationWorkspace &ws, int nPoints,
+                                                   double *x, double *result ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->evaluateBatch( ws, nPoints, x, result );
+}
+
+
+returnValue FunctionEvaluationTree::AD_forwardBatch( EvaluationWorkspace &ws, int nPoints,
+                                                     double *seed, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_forwardBatch( ws, nPoints, seed, df );
+}
+
+
+returnValue FunctionEvaluationTree::AD_backwardBatch( EvaluationWorkspace &ws, int nPoints,
+                                                      double *seed, double *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_backwardBatch( ws, nPoints, seed, df );
+}
+
+
+returnValue FunctionEvaluationTree::evaluateBatch( EvaluationWorkspace &ws, int nPoints,
+                                                   float *x, float *result ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->evaluateBatch( ws, nPoints, x, result );
+}
+
+
+returnValue FunctionEvaluationTree::AD_forwardBatch( EvaluationWorkspace &ws, int nPoints,
+                                                     float *seed, float *df ) const{
+
+    if( tape == NULL )
+        return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+    return tape->AD_forwardBatch( ws, nPoints, seed, df );
+}
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void FunctionEvaluationTree::copy( const FunctionEvaluationTree& arg ){
+
+    int run1;
+
+    dim = arg.dim;
+    n   = arg.n  ;
+
+    auxVariableName = arg.auxVariableName;
+    auxVariableStructName = arg.auxVariableStructName;
+
+    // the copy gets its own nodes as the nodes carry evaluation buffers:
+    table = new OperatorTable();
+
+    if( arg.f == NULL ){
+        f = NULL;
+    }
+    else{
+        f = (Operator**)calloc(dim,sizeof(Operator*));
+
+        for( run1 = 0; run1 < dim; run1++ ){
+            f[run1] = table->import( arg.f[run1] );
+        }
+    }
+
+    indexList = new SymbolicIndexList(*arg.indexList);
+
+    if( arg.sub == NULL ){
+        sub       = NULL;
+        lhs_comp  = NULL;
+    }
+    else{
+        sub = (Operator**)calloc(n,sizeof(Operator*));
+        lhs_comp = (int*)calloc(n,sizeof(int));
+
+        for( run1 = 0; run1 < n; run1++ ){
+            sub[run1] = table->import( arg.sub[run1] );
+            lhs_comp[run1] = arg.lhs_comp[run1];
+        }
+    }
+    table->endImport();
+
+    if( arg.tape != NULL ) tape = new EvaluationTape( *arg.tape );
+    else                   tape = NULL;
+
+    hornerForm = arg.hornerForm;
+
+    safeCopy = arg.safeCopy;
+
+    // the selection is determined again when needed:
+    selection = NULL;
+    nSelected = -1;
+    needed    = NULL;
+    nNeeded   =  0;
+    extra     = NULL;
+    nExtra    =  0;
+
+    // so are the derivatives:
+    derivative   = NULL;
+    nDerivatives = 0;
+
+    // the copy has its own nodes, i.e. it is profiled from scratch:
+    if( arg.profile != NULL ) profile = new EvaluationProfile();
+    else                      profile = NULL;
+}
+
+
+returnValue FunctionEvaluationTree::sortIntermediateStates( int nOld ){
+
+    int run1, run2;
+
+    int  nIndices = getNumberOfIntermediateStateIndices();
+    int *position = (int*)calloc(nIndices+1,sizeof(int));
+
+    for( run1 = 0; run1 < n; run1++ )
+        position[lhs_comp[run1]] = run1;
+
+    for( run1 = nOld; run1 < n; run1++ ){
+
+        // find the last intermediate state the state run1 depends on:
+        int last = -1;
+
+        std::set<const Operator*> visited;
+        std::vector<Operator*>    stack;
+        stack.push_back( sub[run1] );
+
+        while( stack.empty() == false ){
+
+            Operator *tmp = stack.back();
+            stack.pop_back();
+
+            if( visited.insert( tmp ).second == false ) continue;
+
+            VariableType varType;
+            int          component;
+
+            if( tmp->isVariable( varType, component ) == BT_TRUE ){
+
+                if( varType == VT_INTERMEDIATE_STATE && component < nIndices &&
+                    position[component] > last )
+                    last = position[component];
+                continue;
+            }
+
+            for( run2 = 0; run2 < tmp->getNumberOfArguments(); run2++ )
+                stack.push_back( tmp->getArgumentPointer(run2) );
+        }
+
+        if( last+1 >= run1 ) continue;
+
+        // move it directly behind this state:
+        Operator *state = sub     [run1];
+        int       comp  = lhs_comp[run1];
+
+        for( run2 = run1; run2 > last+1; run2-- ){
+            sub     [run2] = sub     [run2-1];
+            lhs_comp[run2] = lhs_comp[run2-1];
+            position[lhs_comp[run2]] = run2;
+        }
+        sub     [last+1] = state;
+        lhs_comp[last+1] = comp ;
+        position[comp]   = last+1;
+    }
+
+    free( position );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void FunctionEvaluationTree::clearComponents( ){
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        Operator::release( f[run1] );
+
+    for( run1 = 0; run1 < n; run1++ )
+        Operator::release( sub[run1] );
+
+    free( f        );
+    free( sub      );
+    free( lhs_comp );
+
+    delete indexList;
+    delete table;
+
+    f         = NULL;
+    sub       = NULL;
+    lhs_comp  = NULL;
+    indexList = new SymbolicIndexList();
+    table     = new OperatorTable();
+    dim       = 0;
+    n         = 0;
+    safeCopy  = Expression();
+
+    clearSelection();
+    clearDerivatives();
+    if( profile != NULL ) profile->clear();
+}
+
+
+void FunctionEvaluationTree::deleteAll( ){
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ ){
+         Operator::release( f[run1] );
+    }
+    if( f != NULL){
+        free(f);
+    }
+
+    for( run1 = 0; run1 < n; run1++ ){
+         Operator::release( sub[run1] );
+    }
+    if( sub != NULL ){
+        free(sub);
+    }
+
+    if( lhs_comp != NULL ){
+        free(lhs_comp);
+    }
+
+    delete indexList;
+    delete table;
+    delete tape;
+    delete profile;
+
+    clearSelection();
+    clearDerivatives();
+}
+
+
+returnValue FunctionEvaluationTree::select( int nComp, const int *comp ){
+
+    int run1, run2;
+
+    for( run1 = 0; run1 < nComp; run1++ )
+        if( comp[run1] < 0 || comp[run1] >= dim )
+            return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    if( nSelected == nComp && ( nComp == 0 || memcmp( selection, comp, nComp*sizeof(int) ) == 0 ) )
+        return SUCCESSFUL_RETURN;
+
+    clearSelection();
+
+    nSelected = nComp;
+    selection = (int*)calloc(nComp+1,sizeof(int));
+    needed    = (int*)calloc(n    +1,sizeof(int));
+    extra     = (BooleanType*)calloc(dim+1,sizeof(BooleanType));
+
+    if( nComp > 0 )
+        memcpy( selection, comp, nComp*sizeof(int) );
+
+    // the position of the intermediate states in sub:
+    std::map< int, int > position;
+
+    for( run1 = 0; run1 < n; run1++ )
+        position[ lhs_comp[run1] ] = run1;
+
+    // a C function is evaluated by its first component, all other
+    // components read the results from x. Note the state (or the
+    // output component j, as -1-j) evaluating it first:
+    std::map< int, int >     owner;
+    std::set< Operator* >    visited;
+    std::vector< Operator* > stack;
+
+    if( isSymbolic() == BT_FALSE ){
+
+        for( run1 = 0; run1 < n+dim; run1++ ){
+
+            if( run1 < n ) stack.push_back( sub[run1]   );
+            else           stack.push_back( f[run1-n]   );
+
+            while( stack.empty() == false ){
+
+                Operator *node = stack.back();
+                stack.pop_back();
+
+                if( visited.insert( node ).second == false ) continue;
+
+                if( node->getName() == ON_CEXPRESSION ){
+
+                    COperator *cNode = (COperator*)node;
+
+                    if( cNode->isFirstComponent() == BT_TRUE )
+                        owner[ cNode->getTypeID() ] = ( run1 < n ) ? run1 : n-1-run1;
+
+                    for( run2 = 0; run2 < (int)cNode->getArgument().getDim(); run2++ )
+                        stack.push_back( cNode->getArgument().element[run2] );
+                    continue;
+                }
+
+                for( run2 = 0; run2 < node->getNumberOfArguments(); run2++ )
+                    stack.push_back( node->getArgumentPointer( run2 ) );
+            }
+        }
+        visited.clear();
+    }
+
+    // mark the states the selected components depend on; as every state
+    // only depends on states before it, one backward pass suffices:
+    BooleanType *isNeeded = (BooleanType*)calloc(n+1,sizeof(BooleanType));
+    BooleanType  isOpaque = BT_FALSE;
+
+    for( run1 = 0; run1 < nComp; run1++ )
+        stack.push_back( f[comp[run1]] );
+
+    for( run1 = n; run1 >= 0; run1-- ){
+
+        if( run1 < n ){
+            if( isNeeded[run1] == BT_FALSE ) continue;
+            stack.push_back( sub[run1] );
+        }
+
+        while( stack.empty() == false ){
+
+            Operator *node = stack.back();
+            stack.pop_back();
+
+            if( visited.insert( node ).second == false ) continue;
+
+            VariableType varType;
+            int          component;
+
+            const int nArgs = node->getNumberOfArguments();
+
+            if( node->getName() == ON_CEXPRESSION ){
+
+                COperator *cNode = (COperator*)node;
+
+                for( run2 = 0; run2 < (int)cNode->getArgument().getDim(); run2++ )
+                    stack.push_back( cNode->getArgument().element[run2] );
+
+                if( cNode->isFirstComponent() == BT_TRUE ) continue;
+
+                std::map< int, int >::iterator it = owner.find( cNode->getTypeID() );
+
+                // the first component has to be evaluated before:
+                if( it != owner.end() && it->second >= 0 && it->second <= run1 ){
+                    isNeeded[ it->second ] = BT_TRUE;
+                }
+                else if( it != owner.end() && it->second < 0 && run1 == n ){
+                    extra[ -1-it->second ] = BT_TRUE;
+                    stack.push_back( f[ -1-it->second ] );
+                }
+                else{
+                    isOpaque = BT_TRUE;
+                }
+            }
+            else if( nArgs > 0 ){
+                for( run2 = 0; run2 < nArgs; run2++ )
+                    stack.push_back( node->getArgumentPointer( run2 ) );
+            }
+            else if( node->getName() == ON_DOUBLE_CONSTANT ){
+                continue;
+            }
+            else if( node->isVariable( varType, component ) == BT_TRUE ){
+
+                if( varType == VT_INTERMEDIATE_STATE && position.find( component ) != position.end() )
+                    isNeeded[ position[component] ] = BT_TRUE;
+            }
+            else{
+                isOpaque = BT_TRUE;
+            }
+        }
+    }
+
+    // otherwise, the order of the full evaluation is kept:
+    if( isOpaque == BT_TRUE ){
+
+        std::map< int, int >::iterator it;
+
+        for( it = owner.begin(); it != owner.end(); ++it )
+            if( it->second < 0 )
+                extra[ -1-it->second ] = BT_TRUE;
+    }
+
+    nNeeded = 0;
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( isNeeded[run1] == BT_TRUE || isOpaque == BT_TRUE )
+            needed[nNeeded++] = run1;
+
+    nExtra = 0;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( extra[run1] == BT_TRUE )
+            nExtra++;
+
+    free( isNeeded );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void FunctionEvaluationTree::clearSelection( ){
+
+    if( selection != NULL ) free( selection );
+    if( needed    != NULL ) free( needed    );
+    if( extra     != NULL ) free( extra     );
+
+    selection = NULL;
+    nSelected = -1;
+    needed    = NULL;
+    nNeeded   =  0;
+    extra     = NULL;
+    nExtra    =  0;
+}
+
+
+void FunctionEvaluationTree::clearDerivatives( ){
+
+    int run1;
+
+    for( run1 = 0; run1 < nDerivatives; run1++ )
+        delete derivative[run1];
+
+    if( derivative != NULL ) free( derivative );
+
+    derivative   = NULL;
+    nDerivatives = 0;
+}
+
+
+returnValue FunctionEvaluationTree::evaluateProfiled( int number, double *x, double *result ){
+
+    int run1;
+    unsigned long long start;
+
+    if( profile->getNumberOfNodes() == 0 && profile->getNumberOfStates() == 0 )
+        setUpProfile();
+
+    profile->recordEvaluation();
+
+    for( run1 = 0; run1 < n; run1++ ){
+
+        start = acadoGetCycles();
+        sub[run1]->evaluate( number, x, &x[ indexList->index(VT_INTERMEDIATE_STATE,
+                                                             lhs_comp[run1]         ) ] );
+        profile->recordState( run1, acadoGetCycles() - start );
+    }
+    for( run1 = 0; run1 < dim; run1++ ){
+        f[run1]->evaluate( number, x, &result[run1] );
+    }
+
+    // time some subtrees on their own (all intermediate states are set);
+    // timing all of them would take quadratic time in the depth of the
+    // expression, so they take turns such that timing them costs about
+    // one more evaluation:
+    const int nNodes = profile->getNumberOfNodes();
+    int       nTimed;
+    double    tmp;
+
+    if( nNodes == 0 )
+        return SUCCESSFUL_RETURN;
+
+    int idx = profile->selectNodes( nTimed );
+
+    for( run1 = 0; run1 < nTimed; run1++ ){
+
+        start = acadoGetCycles();
+        profile->getNode( idx )->evaluate( number, x, &tmp );
+        profile->recordNode( idx, acadoGetCycles() - start );
+
+        idx = ( idx+1 ) % nNodes;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void FunctionEvaluationTree::setUpProfile( ){
+
+    int run1, run2;
+
+    // sort the nodes such that every node comes after its arguments,
+    // the walk stops at intermediate states (which are profiled as such):
+    std::map< Operator*, int > position;
+    std::vector< Operator* >   order;
+    std::vector< int >         references;
+
+    std::vector< Operator* > stack;
+    std::vector< int >       next;
+
+    for( run1 = 0; run1 < n+dim; run1++ ){
+
+        Operator *root = ( run1 < n ) ? sub[run1] : f[run1-n];
+
+        stack.push_back( root );
+        next.push_back( 0 );
+
+        while( stack.empty() == false ){
+
+            Operator *node = stack.back();
+
+            if( next.back() == 0 && position.find( node ) != position.end() ){
+                stack.pop_back();
+                next.pop_back();
+                continue;
+            }
+
+            if( next.back() < node->getNumberOfArguments() ){
+                stack.push_back( node->getArgumentPointer( next.back()++ ) );
+                next.push_back( 0 );
+                continue;
+            }
+
+            position[node] = (int)order.size();
+            order.push_back( node );
+            references.push_back( 0 );
+
+            stack.pop_back();
+            next.pop_back();
+        }
+    }
+
+    // count the references and (in reverse order) the number of times
+    // every node is evaluated, as shared nodes are evaluated per reference:
+    const int nOrder = (int)order.size();
+    int *evaluations = (int*)calloc(nOrder+1,sizeof(int));
+
+    for( run1 = 0; run1 < n+dim; run1++ ){
+
+        const int idx = position[ ( run1 < n ) ? sub[run1] : f[run1-n] ];
+        references [idx]++;
+        evaluations[idx]++;
+    }
+
+    for( run1 = nOrder-1; run1 >= 0; run1-- ){
+        for( run2 = 0; run2 < order[run1]->getNumberOfArguments(); run2++ ){
+
+            const int idx = position[ order[run1]->getArgumentPointer( run2 ) ];
+            references [idx]++;
+            evaluations[idx] += evaluations[run1];
+        }
+    }
+
+    // the operator evaluations of every subtree (shared nodes count
+    // once per reference, as they are evaluated per reference):
+    double *operations = (double*)calloc(nOrder+1,sizeof(double));
+    double  total      = 0.0;
+
+    for( run1 = 0; run1 < nOrder; run1++ ){
+
+        operations[run1] = 1.0;
+
+        for( run2 = 0; run2 < order[run1]->getNumberOfArguments(); run2++ )
+            operations[run1] += operations[ position[ order[run1]->getArgumentPointer( run2 ) ] ];
+    }
+
+    for( run1 = 0; run1 < n+dim; run1++ )
+        total += operations[ position[ ( run1 < n ) ? sub[run1] : f[run1-n] ] ];
+
+    profile->setNumberOfOperations( total );
+
+    // variables and constants are not worth a record:
+    for( run1 = 0; run1 < nOrder; run1++ ){
+
+        VariableType varType;
+        int          component;
+
+        if( order[run1]->getNumberOfArguments() == 0 &&
+            ( order[run1]->getName() == ON_DOUBLE_CONSTANT ||
+              order[run1]->isVariable( varType, component ) == BT_TRUE ) )
+            continue;
+
+        profile->addNode( order[run1], evaluations[run1], references[run1], operations[run1] );
+    }
+
+    for( run1 = 0; run1 < n; run1++ )
+        profile->addState( sub[run1] );
+
+    free( evaluations );
+    free( operations  );
+}
+
+
+int FunctionEvaluationTree::getNumberOfIntermediateStateIndices( ) const{
+
+    int run1;
+    int nni = 0;
+
+    for( run1 = 0; run1 < n; run1++ )
+        if( lhs_comp[run1]+1 > nni )
+            nni = lhs_comp[run1]+1;
+
+    return nni;
+}
+
+
+returnValue FunctionEvaluationTree::setAuxVariableName(const String& s)
+{
+	auxVariableName = s;
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue FunctionEvaluationTree::getAuxVariableName(String& s) const
+{
+	s = auxVariableName;
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue FunctionEvaluationTree::setAuxVariableStructName(const String& s)
+{
+	if (s.isEmpty() || s.getLength() == 1)
+		auxVariableStructName = String();
+	else
+		auxVariableStructName = s;
+
+	return SUCCESSFUL_RETURN;
+}
+
+returnValue FunctionEvaluationTree::batchCFunctions( Operator *node, int number, int nPoints,
+                                                    int nv, double *x ){
+
+    int run1;
+
+    std::vector< Operator* > stack;
+    std::set< Operator* >    visited;
+
+    stack.push_back( node );
+
+    while( stack.empty() == false ){
+
+        Operator *tmp = stack.back();
+        stack.pop_back();
+
+        if( visited.insert( tmp ).second == false )
+            continue;
+
+        if( tmp->getName() == ON_CEXPRESSION ){
+            returnValue returnvalue = ((COperator*)tmp)->evaluateBatch( number, nPoints, nv, x );
+            if( returnvalue != SUCCESSFUL_RETURN ) return returnvalue;
+            continue;
+        }
+
+        for( run1 = 0; run1 < tmp->getNumberOfArguments(); run1++ )
+            stack.push_back( tmp->getArgumentPointer(run1) );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 CLOSE_NAMESPACE_ACADO
 
 // end of file.
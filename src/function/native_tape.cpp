@@ -0,0 +1,541 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/function/native_tape.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/native_tape.hpp>
+#include <acado/function/evaluation_tape.hpp>
+
+#include <string.h>
+
+#ifndef WIN32
+#include <dlfcn.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#endif
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+NativeTape::NativeTape( ){
+
+    handle        = 0;
+    path          = 0;
+    nRegisters    = 0;
+    nInstructions = 0;
+
+    evaluateFcn   = 0;
+    forwardFcn    = 0;
+    derivativeFcn = 0;
+    backwardFcn   = 0;
+}
+
+
+NativeTape::NativeTape( const NativeTape& arg ){
+
+    copy( arg );
+}
+
+
+NativeTape::~NativeTape( ){
+
+    deleteAll();
+}
+
+
+NativeTape& NativeTape::operator=( const NativeTape& arg ){
+
+    if( this != &arg ){
+
+        deleteAll();
+        copy( arg );
+    }
+    return *this;
+}
+
+
+
+returnValue NativeTape::init( const EvaluationTape &tape ){
+
+#ifdef WIN32
+
+    return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+
+#else
+
+    deleteAll();
+
+    char *dir = 0;
+    returnValue returnvalue = setupCacheDirectory( dir );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        free( dir );
+        return ACADOERROR( returnvalue );
+    }
+
+    // the shared object is keyed by the hash of the tape:
+    const uint64_t hash = tape.getHash();
+
+    path = (char*)calloc(strlen(dir)+64,sizeof(char));
+    sprintf( path, "%s/acado_tape_%08lx%08lx.so", dir,
+             (unsigned long)( hash >> 32 ), (unsigned long)( hash & 0xffffffffu ) );
+
+    const int signature[4] = { tape.getNumberOfRegisters(), tape.getNumberOfInstructions(),
+                               tape.getNumberOfVariables(), tape.getNumberOfConstants()    };
+
+    // reuse a cached shared object only if it passes all checks;
+    // otherwise it is (re-)compiled and replaces the cached one:
+    if( access( path, F_OK ) == 0 &&
+        load( signature, hash, tape.getCode(), tape.getConstantIndex() ) == SUCCESSFUL_RETURN ){
+
+        free( dir );
+        return SUCCESSFUL_RETURN;
+    }
+
+    returnvalue = compile( tape, dir );
+    free( dir );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        deleteAll();
+        return ACADOERROR( returnvalue );
+    }
+
+    if( load( signature, hash, tape.getCode(), tape.getConstantIndex() ) != SUCCESSFUL_RETURN ){
+        deleteAll();
+        return ACADOERROR( RET_UNABLE_TO_LOAD_COMPILED_FUNCTION );
+    }
+
+    return SUCCESSFUL_RETURN;
+
+#endif
+}
+
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue NativeTape::setupCacheDirectory( char *&dir ) const{
+
+#ifdef WIN32
+
+    return RET_NOT_YET_IMPLEMENTED;
+
+#else
+
+    const char *env = getenv( "ACADO_JIT_DIR" );
+
+    if( env != 0 ){
+
+        dir = (char*)calloc(strlen(env)+1,sizeof(char));
+        strcpy( dir, env );
+    }
+    else{
+
+        dir = (char*)calloc(64,sizeof(char));
+        sprintf( dir, "/tmp/acado_jit_%ld", (long)geteuid() );
+    }
+
+    // missing directories are created accessible by the current user only:
+    if( mkdir( dir, S_IRWXU ) != 0 && errno != EEXIST )
+        return RET_FILE_CAN_NOT_BE_OPENED;
+
+    // the default directory is not even readable by others (an
+    // existing ACADO_JIT_DIR is left as chosen by the user):
+    if( env == 0 && chmod( dir, S_IRWXU ) != 0 )
+        return RET_FILE_CAN_NOT_BE_OPENED;
+
+    // the directory must not be a symbolic link, must belong to the
+    // current user and must not be writable by anybody else:
+    if( isPrivate( dir, BT_TRUE ) == BT_FALSE )
+        return RET_FILE_CAN_NOT_BE_OPENED;
+
+    return SUCCESSFUL_RETURN;
+
+#endif
+}
+
+
+BooleanType NativeTape::isPrivate( const char *fileName, BooleanType isDirectory ){
+
+#ifdef WIN32
+
+    return BT_FALSE;
+
+#else
+
+    struct stat info;
+
+    if( lstat( fileName, &info ) != 0 )
+        return BT_FALSE;
+
+    if( isDirectory == BT_TRUE && !S_ISDIR( info.st_mode ) ) return BT_FALSE;
+    if( isDirectory == BT_FALSE && !S_ISREG( info.st_mode ) ) return BT_FALSE;
+
+    if( info.st_uid != geteuid() )                     return BT_FALSE;
+    if( ( info.st_mode & ( S_IWGRP | S_IWOTH ) ) != 0 ) return BT_FALSE;
+
+    return BT_TRUE;
+
+#endif
+}
+
+
+returnValue NativeTape::compile( const EvaluationTape &tape, const char *dir ) const{
+
+#ifdef WIN32
+
+    return RET_NOT_YET_IMPLEMENTED;
+
+#else
+
+    const char *cc = getenv( "ACADO_JIT_CC" );
+    if( cc == 0 ) cc = "cc";
+
+    // create the source and the object as new files with unique names
+    // in the cache directory and publish the object by renaming it:
+    char *source = (char*)calloc(strlen(dir)+64,sizeof(char));
+    char *object = (char*)calloc(strlen(dir)+64,sizeof(char));
+
+    sprintf( source, "%s/acado_tape_XXXXXX.c" , dir );
+    sprintf( object, "%s/acado_tape_XXXXXX.so", dir );
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    int sourceFd = mkstemps( source, 2 );
+    int objectFd = mkstemps( object, 3 );
+
+    if( sourceFd < 0 || objectFd < 0 ){
+
+        if( sourceFd >= 0 ){ close( sourceFd ); remove( source ); }
+        if( objectFd >= 0 ){ close( objectFd ); remove( object ); }
+
+        free( source );
+        free( object );
+        return RET_FILE_CAN_NOT_BE_OPENED;
+    }
+    close( objectFd );
+
+    FILE *file = fdopen( sourceFd, "w" );
+
+    if( file == 0 ){
+        close( sourceFd );
+        returnvalue = RET_FILE_CAN_NOT_BE_OPENED;
+    }
+    else{
+        tape.exportCode( file );
+        fclose( file );
+
+        // run the compiler directly, i.e. without a shell:
+        const char *argv[] = { cc, "-O2", "-fPIC", "-shared", "-o", object, source, "-lm", 0 };
+
+        int   status = -1;
+        pid_t pid    = fork();
+
+        if( pid == 0 ){
+            execvp( cc, (char* const*)argv );
+            _exit( 127 );
+        }
+
+        // the digest is written before the object is published, such
+        // that a published object always has a digest to be checked:
+        if( pid < 0 || waitpid( pid, &status, 0 ) != pid ||
+            !WIFEXITED( status ) || WEXITSTATUS( status ) != 0 ||
+            chmod( object, S_IRWXU ) != 0 || isPrivate( object, BT_FALSE ) == BT_FALSE ||
+            writeDigest( object, dir ) != SUCCESSFUL_RETURN || rename( object, path ) != 0 )
+            returnvalue = RET_UNABLE_TO_COMPILE_FUNCTION;
+    }
+
+    remove( source );
+    remove( object );
+
+    free( source );
+    free( object );
+
+    return returnvalue;
+
+#endif
+}
+
+
+returnValue NativeTape::load( const int *signature_, uint64_t hash_,
+                              const int *code_, const int *constantIndex_ ){
+
+#ifdef WIN32
+
+    return ACADOERROR( RET_NOT_YET_IMPLEMENTED );
+
+#else
+
+    if( handle != 0 ){
+        dlclose( handle );
+        handle = 0;
+    }
+
+    // never load files that other users could have written or that
+    // differ from the object which has been compiled (dlopen already
+    // runs code of the object):
+    if( isPrivate( path, BT_FALSE ) == BT_TRUE && hasValidDigest( ) == BT_TRUE )
+        handle = dlopen( path, RTLD_NOW | RTLD_LOCAL );
+
+    if( handle != 0 ){
+
+        const int                *signature = (const int*               )dlsym( handle, "acado_tape_signature" );
+        const uint64_t           *hash      = (const uint64_t*          )dlsym( handle, "acado_tape_hash"      );
+        const int                *code      = (const int*               )dlsym( handle, "acado_tape_code"      );
+        const int                *constants = (const int*               )dlsym( handle, "acado_tape_constants" );
+
+        evaluateFcn   = (EvaluateFcn)dlsym( handle, "acado_tape_evaluate"   );
+        forwardFcn    = (ForwardFcn )dlsym( handle, "acado_tape_forward"    );
+        derivativeFcn = (SweepFcn   )dlsym( handle, "acado_tape_derivative" );
+        backwardFcn   = (SweepFcn   )dlsym( handle, "acado_tape_backward"   );
+
+        // guard against hash collisions and stale files by comparing
+        // the complete instruction stream:
+        if( signature     != 0 && hash       != 0 && code != 0 && constants != 0 &&
+            evaluateFcn   != 0 && forwardFcn != 0 &&
+            derivativeFcn != 0 && backwardFcn != 0 &&
+            memcmp( signature, signature_, 4*sizeof(int) ) == 0 && *hash == hash_ &&
+            memcmp( code     , code_     , 4*signature_[1]*sizeof(int) ) == 0 &&
+            memcmp( constants, constantIndex_, signature_[3]*sizeof(int) ) == 0 ){
+
+            nRegisters    = signature_[0];
+            nInstructions = signature_[1];
+            return SUCCESSFUL_RETURN;
+        }
+
+        dlclose( handle );
+    }
+
+    handle        = 0;
+    nRegisters    = 0;
+    nInstructions = 0;
+
+    evaluateFcn   = 0;
+    forwardFcn    = 0;
+    derivativeFcn = 0;
+    backwardFcn   = 0;
+
+    return RET_UNABLE_TO_LOAD_COMPILED_FUNCTION;
+
+#endif
+}
+
+
+returnValue NativeTape::writeDigest( const char *object, const char *dir ) const{
+
+#ifdef WIN32
+
+    return RET_NOT_YET_IMPLEMENTED;
+
+#else
+
+    uint64_t digest;
+
+    if( getDigest( object, digest ) != SUCCESSFUL_RETURN )
+        return RET_FILE_CAN_NOT_BE_OPENED;
+
+    // the digest is published by renaming a new file, too:
+    char *digestFile = (char*)calloc(strlen(path)+8,sizeof(char));
+    char *tmpFile    = (char*)calloc(strlen(dir)+64,sizeof(char));
+
+    sprintf( digestFile, "%s.digest", path );
+    sprintf( tmpFile, "%s/acado_tape_XXXXXX.digest", dir );
+
+    returnValue returnvalue = RET_FILE_CAN_NOT_BE_OPENED;
+
+    int fd = mkstemps( tmpFile, 7 );
+
+    if( fd >= 0 ){
+
+        FILE *file = fdopen( fd, "w" );
+
+        if( file == 0 )
+            close( fd );
+        else{
+            int nWritten = fprintf( file, "%08lx%08lx\n", (unsigned long)( digest >> 32 ),
+                                                          (unsigned long)( digest & 0xffffffffu ) );
+
+            if( fclose( file ) == 0 && nWritten == 17 && rename( tmpFile, digestFile ) == 0 )
+                returnvalue = SUCCESSFUL_RETURN;
+        }
+
+        if( returnvalue != SUCCESSFUL_RETURN )
+            remove( tmpFile );
+    }
+
+    free( digestFile );
+    free( tmpFile );
+
+    return returnvalue;
+
+#endif
+}
+
+
+BooleanType NativeTape::hasValidDigest( ) const{
+
+#ifdef WIN32
+
+    return BT_FALSE;
+
+#else
+
+    BooleanType isValid = BT_FALSE;
+
+    char *digestFile = (char*)calloc(strlen(path)+8,sizeof(char));
+    sprintf( digestFile, "%s.digest", path );
+
+    uint64_t      digest;
+    unsigned long high, low;
+
+    if( isPrivate( digestFile, BT_FALSE ) == BT_TRUE ){
+
+        FILE *file = fopen( digestFile, "r" );
+
+        if( file != 0 ){
+
+            if( fscanf( file, "%8lx%8lx", &high, &low ) == 2 &&
+                getDigest( path, digest ) == SUCCESSFUL_RETURN &&
+                ( digest >> 32 ) == (uint64_t)high && ( digest & 0xffffffffu ) == (uint64_t)low )
+                isValid = BT_TRUE;
+
+            fclose( file );
+        }
+    }
+
+    free( digestFile );
+
+    return isValid;
+
+#endif
+}
+
+
+returnValue NativeTape::getDigest( const char *fileName, uint64_t &digest ){
+
+    FILE *file = fopen( fileName, "rb" );
+
+    if( file == 0 )
+        return RET_FILE_CAN_NOT_BE_OPENED;
+
+    unsigned char buffer[4096];
+    size_t nBytes, run1;
+
+    // 64 bit FNV-1a hash, starting from the offset basis 0xcbf29ce484222325:
+    digest = ( (uint64_t)0xcbf29ce4u << 32 ) | 0x84222325u;
+
+    while( ( nBytes = fread( buffer, 1, sizeof(buffer), file ) ) > 0 )
+        for( run1 = 0; run1 < nBytes; run1++ )
+            digest = hashByte( digest, buffer[run1] );
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+    if( ferror( file ) != 0 )
+        returnvalue = RET_FILE_CAN_NOT_BE_OPENED;
+
+    fclose( file );
+
+    return returnvalue;
+}
+
+
+void NativeTape::copy( const NativeTape& arg ){
+
+    handle        = 0;
+    path          = 0;
+    nRegisters    = 0;
+    nInstructions = 0;
+
+    evaluateFcn   = 0;
+    forwardFcn    = 0;
+    derivativeFcn = 0;
+    backwardFcn   = 0;
+
+#ifndef WIN32
+    if( arg.handle != 0 ){
+
+        path = (char*)calloc(strlen(arg.path)+1,sizeof(char));
+        strcpy( path, arg.path );
+
+        // the shared object must still match the one loaded by arg:
+        const int                *signature = (const int*               )dlsym( arg.handle, "acado_tape_signature" );
+        const uint64_t           *hash      = (const uint64_t*          )dlsym( arg.handle, "acado_tape_hash"      );
+        const int                *code      = (const int*               )dlsym( arg.handle, "acado_tape_code"      );
+        const int                *constants = (const int*               )dlsym( arg.handle, "acado_tape_constants" );
+
+        if( signature == 0 || hash == 0 || code == 0 || constants == 0 ||
+            load( signature, *hash, code, constants ) != SUCCESSFUL_RETURN )
+            ACADOERROR( RET_UNABLE_TO_LOAD_COMPILED_FUNCTION );
+    }
+#endif
+}
+
+
+void NativeTape::deleteAll(){
+
+#ifndef WIN32
+    if( handle != 0 )
+        dlclose( handle );
+#endif
+
+    free( path );
+
+    handle        = 0;
+    path          = 0;
+    nRegisters    = 0;
+    nInstructions = 0;
+
+    evaluateFcn   = 0;
+    forwardFcn    = 0;
+    derivativeFcn = 0;
+    backwardFcn   = 0;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
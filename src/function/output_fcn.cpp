@@ -109,13 +109,62 @@ returnValue OutputFcn::evaluate( const VariablesGrid *x ,
 
     EvaluationPoint z( *this, iter );
 
-    for( run1 = 0; run1 < N; run1++ ){
+    if( isCompiled() == BT_FALSE ){
 
-        z.setZ( run1, iter ); 
-        _result->setVector( run1, Function::evaluate(z) );
+        for( run1 = 0; run1 < N; run1++ ){
+
+            z.setZ( run1, iter );
+            _result->setVector( run1, Function::evaluate(z) );
+        }
+
+        return SUCCESSFUL_RETURN;
+    }
+
+
+    // COMPILED FUNCTIONS ARE EVALUATED AT ALL POINTS AT ONCE:
+    // -------------------------------------------------------
+    int run2;
+
+    const int nv = getNumberOfVariables()+1;
+    const int ny = getDim();
+
+    double *xBatch = new double[nv*N];
+    double *yBatch = new double[ny*N];
+
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < N && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+
+        z.setZ( run1, iter );
+
+        returnvalue = z.copyToBatch( xBatch, nv, N, run1 );
     }
 
-    return SUCCESSFUL_RETURN;
+    EvaluationWorkspace ws;
+
+    if( returnvalue == SUCCESSFUL_RETURN )
+        returnvalue = initWorkspace( ws );
+
+    if( returnvalue == SUCCESSFUL_RETURN )
+        returnvalue = evaluateBatch( ws, N, xBatch, yBatch );
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        Vector y( ny );
+
+        for( run1 = 0; run1 < N; run1++ ){
+
+            for( run2 = 0; run2 < ny; run2++ )
+                y(run2) = yBatch[run2*N+run1];
+
+            _result->setVector( run1, y );
+        }
+    }
+
+    delete[] xBatch;
+    delete[] yBatch;
+
+    return returnvalue;
 }
 
 
@@ -0,0 +1,465 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/function/sparsity_pattern.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/function/sparsity_pattern.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SparsityPattern::SparsityPattern( ){
+
+    rowStart = 0;
+    colIndex = 0;
+    init( 0, 0 );
+}
+
+
+SparsityPattern::SparsityPattern( int nRows_, int nCols_ ){
+
+    rowStart = 0;
+    colIndex = 0;
+    init( nRows_, nCols_ );
+}
+
+
+SparsityPattern::SparsityPattern( const SparsityPattern& arg ){
+
+    copy( arg );
+}
+
+
+SparsityPattern::~SparsityPattern( ){
+
+    deleteAll();
+}
+
+
+SparsityPattern& SparsityPattern::operator=( const SparsityPattern& arg ){
+
+    if( this != &arg ){
+
+        deleteAll();
+        copy( arg );
+    }
+    return *this;
+}
+
+
+returnValue SparsityPattern::init( int nRows_, int nCols_ ){
+
+    deleteAll();
+
+    nRows    = nRows_;
+    nCols    = nCols_;
+    rowStart = (int*)calloc(nRows+1,sizeof(int));
+    colIndex = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparsityPattern::init( int nRows_, int nCols_, const int *rowStart_, const int *colIndex_ ){
+
+    int run1;
+
+    for( run1 = 0; run1 < rowStart_[nRows_]; run1++ )
+        if( colIndex_[run1] < 0 || colIndex_[run1] >= nCols_ )
+            return ACADOERROR(RET_INDEX_OUT_OF_BOUNDS);
+
+    init( nRows_, nCols_ );
+
+    colIndex = (int*)calloc(rowStart_[nRows],sizeof(int));
+
+    memcpy( rowStart, rowStart_, (nRows+1)        *sizeof(int) );
+    memcpy( colIndex, colIndex_, rowStart_[nRows] *sizeof(int) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparsityPattern::setDense( int nRows_, int nCols_ ){
+
+    int run1, run2;
+
+    init( nRows_, nCols_ );
+
+    colIndex = (int*)calloc(nRows*nCols,sizeof(int));
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+
+        rowStart[run1+1] = rowStart[run1] + nCols;
+
+        for( run2 = 0; run2 < nCols; run2++ )
+            colIndex[run1*nCols+run2] = run2;
+    }
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType SparsityPattern::isNonzero( int row, int col ) const{
+
+    int run1;
+
+    if( row < 0 || row >= nRows ) return BT_FALSE;
+
+    for( run1 = rowStart[row]; run1 < rowStart[row+1]; run1++ )
+        if( colIndex[run1] == col )
+            return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+SparsityPattern SparsityPattern::getTranspose() const{
+
+    int *colStart = (int*)calloc(nCols+1          ,sizeof(int));
+    int *rowIndex = (int*)calloc(rowStart[nRows]+1,sizeof(int));
+
+    getTranspose( colStart, rowIndex );
+
+    SparsityPattern transposed;
+    transposed.init( nCols, nRows, colStart, rowIndex );
+
+    free( colStart );
+    free( rowIndex );
+
+    return transposed;
+}
+
+
+SparsityPattern SparsityPattern::getLowerTriangle() const{
+
+    int run1, run2;
+
+    int *lowerStart = (int*)calloc(nRows+1          ,sizeof(int));
+    int *lowerIndex = (int*)calloc(rowStart[nRows]+1,sizeof(int));
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+
+        lowerStart[run1+1] = lowerStart[run1];
+
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ )
+            if( colIndex[run2] <= run1 )
+                lowerIndex[lowerStart[run1+1]++] = colIndex[run2];
+    }
+
+    SparsityPattern lower;
+    lower.init( nRows, nCols, lowerStart, lowerIndex );
+
+    free( lowerStart );
+    free( lowerIndex );
+
+    return lower;
+}
+
+
+SparsityPattern SparsityPattern::getSymmetric() const{
+
+    int run1, run2;
+
+    SparsityPattern lower      = getLowerTriangle();
+    SparsityPattern transposed = lower.getTranspose();
+
+    const int *lStart = lower.getRowStart();
+    const int *lIndex = lower.getColIndex();
+    const int *tStart = transposed.getRowStart();
+    const int *tIndex = transposed.getColIndex();
+
+    int *symStart = (int*)calloc(nRows+1                 ,sizeof(int));
+    int *symIndex = (int*)calloc(2*lStart[nRows]+1       ,sizeof(int));
+
+    // the rows of both triangles are sorted, the diagonal is contained in both:
+    for( run1 = 0; run1 < nRows; run1++ ){
+
+        symStart[run1+1] = symStart[run1];
+
+        for( run2 = lStart[run1]; run2 < lStart[run1+1]; run2++ )
+            symIndex[symStart[run1+1]++] = lIndex[run2];
+
+        for( run2 = tStart[run1]; run2 < tStart[run1+1]; run2++ )
+            if( tIndex[run2] != run1 )
+                symIndex[symStart[run1+1]++] = tIndex[run2];
+    }
+
+    SparsityPattern symmetric;
+    symmetric.init( nRows, nRows, symStart, symIndex );
+
+    free( symStart );
+    free( symIndex );
+
+    return symmetric;
+}
+
+
+int SparsityPattern::getColumnColoring( int *color ) const{
+
+    int *colStart = (int*)calloc(nCols+1          ,sizeof(int));
+    int *rowIndex = (int*)calloc(rowStart[nRows]+1,sizeof(int));
+
+    getTranspose( colStart, rowIndex );
+
+    // columns are linked to their rows, rows hold their columns:
+    int nColors = colorGreedy( nCols, colStart, rowIndex, nRows, rowStart, colIndex, color );
+
+    free( colStart );
+    free( rowIndex );
+
+    return nColors;
+}
+
+
+int SparsityPattern::getRowColoring( int *color ) const{
+
+    int *colStart = (int*)calloc(nCols+1          ,sizeof(int));
+    int *rowIndex = (int*)calloc(rowStart[nRows]+1,sizeof(int));
+
+    getTranspose( colStart, rowIndex );
+
+    // rows are linked to their columns, columns hold their rows:
+    int nColors = colorGreedy( nRows, rowStart, colIndex, nCols, colStart, rowIndex, color );
+
+    free( colStart );
+    free( rowIndex );
+
+    return nColors;
+}
+
+
+int SparsityPattern::getStarColoring( int *color ) const{
+
+    int run1, run2, run3, run4;
+    int nColors = 0;
+
+    const int n = nRows;
+
+    // forbidden[c] == v means that colour c is not admissible for v,
+    // count[c] is the number of neighbours of v with colour c:
+    int *forbidden = (int*)calloc(n+1,sizeof(int));
+    int *count     = (int*)calloc(n+1,sizeof(int));
+
+    for( run1 = 0; run1 <= n; run1++ )
+        forbidden[run1] = -1;
+
+    for( run1 = 0; run1 < n; run1++ )
+        color[run1] = -1;
+
+    for( run1 = 0; run1 < n; run1++ ){
+
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
+
+            const int w = colIndex[run2];
+
+            if( w != run1 && color[w] >= 0 ){
+                forbidden[color[w]] = run1;
+                count[color[w]]++;
+            }
+        }
+
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
+
+            const int w = colIndex[run2];
+
+            if( w == run1 || color[w] < 0 ) continue;
+
+            for( run3 = rowStart[w]; run3 < rowStart[w+1]; run3++ ){
+
+                const int x = colIndex[run3];
+
+                if( x == run1 || x == w || color[x] < 0 ) continue;
+
+                // path a - v - w - x with colour(a) == colour(w):
+                if( count[color[w]] > 1 ){
+                    forbidden[color[x]] = run1;
+                    continue;
+                }
+
+                // path v - w - x - y with colour(y) == colour(w):
+                for( run4 = rowStart[x]; run4 < rowStart[x+1]; run4++ ){
+
+                    const int y = colIndex[run4];
+
+                    if( y != w && y != x && color[y] == color[w] ){
+                        forbidden[color[x]] = run1;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ )
+            if( colIndex[run2] != run1 && color[colIndex[run2]] >= 0 )
+                count[color[colIndex[run2]]] = 0;
+
+        int c = 0;
+        while( forbidden[c] == run1 ) c++;
+
+        color[run1] = c;
+        if( c+1 > nColors ) nColors = c+1;
+    }
+
+    free( forbidden );
+    free( count     );
+
+    return nColors;
+}
+
+
+returnValue SparsityPattern::print() const{
+
+    int run1, run2;
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+
+        for( run2 = 0; run2 < nCols; run2++ ){
+
+            if( isNonzero( run1, run2 ) == BT_TRUE ) acadoPrintf("x");
+            else                                     acadoPrintf(".");
+        }
+        acadoPrintf("\n");
+    }
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void SparsityPattern::copy( const SparsityPattern& arg ){
+
+    nRows    = arg.nRows;
+    nCols    = arg.nCols;
+    rowStart = (int*)calloc(nRows+1            ,sizeof(int));
+    colIndex = (int*)calloc(arg.rowStart[nRows],sizeof(int));
+
+    memcpy( rowStart, arg.rowStart, (nRows+1)           *sizeof(int) );
+    memcpy( colIndex, arg.colIndex, arg.rowStart[nRows] *sizeof(int) );
+}
+
+
+void SparsityPattern::deleteAll(){
+
+    free( rowStart );
+    free( colIndex );
+
+    nRows    = 0;
+    nCols    = 0;
+    rowStart = 0;
+    colIndex = 0;
+}
+
+
+void SparsityPattern::getTranspose( int *colStart, int *rowIndex ) const{
+
+    int run1, run2;
+
+    for( run1 = 0; run1 <= nCols; run1++ )
+        colStart[run1] = 0;
+
+    for( run1 = 0; run1 < rowStart[nRows]; run1++ )
+        colStart[colIndex[run1]+1]++;
+
+    for( run1 = 0; run1 < nCols; run1++ )
+        colStart[run1+1] += colStart[run1];
+
+    int *next = (int*)calloc(nCols+1,sizeof(int));
+    memcpy( next, colStart, (nCols+1)*sizeof(int) );
+
+    for( run1 = 0; run1 < nRows; run1++ )
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ )
+            rowIndex[next[colIndex[run2]]++] = run1;
+
+    free( next );
+}
+
+
+int SparsityPattern::colorGreedy( int n, const int *linkStart, const int *link,
+                                  int nLinks, const int *objectStart, const int *object,
+                                  int *color ){
+
+    int run1, run2, run3;
+    int nColors = 0;
+
+    // forbidden[c] == j means that colour c is taken by a neighbour of j:
+    int *forbidden = (int*)calloc(n+1,sizeof(int));
+
+    for( run1 = 0; run1 <= n; run1++ )
+        forbidden[run1] = -1;
+
+    for( run1 = 0; run1 < n; run1++ )
+        color[run1] = -1;
+
+    for( run1 = 0; run1 < n; run1++ ){
+
+        for( run2 = linkStart[run1]; run2 < linkStart[run1+1]; run2++ ){
+
+            const int l = link[run2];
+
+            if( l < 0 || l >= nLinks ) continue;
+
+            for( run3 = objectStart[l]; run3 < objectStart[l+1]; run3++ )
+                if( color[object[run3]] >= 0 )
+                    forbidden[color[object[run3]]] = run1;
+        }
+
+        int c = 0;
+        while( forbidden[c] == run1 ) c++;
+
+        color[run1] = c;
+        if( c+1 > nColors ) nColors = c+1;
+    }
+
+    free( forbidden );
+
+    return nColors;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -576,6 +576,7 @@ returnValue Integrator::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( INTEGRATOR_MIXED_PRECISION  , defaultIntegratorMixedPrecision );
 	
 	return SUCCESSFUL_RETURN;
 }
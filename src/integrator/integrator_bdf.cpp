@@ -54,6 +54,7 @@ IntegratorBDF::IntegratorBDF( )
 IntegratorBDF::IntegratorBDF( const DifferentialEquation& rhs_ )
               :Integrator( ){
 
+    initializeVariables();
     init( rhs_ );
 }
 
@@ -85,6 +86,15 @@ IntegratorBDF& IntegratorBDF::operator=( const IntegratorBDF& arg ){
 
 returnValue IntegratorBDF::init( const DifferentialEquation &rhs_ ){
 
+    // THE COLOURING OF THE ITERATION MATRIX BELONGS TO THE OLD RHS:
+    // -------------------------------------------------------------
+    if( iterationColor != 0 )
+        free(iterationColor);
+
+    iterationColor   = 0;
+    nIterationColors = 0;
+    iterationPattern = SparsityPattern();
+
     // RHS:
     // ---------
     rhs = new DifferentialEquation( rhs_ );
@@ -246,6 +256,7 @@ void IntegratorBDF::allocateMemory( ){
 
     maxNM = 1;
     M     = (Matrix**)calloc(maxNM,sizeof(Matrix*));
+    Mdec  = (MatrixFactorization**)calloc(maxNM,sizeof(MatrixFactorization*));
     M_index   = (int*)calloc(maxNM,sizeof(int));
 
     M_index[0] = 0;
@@ -420,7 +431,9 @@ void IntegratorBDF::initializeVariables(){
     eta2  = 0; x     = 0; t     = 0;
 
     nOfNewtonSteps = 0;
-    maxNM = 0; M = 0; M_index = 0; nOfM = 0;
+    maxNM = 0; M = 0; Mdec = 0; M_index = 0; nOfM = 0;
+
+    iterationColor = 0; nIterationColors = 0;
 
     F  = 0; F2 = 0;
 
@@ -578,12 +591,16 @@ void IntegratorBDF::constructAll( const IntegratorBDF& arg ){
 
     maxNM = 1;
     M     = (Matrix**)calloc(maxNM,sizeof(Matrix*));
+    Mdec  = (MatrixFactorization**)calloc(maxNM,sizeof(MatrixFactorization*));
     M_index   = (int*)calloc(maxNM,sizeof(int));
 
     M_index[0] = 0;
     M      [0] = 0;
     nOfM       = 0;
 
+    iterationColor   = 0;
+    nIterationColors = 0;
+
     las = arg.las;
 
     for( run1 = 0; run1 < 4; run1++ ){
@@ -916,13 +933,19 @@ void IntegratorBDF::deleteAll(){
     for( run1 = 0; run1 < maxNM; run1++ ){
          if( M[run1] != 0  )
              delete M[run1];
+         if( Mdec[run1] != 0 )
+             delete Mdec[run1];
     }
 
     if( M != NULL ){
         free(M);
+        free(Mdec);
         free(M_index);
     }
 
+    if( iterationColor != 0 )
+        free(iterationColor);
+
     if( F != NULL )
         delete[] F;
     if( F2 != NULL )
@@ -1090,12 +1113,16 @@ returnValue IntegratorBDF::unfreeze(){
     for( run1 = 0; run1 < maxNM; run1++ ){
          if( M[run1] != 0  )
              delete M[run1];
-         M[run1] = 0;
+         if( Mdec[run1] != 0 )
+             delete Mdec[run1];
+         M   [run1] = 0;
+         Mdec[run1] = 0;
     }
 
     maxNM = 1;
     nOfM  = 0;
     M       = (Matrix**)realloc(M,maxNM*sizeof(Matrix*));
+    Mdec    = (MatrixFactorization**)realloc(Mdec,maxNM*sizeof(MatrixFactorization*));
     M_index = (int*)realloc(M_index,maxAlloc*sizeof(int));
 
     h = (double*)realloc(h,maxAlloc*sizeof(double));
@@ -2400,8 +2427,11 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                    int oldMN = maxNM;
                    maxNM += maxNM;
                    M = (Matrix**)realloc(M, maxNM*sizeof(Matrix*));
-                   for( run1 = oldMN; run1 < maxNM; run1++ )
-                       M[run1] = 0;
+                   Mdec = (MatrixFactorization**)realloc(Mdec, maxNM*sizeof(MatrixFactorization*));
+                   for( run1 = oldMN; run1 < maxNM; run1++ ){
+                       M   [run1] = 0;
+                       Mdec[run1] = 0;
+                   }
                }
                M_index[stepnumber] = nOfM;
                M[nOfM] = new Matrix(m,m);
@@ -2413,37 +2443,15 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
                M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = gamma[stepnumber][4];
-               iseed[ diff_index[run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                        k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
-           }
+           if( computeIterationMatrix( 3*stepnumber+newtonsteps, gamma[stepnumber][4], 1.0,
+                                       *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
            nJacEvaluations++;
            jacComputation.stop();
            jacDecomposition.start();
 
-           if( decomposeJacobian( *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
+           if( decomposeJacobian( M_index[stepnumber] ) != SUCCESSFUL_RETURN )
                return ACADOERROR(RET_THE_DAE_INDEX_IS_TOO_LARGE);
 
            jacDecomposition.stop();
@@ -2454,7 +2462,7 @@ returnValue IntegratorBDF::determineCorrector( int stepnumber, BooleanType ini )
 
        norm1 = applyNewtonStep( eta[newtonsteps+1],
                                 eta[newtonsteps],
-                               *M[M_index[stepnumber]],
+                               M_index[stepnumber],
                                 F );
 
        if( soa == SOA_MESH_FROZEN || soa == SOA_EVERYTHING_FROZEN ){
@@ -2907,8 +2915,11 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                    int oldMN = maxNM;
                    maxNM += maxNM;
                    M = (Matrix**)realloc(M, maxNM*sizeof(Matrix*));
-                   for( run1 = oldMN; run1 < maxNM; run1++ )
-                       M[run1] = 0;
+                   Mdec = (MatrixFactorization**)realloc(Mdec, maxNM*sizeof(MatrixFactorization*));
+                   for( run1 = oldMN; run1 < maxNM; run1++ ){
+                       M   [run1] = 0;
+                       Mdec[run1] = 0;
+                   }
                }
                M_index[stepnumber] = nOfM;
                M[nOfM] = new Matrix(m,m);
@@ -2920,38 +2931,15 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
                M[0]->init(m,m);
            }
 
-           for( run1 = 0; run1 < md; run1++ ){
-               iseed[ddiff_index[run1]] = 1.0;
-               iseed[ diff_index[run1]] = ise;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,run1) = k2[0][0][run2];
-
-               iseed[ddiff_index[run1]] = 0.0;
-               iseed[ diff_index[run1]] = 0.0;
-           }
-           for( run1 = 0; run1 < ma; run1++ ){
-               iseed[ diff_index[md+run1]] = 1.0;
-               if( rhs[0].AD_forward( 3*stepnumber+newtonsteps, iseed,
-                                      k2[0][0] ) != SUCCESSFUL_RETURN ){
-                  return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
-               }
-
-               for( run2 = 0; run2 < m; run2++ )
-                   M[M_index[stepnumber]]->operator()(run2,md+run1) = k2[0][0][run2];
-
-               iseed[diff_index[md+run1]] = 0.0;
-           }
+           if( computeIterationMatrix( 3*stepnumber+newtonsteps, 1.0, ise,
+                                       *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
+               return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
            nJacEvaluations++;
            jacComputation.stop();
            jacDecomposition.start();
 
-           if( decomposeJacobian( *M[M_index[stepnumber]] ) != SUCCESSFUL_RETURN )
+           if( decomposeJacobian( M_index[stepnumber] ) != SUCCESSFUL_RETURN )
                    return ACADOERROR(RET_THE_DAE_INDEX_IS_TOO_LARGE);
 
            jacDecomposition.stop();
@@ -2962,7 +2950,7 @@ returnValue IntegratorBDF::rk_start_solve( int stepnumber ){
 
        norm1 = applyNewtonStep( k[newtonsteps+1][stepnumber],
                                 k[newtonsteps][stepnumber]  ,
-                               *M[M_index[stepnumber]],
+                               M_index[stepnumber],
                                 F );
 
        if( soa == SOA_MESH_FROZEN || soa == SOA_EVERYTHING_FROZEN ){
@@ -3069,7 +3057,7 @@ void IntegratorBDF::determineRKEtaGForward(){
 
                applyNewtonStep( k[newtonsteps+1][run1],
                                 k[newtonsteps][run1]  ,
-                               *M[M_index[run1]],
+                               M_index[run1],
                                 F );
 
                newtonsteps++;
@@ -3145,9 +3133,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3192,9 +3181,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3245,9 +3235,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3304,9 +3295,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3368,9 +3360,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3437,9 +3430,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3511,9 +3505,10 @@ void IntegratorBDF::determineRKEtaHBackward(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H );
+            if( applyMTranspose( kH[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][number_] )
                 != SUCCESSFUL_RETURN ){
@@ -3615,11 +3610,11 @@ void IntegratorBDF::determineRKEtaGForward2(){
 
                applyNewtonStep( k[newtonsteps+1][run1],
                                 k[newtonsteps][run1]  ,
-                               *M[M_index[run1]],
+                               M_index[run1],
                                 F );
                applyNewtonStep( k2[newtonsteps+1][run1],
                                 k2[newtonsteps][run1]  ,
-                               *M[M_index[run1]],
+                               M_index[run1],
                                 F2 );
 
                newtonsteps++;
@@ -3721,13 +3716,15 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
@@ -3788,12 +3785,14 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -3866,12 +3865,14 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -3956,12 +3957,14 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4056,12 +4059,14 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4166,12 +4171,14 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4286,12 +4293,14 @@ void IntegratorBDF::determineRKEtaHBackward2(){
 
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( kH2[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
-            applyMTranspose( kH3[number_][newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( kH2[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+            if( applyMTranspose( kH3[number_][newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][number_], l2[newtonsteps][number_] )
@@ -4416,7 +4425,7 @@ void IntegratorBDF::determineBDFEtaGForward( int number_ ){
 
             applyNewtonStep( eta[newtonsteps+1],
                              eta[newtonsteps],
-                            *M[M_index[number_]],
+                            M_index[number_],
                              F );
 
             newtonsteps++;
@@ -4466,7 +4475,8 @@ void IntegratorBDF::determineBDFEtaHBackward( int number_ ){
     newtonsteps--;
     while( newtonsteps >= 0 ){
 
-        applyMTranspose( etaH[newtonsteps+1], M[M_index[number_]][0], H );
+        if( applyMTranspose( etaH[newtonsteps+1], M_index[number_], H ) != SUCCESSFUL_RETURN )
+            ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
         if( rhs[0].AD_backward( 3*number_+newtonsteps, H, l[newtonsteps][0] ) != SUCCESSFUL_RETURN )
             ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
@@ -4628,12 +4638,12 @@ void IntegratorBDF::determineBDFEtaGForward2( int number_ ){
 
             applyNewtonStep( eta[newtonsteps+1],
                              eta[newtonsteps],
-                            *M[M_index[number_]],
+                            M_index[number_],
                              F );
 
             applyNewtonStep( eta2[newtonsteps+1],
                              eta2[newtonsteps],
-                            *M[M_index[number_]],
+                            M_index[number_],
                              F2 );
 
             newtonsteps++;
@@ -4704,13 +4714,15 @@ void IntegratorBDF::determineBDFEtaHBackward2( int number_ ){
         newtonsteps--;
         while( newtonsteps >= 0 ){
 
-            applyMTranspose( etaH2[newtonsteps+1],
-                            *M[M_index[number_]],
-                             H2 );
+            if( applyMTranspose( etaH2[newtonsteps+1],
+                                M_index[number_],
+                                 H2 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
-            applyMTranspose( etaH3[newtonsteps+1],
-                            *M[M_index[number_]],
-                             H3 );
+            if( applyMTranspose( etaH3[newtonsteps+1],
+                                M_index[number_],
+                                 H3 ) != SUCCESSFUL_RETURN )
+                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
 
             if( rhs[0].AD_backward2( 3*number_+newtonsteps, H2, H3,
                                      l[newtonsteps][0], l2[newtonsteps][0] )
@@ -5095,15 +5107,138 @@ void IntegratorBDF::printRKIntermediateResults(){
 }
 
 
-returnValue IntegratorBDF::decomposeJacobian( Matrix &J ) const{
+returnValue IntegratorBDF::determineIterationPattern(){
+
+    int run1, run2;
+
+    SparsityPattern pattern;
+
+    if( rhs[0].getSparsityPattern( pattern ) != SUCCESSFUL_RETURN )
+        pattern.setDense( m, rhs[0].getNumberOfVariables()+1 );
+
+    // map the variables to the columns of M:
+    const int N = pattern.getNumCols();
+
+    int *column  = (int*)calloc(N,sizeof(int));
+    int *column2 = (int*)calloc(N,sizeof(int));
+
+    for( run1 = 0; run1 < N; run1++ ){
+        column [run1] = -1;
+        column2[run1] = -1;
+    }
+
+    for( run1 = 0; run1 < m; run1++ )
+        if( diff_index[run1] < N ) column[diff_index[run1]] = run1;
+
+    for( run1 = 0; run1 < md; run1++ )
+        if( ddiff_index[run1] < N ) column2[ddiff_index[run1]] = run1;
+
+    const int *rowStart = pattern.getRowStart();
+    const int *colIndex = pattern.getColIndex();
+
+    int *Mstart = (int*)calloc(m+1                           ,sizeof(int));
+    int *Mindex = (int*)calloc(2*pattern.getNumberOfNonzeros()+1,sizeof(int));
+    int *last   = (int*)calloc(m                             ,sizeof(int));
+
+    for( run1 = 0; run1 < m; run1++ )
+        last[run1] = -1;
+
+    for( run1 = 0; run1 < m && run1 < pattern.getNumRows(); run1++ ){
+
+        Mstart[run1+1] = Mstart[run1];
+
+        for( run2 = rowStart[run1]; run2 < rowStart[run1+1]; run2++ ){
+
+            int j = column[colIndex[run2]];
+            if( j < 0 ) j = column2[colIndex[run2]];
+
+            if( j >= 0 && last[j] != run1 ){
+                last[j] = run1;
+                Mindex[Mstart[run1+1]++] = j;
+            }
+        }
+    }
+    for( ; run1 < m; run1++ )
+        Mstart[run1+1] = Mstart[run1];
+
+    SparsityPattern Mpattern;
+    Mpattern.init( m, m, Mstart, Mindex );
+
+    if( iterationColor != 0 )
+        free(iterationColor);
+
+    iterationColor   = (int*)calloc(m,sizeof(int));
+    nIterationColors = Mpattern.getColumnColoring( iterationColor );
+
+    // the columns are needed for the decompression:
+    iterationPattern = Mpattern.getTranspose();
+
+    free( column  );
+    free( column2 );
+    free( Mstart  );
+    free( Mindex  );
+    free( last    );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorBDF::computeIterationMatrix( int number, double ddiffSeed, double diffSeed, Matrix &J ){
+
+    int run1, run2, run3;
+
+    if( nIterationColors == 0 )
+        determineIterationPattern();
+
+    // the pattern is stored column by column:
+    const int *colStart = iterationPattern.getRowStart();
+    const int *rowIndex = iterationPattern.getColIndex();
+
+    J.setZero();
+
+    // one forward derivative per colour of the columns:
+    for( run3 = 0; run3 < nIterationColors; run3++ ){
+
+        for( run1 = 0; run1 < m; run1++ ){
+            if( iterationColor[run1] == run3 ){
+                if( run1 < md ) iseed[ddiff_index[run1]] = ddiffSeed;
+                if( run1 < md ) iseed[ diff_index[run1]] = diffSeed;
+                else            iseed[ diff_index[run1]] = 1.0;
+            }
+        }
+
+        if( rhs[0].AD_forward( number, iseed, k2[0][0] ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_BDF);
+
+        for( run1 = 0; run1 < m; run1++ ){
+            if( iterationColor[run1] == run3 ){
+
+                for( run2 = colStart[run1]; run2 < colStart[run1+1]; run2++ )
+                    J(rowIndex[run2],run1) = k2[0][0][rowIndex[run2]];
+
+                if( run1 < md ) iseed[ddiff_index[run1]] = 0.0;
+                iseed[diff_index[run1]] = 0.0;
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue IntegratorBDF::decomposeJacobian( int index ){
 
     switch( las ){
 
         case HOUSEHOLDER_METHOD:
-             return J.computeQRdecomposition();
+             if( Mdec[index] == 0 )
+                 Mdec[index] = new QRFactorization();
+             if( Mdec[index]->factorize( *M[index] ) != SUCCESSFUL_RETURN )
+                 return ACADOERROR( RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR );
+             return SUCCESSFUL_RETURN;
 
         case SPARSE_LU:
-             return J.computeSparseLUdecomposition();
+             return M[index]->computeSparseLUdecomposition();
 
         default:
              return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
@@ -5113,7 +5248,7 @@ returnValue IntegratorBDF::decomposeJacobian( Matrix &J ) const{
 }
 
 
-double IntegratorBDF::applyNewtonStep( double *etakplus1, const double *etak, const Matrix &J, const double *FFF ){
+double IntegratorBDF::applyNewtonStep( double *etakplus1, const double *etak, int index, const double *FFF ){
 
     int run1;
     Vector bb(m,FFF);
@@ -5121,9 +5256,16 @@ double IntegratorBDF::applyNewtonStep( double *etakplus1, const double *etak, co
 
     switch( las ){
 
-        case      HOUSEHOLDER_METHOD:  deltaX = J.solveQR      ( bb ); break;
-        case      SPARSE_LU:           deltaX = J.solveSparseLU( bb ); break;
-        default:                       deltaX.setZero          (    ); break;        
+        case      HOUSEHOLDER_METHOD:  if( Mdec[index]->solve( bb ) != SUCCESSFUL_RETURN ){
+                                           // AN INFINITE INCREMENT LETS THE NEWTON ITERATION FAIL:
+                                           ACADOERROR( RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR );
+                                           for( run1 = 0; run1 < m; run1++ )
+                                               etakplus1[run1] = etak[run1];
+                                           return INFTY;
+                                       }
+                                       deltaX = bb;  break;
+        case      SPARSE_LU:           deltaX = M[index]->solveSparseLU( bb ); break;
+        default:                       deltaX.setZero                  (    ); break;
     }
 
     for( run1 = 0; run1 < m; run1++ )
@@ -5133,7 +5275,7 @@ double IntegratorBDF::applyNewtonStep( double *etakplus1, const double *etak, co
 }
 
 
-void IntegratorBDF::applyMTranspose( double *seed1, Matrix &J, double *seed2 ){
+returnValue IntegratorBDF::applyMTranspose( double *seed1, int index, double *seed2 ){
 
     int run1;
     Vector bb(m);
@@ -5145,13 +5287,17 @@ void IntegratorBDF::applyMTranspose( double *seed1, Matrix &J, double *seed2 ){
 
     switch( las ){
 
-        case      HOUSEHOLDER_METHOD:  deltaX = J.solveTransposeQR      ( bb ); break;
-        case      SPARSE_LU:           deltaX = J.solveTransposeSparseLU( bb ); break;
-        default:                       deltaX.setZero                   (    ); break;
+        case      HOUSEHOLDER_METHOD:  if( Mdec[index]->solveTranspose( bb ) != SUCCESSFUL_RETURN )
+                                           return ACADOERROR( RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR );
+                                       deltaX = bb;  break;
+        case      SPARSE_LU:           deltaX = M[index]->solveTransposeSparseLU( bb ); break;
+        default:                       deltaX.setZero                           (    ); break;
     }
 
     for( run1 = 0; run1 < m; run1++ )
         seed2[run1] = deltaX(run1);
+
+    return SUCCESSFUL_RETURN;
 }
 
 
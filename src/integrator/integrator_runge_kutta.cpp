@@ -144,6 +144,9 @@ void IntegratorRK::initializeVariables(){
 
     maxAlloc  = 0;
     err_power = 1.0;
+
+    mixedPrecision = BT_FALSE;
+    xSingle = 0; kSingle = 0;
 }
 
 
@@ -188,6 +191,9 @@ void IntegratorRK::allocateMemory( ){
     l2    = new double*[dim];
     x     = new double [rhs->getNumberOfVariables() + 1 + m];
 
+    xSingle = new float[rhs->getNumberOfVariables() + 1 + m];
+    kSingle = new float[rhs->getDim() + 1];
+
     for( run1 = 0; run1 < rhs->getNumberOfVariables() + 1 + m; run1++ ){
         x[run1] = 0.0;
     }
@@ -346,6 +352,12 @@ void IntegratorRK::deleteAll(){
     if( x != NULL )
         delete[] x;
 
+    if( xSingle != NULL )
+        delete[] xSingle;
+
+    if( kSingle != NULL )
+        delete[] kSingle;
+
 
     // SENSITIVITIES:
     // ----------------------------------------
@@ -464,6 +476,9 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
     l2    = new double*[dim];
     x     = new double [rhs->getNumberOfVariables() + 1 + m];
 
+    xSingle = new float[rhs->getNumberOfVariables() + 1 + m];
+    kSingle = new float[rhs->getDim() + 1];
+
     for( run1 = 0; run1 < rhs->getNumberOfVariables() + 1 + m; run1++ ){
         x[run1] = arg.x[run1];
     }
@@ -505,6 +520,8 @@ void IntegratorRK::constructAll( const IntegratorRK& arg ){
 
     err_power = arg.err_power;
 
+    mixedPrecision = arg.mixedPrecision;
+
 
     // INTERNAL INDEX LISTS:
     // ---------------------
@@ -661,6 +678,15 @@ returnValue IntegratorRK::evaluate( const Vector &x0  ,
 
     Integrator::initializeOptions();
 
+    int useMixedPrecision;
+    get( INTEGRATOR_MIXED_PRECISION, useMixedPrecision );
+    mixedPrecision = (BooleanType)useMixedPrecision;
+
+    // only a compiled right-hand side has float kernels; otherwise the
+    // stages would be widened to double again at additional cost:
+    if( mixedPrecision == BT_TRUE && rhs->isCompiled() == BT_FALSE )
+        return ACADOERROR(RET_INVALID_OPTION);
+
     timeInterval  = t_;
 
     xStore.init(  m, timeInterval );
@@ -1641,7 +1667,7 @@ double IntegratorRK::determineEta45(){
            }
            functionEvaluation.start();
 
-           if( rhs[0].evaluate( 0, x, k[run1] ) != SUCCESSFUL_RETURN ){
+           if( evaluateStage( x, k[run1] ) != SUCCESSFUL_RETURN ){
                ACADOERROR(RET_UNSUCCESSFUL_RETURN_FROM_INTEGRATOR_RK45);
                return -1.0;
            }
@@ -1687,6 +1713,28 @@ double IntegratorRK::determineEta45(){
 
 
 
+returnValue IntegratorRK::evaluateStage( double *x_, double *k_ ){
+
+    int run1;
+
+    if( mixedPrecision == BT_FALSE )
+        return rhs[0].evaluate( 0, x_, k_ );
+
+    // only the stage derivatives are rounded to float; the stages,
+    // eta4, eta5 and the error estimate are computed in double:
+    for( run1 = 0; run1 < rhs->getNumberOfVariables()+1; run1++ )
+        xSingle[run1] = (float)x_[run1];
+
+    returnValue returnvalue = rhs[0].evaluateBatch( 0, 1, xSingle, kSingle );
+
+    for( run1 = 0; run1 < m; run1++ )
+        k_[run1] = kSingle[run1];
+
+    return returnvalue;
+}
+
+
+
 double IntegratorRK::determineEta45( int number_ ){
 
     int run1, run2, run3;
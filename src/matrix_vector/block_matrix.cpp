@@ -53,204 +53,68 @@ BlockMatrix::BlockMatrix( ){
 
 BlockMatrix::BlockMatrix( uint _nRows, uint _nCols )
 {
-    uint run1, run2;
-
-	nRows = _nRows;
-	nCols = _nCols;
-
-    elements = new Matrix            *[nRows];
-    types    = new SubBlockMatrixType*[nRows];
-
-    for( run1 = 0; run1 < nRows; run1++ ){
-
-        elements[run1] = new Matrix            [nCols];
-        types   [run1] = new SubBlockMatrixType[nCols];
-
-        for( run2 = 0; run2 < nCols; run2++ ){
-
-            types[run1][run2] = SBMT_ZERO;
-        }
-    }
+    allocateBlocks( _nRows, _nCols );
 }
 
 
 BlockMatrix::BlockMatrix(	const Matrix& value
 							)
 {
-	nRows = 1;
-	nCols = 1;
-
-	elements = new Matrix            *[nRows];
-	types    = new SubBlockMatrixType*[nRows];
-
-	elements[0] = new Matrix            [nCols];
-	types   [0] = new SubBlockMatrixType[nCols];
-
+	allocateBlocks( 1,1 );
 	setDense( 0,0,value );
 }
 
 
 BlockMatrix::BlockMatrix( const BlockMatrix& rhs ){
 
-    uint run1, run2;
-
-	nRows = rhs.nRows;
-	nCols = rhs.nCols;
-
-    if( rhs.elements != 0 ){
-
-        elements = new Matrix            *[nRows];
-        types    = new SubBlockMatrixType*[nRows];
-
-        for( run1 = 0; run1 < nRows; run1++ ){
-
-            elements[run1] = new Matrix            [nCols];
-            types   [run1] = new SubBlockMatrixType[nCols];
-
-            for( run2 = 0; run2 < nCols; run2++ ){
+	nRows    = 0;
+	nCols    = 0;
+    elements = 0;
+    types    = 0;
 
-                elements[run1][run2] = rhs.elements[run1][run2];
-                types   [run1][run2] = rhs.types   [run1][run2];
-            }
-        }
-    }
-    else{
-        elements = 0;
-        types    = 0;
-    }
+    copyBlocks( rhs );
 }
 
 
 BlockMatrix::~BlockMatrix( ){
 
-    uint run1;
-
-    if( elements != 0 ){
-
-        for( run1 = 0; run1 < nRows; run1++ ){
-
-            if( elements[run1] != 0 )
-                delete[] elements[run1];
-        }
-
-        delete[] elements;
-    }
-
-    if( types != 0 ){
-
-        for( run1 = 0; run1 < nRows; run1++ ){
-
-            if( types[run1] != 0 )
-                delete[] types[run1];
-        }
-
-        delete[] types;
-    }
+    releaseBlocks( );
 }
 
 
 BlockMatrix& BlockMatrix::operator=( const BlockMatrix& rhs ){
 
-    uint run1, run2;
-
-    if ( this != &rhs ){
-
-        if( elements != 0 ){
-
-            for( run1 = 0; run1 < nRows; run1++ ){
-
-                if( elements[run1] != 0 )
-                    delete[] elements[run1];
-            }
-
-            delete[] elements;
-        }
-
-        if( types != 0 ){
-
-            for( run1 = 0; run1 < nRows; run1++ ){
-
-                if( types[run1] != 0 )
-                    delete[] types[run1];
-            }
-
-            delete[] types;
-        }
-
-        nRows = rhs.nRows;
-        nCols = rhs.nCols;
-
-        if( rhs.elements != 0 ){
-
-            elements = new Matrix            *[nRows];
-            types    = new SubBlockMatrixType*[nRows];
-
-            for( run1 = 0; run1 < nRows; run1++ ){
-
-                elements[run1] = new Matrix            [nCols];
-                types   [run1] = new SubBlockMatrixType[nCols];
-
-                for( run2 = 0; run2 < nCols; run2++ ){
-                    elements[run1][run2] = rhs.elements[run1][run2];
-                    types   [run1][run2] = rhs.types   [run1][run2];
-                }
-            }
-        }
-        else{
-            elements = 0;
-            types    = 0;
-        }
-    }
+    if ( this != &rhs )
+        copyBlocks( rhs );
 
     return *this;
 }
 
 
-returnValue BlockMatrix::init( uint _nRows, uint _nCols ){
-
-
-    uint run1, run2;
-
-    if( elements != 0 ){
-
-        for( run1 = 0; run1 < nRows; run1++ ){
-
-            if( elements[run1] != 0 )
-                delete[] elements[run1];
-        }
-
-        delete[] elements;
-    }
-
-    if( types != 0 ){
-
-        for( run1 = 0; run1 < nRows; run1++ ){
+returnValue BlockMatrix::swap( BlockMatrix& rhs ){
 
-            if( types[run1] != 0 )
-                delete[] types[run1];
-        }
-
-        delete[] types; 
-    }
-
-    nRows = _nRows;
-    nCols = _nCols;
-
-    elements = new Matrix            *[nRows];
-    types    = new SubBlockMatrixType*[nRows];
+    uint                  tmpRows     = nRows;
+    uint                  tmpCols     = nCols;
+    Matrix              **tmpElements = elements;
+    SubBlockMatrixType  **tmpTypes    = types;
 
-    for( run1 = 0; run1 < nRows; run1++ ){
+    nRows        = rhs.nRows;
+    nCols        = rhs.nCols;
+    elements     = rhs.elements;
+    types        = rhs.types;
+    rhs.nRows    = tmpRows;
+    rhs.nCols    = tmpCols;
+    rhs.elements = tmpElements;
+    rhs.types    = tmpTypes;
 
-        elements[run1] = new Matrix            [nCols];
-        types   [run1] = new SubBlockMatrixType[nCols];
+    return SUCCESSFUL_RETURN;
+}
 
-        for( run2 = 0; run2 < nCols; run2++ ){
 
-            types[run1][run2] = SBMT_ZERO;
-        }
-    }
+returnValue BlockMatrix::init( uint _nRows, uint _nCols ){
 
-	return SUCCESSFUL_RETURN;
+    releaseBlocks( );
+    return allocateBlocks( _nRows, _nCols );
 }
 
 
@@ -299,7 +163,12 @@ BlockMatrix& BlockMatrix::operator+=( const BlockMatrix& arg ){
                 elements [i][j] = arg.elements [i][j];
             }
             else{
-                if( arg.types[i][j] != SBMT_ZERO ){
+                if( arg.types[i][j] == SBMT_ONE ){
+
+                   types    [i][j]  = SBMT_DENSE;
+                   addIdentity( elements[i][j] );
+                }
+                if( arg.types[i][j] == SBMT_DENSE ){
 
                    types    [i][j]  = SBMT_DENSE         ;
                    elements [i][j] += arg.elements [i][j];
@@ -437,7 +306,7 @@ BlockMatrix BlockMatrix::operator*( const BlockMatrix& arg ) const{
                                    result.types   [i][j]  = SBMT_ONE      ;
                              }
                              else{
-                                   result.elements[i][j] += elements[i][k];
+                                   addIdentity( result.elements[i][j] );
                                    result.types   [i][j]  = SBMT_DENSE    ;
                              }
                          }
@@ -513,7 +382,7 @@ BlockMatrix BlockMatrix::operator^( const BlockMatrix& arg ) const{
                                   result.types   [i][j]  = SBMT_ONE      ;
                             }
                             else{
-                                  result.elements[i][j] += elements[k][i];
+                                  addIdentity( result.elements[i][j] );
                                   result.types   [i][j]  = SBMT_DENSE    ;
                             }
                         }
@@ -688,6 +557,98 @@ returnValue BlockMatrix::getSubBlock( uint rowIdx, uint colIdx,
 //
 
 
+returnValue BlockMatrix::allocateBlocks( uint _nRows, uint _nCols ){
+
+    uint run1, run2;
+
+	nRows    = _nRows;
+	nCols    = _nCols;
+    elements = 0;
+    types    = 0;
+
+    if( nRows == 0 )
+        return SUCCESSFUL_RETURN;
+
+    elements = new Matrix            *[nRows];
+    types    = new SubBlockMatrixType*[nRows];
+
+    // the block objects are stored in one contiguous array, the row
+    // pointers only point into it (the entries of the dense blocks are
+    // owned by the block objects themselves):
+    elements[0] = new Matrix            [nRows*nCols];
+    types   [0] = new SubBlockMatrixType[nRows*nCols];
+
+    for( run1 = 0; run1 < nRows; run1++ ){
+
+        elements[run1] = elements[0] + run1*nCols;
+        types   [run1] = types   [0] + run1*nCols;
+
+        for( run2 = 0; run2 < nCols; run2++ )
+            types[run1][run2] = SBMT_ZERO;
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockMatrix::releaseBlocks( ){
+
+    if( elements != 0 ){
+        delete[] elements[0];
+        delete[] elements;
+    }
+
+    if( types != 0 ){
+        delete[] types[0];
+        delete[] types;
+    }
+
+    elements = 0;
+    types    = 0;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockMatrix::copyBlocks( const BlockMatrix& rhs ){
+
+    uint run1, run2;
+
+    if( ( nRows != rhs.nRows ) || ( nCols != rhs.nCols ) || ( elements == 0 ) ){
+
+        releaseBlocks( );
+
+        if( rhs.elements == 0 ){
+            nRows = rhs.nRows;
+            nCols = rhs.nCols;
+            return SUCCESSFUL_RETURN;
+        }
+        allocateBlocks( rhs.nRows, rhs.nCols );
+    }
+
+    // zero blocks are copied as well as they might carry a dimension:
+    for( run1 = 0; run1 < nRows; run1++ ){
+        for( run2 = 0; run2 < nCols; run2++ ){
+            elements[run1][run2] = rhs.elements[run1][run2];
+            types   [run1][run2] = rhs.types   [run1][run2];
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue BlockMatrix::addIdentity( Matrix& block ){
+
+    uint run1;
+
+    ASSERT( block.isSquare() == BT_TRUE );
+
+    for( run1 = 0; run1 < block.getNumRows(); run1++ )
+        block(run1,run1) += 1.0;
+
+    return SUCCESSFUL_RETURN;
+}
 
 
 
@@ -0,0 +1,211 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/ldl_factorization.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+LDLFactorization::LDLFactorization( ) : MatrixFactorization( ){
+
+}
+
+
+LDLFactorization::LDLFactorization( const LDLFactorization& rhs ) : MatrixFactorization( rhs ){
+
+}
+
+
+LDLFactorization::~LDLFactorization( ){
+
+}
+
+
+LDLFactorization& LDLFactorization::operator=( const LDLFactorization& rhs ){
+
+    if( this != &rhs )
+        MatrixFactorization::operator=( rhs );
+
+    return *this;
+}
+
+
+MatrixFactorization* LDLFactorization::clone( ) const{
+
+    return new LDLFactorization(*this);
+}
+
+
+returnValue LDLFactorization::factorize( const Matrix& A ){
+
+    uint i, k, k0, p, r0;
+
+    const uint nb = FACTORIZATION_BLOCK_SIZE;
+
+    if( setUpFactor( A, 2*nb*A.getNumRows() ) != SUCCESSFUL_RETURN )
+        return RET_MATRIX_NOT_SQUARE;
+
+    const uint n = dim;
+    double    *a = factor;
+
+    // the diagonal of the factor holds D, its strict lower triangle L:
+
+    for( k0 = 0; k0 < n; k0 += nb ){
+
+        const uint k1 = ( k0+nb < n ) ? k0+nb : n;
+        const uint kb = k1-k0;
+
+        // FACTORIZE THE BLOCK COLUMN  A(k0:n,k0:k1):
+        // ------------------------------------------
+        for( k = k0; k < k1; k++ ){
+
+            double s = a[k*n+k];
+            for( p = k0; p < k; p++ )
+                s -= a[k*n+p]*a[p*n+p]*a[k*n+p];
+
+            if( fabs( s ) < EPS )
+                return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+
+            a[k*n+k] = s;
+
+            for( i = k+1; i < n; i++ ){
+                double t = a[i*n+k];
+                for( p = k0; p < k; p++ )
+                    t -= a[i*n+p]*a[p*n+p]*a[k*n+p];
+                a[i*n+k] = t / s;
+            }
+        }
+
+        if( k1 == n )
+            break;
+
+        // UPDATE THE LOWER TRIANGLE OF  A(k1:n,k1:n) -= L21 D1 L21^T:
+        // ------------------------------------------------------------
+        const uint m2 = n-k1;
+        double   *W1  = work;
+        double   *W2  = work + m2*kb;
+
+        for( i = 0; i < m2; i++ )
+            for( p = 0; p < kb; p++ ){
+                W1[i*kb+p] = -a[(k1+i)*n+k0+p]*a[(k0+p)*n+k0+p];
+                W2[p*m2+i] =  a[(k1+i)*n+k0+p];
+            }
+
+        for( r0 = 0; r0 < m2; r0 += nb ){
+            const uint rb = ( r0+nb < m2 ) ? nb : m2-r0;
+            acadoGemmStrided( rb,r0+rb,kb, W1+r0*kb,kb, W2,m2, a+(k1+r0)*n+k1,n, BT_TRUE );
+        }
+    }
+
+    factorized = BT_TRUE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue LDLFactorization::getFactors( Matrix& L, Vector& D ) const{
+
+    uint i, k;
+
+    if( factorized == BT_FALSE )
+        return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    L.init( dim,dim );
+    L.setIdentity( );
+    D.init( dim );
+
+    for( i = 0; i < dim; i++ ){
+        for( k = 0; k < i; k++ )
+            L(i,k) = factor[i*dim+k];
+        D(i) = factor[i*dim+i];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue LDLFactorization::solveInPlace( double *B, uint nRhs, BooleanType transposed ) const{
+
+    int  i, k;
+    uint j;
+
+    const int     n = dim;
+    const uint    r = nRhs;
+    const double *a = factor;
+
+    // A is symmetric, i.e. transposed systems are solved in the same way.
+
+    // SOLVE  L*Y = B:
+    for( i = 1; i < n; i++ )
+        for( k = 0; k < i; k++ ){
+            const double l = a[i*n+k];
+            for( j = 0; j < r; j++ )
+                B[i*r+j] -= l*B[k*r+j];
+        }
+
+    // SOLVE  D*Z = Y:
+    for( i = 0; i < n; i++ )
+        for( j = 0; j < r; j++ )
+            B[i*r+j] /= a[i*n+i];
+
+    // SOLVE  L^T*X = Z:
+    for( i = n-1; i > 0; i-- )
+        for( k = 0; k < i; k++ ){
+            const double l = a[i*n+k];
+            for( j = 0; j < r; j++ )
+                B[k*r+j] -= l*B[i*r+j];
+        }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *   end of file
+ */
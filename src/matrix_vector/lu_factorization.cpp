@@ -0,0 +1,276 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/lu_factorization.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+LUFactorization::LUFactorization( ) : MatrixFactorization( ){
+
+    pivots        = 0;
+    pivotCapacity = 0;
+}
+
+
+LUFactorization::LUFactorization( const LUFactorization& rhs ) : MatrixFactorization( rhs ){
+
+    pivotCapacity = rhs.pivotCapacity;
+    pivots        = 0;
+
+    if( pivotCapacity > 0 ){
+        pivots = (uint*)calloc( pivotCapacity,sizeof(uint) );
+        memcpy( pivots, rhs.pivots, pivotCapacity*sizeof(uint) );
+    }
+}
+
+
+LUFactorization::~LUFactorization( ){
+
+    if( pivots != 0 )
+        free( pivots );
+}
+
+
+LUFactorization& LUFactorization::operator=( const LUFactorization& rhs ){
+
+    if( this != &rhs ){
+
+        MatrixFactorization::operator=( rhs );
+
+        if( pivots != 0 )
+            free( pivots );
+
+        pivotCapacity = rhs.pivotCapacity;
+        pivots        = 0;
+
+        if( pivotCapacity > 0 ){
+            pivots = (uint*)calloc( pivotCapacity,sizeof(uint) );
+            memcpy( pivots, rhs.pivots, pivotCapacity*sizeof(uint) );
+        }
+    }
+    return *this;
+}
+
+
+MatrixFactorization* LUFactorization::clone( ) const{
+
+    return new LUFactorization(*this);
+}
+
+
+returnValue LUFactorization::factorize( const Matrix& A ){
+
+    uint i, j, k, k0, p;
+
+    const uint nb = FACTORIZATION_BLOCK_SIZE;
+
+    if( setUpFactor( A, nb*A.getNumRows() ) != SUCCESSFUL_RETURN )
+        return RET_MATRIX_NOT_SQUARE;
+
+    const uint n = dim;
+    double    *a = factor;
+
+    if( n > pivotCapacity ){
+        if( pivots != 0 ) free( pivots );
+        pivots        = (uint*)calloc( n,sizeof(uint) );
+        pivotCapacity = n;
+    }
+
+    for( k0 = 0; k0 < n; k0 += nb ){
+
+        const uint k1 = ( k0+nb < n ) ? k0+nb : n;
+        const uint kb = k1-k0;
+
+        // FACTORIZE THE PANEL  A(k0:n,k0:k1):
+        // -----------------------------------
+        for( k = k0; k < k1; k++ ){
+
+            double maxAbs = fabs( a[k*n+k] );
+            p = k;
+
+            for( i = k+1; i < n; i++ ){
+                if( fabs( a[i*n+k] ) > maxAbs ){
+                    maxAbs = fabs( a[i*n+k] );
+                    p      = i;
+                }
+            }
+
+            if( maxAbs < EPS )
+                return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+
+            pivots[k] = p;
+
+            if( p != k ){
+                for( j = 0; j < n; j++ ){
+                    const double tmp = a[k*n+j];
+                    a[k*n+j] = a[p*n+j];
+                    a[p*n+j] = tmp;
+                }
+            }
+
+            for( i = k+1; i < n; i++ ){
+                const double l = ( a[i*n+k] /= a[k*n+k] );
+                for( j = k+1; j < k1; j++ )
+                    a[i*n+j] -= l*a[k*n+j];
+            }
+        }
+
+        if( k1 == n )
+            break;
+
+        const uint m2 = n-k1;
+
+        // COMPUTE THE BLOCK ROW  U(k0:k1,k1:n) := L(k0:k1,k0:k1)^{-1} A(k0:k1,k1:n):
+        // ---------------------------------------------------------------------------
+        for( k = k0; k < k1; k++ )
+            for( i = k+1; i < k1; i++ ){
+                const double l = a[i*n+k];
+                for( j = k1; j < n; j++ )
+                    a[i*n+j] -= l*a[k*n+j];
+            }
+
+        // UPDATE THE TRAILING MATRIX  A(k1:n,k1:n) -= L(k1:n,k0:k1) U(k0:k1,k1:n):
+        // ------------------------------------------------------------------------
+        for( i = 0; i < m2; i++ )
+            for( k = 0; k < kb; k++ )
+                work[i*kb+k] = -a[(k1+i)*n+k0+k];
+
+        acadoGemmStrided( m2,m2,kb, work,kb, a+k0*n+k1,n, a+k1*n+k1,n, BT_TRUE );
+    }
+
+    factorized = BT_TRUE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue LUFactorization::solveInPlace( double *B, uint nRhs, BooleanType transposed ) const{
+
+    int  i, k;
+    uint j;
+
+    const int     n = dim;
+    const uint    r = nRhs;
+    const double *a = factor;
+
+    if( transposed == BT_FALSE ){
+
+        // APPLY THE ROW INTERCHANGES:
+        for( k = 0; k < n; k++ ){
+            if( (int) pivots[k] != k ){
+                for( j = 0; j < r; j++ ){
+                    const double tmp = B[k*r+j];
+                    B[k*r+j] = B[pivots[k]*r+j];
+                    B[pivots[k]*r+j] = tmp;
+                }
+            }
+        }
+
+        // SOLVE  L*Y = B:
+        for( i = 1; i < n; i++ )
+            for( k = 0; k < i; k++ ){
+                const double l = a[i*n+k];
+                for( j = 0; j < r; j++ )
+                    B[i*r+j] -= l*B[k*r+j];
+            }
+
+        // SOLVE  U*X = Y:
+        for( i = n-1; i >= 0; i-- ){
+            for( k = i+1; k < n; k++ ){
+                const double u = a[i*n+k];
+                for( j = 0; j < r; j++ )
+                    B[i*r+j] -= u*B[k*r+j];
+            }
+            for( j = 0; j < r; j++ )
+                B[i*r+j] /= a[i*n+i];
+        }
+    }
+    else{
+
+        // SOLVE  U^T*Y = B:
+        for( i = 0; i < n; i++ ){
+            for( j = 0; j < r; j++ )
+                B[i*r+j] /= a[i*n+i];
+            for( k = i+1; k < n; k++ ){
+                const double u = a[i*n+k];
+                for( j = 0; j < r; j++ )
+                    B[k*r+j] -= u*B[i*r+j];
+            }
+        }
+
+        // SOLVE  L^T*Z = Y:
+        for( i = n-1; i > 0; i-- )
+            for( k = 0; k < i; k++ ){
+                const double l = a[i*n+k];
+                for( j = 0; j < r; j++ )
+                    B[k*r+j] -= l*B[i*r+j];
+            }
+
+        // UNDO THE ROW INTERCHANGES:
+        for( k = n-1; k >= 0; k-- ){
+            if( (int) pivots[k] != k ){
+                for( j = 0; j < r; j++ ){
+                    const double tmp = B[k*r+j];
+                    B[k*r+j] = B[pivots[k]*r+j];
+                    B[pivots[k]*r+j] = tmp;
+                }
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *   end of file
+ */
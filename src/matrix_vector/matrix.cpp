@@ -1125,35 +1125,10 @@ returnValue Matrix::computeSparseLUdecomposition(){
 
     solver = new ACADOcsparse();
 
-    int run1,run2;
-    double ZERO_TOL = 1.e-12;
-    const int n = getNumRows();
-
-    double *A    = new double[dim];
-    int    *idx1 = new int   [dim];
-    int    *idx2 = new int   [dim];
-
-    int nDense = 0;
-
-    for( run1 = 0; run1 < n; run1++ ){
-        for( run2 = 0; run2 < n; run2++ ){
-            if( fabs( operator()(run1,run2) ) > ZERO_TOL ){
-                A  [nDense]  = operator()(run1,run2);
-                idx1[nDense] = run1;
-                idx2[nDense] = run2;
-                nDense++;
-            }
-        }
-    }
-
-    solver->setDimension      ( n          );
-    solver->setNumberOfEntries( nDense     );
-    solver->setIndices        ( idx1, idx2 );
-    solver->setMatrix         ( A          );
-
-    delete[] A;
-    delete[] idx1;
-    delete[] idx2;
+    // entries below the tolerance are dropped, the remaining ones are
+    // passed to the solver by their row-wise compressed storage:
+    SparseMatrix A( *this, SSF_CSR, 1.e-12 );
+    A.setupSolver( *solver );
 
     return SUCCESSFUL_RETURN;
 }
@@ -0,0 +1,223 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/matrix_factorization.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+MatrixFactorization::MatrixFactorization( ){
+
+    dim        = 0;
+    factorized = BT_FALSE;
+    factor     = 0;
+    work       = 0;
+    capacity   = 0;
+    workSize   = 0;
+    memory     = 0;
+}
+
+
+MatrixFactorization::MatrixFactorization( const MatrixFactorization& rhs ){
+
+    dim        = 0;
+    factorized = BT_FALSE;
+    factor     = 0;
+    work       = 0;
+    capacity   = 0;
+    workSize   = 0;
+    memory     = 0;
+
+    operator=( rhs );
+}
+
+
+MatrixFactorization::~MatrixFactorization( ){
+
+    clear( );
+}
+
+
+MatrixFactorization& MatrixFactorization::operator=( const MatrixFactorization& rhs ){
+
+    if( this != &rhs ){
+
+        clear( );
+
+        if( rhs.memory != 0 ){
+
+            memory   = calloc( rhs.capacity*sizeof(double) + FACTORIZATION_ALIGNMENT, 1 );
+            factor   = (double*)( ( (size_t)memory + FACTORIZATION_ALIGNMENT-1 ) & ~( (size_t)FACTORIZATION_ALIGNMENT-1 ) );
+            capacity = rhs.capacity;
+            workSize = rhs.workSize;
+            work     = factor + ( rhs.work - rhs.factor );
+
+            memcpy( factor, rhs.factor, capacity*sizeof(double) );
+        }
+
+        dim        = rhs.dim;
+        factorized = rhs.factorized;
+    }
+    return *this;
+}
+
+
+returnValue MatrixFactorization::solve( Vector& b ) const{
+
+    if( b.getDim() != dim )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    return solve( b.getDoublePointer(), 1 );
+}
+
+
+returnValue MatrixFactorization::solve( Matrix& B ) const{
+
+    if( B.getNumRows() != dim )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    return solve( B.getDoublePointer(), B.getNumCols() );
+}
+
+
+returnValue MatrixFactorization::solve( double *B, uint nRhs ) const{
+
+    if( factorized == BT_FALSE )
+        return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    if( dim == 0 || nRhs == 0 )
+        return SUCCESSFUL_RETURN;
+
+    return solveInPlace( B, nRhs, BT_FALSE );
+}
+
+
+returnValue MatrixFactorization::solveTranspose( Vector& b ) const{
+
+    if( b.getDim() != dim )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    return solveTranspose( b.getDoublePointer(), 1 );
+}
+
+
+returnValue MatrixFactorization::solveTranspose( Matrix& B ) const{
+
+    if( B.getNumRows() != dim )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    return solveTranspose( B.getDoublePointer(), B.getNumCols() );
+}
+
+
+returnValue MatrixFactorization::solveTranspose( double *B, uint nRhs ) const{
+
+    if( factorized == BT_FALSE )
+        return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    if( dim == 0 || nRhs == 0 )
+        return SUCCESSFUL_RETURN;
+
+    return solveInPlace( B, nRhs, BT_TRUE );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue MatrixFactorization::setUpFactor( const Matrix& A, uint nWork ){
+
+    factorized = BT_FALSE;
+
+    if( A.getNumRows() != A.getNumCols() )
+        return ACADOERROR( RET_MATRIX_NOT_SQUARE );
+
+    const uint n = A.getNumRows();
+
+    // let the workspace start at an aligned address, too:
+    const uint step       = FACTORIZATION_ALIGNMENT / sizeof(double);
+    const uint factorSize = ( ( n*n + step-1 ) / step ) * step;
+
+    if( factorSize + nWork > capacity ){
+
+        clear( );
+
+        capacity = factorSize + nWork;
+        memory   = calloc( capacity*sizeof(double) + FACTORIZATION_ALIGNMENT, 1 );
+        factor   = (double*)( ( (size_t)memory + FACTORIZATION_ALIGNMENT-1 ) & ~( (size_t)FACTORIZATION_ALIGNMENT-1 ) );
+    }
+
+    dim      = n;
+    work     = factor + factorSize;
+    workSize = capacity - factorSize;
+
+    A.convert( factor );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+void MatrixFactorization::clear( ){
+
+    if( memory != 0 )
+        free( memory );
+
+    dim        = 0;
+    factorized = BT_FALSE;
+    factor     = 0;
+    work       = 0;
+    capacity   = 0;
+    workSize   = 0;
+    memory     = 0;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *   end of file
+ */
@@ -0,0 +1,604 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/matrix_kernels.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/matrix_vector/matrix_kernels.hpp>
+
+#include <string.h>
+
+
+#if defined(__AVX__)
+
+    #include <immintrin.h>
+
+    typedef __m256d KernelVector;
+
+    #define KV_WIDTH            4
+    #define KV_LOAD( p )        _mm256_loadu_pd( p )
+    #define KV_STORE( p, v )    _mm256_storeu_pd( p, v )
+    #define KV_SET( a )         _mm256_set1_pd( a )
+    #define KV_GATHER( p, s )   _mm256_set_pd( (p)[3*(s)], (p)[2*(s)], (p)[s], (p)[0] )
+    #define KV_GATHER_INDEXED( p, idx )  _mm256_set_pd( (p)[(idx)[3]], (p)[(idx)[2]], (p)[(idx)[1]], (p)[(idx)[0]] )
+    #define KV_MADD( c, a, b )  _mm256_add_pd( c, _mm256_mul_pd( a, b ) )
+
+#elif defined(__SSE2__)
+
+    #include <emmintrin.h>
+
+    typedef __m128d KernelVector;
+
+    #define KV_WIDTH            2
+    #define KV_LOAD( p )        _mm_loadu_pd( p )
+    #define KV_STORE( p, v )    _mm_storeu_pd( p, v )
+    #define KV_SET( a )         _mm_set1_pd( a )
+    #define KV_GATHER( p, s )   _mm_set_pd( (p)[s], (p)[0] )
+    #define KV_GATHER_INDEXED( p, idx )  _mm_set_pd( (p)[(idx)[1]], (p)[(idx)[0]] )
+    #define KV_MADD( c, a, b )  _mm_add_pd( c, _mm_mul_pd( a, b ) )
+
+#else
+
+    typedef double KernelVector;
+
+    #define KV_WIDTH            1
+    #define KV_LOAD( p )        (*(p))
+    #define KV_STORE( p, v )    (*(p) = (v))
+    #define KV_SET( a )         (a)
+    #define KV_GATHER( p, s )   (*(p))
+    #define KV_GATHER_INDEXED( p, idx )  ((p)[(idx)[0]])
+    #define KV_MADD( c, a, b )  ((c) + (a)*(b))
+
+#endif
+
+
+/** Number of rows of A and columns of B kept in the cache (the panel
+ *  of B has at most GEMM_KC x GEMM_NC entries). */
+#define GEMM_KC 128
+#define GEMM_NC 256
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/*
+ *  C += A*B for the rows [i0,i0+nr) and columns [j0,j1) of C using the
+ *  rows [k0,k1) of B. The entry (i,p) of A is stored at A[i*ars+p*acs],
+ *  such that A^T*B is computed by the same kernel; the rows of B and C
+ *  are ldb and ldc entries apart. FMA instructions are not used, as
+ *  they would change the rounding of the products.
+ */
+static void gemmBlock(	uint i0, uint nr, uint j0, uint j1, uint k0, uint k1,
+						const double *A, uint ars, uint acs,
+						const double *B, uint ldb, double *C, uint ldc
+						)
+{
+	uint i, j, p;
+
+	const uint W = KV_WIDTH;
+
+	// FOUR ROWS OF C AT ONCE:
+	// -----------------------
+	for( i = i0; i+4 <= i0+nr; i += 4 )
+	{
+		const double *a0 = A + (i  )*ars;
+		const double *a1 = A + (i+1)*ars;
+		const double *a2 = A + (i+2)*ars;
+		const double *a3 = A + (i+3)*ars;
+
+		double *c0 = C + (i  )*ldc;
+		double *c1 = C + (i+1)*ldc;
+		double *c2 = C + (i+2)*ldc;
+		double *c3 = C + (i+3)*ldc;
+
+		for( j = j0; j+2*W <= j1; j += 2*W )
+		{
+			KernelVector c00 = KV_LOAD( c0+j ), c01 = KV_LOAD( c0+j+W );
+			KernelVector c10 = KV_LOAD( c1+j ), c11 = KV_LOAD( c1+j+W );
+			KernelVector c20 = KV_LOAD( c2+j ), c21 = KV_LOAD( c2+j+W );
+			KernelVector c30 = KV_LOAD( c3+j ), c31 = KV_LOAD( c3+j+W );
+
+			for( p = k0; p < k1; ++p )
+			{
+				const KernelVector b0 = KV_LOAD( B + p*ldb + j     );
+				const KernelVector b1 = KV_LOAD( B + p*ldb + j + W );
+
+				KernelVector a;
+				a = KV_SET( a0[p*acs] ); c00 = KV_MADD( c00, a, b0 ); c01 = KV_MADD( c01, a, b1 );
+				a = KV_SET( a1[p*acs] ); c10 = KV_MADD( c10, a, b0 ); c11 = KV_MADD( c11, a, b1 );
+				a = KV_SET( a2[p*acs] ); c20 = KV_MADD( c20, a, b0 ); c21 = KV_MADD( c21, a, b1 );
+				a = KV_SET( a3[p*acs] ); c30 = KV_MADD( c30, a, b0 ); c31 = KV_MADD( c31, a, b1 );
+			}
+
+			KV_STORE( c0+j, c00 ); KV_STORE( c0+j+W, c01 );
+			KV_STORE( c1+j, c10 ); KV_STORE( c1+j+W, c11 );
+			KV_STORE( c2+j, c20 ); KV_STORE( c2+j+W, c21 );
+			KV_STORE( c3+j, c30 ); KV_STORE( c3+j+W, c31 );
+		}
+
+		for( ; j < j1; ++j )
+		{
+			double s0 = c0[j], s1 = c1[j], s2 = c2[j], s3 = c3[j];
+
+			for( p = k0; p < k1; ++p )
+			{
+				const double b = B[p*ldb + j];
+				s0 += a0[p*acs] * b;
+				s1 += a1[p*acs] * b;
+				s2 += a2[p*acs] * b;
+				s3 += a3[p*acs] * b;
+			}
+
+			c0[j] = s0; c1[j] = s1; c2[j] = s2; c3[j] = s3;
+		}
+	}
+
+	// REMAINING ROWS:
+	// ---------------
+	for( ; i < i0+nr; ++i )
+	{
+		const double *a0 = A + i*ars;
+		double       *c0 = C + i*ldc;
+
+		for( j = j0; j+2*W <= j1; j += 2*W )
+		{
+			KernelVector c00 = KV_LOAD( c0+j ), c01 = KV_LOAD( c0+j+W );
+
+			for( p = k0; p < k1; ++p )
+			{
+				const KernelVector a = KV_SET( a0[p*acs] );
+				c00 = KV_MADD( c00, a, KV_LOAD( B + p*ldb + j     ) );
+				c01 = KV_MADD( c01, a, KV_LOAD( B + p*ldb + j + W ) );
+			}
+
+			KV_STORE( c0+j, c00 ); KV_STORE( c0+j+W, c01 );
+		}
+
+		for( ; j < j1; ++j )
+		{
+			double s0 = c0[j];
+
+			for( p = k0; p < k1; ++p )
+				s0 += a0[p*acs] * B[p*ldb + j];
+
+			c0[j] = s0;
+		}
+	}
+}
+
+
+/*
+ *  C (+)= op(A)*B, tiled such that a panel of B stays in the cache
+ *  while all rows of C are updated.
+ */
+static void gemm(	uint m, uint n, uint k,
+					const double *A, uint ars, uint acs,
+					const double *B, uint ldb, double *C, uint ldc,
+					BooleanType addToC
+					)
+{
+	uint i, j0, k0;
+
+	if ( addToC == BT_FALSE && n > 0 )
+	{
+		if ( ldc == n )
+			memset( C, 0, m*n*sizeof(double) );
+		else
+			for( i=0; i<m; ++i )
+				memset( C + i*ldc, 0, n*sizeof(double) );
+	}
+
+	for( k0 = 0; k0 < k; k0 += GEMM_KC )
+	{
+		const uint k1 = ( k0+GEMM_KC < k ) ? k0+GEMM_KC : k;
+
+		for( j0 = 0; j0 < n; j0 += GEMM_NC )
+		{
+			const uint j1 = ( j0+GEMM_NC < n ) ? j0+GEMM_NC : n;
+
+			gemmBlock( 0,m, j0,j1, k0,k1, A,ars,acs, B,ldb,C,ldc );
+		}
+	}
+}
+
+
+
+void acadoGemm(	uint m, uint n, uint k,
+				const double *A, const double *B, double *C,
+				BooleanType addToC
+				)
+{
+	gemm( m,n,k, A,k,1, B,n,C,n, addToC );
+}
+
+
+void acadoGemmTN(	uint m, uint n, uint k,
+					const double *A, const double *B, double *C,
+					BooleanType addToC
+					)
+{
+	gemm( m,n,k, A,1,m, B,n,C,n, addToC );
+}
+
+
+void acadoGemmStrided(	uint m, uint n, uint k,
+						const double *A, uint lda,
+						const double *B, uint ldb,
+						double *C, uint ldc,
+						BooleanType addToC
+						)
+{
+	gemm( m,n,k, A,lda,1, B,ldb,C,ldc, addToC );
+}
+
+
+void acadoGemv(	uint m, uint n,
+				const double *A, const double *x, double *y,
+				BooleanType addToY
+				)
+{
+	uint i, j;
+
+	const uint W = KV_WIDTH;
+
+	// every entry of y is a dot product; to keep the order of the
+	// summation, the rows (not the columns) are processed in parallel:
+	for( i = 0; i+2*W <= m; i += 2*W )
+	{
+		KernelVector y0 = KV_SET( 0.0 ), y1 = KV_SET( 0.0 );
+
+		if ( addToY == BT_TRUE )
+		{
+			y0 = KV_LOAD( y+i );
+			y1 = KV_LOAD( y+i+W );
+		}
+
+		for( j = 0; j < n; ++j )
+		{
+			const KernelVector xj = KV_SET( x[j] );
+			y0 = KV_MADD( y0, KV_GATHER( A + (i  )*n + j, n ), xj );
+			y1 = KV_MADD( y1, KV_GATHER( A + (i+W)*n + j, n ), xj );
+		}
+
+		KV_STORE( y+i, y0 );
+		KV_STORE( y+i+W, y1 );
+	}
+
+	for( ; i < m; ++i )
+	{
+		double s = 0.0;
+
+		if ( addToY == BT_TRUE )
+			s = y[i];
+
+		for( j = 0; j < n; ++j )
+			s += A[i*n + j] * x[j];
+
+		y[i] = s;
+	}
+}
+
+
+void acadoGemvT(	uint m, uint n,
+					const double *A, const double *x, double *y,
+					BooleanType addToY
+					)
+{
+	uint i, j;
+
+	const uint W = KV_WIDTH;
+
+	if ( addToY == BT_FALSE && n > 0 )
+		memset( y, 0, n*sizeof(double) );
+
+	// y is updated by the rows of A, four rows at once:
+	for( i = 0; i+4 <= m; i += 4 )
+	{
+		const double *a0 = A + (i  )*n;
+		const double *a1 = A + (i+1)*n;
+		const double *a2 = A + (i+2)*n;
+		const double *a3 = A + (i+3)*n;
+
+		const KernelVector x0 = KV_SET( x[i  ] );
+		const KernelVector x1 = KV_SET( x[i+1] );
+		const KernelVector x2 = KV_SET( x[i+2] );
+		const KernelVector x3 = KV_SET( x[i+3] );
+
+		for( j = 0; j+W <= n; j += W )
+		{
+			KernelVector s = KV_LOAD( y+j );
+			s = KV_MADD( s, KV_LOAD( a0+j ), x0 );
+			s = KV_MADD( s, KV_LOAD( a1+j ), x1 );
+			s = KV_MADD( s, KV_LOAD( a2+j ), x2 );
+			s = KV_MADD( s, KV_LOAD( a3+j ), x3 );
+			KV_STORE( y+j, s );
+		}
+
+		for( ; j < n; ++j )
+			y[j] = (((y[j] + a0[j]*x[i]) + a1[j]*x[i+1]) + a2[j]*x[i+2]) + a3[j]*x[i+3];
+	}
+
+	for( ; i < m; ++i )
+	{
+		const double       *a0 = A + i*n;
+		const KernelVector  x0 = KV_SET( x[i] );
+
+		for( j = 0; j+W <= n; j += W )
+			KV_STORE( y+j, KV_MADD( KV_LOAD( y+j ), KV_LOAD( a0+j ), x0 ) );
+
+		for( ; j < n; ++j )
+			y[j] += a0[j]*x[i];
+	}
+}
+
+
+void acadoCsrGemv(	uint m,
+					const int *start, const int *index, const double *value,
+					const double *x, double *y,
+					BooleanType addToY
+					)
+{
+	uint i, k;
+	int  p;
+
+	const uint W = KV_WIDTH;
+	double     partial[KV_WIDTH];
+
+	// each row is a sparse dot product; the entries of x are gathered
+	// by their column indices:
+	for( i = 0; i < m; ++i )
+	{
+		const int end = start[i+1];
+		double    s   = 0.0;
+
+		p = start[i];
+
+		if ( end-p >= (int)W )
+		{
+			KernelVector acc = KV_SET( 0.0 );
+
+			for( ; p+(int)W <= end; p += W )
+				acc = KV_MADD( acc, KV_LOAD( value+p ), KV_GATHER_INDEXED( x, index+p ) );
+
+			KV_STORE( partial, acc );
+			for( k = 0; k < W; ++k )
+				s += partial[k];
+		}
+
+		for( ; p < end; ++p )
+			s += value[p]*x[index[p]];
+
+		if ( addToY == BT_TRUE )
+			y[i] += s;
+		else
+			y[i] = s;
+	}
+}
+
+
+void acadoCsrGemvT(	uint m, uint n,
+					const int *start, const int *index, const double *value,
+					const double *x, double *y,
+					BooleanType addToY
+					)
+{
+	uint i;
+	int  p;
+
+	if ( addToY == BT_FALSE && n > 0 )
+		memset( y, 0, n*sizeof(double) );
+
+	// y is updated by the rows of A (scattered by the column indices):
+	for( i = 0; i < m; ++i )
+	{
+		const double xi = x[i];
+
+		for( p = start[i]; p < start[i+1]; ++p )
+			y[index[p]] += value[p]*xi;
+	}
+}
+
+
+void acadoCsrGemm(	uint m, uint n,
+					const int *start, const int *index, const double *value,
+					const double *B, double *C,
+					BooleanType addToC
+					)
+{
+	uint i, j;
+	int  p;
+
+	const uint W = KV_WIDTH;
+
+	// row i of C is the combination of the rows of B selected by the
+	// non-zeros of row i of A; 2*W columns of C are kept in registers:
+	for( i = 0; i < m; ++i )
+	{
+		double *c = C + i*n;
+
+		if ( addToC == BT_FALSE && n > 0 )
+			memset( c, 0, n*sizeof(double) );
+
+		for( j = 0; j+2*W <= n; j += 2*W )
+		{
+			KernelVector c0 = KV_LOAD( c+j ), c1 = KV_LOAD( c+j+W );
+
+			for( p = start[i]; p < start[i+1]; ++p )
+			{
+				const KernelVector  a = KV_SET( value[p] );
+				const double       *b = B + index[p]*n + j;
+
+				c0 = KV_MADD( c0, a, KV_LOAD( b     ) );
+				c1 = KV_MADD( c1, a, KV_LOAD( b + W ) );
+			}
+
+			KV_STORE( c+j, c0 ); KV_STORE( c+j+W, c1 );
+		}
+
+		for( ; j < n; ++j )
+		{
+			double s = c[j];
+
+			for( p = start[i]; p < start[i+1]; ++p )
+				s += value[p]*B[index[p]*n + j];
+
+			c[j] = s;
+		}
+	}
+}
+
+
+void acadoSyrkPacked(	uint n, uint k,
+						const double *A, double *P,
+						BooleanType addToP
+						)
+{
+	uint i, j, p;
+
+	const uint W = KV_WIDTH;
+
+	if ( addToP == BT_FALSE && n > 0 )
+		memset( P, 0, (n*(n+1)/2)*sizeof(double) );
+
+	// one rank-one update per row a of A; row i of the packed lower
+	// triangle is updated by a[i]*a[0..i]:
+	for( p = 0; p < k; ++p )
+	{
+		const double *a = A + p*n;
+
+		for( i = 0; i < n; ++i )
+		{
+			double             *row = P + i*(i+1)/2;
+			const KernelVector  ai  = KV_SET( a[i] );
+
+			for( j = 0; j+W <= i+1; j += W )
+				KV_STORE( row+j, KV_MADD( KV_LOAD( row+j ), ai, KV_LOAD( a+j ) ) );
+
+			for( ; j <= i; ++j )
+				row[j] += a[i]*a[j];
+		}
+	}
+}
+
+
+void acadoSpmv(	uint n,
+				const double *P, const double *x, double *y,
+				BooleanType addToY
+				)
+{
+	uint i, j, l;
+
+	const uint W = KV_WIDTH;
+	double     partial[KV_WIDTH];
+
+	if ( addToY == BT_FALSE && n > 0 )
+		memset( y, 0, n*sizeof(double) );
+
+	// row i of the lower triangle contributes a dot product to y[i] and,
+	// as column i of the upper triangle, an update of y[0..i-1]:
+	for( i = 0; i < n; ++i )
+	{
+		const double       *row = P + i*(i+1)/2;
+		const KernelVector  xi  = KV_SET( x[i] );
+
+		KernelVector acc = KV_SET( 0.0 );
+		double       s   = 0.0;
+
+		for( j = 0; j+W <= i; j += W )
+		{
+			const KernelVector r = KV_LOAD( row+j );
+
+			acc = KV_MADD( acc, r, KV_LOAD( x+j ) );
+			KV_STORE( y+j, KV_MADD( KV_LOAD( y+j ), r, xi ) );
+		}
+
+		KV_STORE( partial, acc );
+		for( l = 0; l < W; ++l )
+			s += partial[l];
+
+		for( ; j < i; ++j )
+		{
+			s    += row[j]*x[j];
+			y[j] += row[j]*x[i];
+		}
+
+		y[i] += s + row[i]*x[i];
+	}
+}
+
+
+void acadoSpmm(	uint n, uint m,
+				const double *P, const double *B, double *C,
+				BooleanType addToC
+				)
+{
+	uint i, j, l;
+
+	const uint W = KV_WIDTH;
+
+	if ( addToC == BT_FALSE && n*m > 0 )
+		memset( C, 0, n*m*sizeof(double) );
+
+	// every off-diagonal entry P(i,j) updates the rows i and j of C:
+	for( i = 0; i < n; ++i )
+	{
+		const double *row = P + i*(i+1)/2;
+		const double *bi  = B + i*m;
+		double       *ci  = C + i*m;
+
+		for( j = 0; j <= i; ++j )
+		{
+			const double       *bj = B + j*m;
+			double             *cj = C + j*m;
+			const KernelVector  p  = KV_SET( row[j] );
+
+			for( l = 0; l+W <= m; l += W )
+				KV_STORE( ci+l, KV_MADD( KV_LOAD( ci+l ), p, KV_LOAD( bj+l ) ) );
+			for( ; l < m; ++l )
+				ci[l] += row[j]*bj[l];
+
+			if ( j == i )
+				continue;
+
+			for( l = 0; l+W <= m; l += W )
+				KV_STORE( cj+l, KV_MADD( KV_LOAD( cj+l ), p, KV_LOAD( bi+l ) ) );
+			for( ; l < m; ++l )
+				cj[l] += row[j]*bi[l];
+		}
+	}
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
@@ -0,0 +1,214 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/qr_factorization.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+QRFactorization::QRFactorization( ) : MatrixFactorization( ){
+
+}
+
+
+QRFactorization::QRFactorization( const QRFactorization& rhs ) : MatrixFactorization( rhs ){
+
+}
+
+
+QRFactorization::~QRFactorization( ){
+
+}
+
+
+QRFactorization& QRFactorization::operator=( const QRFactorization& rhs ){
+
+    if( this != &rhs )
+        MatrixFactorization::operator=( rhs );
+
+    return *this;
+}
+
+
+MatrixFactorization* QRFactorization::clone( ) const{
+
+    return new QRFactorization(*this);
+}
+
+
+returnValue QRFactorization::factorize( const Matrix& A ){
+
+    int run1, run2, run3;
+
+    // the workspace holds the diagonal of R, the squared norms of the
+    // Householder vectors and the products of the reflectors with A:
+    if( setUpFactor( A, 3*A.getNumRows() ) != SUCCESSFUL_RETURN )
+        return RET_MATRIX_NOT_SQUARE;
+
+    const int n  = dim;
+    double   *a  = factor;
+    double   *d  = work;
+    double   *vv = work +   n;
+    double   *w  = work + 2*n;
+
+    double r, h_s, kappa, v;
+
+    for( run2 = 0; run2 < n; run2++ ){
+
+        r = 0.0;
+        for( run1 = run2; run1 < n; run1++ )
+            r = r + a[run1*n+run2] * a[run1*n+run2];
+
+        if( r < EPS )
+            return RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR;
+
+        if( a[run2*n+run2] < 0.0 ) h_s =  sqrt(r);
+        else                       h_s = -sqrt(r);
+
+        d[run2]  = h_s;
+        kappa    = 1.0/( h_s * a[run2*n+run2] - r );
+        a[run2*n+run2] -= h_s;
+
+        // APPLY THE REFLECTION ROW BY ROW TO THE TRAILING COLUMNS:
+        // ---------------------------------------------------------
+        for( run3 = run2+1; run3 < n; run3++ )
+            w[run3] = 0.0;
+
+        for( run1 = run2; run1 < n; run1++ ){
+            v = a[run1*n+run2];
+            for( run3 = run2+1; run3 < n; run3++ )
+                w[run3] += v * a[run1*n+run3];
+        }
+
+        for( run3 = run2+1; run3 < n; run3++ )
+            w[run3] = kappa * w[run3];
+
+        for( run1 = run2; run1 < n; run1++ ){
+            v = a[run1*n+run2];
+            for( run3 = run2+1; run3 < n; run3++ )
+                a[run1*n+run3] = a[run1*n+run3] + v * w[run3];
+        }
+    }
+
+    for( run1 = 0; run1 < n; run1++ ){
+        vv[run1] = 0.0;
+        for( run2 = run1; run2 < n; run2++ )
+            vv[run1] = vv[run1] + a[run2*n+run1]*a[run2*n+run1];
+    }
+
+    factorized = BT_TRUE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+returnValue QRFactorization::solveInPlace( double *B, uint nRhs, BooleanType transposed ) const{
+
+    int  run1, run2;
+    uint col;
+
+    const int     n  = dim;
+    const int     r  = nRhs;
+    const double *a  = factor;
+    const double *d  = work;
+    const double *vv = work + n;
+
+    double dotp, cc;
+
+    for( col = 0; col < nRhs; col++ ){
+
+        double *x = B + col;
+
+        if( transposed == BT_FALSE ){
+
+            // APPLY Q^T:
+            for( run1 = 0; run1 < n; run1++ ){
+                dotp = 0.0;
+                for( run2 = run1; run2 < n; run2++ )
+                    dotp = dotp + a[run2*n+run1]*x[run2*r];
+                cc = 2.0*dotp/vv[run1];
+                for( run2 = run1; run2 < n; run2++ )
+                    x[run2*r] -= cc*a[run2*n+run1];
+            }
+
+            // SOLVE  R*X = Q^T*B:
+            for( run1 = n-1; run1 >= 0; run1-- ){
+                for( run2 = run1+1; run2 < n; run2++ )
+                    x[run1*r] -= a[run1*n+run2]*x[run2*r];
+                x[run1*r] /= d[run1];
+            }
+        }
+        else{
+
+            // SOLVE  R^T*Y = B:
+            for( run1 = 0; run1 < n; run1++ ){
+                for( run2 = 0; run2 < run1; run2++ )
+                    x[run1*r] -= a[run2*n+run1]*x[run2*r];
+                x[run1*r] /= d[run1];
+            }
+
+            // APPLY Q:
+            for( run1 = n-1; run1 >= 0; run1-- ){
+                dotp = 0.0;
+                for( run2 = run1; run2 < n; run2++ )
+                    dotp = dotp + a[run2*n+run1]*x[run2*r];
+                cc = 2.0*dotp/vv[run1];
+                for( run2 = run1; run2 < n; run2++ )
+                    x[run2*r] -= cc*a[run2*n+run1];
+            }
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *   end of file
+ */
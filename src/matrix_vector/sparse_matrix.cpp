@@ -0,0 +1,582 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/sparse_matrix.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+#include <acado/sparse_solver/sparse_solver.hpp>
+#include <acado/function/sparsity_pattern.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SparseMatrix::SparseMatrix( ){
+
+    start      = 0;
+    index      = 0;
+    majorIndex = 0;
+    value      = 0;
+
+    allocate( 0, 0, 0, SSF_CSR );
+}
+
+
+SparseMatrix::SparseMatrix( uint _nRows, uint _nCols, SparseStorageFormat _format ){
+
+    start      = 0;
+    index      = 0;
+    majorIndex = 0;
+    value      = 0;
+
+    allocate( _nRows, _nCols, 0, _format );
+}
+
+
+SparseMatrix::SparseMatrix( const Matrix& A, SparseStorageFormat _format, double tol ){
+
+    uint run1, run2;
+    uint counter = 0;
+
+    start      = 0;
+    index      = 0;
+    majorIndex = 0;
+    value      = 0;
+
+    const uint nR = A.getNumRows();
+    const uint nC = A.getNumCols();
+
+    // COUNT THE NON-ZEROS:
+    // --------------------
+    for( run1 = 0; run1 < nR; run1++ )
+        for( run2 = 0; run2 < nC; run2++ )
+            if( fabs( A(run1,run2) ) > tol )
+                counter++;
+
+    allocate( nR, nC, counter, _format );
+
+    // STORE THE NON-ZEROS ROW- OR COLUMN-WISE:
+    // ----------------------------------------
+    counter = 0;
+
+    if( format == SSF_CSR ){
+
+        for( run1 = 0; run1 < nR; run1++ ){
+            for( run2 = 0; run2 < nC; run2++ ){
+                if( fabs( A(run1,run2) ) > tol ){
+                    index[counter] = run2;
+                    value[counter] = A(run1,run2);
+                    counter++;
+                }
+            }
+            start[run1+1] = counter;
+        }
+    }
+    else{
+
+        for( run2 = 0; run2 < nC; run2++ ){
+            for( run1 = 0; run1 < nR; run1++ ){
+                if( fabs( A(run1,run2) ) > tol ){
+                    index[counter] = run1;
+                    value[counter] = A(run1,run2);
+                    counter++;
+                }
+            }
+            start[run2+1] = counter;
+        }
+    }
+
+    setupMajorIndex();
+}
+
+
+SparseMatrix::SparseMatrix( const BlockMatrix& A, SparseStorageFormat _format, double tol ){
+
+    uint run1, run2, run3, run4;
+    uint pass, counter;
+
+    start      = 0;
+    index      = 0;
+    majorIndex = 0;
+    value      = 0;
+
+    const uint nBR = A.getNumRows();
+    const uint nBC = A.getNumCols();
+
+    // DETERMINE THE DIMENSIONS OF THE BLOCK ROWS AND COLUMNS:
+    // -------------------------------------------------------
+    uint *rowOffset = (uint*)calloc(nBR+1,sizeof(uint));
+    uint *colOffset = (uint*)calloc(nBC+1,sizeof(uint));
+
+    for( run1 = 0; run1 < nBR; run1++ ){
+        for( run2 = 0; run2 < nBC; run2++ ){
+
+            if( A.getNumRows( run1,run2 ) > rowOffset[run1+1] )
+                rowOffset[run1+1] = A.getNumRows( run1,run2 );
+
+            if( A.getNumCols( run1,run2 ) > colOffset[run2+1] )
+                colOffset[run2+1] = A.getNumCols( run1,run2 );
+        }
+    }
+
+    for( run1 = 0; run1 < nBR; run1++ ) rowOffset[run1+1] += rowOffset[run1];
+    for( run2 = 0; run2 < nBC; run2++ ) colOffset[run2+1] += colOffset[run2];
+
+
+    // SET UP THE CSR STORAGE (COUNTING THE ENTRIES IN THE FIRST PASS):
+    // ----------------------------------------------------------------
+    SparseMatrix tmp;
+
+    for( pass = 0; pass < 2; pass++ ){
+
+        counter = 0;
+
+        for( run1 = 0; run1 < nBR; run1++ ){
+            for( run3 = 0; run3 < rowOffset[run1+1]-rowOffset[run1]; run3++ ){
+                for( run2 = 0; run2 < nBC; run2++ ){
+
+                    const Matrix &block = A.getBlock( run1,run2 );
+
+                    switch( A.getType( run1,run2 ) ){
+
+                        case SBMT_ONE:
+                            if( run3 < block.getNumCols() ){
+                                if( pass == 1 ){
+                                    tmp.index[counter] = colOffset[run2]+run3;
+                                    tmp.value[counter] = 1.0;
+                                }
+                                counter++;
+                            }
+                            break;
+
+                        case SBMT_DENSE:
+                            ASSERT( block.getNumRows() == rowOffset[run1+1]-rowOffset[run1] );
+                            for( run4 = 0; run4 < block.getNumCols(); run4++ ){
+                                if( fabs( block(run3,run4) ) > tol ){
+                                    if( pass == 1 ){
+                                        tmp.index[counter] = colOffset[run2]+run4;
+                                        tmp.value[counter] = block(run3,run4);
+                                    }
+                                    counter++;
+                                }
+                            }
+                            break;
+
+                        default:
+                            break;
+                    }
+                }
+                if( pass == 1 )
+                    tmp.start[rowOffset[run1]+run3+1] = counter;
+            }
+        }
+
+        if( pass == 0 ){
+            tmp.deleteAll();
+            tmp.allocate( rowOffset[nBR], colOffset[nBC], counter, SSF_CSR );
+        }
+    }
+    tmp.setupMajorIndex();
+
+    free( rowOffset );
+    free( colOffset );
+
+    copy( tmp.convert( _format ) );
+}
+
+
+SparseMatrix::SparseMatrix( const SparsityPattern& pattern, SparseStorageFormat _format ){
+
+    start      = 0;
+    index      = 0;
+    majorIndex = 0;
+    value      = 0;
+
+    allocate( 0, 0, 0, _format );
+
+    if( _format == SSF_CSR ){
+        init( pattern.getNumRows(), pattern.getNumCols(), SSF_CSR,
+              pattern.getRowStart(), pattern.getColIndex() );
+    }
+    else{
+        SparsityPattern transposed = pattern.getTranspose();
+        init( pattern.getNumRows(), pattern.getNumCols(), SSF_CSC,
+              transposed.getRowStart(), transposed.getColIndex() );
+    }
+}
+
+
+SparseMatrix::SparseMatrix( const SparseMatrix& rhs ){
+
+    copy( rhs );
+}
+
+
+SparseMatrix::~SparseMatrix( ){
+
+    deleteAll();
+}
+
+
+SparseMatrix& SparseMatrix::operator=( const SparseMatrix& rhs ){
+
+    if( this != &rhs ){
+
+        deleteAll();
+        copy( rhs );
+    }
+    return *this;
+}
+
+
+returnValue SparseMatrix::init( uint _nRows, uint _nCols, SparseStorageFormat _format,
+                                const int *_start, const int *_index, const double *_value ){
+
+    uint run1;
+
+    const uint nMajor = ( _format == SSF_CSR ) ? _nRows : _nCols;
+    const uint nMinor = ( _format == SSF_CSR ) ? _nCols : _nRows;
+
+    // CONSISTENCY CHECKS:
+    // -------------------
+    if( _start[0] != 0 )
+        return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+    for( run1 = 0; run1 < nMajor; run1++ )
+        if( _start[run1+1] < _start[run1] )
+            return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+    for( run1 = 0; run1 < (uint)_start[nMajor]; run1++ )
+        if( _index[run1] < 0 || (uint)_index[run1] >= nMinor )
+            return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+    deleteAll();
+    allocate( _nRows, _nCols, _start[nMajor], _format );
+
+    memcpy( start, _start, (nMajor+1)*sizeof(int) );
+    memcpy( index, _index, nnz*sizeof(int) );
+
+    if( _value != 0 )
+        memcpy( value, _value, nnz*sizeof(double) );
+
+    setupMajorIndex();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseMatrix::setValues( const Matrix& A ){
+
+    uint run1;
+
+    if( A.getNumRows() != nRows || A.getNumCols() != nCols )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    if( format == SSF_CSR ){
+        for( run1 = 0; run1 < nnz; run1++ )
+            value[run1] = A( majorIndex[run1],index[run1] );
+    }
+    else{
+        for( run1 = 0; run1 < nnz; run1++ )
+            value[run1] = A( index[run1],majorIndex[run1] );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseMatrix::setValues( const double *_value ){
+
+    if( nnz > 0 )
+        memcpy( value, _value, nnz*sizeof(double) );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+SparseMatrix SparseMatrix::convert( SparseStorageFormat _format ) const{
+
+    uint run1;
+    int  run2;
+
+    if( _format == format )
+        return *this;
+
+    // the compressed storage of the other format is obtained by a
+    // counting sort of the entries by their (minor) index:
+    const uint nMajor = getNumMajor();
+    const uint nMinor = ( format == SSF_CSR ) ? nCols : nRows;
+
+    SparseMatrix result( nRows, nCols, _format );
+
+    result.deleteAll();
+    result.allocate( nRows, nCols, nnz, _format );
+
+    for( run1 = 0; run1 < nnz; run1++ )
+        result.start[index[run1]+1]++;
+
+    for( run1 = 0; run1 < nMinor; run1++ )
+        result.start[run1+1] += result.start[run1];
+
+    int *position = (int*)calloc(nMinor+1,sizeof(int));
+    memcpy( position, result.start, (nMinor+1)*sizeof(int) );
+
+    for( run1 = 0; run1 < nMajor; run1++ ){
+        for( run2 = start[run1]; run2 < start[run1+1]; run2++ ){
+
+            const int q = position[index[run2]]++;
+
+            result.index[q] = run1;
+            result.value[q] = value[run2];
+        }
+    }
+
+    free( position );
+
+    result.setupMajorIndex();
+
+    return result;
+}
+
+
+SparseMatrix SparseMatrix::transpose( ) const{
+
+    // the arrays of a CSR matrix are the arrays of its transpose in CSC
+    // format (and vice versa):
+    SparseMatrix tmp;
+
+    tmp.init( nCols, nRows, ( format == SSF_CSR ) ? SSF_CSC : SSF_CSR, start, index, value );
+
+    return tmp.convert( format );
+}
+
+
+Matrix SparseMatrix::getDense( ) const{
+
+    uint run1;
+
+    Matrix result( nRows, nCols );
+    result.setZero();
+
+    for( run1 = 0; run1 < nnz; run1++ ){
+
+        if( format == SSF_CSR ) result( majorIndex[run1],index[run1] ) = value[run1];
+        else                    result( index[run1],majorIndex[run1] ) = value[run1];
+    }
+
+    return result;
+}
+
+
+returnValue SparseMatrix::multiply( const double *x, double *y, BooleanType addToY ) const{
+
+    if( format == SSF_CSR ) acadoCsrGemv ( nRows,        start, index, value, x, y, addToY );
+    else                    acadoCsrGemvT( nCols, nRows, start, index, value, x, y, addToY );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SparseMatrix::multiplyTranspose( const double *x, double *y, BooleanType addToY ) const{
+
+    if( format == SSF_CSR ) acadoCsrGemvT( nRows, nCols, start, index, value, x, y, addToY );
+    else                    acadoCsrGemv ( nCols,        start, index, value, x, y, addToY );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Vector SparseMatrix::operator*( const Vector& x ) const{
+
+    ASSERT( x.getDim() == nCols );
+
+    Vector result( nRows );
+    multiply( x.getDoublePointer(), result.getDoublePointer() );
+
+    return result;
+}
+
+
+Vector SparseMatrix::operator^( const Vector& x ) const{
+
+    ASSERT( x.getDim() == nRows );
+
+    Vector result( nCols );
+    multiplyTranspose( x.getDoublePointer(), result.getDoublePointer() );
+
+    return result;
+}
+
+
+Matrix SparseMatrix::operator*( const Matrix& B ) const{
+
+    uint run1, run3;
+    int  run2;
+
+    ASSERT( B.getNumRows() == nCols );
+
+    const uint n = B.getNumCols();
+
+    Matrix result( nRows, n );
+
+    if( format == SSF_CSR ){
+        acadoCsrGemm( nRows, n, start, index, value, B.getDoublePointer(), result.getDoublePointer() );
+    }
+    else{
+        // scatter the rows of B weighted by the columns of A:
+        const double *b = B.getDoublePointer();
+        double       *c = result.getDoublePointer();
+
+        result.setZero();
+
+        for( run1 = 0; run1 < nCols; run1++ )
+            for( run2 = start[run1]; run2 < start[run1+1]; run2++ )
+                for( run3 = 0; run3 < n; run3++ )
+                    c[index[run2]*n+run3] += value[run2]*b[run1*n+run3];
+    }
+
+    return result;
+}
+
+
+returnValue SparseMatrix::setupSolver( SparseSolver& solver ) const{
+
+    returnValue returnvalue;
+
+    if( nRows != nCols )
+        return ACADOERROR( RET_MATRIX_NOT_SQUARE );
+
+    solver.setDimension      ( (int)nRows );
+    solver.setNumberOfEntries( (int)nnz   );
+
+    if( format == SSF_CSR ) returnvalue = solver.setIndices( majorIndex, index );
+    else                    returnvalue = solver.setIndices( index, majorIndex );
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return returnvalue;
+
+    return solver.setMatrix( value );
+}
+
+
+returnValue SparseMatrix::updateSolver( SparseSolver& solver ) const{
+
+    return solver.setMatrix( value );
+}
+
+
+returnValue SparseMatrix::print( ) const{
+
+    uint run1;
+
+    acadoPrintf( "Sparse matrix (%d x %d, %d non-zeros):\n", nRows, nCols, nnz );
+
+    for( run1 = 0; run1 < nnz; run1++ ){
+
+        if( format == SSF_CSR ) acadoPrintf( "(%d,%d)\t% .16e\n", majorIndex[run1], index[run1], value[run1] );
+        else                    acadoPrintf( "(%d,%d)\t% .16e\n", index[run1], majorIndex[run1], value[run1] );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void SparseMatrix::allocate( uint _nRows, uint _nCols, uint _nnz, SparseStorageFormat _format ){
+
+    nRows  = _nRows;
+    nCols  = _nCols;
+    nnz    = _nnz;
+    format = _format;
+
+    start      = (int*)   calloc(getNumMajor()+1,sizeof(int)   );
+    index      = (int*)   calloc(nnz+1          ,sizeof(int)   );
+    majorIndex = (int*)   calloc(nnz+1          ,sizeof(int)   );
+    value      = (double*)calloc(nnz+1          ,sizeof(double));
+}
+
+
+void SparseMatrix::deleteAll( ){
+
+    if( start      != 0 ) free( start      );
+    if( index      != 0 ) free( index      );
+    if( majorIndex != 0 ) free( majorIndex );
+    if( value      != 0 ) free( value      );
+
+    start      = 0;
+    index      = 0;
+    majorIndex = 0;
+    value      = 0;
+}
+
+
+void SparseMatrix::copy( const SparseMatrix& rhs ){
+
+    allocate( rhs.nRows, rhs.nCols, rhs.nnz, rhs.format );
+
+    memcpy( start     , rhs.start     , (getNumMajor()+1)*sizeof(int)    );
+    memcpy( index     , rhs.index     , nnz              *sizeof(int)    );
+    memcpy( majorIndex, rhs.majorIndex, nnz              *sizeof(int)    );
+    memcpy( value     , rhs.value     , nnz              *sizeof(double) );
+}
+
+
+void SparseMatrix::setupMajorIndex( ){
+
+    uint run1;
+    int  run2;
+
+    for( run1 = 0; run1 < getNumMajor(); run1++ )
+        for( run2 = start[run1]; run2 < start[run1+1]; run2++ )
+            majorIndex[run2] = run1;
+}
+
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
@@ -0,0 +1,340 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/matrix_vector/symmetric_matrix.cpp
+ *    \author Hans Joachim Ferreau, Boris Houska
+ *    \date 2026
+ */
+
+
+
+
+
+
+#include <acado/matrix_vector/matrix_vector.hpp>
+
+#include <string.h>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+
+//
+// PUBLIC MEMBER FUNCTIONS:
+//
+
+SymmetricMatrix::SymmetricMatrix( ){
+
+    dim        = 0;
+    element    = 0;
+    factorized = BT_FALSE;
+}
+
+
+SymmetricMatrix::SymmetricMatrix( uint _dim ){
+
+    dim        = 0;
+    element    = 0;
+    factorized = BT_FALSE;
+
+    init( _dim );
+}
+
+
+SymmetricMatrix::SymmetricMatrix( const Matrix& A ){
+
+    uint run1, run2;
+
+    ASSERT( A.getNumRows() == A.getNumCols() );
+
+    dim        = 0;
+    element    = 0;
+    factorized = BT_FALSE;
+
+    init( A.getNumRows() );
+
+    for( run1 = 0; run1 < dim; run1++ )
+        for( run2 = 0; run2 <= run1; run2++ )
+            element[run1*(run1+1)/2+run2] = A(run1,run2);
+}
+
+
+SymmetricMatrix::SymmetricMatrix( const SymmetricMatrix& rhs ){
+
+    dim        = 0;
+    element    = 0;
+    factorized = BT_FALSE;
+
+    init( rhs.dim );
+
+    if( dim > 0 )
+        memcpy( element, rhs.element, getNumberOfEntries()*sizeof(double) );
+
+    factorized = rhs.factorized;
+}
+
+
+SymmetricMatrix::~SymmetricMatrix( ){
+
+    if( element != 0 ) free( element );
+}
+
+
+SymmetricMatrix& SymmetricMatrix::operator=( const SymmetricMatrix& rhs ){
+
+    if( this != &rhs ){
+
+        init( rhs.dim );
+
+        if( dim > 0 )
+            memcpy( element, rhs.element, getNumberOfEntries()*sizeof(double) );
+
+        factorized = rhs.factorized;
+    }
+    return *this;
+}
+
+
+returnValue SymmetricMatrix::init( uint _dim ){
+
+    // keep the memory if the dimension does not change:
+    if( ( _dim != dim ) || ( element == 0 ) ){
+
+        if( element != 0 ) free( element );
+
+        dim     = _dim;
+        element = (double*)calloc( getNumberOfEntries()+1, sizeof(double) );
+    }
+    return setZero();
+}
+
+
+returnValue SymmetricMatrix::setZero( ){
+
+    if( dim > 0 )
+        memset( element, 0, getNumberOfEntries()*sizeof(double) );
+
+    factorized = BT_FALSE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SymmetricMatrix::addRankOneUpdate( const double *x, double alpha ){
+
+    uint run1, run2;
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        double *row = element + run1*(run1+1)/2;
+        const double ax = alpha*x[run1];
+
+        for( run2 = 0; run2 <= run1; run2++ )
+            row[run2] += ax*x[run2];
+    }
+
+    factorized = BT_FALSE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SymmetricMatrix::addRankKUpdate( const Matrix& A ){
+
+    if( A.getNumCols() != dim )
+        return ACADOERROR( RET_VECTOR_DIMENSION_MISMATCH );
+
+    acadoSyrkPacked( dim, A.getNumRows(), A.getDoublePointer(), element, BT_TRUE );
+
+    factorized = BT_FALSE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SymmetricMatrix::multiply( const double *x, double *y, BooleanType addToY ) const{
+
+    acadoSpmv( dim, element, x, y, addToY );
+    return SUCCESSFUL_RETURN;
+}
+
+
+Vector SymmetricMatrix::operator*( const Vector& x ) const{
+
+    ASSERT( x.getDim() == dim );
+
+    Vector result( dim );
+    multiply( x.getDoublePointer(), result.getDoublePointer() );
+
+    return result;
+}
+
+
+Matrix SymmetricMatrix::operator*( const Matrix& B ) const{
+
+    ASSERT( B.getNumRows() == dim );
+
+    Matrix result( dim, B.getNumCols() );
+    acadoSpmm( dim, B.getNumCols(), element, B.getDoublePointer(), result.getDoublePointer() );
+
+    return result;
+}
+
+
+Matrix SymmetricMatrix::getDense( ) const{
+
+    Matrix result;
+    getSubBlock( 0, 0, dim, dim, result );
+
+    return result;
+}
+
+
+returnValue SymmetricMatrix::getSubBlock( uint rowIdx, uint colIdx, uint nR, uint nC, Matrix& block ) const{
+
+    uint run1, run2;
+
+    if( ( rowIdx+nR > dim ) || ( colIdx+nC > dim ) )
+        return ACADOERROR( RET_INDEX_OUT_OF_BOUNDS );
+
+    block.init( nR, nC );
+
+    for( run1 = 0; run1 < nR; run1++ ){
+
+        const uint i = rowIdx+run1;
+
+        for( run2 = 0; run2 < nC; run2++ )
+            block( run1,run2 ) = element[ getIndex( i,colIdx+run2 ) ];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SymmetricMatrix::computeCholeskyDecomposition( ){
+
+    uint i, j, p;
+
+    // ROW-WISE (LEFT-LOOKING) FACTORIZATION; ROWS i AND j OF L ARE
+    // CONTIGUOUS IN THE PACKED STORAGE:
+    // ---------------------------------------------------------------
+    for( i = 0; i < dim; i++ ){
+
+        double *li = element + i*(i+1)/2;
+
+        for( j = 0; j < i; j++ ){
+
+            const double *lj = element + j*(j+1)/2;
+
+            double s = li[j];
+            for( p = 0; p < j; p++ )
+                s -= li[p]*lj[p];
+
+            li[j] = s / lj[j];
+        }
+
+        double s = li[i];
+        for( p = 0; p < i; p++ )
+            s -= li[p]*li[p];
+
+        if( !( s > 0.0 ) )
+            return RET_MATRIX_NOT_POSITIVE_DEFINITE;
+
+        li[i] = sqrt( s );
+    }
+
+    factorized = BT_TRUE;
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue SymmetricMatrix::solveCholesky( double *b ) const{
+
+    int  i;
+    uint p;
+
+    if( factorized == BT_FALSE )
+        return ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    // SOLVE  L*Y = B:
+    for( i = 0; i < (int)dim; i++ ){
+
+        const double *li = element + i*(i+1)/2;
+
+        double s = b[i];
+        for( p = 0; p < (uint)i; p++ )
+            s -= li[p]*b[p];
+        b[i] = s / li[i];
+    }
+
+    // SOLVE  L^T*X = Y  (COLUMN i OF L^T IS ROW i OF L):
+    for( i = (int)dim-1; i >= 0; i-- ){
+
+        const double *li = element + i*(i+1)/2;
+
+        b[i] /= li[i];
+        for( p = 0; p < (uint)i; p++ )
+            b[p] -= li[p]*b[i];
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Vector SymmetricMatrix::solveCholesky( const Vector& b ) const{
+
+    ASSERT( b.getDim() == dim );
+
+    Vector result( b );
+
+    if( solveCholesky( result.getDoublePointer() ) != SUCCESSFUL_RETURN )
+        ACADOERROR( RET_MEMBER_NOT_INITIALISED );
+
+    return result;
+}
+
+
+returnValue SymmetricMatrix::print( ) const{
+
+    uint run1, run2;
+
+    acadoPrintf( "Symmetric matrix (%d x %d):\n", dim, dim );
+
+    for( run1 = 0; run1 < dim; run1++ ){
+        for( run2 = 0; run2 < dim; run2++ )
+            acadoPrintf( "% .16e\t", element[ getIndex( run1,run2 ) ] );
+        acadoPrintf( "\n" );
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+/*
+ *	end of file
+ */
@@ -106,11 +106,14 @@ VectorspaceElement& VectorspaceElement::operator=( const VectorspaceElement& rhs
 
     if ( this != &rhs )
     {
-		if ( element != 0 )
-			delete[] element;
+		if ( dim != rhs.dim )
+		{
+			if ( element != 0 )
+				delete[] element;
 
-		dim = rhs.dim;
-		element = new double[ dim ];
+			dim = rhs.dim;
+			element = new double[ dim ];
+		}
 
 		for( i=0; i<dim; ++i )
 			element[i] = rhs.element[i];
@@ -513,6 +516,12 @@ double* VectorspaceElement::getDoublePointer( )
 }
 
 
+const double* VectorspaceElement::getDoublePointer( ) const
+{
+	return element;
+}
+
+
 
 //
 // PROTECTED MEMBER FUNCTIONS:
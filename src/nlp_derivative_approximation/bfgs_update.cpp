@@ -160,7 +160,7 @@ returnValue BFGSupdate::applyUpdate(	BlockMatrix &B,
     Bx = B*x;
     (x^Bx).getSubBlock( 0, 0, xBx, 1, 1 );
     (y^x ).getSubBlock( 0, 0, xy , 1, 1 );
-    BxxB = Bx*Bx.transpose();
+    computeSymmetricOuterProduct( Bx, BxxB );
 
 
     // CURVATURE CHECK:
@@ -200,7 +200,7 @@ returnValue BFGSupdate::applyUpdate(	BlockMatrix &B,
         }
     }
 
-    zz = z*z.transpose();
+    computeSymmetricOuterProduct( z, zz );
 
     BxxB *= 1.0/(xBx(0,0) + regularisation);
     zz   *= 1.0/(xz       + regularisation);
@@ -253,6 +253,47 @@ returnValue BFGSupdate::applyBlockDiagonalUpdate(	BlockMatrix &B,
 
 
 
+returnValue BFGSupdate::computeSymmetricOuterProduct(	const BlockMatrix &v,
+														BlockMatrix &vv
+														) const
+{
+    uint run1, run2;
+
+    const uint n = v.getNumRows();
+
+    for( run1 = 0; run1 < n; run1++ ){
+        if( ( v.getNumCols() != 1 ) || ( v.getType( run1,0 ) == SBMT_ONE ) ){
+            vv = v*v.transpose();
+            return SUCCESSFUL_RETURN;
+        }
+    }
+
+    // ONLY THE LOWER BLOCK TRIANGLE IS MULTIPLIED, THE UPPER ONE IS ITS
+    // (EXACT) TRANSPOSE:
+    // -----------------------------------------------------------------
+    vv.init( n,n );
+
+    for( run1 = 0; run1 < n; run1++ ){
+
+        if( v.getType( run1,0 ) == SBMT_ZERO )
+            continue;
+
+        for( run2 = 0; run2 <= run1; run2++ ){
+
+            if( v.getType( run2,0 ) == SBMT_ZERO )
+                continue;
+
+            Matrix tmp = v.getBlock( run1,0 ) * v.getBlock( run2,0 ).transpose();
+
+            if( run2 < run1 ) vv.setDense( run2, run1, tmp.transpose() );
+            vv.setDense( run1, run2, tmp );
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
 returnValue BFGSupdate::getSubBlockLine( const int         &N     ,
                                          const int         &line1 ,
                                          const int         &line2 ,
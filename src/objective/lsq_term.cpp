@@ -213,14 +213,46 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
 	double currentValue;
 	VariablesGrid allValues( 1,grid );
 
+    // EVALUATE THE LSQ-FUNCTION AT ALL GRID POINTS AT ONCE:
+    // -----------------------------------------------------
+    const uint nv = fcn.getNumberOfVariables()+1;
+
+    // (symbolic functions are compiled, such that all points are
+    //  evaluated by one sweep of the tape)
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    if( fcn.isSymbolic() == BT_TRUE && fcn.isCompiled() == BT_FALSE )
+        returnvalue = fcn.compile();
+
+    if( returnvalue != SUCCESSFUL_RETURN )
+        return ACADOERROR(returnvalue);
+
+    double *xBatch = new double[nv*N];
+    double *hBatch = new double[nh*N];
+
+    for( run1 = 0; run1 < N && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+
+        z.setZ( run1, x );
+
+        returnvalue = z.copyToBatch( xBatch, nv, N, run1 );
+    }
+
+    if( returnvalue == SUCCESSFUL_RETURN )
+        returnvalue = fcn.evaluateBatch( 0, N, xBatch, hBatch );
+
+    if( returnvalue != SUCCESSFUL_RETURN ){
+        delete[] xBatch;
+        delete[] hBatch;
+        return ACADOERROR(returnvalue);
+    }
+
     for( run1 = 0; run1 < N; run1++ ){
 
 		currentValue = 0.0;
 
-        // EVALUATE THE LSQ-FUCNTION:
-        // --------------------------
-        z.setZ( run1, x );
-        h_res = fcn.evaluate( z, (int) run1 );
+        h_res = Vector( nh );
+        for( run2 = 0; run2 < nh; run2++ )
+            h_res(run2) = hBatch[run2*N+run1];
 
 	
 	#ifdef SIM_DEBUG
@@ -264,6 +296,9 @@ returnValue LSQTerm::evaluate( const OCPiterate &x ){
 		allValues( run1,0 ) = currentValue;
     }
 
+    delete[] xBatch;
+    delete[] hBatch;
+
 	Vector tmp(1);
 	allValues.getIntegral( IM_CONSTANT,tmp );
 	obj = tmp(0);
@@ -368,6 +403,15 @@ returnValue LSQTerm::evaluateSensitivities( BlockMatrix *hessian ){
             }
             Matrix tmp2;
             int i,j;
+
+            // WITHOUT WEIGHTING MATRIX, THE BLOCKS ARE TAKEN FROM J^T*J WHICH IS
+            // ACCUMULATED IN PACKED SYMMETRIC STORAGE (LOWER TRIANGLE ONLY):
+            SymmetricMatrix JtJ;
+            if( S == 0 ){
+                JtJ.init( nnn );
+                JtJ.addRankKUpdate( tmp );
+            }
+
             int *Sidx = new int[6];
             int *Hidx = new int[5];
 
@@ -387,13 +431,18 @@ returnValue LSQTerm::evaluateSensitivities( BlockMatrix *hessian ){
             for( i = 0; i < 5; i++ ){
                 for( j = 0; j < 5; j++ ){
 
-                    tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                    tmp2.setZero();
+                    if( S == 0 ){
+                        JtJ.getSubBlock( Sidx[i],Sidx[j], Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j], tmp2 );
+                    }
+                    else{
+                        tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
+                        tmp2.setZero();
 
-                    for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                        for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                            for( run2 = 0; run2 < nh; run2++ )
-                                tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
+                        for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
+                            for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
+                                for( run2 = 0; run2 < nh; run2++ )
+                                    tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
+                    }
 
                     if( tmp2.getDim() != 0 ) hessian->addDense(Hidx[i],Hidx[j],tmp2);
                 }
@@ -524,6 +573,15 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
                 }
                 Matrix tmp2;
                 int i,j;
+
+                // WITHOUT WEIGHTING MATRIX, THE BLOCKS ARE TAKEN FROM J^T*J WHICH IS
+                // ACCUMULATED IN PACKED SYMMETRIC STORAGE (LOWER TRIANGLE ONLY):
+                SymmetricMatrix JtJ;
+                if( S == 0 ){
+                    JtJ.init( nnn );
+                    JtJ.addRankKUpdate( tmp );
+                }
+
                 int *Sidx = new int[6];
                 int *Hidx = new int[5];
 
@@ -543,13 +601,18 @@ returnValue LSQTerm::evaluateSensitivitiesGN( BlockMatrix *GNhessian ){
                 for( i = 0; i < 5; i++ ){
                     for( j = 0; j < 5; j++ ){
 
-                        tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
-                        tmp2.setZero();
+                        if( S == 0 ){
+                            JtJ.getSubBlock( Sidx[i],Sidx[j], Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j], tmp2 );
+                        }
+                        else{
+                            tmp2.init(Sidx[i+1]-Sidx[i],Sidx[j+1]-Sidx[j]);
+                            tmp2.setZero();
 
-                        for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
-                            for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
-                                for( run2 = 0; run2 < nh; run2++ )
-                                    tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
+                            for( run3 = Sidx[i]; run3 < Sidx[i+1]; run3++ )
+                                for( run4 = Sidx[j]; run4 < Sidx[j+1]; run4++ )
+                                    for( run2 = 0; run2 < nh; run2++ )
+                                        tmp2(run3-Sidx[i],run4-Sidx[j]) += J[run2][y_index[run3]]*tmp(run2,run4);
+                        }
 
                         if( tmp2.getDim() != 0 ) GNhessian->addDense(Hidx[i],Hidx[j],tmp2);
                     }
@@ -173,6 +173,7 @@ returnValue OptimizationAlgorithm::setupOptions( )
 	addOption( ALGEBRAIC_RELAXATION        , defaultAlgebraicRelaxation     );
 	addOption( RELAXATION_PARAMETER        , defaultRelaxationParameter     );
 	addOption( PRINT_INTEGRATOR_PROFILE    , defaultprintIntegratorProfile  );
+	addOption( INTEGRATOR_MIXED_PRECISION  , defaultIntegratorMixedPrecision );
 
 	return SUCCESSFUL_RETURN;
 }
@@ -109,7 +109,33 @@ SparseSolver* SymmetricConjugateGradientMethod::clone() const{
 
 returnValue SymmetricConjugateGradientMethod::setIndices( const int *rowIdx_, const int *colIdx_  ){
 
-     return ACADOERROR( RET_NOT_IMPLEMENTED_YET );
+    // CONSISTENCY CHECK:
+    // ------------------
+
+    if( dim    <= 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+    if( nDense <= 0 )  return ACADOERROR(RET_MEMBER_NOT_INITIALISED);
+
+
+    // CONVERT THE TRIPLETS INTO THE INDEX LIST (row by row):
+    // ------------------------------------------------------
+
+    int run1;
+    int *indices = new int[nDense];
+
+    for( run1 = 0; run1 < nDense; run1++ ){
+
+        indices[run1] = rowIdx_[run1]*dim + colIdx_[run1];
+
+        if( run1 > 0 && indices[run1] <= indices[run1-1] ){
+            delete[] indices;
+            return ACADOERROR( RET_INVALID_ARGUMENTS );
+        }
+    }
+
+    returnValue returnvalue = setIndices( indices );
+
+    delete[] indices;
+    return returnvalue;
 }
 
 
@@ -469,8 +469,8 @@ Expression Expression::operator+( const Expression& arg ) const{
             delete tmp.element[i*getNumCols()+j];
             if( element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO ){
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                    tmp.element[i*getNumCols()+j] = new Addition( element[i*getNumCols()+j]->clone(),
-                                                    arg.element[i*getNumCols()+j]->clone() );
+                    tmp.element[i*getNumCols()+j] = new Addition( element[i*getNumCols()+j]->shareUnique(),
+                                                    arg.element[i*getNumCols()+j]->shareUnique() );
                 else
                     tmp.element[i*getNumCols()+j] = element[i*getNumCols()+j]->clone();
             }
@@ -500,15 +500,15 @@ Expression Expression::operator-( const Expression& arg ) const{
             delete tmp.element[i*getNumCols()+j];
             if( element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO ){
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                    tmp.element[i*getNumCols()+j] = new Subtraction( element[i*getNumCols()+j]->clone(),
-                                                    arg.element[i*getNumCols()+j]->clone() );
+                    tmp.element[i*getNumCols()+j] = new Subtraction( element[i*getNumCols()+j]->shareUnique(),
+                                                    arg.element[i*getNumCols()+j]->shareUnique() );
                 else
                     tmp.element[i*getNumCols()+j] = element[i*getNumCols()+j]->clone();
             }
             else{
                 if( arg.element[i*getNumCols()+j]->isOneOrZero() != NE_ZERO )
-                     tmp.element[i*getNumCols()+j] = new Subtraction( new DoubleConstant(0.0,NE_ZERO),
-                                                                      arg.element[i*getNumCols()+j]->clone() );
+                     tmp.element[i*getNumCols()+j] = new Subtraction( DoubleConstant(0.0,NE_ZERO).shareUnique(),
+                                                                      arg.element[i*getNumCols()+j]->shareUnique() );
                 else tmp.element[i*getNumCols()+j] = new DoubleConstant(0.0,NE_ZERO);
             }
         }
@@ -539,7 +539,7 @@ Operator* Expression::product( const Operator *a, const Operator *b ) const{
                       return a->clone();
 
                  default:
-                      return new Product( a->clone(), b->clone() );
+                      return new Product( a->shareUnique(), b->shareUnique() );
              }
     }
     return 0;
@@ -620,7 +620,7 @@ Expression Expression::operator/( const Expression& arg ) const{
 
     for( i = 0; i< getDim(); i++ ){
          delete tmp.element[i];
-         tmp.element[i] = new Quotient( element[i]->clone(), arg.element[0]->clone() );
+         tmp.element[i] = new Quotient( element[i]->shareUnique(), arg.element[0]->shareUnique() );
     }
     return tmp;
 }
@@ -739,7 +739,7 @@ Expression Expression::getSin( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Sin( element[run1]->clone() ); 
+        tmp.element[run1] = new Sin( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -751,7 +751,7 @@ Expression Expression::getCos( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Cos( element[run1]->clone() ); 
+        tmp.element[run1] = new Cos( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -763,7 +763,7 @@ Expression Expression::getTan( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Tan( element[run1]->clone() ); 
+        tmp.element[run1] = new Tan( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -775,7 +775,7 @@ Expression Expression::getAsin( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Asin( element[run1]->clone() ); 
+        tmp.element[run1] = new Asin( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -787,7 +787,7 @@ Expression Expression::getAcos( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Acos( element[run1]->clone() ); 
+        tmp.element[run1] = new Acos( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -799,7 +799,7 @@ Expression Expression::getAtan( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Atan( element[run1]->clone() ); 
+        tmp.element[run1] = new Atan( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -811,7 +811,7 @@ Expression Expression::getExp( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Exp( element[run1]->clone() ); 
+        tmp.element[run1] = new Exp( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -823,7 +823,7 @@ Expression Expression::getSqrt( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Power( element[run1]->clone(), new DoubleConstant( 0.5, NE_NEITHER_ONE_NOR_ZERO ) ); 
+        tmp.element[run1] = new Power( element[run1]->shareUnique(), DoubleConstant( 0.5, NE_NEITHER_ONE_NOR_ZERO ).shareUnique() );
     }
     return tmp;
 }
@@ -835,7 +835,7 @@ Expression Expression::getLn( ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Logarithm( element[run1]->clone() ); 
+        tmp.element[run1] = new Logarithm( element[run1]->shareUnique() );
     }
     return tmp;
 }
@@ -850,7 +850,7 @@ Expression Expression::getPow( const Expression& arg ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Power( element[run1]->clone(), arg.element[0]->clone() ); 
+        tmp.element[run1] = new Power( element[run1]->shareUnique(), arg.element[0]->shareUnique() );
     }
     return tmp;
 }
@@ -863,7 +863,7 @@ Expression Expression::getPowInt( const int &arg ) const{
 
     for( run1 = 0; run1 < dim; run1++ ){
         delete tmp.element[run1];
-        tmp.element[run1] = new Power_Int( element[run1]->clone(), arg );
+        tmp.element[run1] = new Power_Int( element[run1]->shareUnique(), arg );
     }
     return tmp;
 }
@@ -1289,9 +1289,8 @@ Expression Expression::ADbackward( const Expression &arg, const Expression &seed
         element[run1]->AD_backward( Dim, varType, Component, seed1, iresult );
 
         for( run2 = 0; run2 < Dim; run2++ ){
-            Operator *sum = result.element[run2]->clone();
-            delete result.element[run2];
-            result.element[run2] = new Addition( sum->clone(), iresult[run2]->clone() );
+            Operator *sum = result.element[run2];
+            result.element[run2] = new Addition( sum->shareUnique(), iresult[run2]->shareUnique() );
             delete sum;
             delete iresult[run2];
         }
@@ -1325,8 +1324,8 @@ Expression Expression::operator-() const{
     for( run1 = 0; run1 < getNumRows(); run1++ ){
         for( run2 = 0; run2 < getNumCols(); run2++ ){
              delete tmp.element[run1*getNumCols()+run2];
-             tmp.element[run1*getNumCols()+run2] = new Subtraction( new DoubleConstant(0.0,NE_ZERO),
-                                                                    element[run1*getNumCols()+run2]->clone() );
+             tmp.element[run1*getNumCols()+run2] = new Subtraction( DoubleConstant(0.0,NE_ZERO).shareUnique(),
+                                                                    element[run1*getNumCols()+run2]->shareUnique() );
         }
     }
     return tmp;
@@ -1392,8 +1391,7 @@ void Expression::deleteAll( ){
     uint i;
 
     for( i = 0; i < dim; i++ )
-        if( element[i] != 0 )
-            delete element[i];
+        Operator::release( element[i] );
 
     if( element != 0 ) free(element);
 }
@@ -103,11 +103,13 @@ returnValue Acos::evaluate( EvaluationBase *x ){
 
 Operator* Acos::differentiate( int index ){
 
-    dargument = argument->differentiate( index );
+    Operator *dargument = argument->differentiate( index );
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Product(
              new DoubleConstant( -1.0, NE_NEITHER_ONE_NOR_ZERO ),
              new Power(
@@ -141,7 +143,7 @@ Operator* Acos::differentiate( int index ){
                ),
                new DoubleConstant( -0.5 , NE_NEITHER_ONE_NOR_ZERO )
              ),
-             dargument->clone()
+             dargument
            )
      );
 
@@ -155,15 +157,14 @@ Operator* Acos::ADforwardProtected( int dim,
                                       int &nNewIS,
                                       TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Product(
                  new DoubleConstant( -1.0, NE_NEITHER_ONE_NOR_ZERO ),
                  new Power(
@@ -197,7 +198,7 @@ Operator* Acos::ADforwardProtected( int dim,
                ),
                new DoubleConstant( -0.5 , NE_NEITHER_ONE_NOR_ZERO )
              ),
-             dargument->clone()
+             dargument
            )
      );
 }
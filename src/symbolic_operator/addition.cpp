@@ -94,18 +94,22 @@ returnValue Addition::evaluate( EvaluationBase *x ){
 
 Operator* Addition::differentiate( int index ){
 
-  dargument1 = argument1->differentiate( index );
-  dargument2 = argument2->differentiate( index );
+  Operator *dargument1 = argument1->differentiate( index );
+  Operator *dargument2 = argument2->differentiate( index );
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO ){
-    return dargument2->clone();
+    release( dargument1 );
+    return dargument2;
   }
   if ( dargument2->isOneOrZero() == NE_ZERO ){
-    return dargument1->clone();
+    release( dargument2 );
+    return dargument1;
   }
-  return new Addition( dargument1->clone() , dargument2->clone() );
+  return new Addition( dargument1 , dargument2 );
 
 }
 
@@ -118,27 +122,25 @@ Operator* Addition::AD_forward( int dim,
                                   int &nNewIS,
                                   TreeProjection ***newIS ){
 
-    if( dargument1 != 0 )
-        delete dargument1;
-
-    if( dargument2 != 0 )
-        delete dargument2;
-
-    dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
-    dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
 
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO ){
-        return dargument2->clone();
+        release( dargument1 );
+        return dargument2;
     }
     if ( dargument2->isOneOrZero() == NE_ZERO ){
-        return dargument1->clone();
+        release( dargument2 );
+        return dargument1;
     }
 
-    return new Addition( dargument1->clone() , dargument2->clone() );
+    return new Addition( dargument1 , dargument2 );
 }
 
 
@@ -402,6 +404,16 @@ Operator* Addition::clone() const{
 }
 
 
+Operator* Addition::hashCons( OperatorTable *table ) const{
+
+    // consistent with clone, which drops an addition of zero:
+    if( argument1->isOneOrZero() == NE_ZERO ) return table->import( argument2 );
+    if( argument2->isOneOrZero() == NE_ZERO ) return table->import( argument1 );
+
+    return BinaryOperator::hashCons( table );
+}
+
+
 OperatorName Addition::getName(){
 
     return ON_ADDITION;
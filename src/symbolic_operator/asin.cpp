@@ -102,11 +102,13 @@ returnValue Asin::evaluate( EvaluationBase *x ){
 
 Operator* Asin::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return new Power(
                    new Subtraction(
                            new DoubleConstant(1.0 , NE_ONE),
@@ -129,7 +131,7 @@ Operator* Asin::differentiate( int index ){
                              ),
                          new DoubleConstant( -0.5 , NE_NEITHER_ONE_NOR_ZERO )
                      ),
-                 dargument->clone()
+                 dargument
             );
 }
 
@@ -142,15 +144,14 @@ Operator* Asin::ADforwardProtected( int dim,
                                       int &nNewIS,
                                       TreeProjection ***newIS  ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Power(
                    new Subtraction(
                            new DoubleConstant(1.0 , NE_ONE),
@@ -173,7 +174,7 @@ Operator* Asin::ADforwardProtected( int dim,
                              ),
                          new DoubleConstant( -0.5 , NE_NEITHER_ONE_NOR_ZERO )
                      ),
-                 dargument->clone()
+                 dargument
          );
 }
 
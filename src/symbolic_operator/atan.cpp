@@ -103,11 +103,13 @@ returnValue Atan::evaluate( EvaluationBase *x ){
 
 Operator* Atan::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return new Power_Int(
              new Addition(
                new DoubleConstant( 1.0 , NE_ONE ),
@@ -120,7 +122,7 @@ Operator* Atan::differentiate( int index ){
            );
   }
   return new Quotient(
-                 dargument->clone(),
+                 dargument,
                  new Addition(
                          new DoubleConstant( 1.0 , NE_ONE ),
                          new Power_Int(
@@ -141,15 +143,14 @@ Operator* Atan::ADforwardProtected( int dim,
                                       int &nNewIS,
                                       TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Power_Int(
                  new Addition(
                    new DoubleConstant( 1.0 , NE_ONE ),
@@ -162,7 +163,7 @@ Operator* Atan::ADforwardProtected( int dim,
              );
     }
     return new Quotient(
-                 dargument->clone(),
+                 dargument,
                  new Addition(
                          new DoubleConstant( 1.0 , NE_ONE ),
                          new Power_Int(
@@ -47,8 +47,6 @@ BinaryOperator::BinaryOperator( Operator *_argument1, Operator *_argument2 ) : S
 {
     argument1          = _argument1                      ;
     argument2          = _argument2                      ;
-    dargument1         = NULL                            ;
-    dargument2         = NULL                            ;
     argument1_result  = (double*)calloc(1,sizeof(double));
     argument2_result  = (double*)calloc(1,sizeof(double));
     dargument1_result = (double*)calloc(1,sizeof(double));
@@ -63,8 +61,8 @@ BinaryOperator::BinaryOperator( Operator *_argument1, Operator *_argument2 ) : S
 
 BinaryOperator::BinaryOperator( const BinaryOperator &arg ){
 
-	argument1  = arg.argument1->clone();
-    argument2  = arg.argument2->clone();
+    argument1  = arg.argument1->share();
+    argument2  = arg.argument2->share();
     copy( arg );
 }
 
@@ -78,7 +76,11 @@ BinaryOperator::~BinaryOperator(){
 BinaryOperator& BinaryOperator::operator=( const BinaryOperator &arg ){
 
     if( this != &arg ){
+        Operator *tmp1 = arg.argument1->share();
+        Operator *tmp2 = arg.argument2->share();
         deleteAll();
+        argument1 = tmp1;
+        argument2 = tmp2;
         copy( arg );
     }
     return *this;
@@ -181,6 +183,60 @@ BooleanType BinaryOperator::isSymbolic() const{
 }
 
 
+int BinaryOperator::getNumberOfArguments() const{
+
+    return 2;
+}
+
+
+Operator* BinaryOperator::getArgumentPointer( int idx ) const{
+
+    if( idx == 0 ) return argument1;
+    if( idx == 1 ) return argument2;
+    return 0;
+}
+
+
+returnValue BinaryOperator::setArgumentPointer( int idx, Operator *_argument ){
+
+    switch( idx ){
+
+        case 0:  release( argument1 );
+                 argument1 = _argument;
+                 return SUCCESSFUL_RETURN;
+
+        case 1:  release( argument2 );
+                 argument2 = _argument;
+                 return SUCCESSFUL_RETURN;
+
+        default: break;
+    }
+
+    return Operator::setArgumentPointer( idx, _argument );
+}
+
+
+Operator* BinaryOperator::hashCons( OperatorTable *table ) const{
+
+    BinaryOperator *tmp = (BinaryOperator*)clone();
+
+    tmp->setArgumentPointer( 0, table->import( argument1 ) );
+    tmp->setArgumentPointer( 1, table->import( argument2 ) );
+
+    return table->unique( tmp );
+}
+
+
+BooleanType BinaryOperator::getHashKey( int &type, int &index, double &value ) const{
+
+    type  = 0  ;
+    index = 0  ;
+    value = 0.0;
+
+    return BT_TRUE;
+}
+
+
 
 // //
 // // PROTECTED MEMBER FUNCTIONS:
@@ -193,20 +249,6 @@ void BinaryOperator::copy( const BinaryOperator &arg ){
 
     bufferSize = arg.bufferSize;
 
-    if( arg.dargument1 == NULL ){
-        dargument1 = NULL;
-    }
-    else{
-        dargument1 = arg.dargument1->clone();
-    }
-
-    if( arg.dargument2 == NULL ){
-        dargument2 = NULL;
-    }
-    else{
-        dargument2 = arg.dargument2->clone();
-    }
-
     argument1_result  = (double*)calloc(bufferSize,sizeof(double));
     argument2_result  = (double*)calloc(bufferSize,sizeof(double));
     dargument1_result = (double*)calloc(bufferSize,sizeof(double));
@@ -229,15 +271,8 @@ void BinaryOperator::copy( const BinaryOperator &arg ){
 
 void BinaryOperator::deleteAll(){
 
-    if( argument1 != 0 ) delete argument1;
-    if( argument2 != 0 ) delete argument2;
-
-    if( dargument1 != NULL ){
-        delete dargument1;
-    }
-    if( dargument2 != NULL ){
-        delete dargument2;
-    }
+    release( argument1 );
+    release( argument2 );
 
     free(  argument1_result );
     free(  argument2_result );
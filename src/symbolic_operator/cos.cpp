@@ -102,11 +102,13 @@ returnValue Cos::evaluate( EvaluationBase *x ){
 
 Operator* Cos::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return new Product(
              new DoubleConstant( -1.0 , NE_NEITHER_ONE_NOR_ZERO ),
              new Sin( argument->clone() )
@@ -115,7 +117,7 @@ Operator* Cos::differentiate( int index ){
   return new Product(
            new DoubleConstant( -1.0 , NE_NEITHER_ONE_NOR_ZERO ),
            new Product(
-             dargument->clone(),
+             dargument,
              new Sin(
                argument->clone()
              )
@@ -131,15 +133,14 @@ Operator* Cos::ADforwardProtected( int dim,
                                      int &nNewIS,
                                      TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Product(
                 new DoubleConstant( -1.0 , NE_NEITHER_ONE_NOR_ZERO ),
                 new Sin( argument->clone() )
@@ -148,7 +149,7 @@ Operator* Cos::ADforwardProtected( int dim,
     return new Product(
            new DoubleConstant( -1.0 , NE_NEITHER_ONE_NOR_ZERO ),
            new Product(
-             dargument->clone(),
+             dargument,
              new Sin(
                argument->clone()
              )
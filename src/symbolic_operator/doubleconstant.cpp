@@ -308,6 +308,22 @@ BooleanType DoubleConstant::isSymbolic() const{
 }
 
 
+Operator* DoubleConstant::hashCons( OperatorTable *table ) const{
+
+    return table->unique( clone(), neutralElement, 0, value );
+}
+
+
+BooleanType DoubleConstant::getHashKey( int &_type, int &_index, double &_value ) const{
+
+    _type  = neutralElement;
+    _index = 0             ;
+    _value = value         ;
+
+    return BT_TRUE;
+}
+
+
 double DoubleConstant::getValue() const{
 
     return value;
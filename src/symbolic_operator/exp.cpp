@@ -94,14 +94,16 @@ returnValue Exp::evaluate( EvaluationBase *x ){
 
 Operator* Exp::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return clone();
   }
-  return new Product( dargument->clone() , clone() );
+  return new Product( dargument , clone() );
 }
 
 
@@ -113,18 +115,17 @@ Operator* Exp::ADforwardProtected( int dim,
                                      int &nNewIS,
                                      TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return clone();
     }
-    return new Product( dargument->clone() , clone() );
+    return new Product( dargument , clone() );
 }
 
 
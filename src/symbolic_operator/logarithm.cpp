@@ -102,18 +102,20 @@ returnValue Logarithm::evaluate( EvaluationBase *x ){
 
 Operator* Logarithm::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return new Power_Int(
              argument->clone(),
              -1
            );
   }
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   return new Quotient(
-                dargument->clone(),
+                dargument,
                 argument->clone()
              );
 }
@@ -126,22 +128,21 @@ Operator* Logarithm::ADforwardProtected( int dim,
                                            int &nNewIS,
                                            TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Power_Int(
                  argument->clone(),
                  -1
              );
     }
     return new Quotient(
-                dargument->clone(),
+                dargument,
                 argument->clone()
              );
 }
@@ -0,0 +1,229 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+*    \file src/symbolic_operator/negation.cpp
+*    \author Boris Houska, Hans Joachim Ferreau
+*    \date 2026
+*/
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/* the function and its first and second derivative: */
+static double negationFcn  ( double x ){ return -x;   }
+static double negationDfcn ( double   ){ return -1.0; }
+static double negationDdfcn( double   ){ return  0.0; }
+
+
+Negation::Negation():UnaryOperator(){
+  cName = "-";
+
+  fcn = &negationFcn;
+  dfcn = &negationDfcn;
+  ddfcn = &negationDdfcn;
+
+  operatorName = ON_NEGATION;
+
+}
+
+Negation::Negation( Operator *_argument ):UnaryOperator(_argument){
+  cName = "-";
+
+  fcn = &negationFcn;
+  dfcn = &negationDfcn;
+  ddfcn = &negationDdfcn;
+
+  operatorName = ON_NEGATION;
+}
+
+
+Negation::Negation( const Negation &arg ):UnaryOperator(arg){
+  cName = "-";
+
+  fcn = &negationFcn;
+  dfcn = &negationDfcn;
+  ddfcn = &negationDdfcn;
+
+  operatorName = ON_NEGATION;
+}
+
+
+Negation::~Negation(){
+
+}
+
+
+Negation& Negation::operator=( const Negation &arg ){
+
+  UnaryOperator::operator=(arg);
+
+  return *this;
+}
+
+
+returnValue Negation::evaluate( EvaluationBase *x ){
+
+    x->negation(*argument);
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* Negation::differentiate( int index ){
+
+  Operator *dargument = argument->differentiate( index );
+  if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
+    return new DoubleConstant( 0.0 , NE_ZERO );
+  }
+  return new Negation( dargument );
+}
+
+
+
+Operator* Negation::ADforwardProtected( int dim,
+                                        VariableType *varType,
+                                        int *component,
+                                        Operator **seed,
+                                        int &nNewIS,
+                                        TreeProjection ***newIS ){
+
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+
+    if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
+        return new DoubleConstant( 0.0 , NE_ZERO );
+    }
+    return new Negation( dargument );
+}
+
+
+
+returnValue Negation::ADbackwardProtected( int dim,
+                                           VariableType *varType,
+                                           int *component,
+                                           Operator *seed,
+                                           Operator **df         ){
+
+    if( seed->isOneOrZero() == NE_ZERO ){
+            argument->AD_backward( dim,
+                                          varType,
+                                          component,
+                                          new DoubleConstant( 0.0 , NE_ZERO ),
+                                          df
+            );
+        delete seed;
+        return SUCCESSFUL_RETURN;
+    }
+    argument->AD_backward( dim,
+                                  varType,
+                                  component,
+                                  new Negation( seed->clone() ),
+                                  df
+            );
+
+    delete seed;
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* Negation::substitute( int index, const Operator *sub ){
+
+    return new Negation( argument->substitute( index , sub ) );
+
+}
+
+
+Operator* Negation::clone() const{
+
+    return new Negation(*this);
+}
+
+
+BooleanType Negation::isLinearIn( int dim,
+                                  VariableType *varType,
+                                  int *component,
+                                  BooleanType   *implicit_dep ){
+
+    return argument->isLinearIn( dim, varType, component, implicit_dep );
+}
+
+
+BooleanType Negation::isPolynomialIn( int dim,
+                                      VariableType *varType,
+                                      int *component,
+                                      BooleanType   *implicit_dep ){
+
+    return argument->isPolynomialIn( dim, varType, component, implicit_dep );
+}
+
+
+BooleanType Negation::isRationalIn( int dim,
+                                    VariableType *varType,
+                                    int *component,
+                                    BooleanType   *implicit_dep ){
+
+    return argument->isRationalIn( dim, varType, component, implicit_dep );
+}
+
+
+MonotonicityType Negation::getMonotonicity( ){
+
+    if( monotonicity != MT_UNKNOWN )  return monotonicity;
+
+    const MonotonicityType m = argument->getMonotonicity();
+
+    if( m == MT_CONSTANT      )  return MT_CONSTANT     ;
+    if( m == MT_NONDECREASING )  return MT_NONINCREASING;
+    if( m == MT_NONINCREASING )  return MT_NONDECREASING;
+
+    return MT_NONMONOTONIC;
+}
+
+
+CurvatureType Negation::getCurvature( ){
+
+    if( curvature != CT_UNKNOWN )  return curvature;
+
+    const CurvatureType cc = argument->getCurvature();
+
+    if( cc == CT_CONSTANT )  return CT_CONSTANT;
+    if( cc == CT_AFFINE   )  return CT_AFFINE  ;
+    if( cc == CT_CONVEX   )  return CT_CONCAVE ;
+    if( cc == CT_CONCAVE  )  return CT_CONVEX  ;
+
+    return CT_NEITHER_CONVEX_NOR_CONCAVE;
+}
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
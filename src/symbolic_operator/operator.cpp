@@ -45,12 +45,25 @@ BEGIN_NAMESPACE_ACADO
 
 Operator::Operator(){
 
-    nCount = 0;
+    nCount   = 0       ;
+    isUnique = BT_FALSE;
 }
 
 Operator::~Operator(){ }
 
 
+void* Operator::operator new( size_t size ){
+
+    return OperatorPool::allocate( size );
+}
+
+
+void Operator::operator delete( void *ptr, size_t size ){
+
+    OperatorPool::release( ptr, size );
+}
+
+
 TreeProjection& Operator::operator=( const double &arg ){
 
     ACADOERROR( RET_UNKNOWN_BUG );
@@ -235,6 +248,70 @@ Operator* Operator::passArgument() const{
     return 0;
 }
 
+
+int Operator::getNumberOfArguments() const{
+
+    return 0;
+}
+
+
+Operator* Operator::getArgumentPointer( int idx ) const{
+
+    return 0;
+}
+
+
+returnValue Operator::setArgumentPointer( int idx, Operator *_argument ){
+
+    release( _argument );
+    return ACADOERROR( RET_INDEX_OUT_OF_RANGE );
+}
+
+
+Operator* Operator::hashCons( OperatorTable *table ) const{
+
+    return clone();
+}
+
+
+Operator* Operator::shareUnique() const{
+
+    return OperatorTable::shareExpression( this );
+}
+
+
+BooleanType Operator::getHashKey( int &type, int &index, double &value ) const{
+
+    return BT_FALSE;
+}
+
+
+Operator* Operator::share(){
+
+    // nodes of the expression table may be shared by several threads:
+    if( isUnique == BT_TRUE ){
+        OperatorTable::shareExpressionNode( this );
+        return this;
+    }
+
+    nCount++;
+    return this;
+}
+
+
+void Operator::release( Operator *arg ){
+
+    if( arg == 0 ) return;
+
+    if( arg->isUnique == BT_TRUE ){
+        if( OperatorTable::releaseExpressionNode( arg ) == BT_TRUE ) delete arg;
+        return;
+    }
+
+    if( arg->nCount == 0 ) delete arg;
+    else                   arg->nCount--;
+}
+
 returnValue Operator::setVariableExportName( const VariableType &_type, const Stream *_name ){
 
 	return SUCCESSFUL_RETURN;
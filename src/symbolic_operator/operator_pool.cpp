@@ -0,0 +1,195 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file src/symbolic_operator/operator_pool.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date 2026
+ */
+
+
+
+
+#include <acado/symbolic_operator/operator_pool.hpp>
+
+#include <new>
+
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+void*         OperatorPool::freeList[OP_CLASSES];
+int           OperatorPool::nBlocks    = 0;
+char**        OperatorPool::chunk      = 0;
+int           OperatorPool::nChunks    = 0;
+BooleanType   OperatorPool::isFinished = BT_FALSE;
+volatile long OperatorPool::lock       = 0;
+
+
+/* frees the chunks of the pool at the end of the program: */
+class OperatorPoolGuard{
+
+public:
+
+    ~OperatorPoolGuard(){ OperatorPool::finish(); }
+};
+
+static OperatorPoolGuard operatorPoolGuard;
+
+
+void* OperatorPool::allocate( size_t size ){
+
+    int sizeClass = ( (int) size - 1 ) / OP_GRANULARITY;
+
+    if( size == 0 ) sizeClass = 0;
+
+    if( sizeClass >= OP_CLASSES ){
+
+        void *ptr = malloc( size );
+        if( ptr == 0 ) throw std::bad_alloc();
+        return ptr;
+    }
+
+    acadoLock( &lock );
+
+    if( freeList[sizeClass] == 0 )
+        grow( sizeClass );
+
+    // the first bytes of a free block point to the next one:
+    void *ptr = freeList[sizeClass];
+
+    if( ptr != 0 ){
+        freeList[sizeClass] = *(void**)ptr;
+        nBlocks++;
+    }
+
+    acadoUnlock( &lock );
+
+    if( ptr == 0 ) throw std::bad_alloc();
+    return ptr;
+}
+
+
+void OperatorPool::release( void *ptr, size_t size ){
+
+    if( ptr == 0 ) return;
+
+    int sizeClass = ( (int) size - 1 ) / OP_GRANULARITY;
+
+    if( size == 0 ) sizeClass = 0;
+
+    if( sizeClass >= OP_CLASSES ){
+        free( ptr );
+        return;
+    }
+
+    acadoLock( &lock );
+
+    *(void**)ptr = freeList[sizeClass];
+    freeList[sizeClass] = ptr;
+
+    nBlocks--;
+
+    if( nBlocks == 0 && isFinished == BT_TRUE )
+        freeChunks();
+
+    acadoUnlock( &lock );
+}
+
+
+int OperatorPool::getNumberOfBlocks(){
+
+    return nBlocks;
+}
+
+
+void OperatorPool::finish(){
+
+    acadoLock( &lock );
+
+    // operators of other static objects may still be destroyed later:
+    isFinished = BT_TRUE;
+
+    if( nBlocks == 0 )
+        freeChunks();
+
+    acadoUnlock( &lock );
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void OperatorPool::grow( int sizeClass ){
+
+    int run1;
+    int blockSize = ( sizeClass+1 )*OP_GRANULARITY;
+    int nNew      = OP_CHUNK_SIZE / blockSize;
+
+    // (the caller holds the lock and checks whether a block is available)
+    char  *newChunk = (char*)malloc( nNew*blockSize );
+    char **newList  = (char**)realloc( chunk, (nChunks+1)*sizeof(char*) );
+
+    if( newList != 0 ) chunk = newList;
+
+    if( newChunk == 0 || newList == 0 ){
+        free( newChunk );
+        return;
+    }
+
+    chunk[nChunks++] = newChunk;
+
+    for( run1 = 0; run1 < nNew-1; run1++ )
+        *(void**)( newChunk + run1*blockSize ) = newChunk + (run1+1)*blockSize;
+
+    *(void**)( newChunk + (nNew-1)*blockSize ) = freeList[sizeClass];
+    freeList[sizeClass] = newChunk;
+}
+
+
+void OperatorPool::freeChunks(){
+
+    int run1;
+
+    for( run1 = 0; run1 < nChunks; run1++ )
+        free( chunk[run1] );
+
+    for( run1 = 0; run1 < OP_CLASSES; run1++ )
+        freeList[run1] = 0;
+
+    free( chunk );
+
+    chunk   = 0;
+    nChunks = 0;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
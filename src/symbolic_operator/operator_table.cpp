@@ -0,0 +1,1547 @@
+/*
+ *    This file is part of ACADO Toolkit.
+ *
+ *    ACADO Toolkit -- A Toolkit for Automatic Control and Dynamic Optimization.
+ *    Copyright (C) 2008-2009 by Boris Houska and Hans Joachim Ferreau, K.U.Leuven.
+ *    Developed within the Optimization in Engineering Center (OPTEC) under
+ *    supervision of Moritz Diehl. All rights reserved.
+ *
+ *    ACADO Toolkit is free software; you can redistribute it and/or
+ *    modify it under the terms of the GNU Lesser General Public
+ *    License as published by the Free Software Foundation; either
+ *    version 3 of the License, or (at your option) any later version.
+ *
+ *    ACADO Toolkit is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the GNU
+ *    Lesser General Public License for more details.
+ *
+ *    You should have received a copy of the GNU Lesser General Public
+ *    License along with ACADO Toolkit; if not, write to the Free Software
+ *    Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA  02110-1301  USA
+ *
+ */
+
+
+
+/**
+ *    \file   src/symbolic_operator/operator_table.cpp
+ *    \author Boris Houska, Hans Joachim Ferreau
+ *    \date   2026
+ */
+
+
+#include <acado/utils/acado_utils.hpp>
+#include <acado/symbolic_operator/symbolic_operator.hpp>
+
+#include <string.h>
+#include <functional>
+
+
+BEGIN_NAMESPACE_ACADO
+
+
+/** Version of the binary format written by OperatorTable::write(). */
+#define OT_FILE_VERSION 2
+
+/** Largest number of terms of a polynomial expanded by convertToHornerForm(). */
+#define OT_HORNER_MAX_TERMS 4096
+
+/** Largest power of a leaf which the Horner form multiplies out. */
+#define OT_HORNER_MAX_PRODUCTS 3
+
+/** Largest exponent of a power expanded by convertToHornerForm(). */
+#define OT_HORNER_MAX_EXPONENT 64
+
+/** Costs of the operations (in multiples of an addition) as assumed \n
+ *  by convertToHornerForm().                                        \n
+ */
+#define OT_COST_POWER_INT 8
+#define OT_COST_POWER    20
+
+
+/** Compares two doubles exactly, i.e. like ==, but without a warning \n
+ *  of -Wfloat-equal. The simplification must not use the tolerance   \n
+ *  of acadoIsEqual, which would change the simplified expressions.   \n
+ */
+static inline BooleanType isExactlyEqual( double a, double b ){
+
+    if( a <= b && a >= b ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+
+OperatorTable::OperatorKey::OperatorKey( OperatorName name_, int type_, int index_, double value_,
+                                         const Operator *argument1_, const Operator *argument2_ ){
+
+    name      = name_     ;
+    type      = type_     ;
+    index     = index_    ;
+    value     = value_    ;
+    argument1 = argument1_;
+    argument2 = argument2_;
+}
+
+
+bool OperatorTable::OperatorKey::operator<( const OperatorKey &arg ) const{
+
+    if( name  != arg.name  ) return name  < arg.name ;
+    if( type  != arg.type  ) return type  < arg.type ;
+    if( index != arg.index ) return index < arg.index;
+
+    // compare the bit patterns, such that NaNs and signed zeros are kept apart:
+    int cmp = memcmp( &value, &arg.value, sizeof(double) );
+    if( cmp != 0 ) return cmp < 0;
+
+    std::less<const Operator*> less;
+
+    if( argument1 != arg.argument1 ) return less( argument1, arg.argument1 );
+    return less( argument2, arg.argument2 );
+}
+
+
+
+OperatorTable::OperatorTable(){ }
+
+
+OperatorTable::~OperatorTable(){
+
+    clear();
+}
+
+
+Operator* OperatorTable::import( const Operator *arg ){
+
+    if( arg == 0 ) return 0;
+
+    // nodes of the table are imported as they are:
+    if( members.find( arg ) != members.end() )
+        return ((Operator*)arg)->share();
+
+    MemoMap::iterator it = memo.find( arg );
+    if( it != memo.end() ) return it->second->share();
+
+    Operator *tmp = arg->hashCons( this );
+    memo[arg] = tmp->share();
+
+    return tmp;
+}
+
+
+Operator* OperatorTable::unique( Operator *node, int type, int index, double value ){
+
+    Operator *simple = simplify( node, type );
+    if( simple != 0 ) return simple;
+
+    OperatorKey key( node->getName(), type, index, value,
+                     node->getArgumentPointer(0), node->getArgumentPointer(1) );
+
+    NodeMap::iterator it = nodes.find( key );
+
+    if( it != nodes.end() ){
+        Operator::release( node );
+        return it->second->share();
+    }
+
+    int ordinal = (int) members.size();
+
+    nodes.insert( NodeMap::value_type( key, node ) );
+    members[node] = ordinal;
+    fresh  [node] = 1;
+
+    int run1;
+    for( run1 = 0; run1 < node->getNumberOfArguments(); run1++ )
+        parents.insert( ParentMap::value_type( node->getArgumentPointer(run1), node ) );
+
+    return node->share();
+}
+
+
+returnValue OperatorTable::addIntermediateState( TreeProjection *arg ){
+
+    const Operator *tmp = arg->passArgument();
+
+    if( tmp == 0 || states.find( tmp ) != states.end() )
+        return SUCCESSFUL_RETURN;
+
+    arg->share();
+    states[tmp] = arg;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTable::promote( int dim, Operator **root ){
+
+    int run1, run2;
+
+    CountMap                counter;
+    std::vector<Operator*>  order  ;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        countReferences( root[run1], counter, order );
+
+    // INTRODUCE AN INTERMEDIATE STATE FOR EVERY SHARED NODE:
+    // ------------------------------------------------------
+    for( run1 = 0; run1 < (int) order.size(); run1++ ){
+
+        Operator *tmp = order[run1];
+
+        // nodes of previous imports are shared with previous roots:
+        BooleanType isPrevious = BT_FALSE;
+        if( fresh.find( tmp ) == fresh.end() ) isPrevious = BT_TRUE;
+
+        if( ( counter[tmp] > 1 || isPrevious == BT_TRUE ) &&
+            tmp->getNumberOfArguments() > 0 && getIntermediateState( tmp ) == 0 ){
+
+            int ordinal = (int) members.size();
+
+            states[tmp] = new TreeProjection( tmp->share() );
+            members[states[tmp]] = ordinal;
+
+            // let the previous nodes refer to the new state as well:
+            if( isPrevious == BT_TRUE ){
+
+                std::pair< ParentMap::iterator, ParentMap::iterator > range = parents.equal_range( tmp );
+                ParentMap::iterator it;
+
+                for( it = range.first; it != range.second; ++it )
+                    for( run2 = 0; run2 < it->second->getNumberOfArguments(); run2++ )
+                        if( it->second->getArgumentPointer(run2) == tmp )
+                            it->second->setArgumentPointer( run2, states[tmp]->share() );
+            }
+        }
+    }
+
+    // LET THE NEW NODES REFER TO THE INTERMEDIATE STATES:
+    // ---------------------------------------------------
+    for( run1 = 0; run1 < (int) order.size(); run1++ ){
+
+        Operator *tmp = order[run1];
+
+        if( fresh.find( tmp ) == fresh.end() ) continue;
+
+        for( run2 = 0; run2 < tmp->getNumberOfArguments(); run2++ ){
+
+            TreeProjection *state = getIntermediateState( tmp->getArgumentPointer(run2) );
+
+            if( state != 0 )
+                tmp->setArgumentPointer( run2, state->share() );
+        }
+    }
+
+    return substituteIntermediateStates( dim, root );
+}
+
+
+returnValue OperatorTable::substituteIntermediateStates( int dim, Operator **root ) const{
+
+    int run1;
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        TreeProjection *state = getIntermediateState( root[run1] );
+
+        if( state != 0 ){
+            Operator::release( root[run1] );
+            root[run1] = state->share();
+        }
+    }
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+BooleanType OperatorTable::isSharingPreviousNodes( int dim, Operator **root ) const{
+
+    int run1;
+    CountMap visited;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( findPreviousNode( root[run1], visited ) == BT_TRUE )
+            return BT_TRUE;
+
+    return BT_FALSE;
+}
+
+
+returnValue OperatorTable::convertToHornerForm( int dim, Operator **root ){
+
+    int run1;
+
+    MemoMap hornerMemo;
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        Operator *tmp = hornerize( root[run1], hornerMemo );
+        Operator::release( root[run1] );
+        root[run1] = tmp;
+    }
+
+    MemoMap::iterator it;
+    for( it = hornerMemo.begin(); it != hornerMemo.end(); ++it )
+        Operator::release( it->second );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* OperatorTable::differentiate( Operator *node, int index ){
+
+    DerivativeKey key( node, index );
+    DerivativeMap::iterator it = derivatives.find( key );
+
+    if( it != derivatives.end() )
+        return it->second->share();
+
+    Operator *result = applyChainRule( node, index );
+    if( result == 0 ) return 0;
+
+    derivatives[key] = result->share();
+    return result;
+}
+
+
+returnValue OperatorTable::write( FILE *file, int dim, Operator **root ) const{
+
+    int run1;
+
+    CountMap                id   ;
+    std::vector<Operator*>  order;
+
+    for( run1 = 0; run1 < dim; run1++ )
+        if( collect( root[run1], id, order ) != SUCCESSFUL_RETURN )
+            return ACADOERROR(RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS);
+
+    // THE MEMOIZED DERIVATIVES OF THE WRITTEN NODES ARE WRITTEN AS WELL:
+    // -------------------------------------------------------------------
+    // (the variable indices are assigned again after reading, so the
+    //  derivatives refer to the node of their variable instead)
+    std::map< int, int > variable;
+
+    for( run1 = 0; run1 < (int) order.size(); run1++ )
+        if( order[run1]->getName() == ON_VARIABLE && order[run1]->passArgument() == 0 )
+            variable[ ((Projection*)order[run1])->getVariableIndex() ] = run1;
+
+    DerivativeMap::const_iterator it;
+    int nOld = -1;
+
+    // derivatives may be differentiated again, i.e. their derivatives
+    // have to be written once the derivatives themselves are written:
+    while( nOld != (int) order.size() ){
+
+        nOld = (int) order.size();
+
+        for( it = derivatives.begin(); it != derivatives.end(); ++it )
+            if( id.find( it->first.first ) != id.end() &&
+                variable.find( it->first.second ) != variable.end() )
+                collect( it->second, id, order );
+    }
+
+    std::vector<int> derivative;
+
+    for( it = derivatives.begin(); it != derivatives.end(); ++it ){
+
+        CountMap::const_iterator node = id.find( it->first.first );
+        CountMap::const_iterator dnode = id.find( it->second );
+
+        if( node == id.end() || dnode == id.end() ||
+            variable.find( it->first.second ) == variable.end() )
+            continue;
+
+        derivative.push_back( node->second );
+        derivative.push_back( variable[ it->first.second ] );
+        derivative.push_back( dnode->second );
+    }
+
+    int header[4];
+    header[0] = OT_FILE_VERSION;
+    header[1] = (int) order.size();
+    header[2] = dim;
+    header[3] = (int) derivative.size()/3;
+
+    if( fwrite( header, sizeof(int), 4, file ) != 4 )
+        return ACADOERROR(RET_CAN_NOT_WRITE_INTO_FILE);
+
+    // ONE RECORD PER NODE, ARGUMENTS ARE WRITTEN FIRST:
+    // -------------------------------------------------
+    for( run1 = 0; run1 < (int) order.size(); run1++ ){
+
+        Operator *tmp = order[run1];
+
+        int    record[5] = { tmp->getName(), 0, 0, -1, -1 };
+        double value     = 0.0;
+
+        switch( record[0] ){
+
+            case ON_DOUBLE_CONSTANT:
+                 record[1] = tmp->isOneOrZero();
+                 value     = tmp->getValue();
+                 break;
+
+            case ON_VARIABLE:
+                 record[1] = ((Projection*)tmp)->getType();
+                 record[2] = tmp->getGlobalIndex();
+                 value     = ((Projection*)tmp)->getScale();
+                 if( tmp->passArgument() != 0 ){
+                     record[2] = ((TreeProjection*)tmp)->isHoisted();
+                     record[3] = id.find( tmp->passArgument() )->second;
+                 }
+                 break;
+
+            case ON_POWER_INT:
+                 record[2] = ((Power_Int*)tmp)->getExponent();
+                 record[3] = id.find( tmp->getArgumentPointer(0) )->second;
+                 break;
+
+            default:
+                 record[3] = id.find( tmp->getArgumentPointer(0) )->second;
+                 if( tmp->getNumberOfArguments() > 1 )
+                     record[4] = id.find( tmp->getArgumentPointer(1) )->second;
+                 break;
+        }
+
+        if( fwrite( record, sizeof(int), 5, file ) != 5 ||
+            fwrite( &value, sizeof(double), 1, file ) != 1 )
+            return ACADOERROR(RET_CAN_NOT_WRITE_INTO_FILE);
+    }
+
+    for( run1 = 0; run1 < dim; run1++ ){
+
+        int idx = id.find( root[run1] )->second;
+
+        if( fwrite( &idx, sizeof(int), 1, file ) != 1 )
+            return ACADOERROR(RET_CAN_NOT_WRITE_INTO_FILE);
+    }
+
+    // (node, variable, derivative) per memoized derivative:
+    if( derivative.empty() == false &&
+        fwrite( &derivative[0], sizeof(int), derivative.size(), file ) != derivative.size() )
+        return ACADOERROR(RET_CAN_NOT_WRITE_INTO_FILE);
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTable::read( FILE *file, int &dim, Operator **&root ){
+
+    int run1;
+    int header[4];
+
+    if( fread( header, sizeof(int), 4, file ) != 4 ||
+        header[0] != OT_FILE_VERSION || header[1] < 0 || header[2] < 0 || header[3] < 0 )
+        return ACADOERROR(RET_FILE_HAS_NO_VALID_ENTRIES);
+
+    std::vector<Operator*> node( header[1], (Operator*)0 );
+    returnValue returnvalue = SUCCESSFUL_RETURN;
+
+    for( run1 = 0; run1 < header[1]; run1++ ){
+
+        int    record[5];
+        double value;
+
+        if( fread( record, sizeof(int), 5, file ) != 5 ||
+            fread( &value, sizeof(double), 1, file ) != 1 ||
+            record[3] >= run1 || record[4] >= run1 ||
+            ( record[3] < 0 && record[0] != ON_DOUBLE_CONSTANT && record[0] != ON_VARIABLE ) ||
+            ( record[0] == ON_VARIABLE && ( record[1] < 0 || record[1] >= VT_UNKNOWN ) ) ||
+            ( record[0] == ON_VARIABLE && record[3] < 0 && record[2] < 0 ) ){
+
+            returnvalue = ACADOERROR(RET_FILE_HAS_NO_VALID_ENTRIES);
+            break;
+        }
+
+        Operator *a = 0, *b = 0;
+        if( record[3] >= 0 ) a = node[record[3]]->share();
+        if( record[4] >= 0 ) b = node[record[4]]->share();
+
+        node[run1] = create( record, value, a, b );
+
+        if( node[run1] == 0 ){
+
+            Operator::release( a );
+            Operator::release( b );
+            returnvalue = ACADOERROR(RET_FILE_HAS_NO_VALID_ENTRIES);
+            break;
+        }
+    }
+
+    dim  = 0;
+    root = 0;
+
+    if( returnvalue == SUCCESSFUL_RETURN ){
+
+        root = (Operator**)calloc( header[2], sizeof(Operator*) );
+
+        for( dim = 0; dim < header[2]; dim++ ){
+
+            int idx;
+
+            if( fread( &idx, sizeof(int), 1, file ) != 1 || idx < 0 || idx >= header[1] ){
+                returnvalue = ACADOERROR(RET_FILE_HAS_NO_VALID_ENTRIES);
+                break;
+            }
+            root[dim] = node[idx]->share();
+        }
+    }
+
+    // the derivatives are kept until the variables have been enumerated:
+    for( run1 = 0; run1 < header[3] && returnvalue == SUCCESSFUL_RETURN; run1++ ){
+
+        int record[3];
+
+        if( fread( record, sizeof(int), 3, file ) != 3 ||
+            record[0] < 0 || record[0] >= header[1] ||
+            record[1] < 0 || record[1] >= header[1] ||
+            record[2] < 0 || record[2] >= header[1] ||
+            node[record[1]]->getName() != ON_VARIABLE || node[record[1]]->passArgument() != 0 ){
+
+            returnvalue = ACADOERROR(RET_FILE_HAS_NO_VALID_ENTRIES);
+            break;
+        }
+
+        importedDerivatives.push_back( node[record[0]]->share() );
+        importedDerivatives.push_back( node[record[1]]->share() );
+        importedDerivatives.push_back( node[record[2]]->share() );
+    }
+
+    for( run1 = 0; run1 < header[1]; run1++ )
+        Operator::release( node[run1] );
+
+    endImport();
+    return returnvalue;
+}
+
+
+returnValue OperatorTable::restoreDerivatives(){
+
+    int run1;
+
+    for( run1 = 0; run1 < (int) importedDerivatives.size(); run1 += 3 ){
+
+        Operator *node       = importedDerivatives[run1  ];
+        Operator *variable   = importedDerivatives[run1+1];
+        Operator *derivative = importedDerivatives[run1+2];
+
+        DerivativeKey key( node, ((Projection*)variable)->getVariableIndex() );
+
+        if( key.second >= 0 && derivatives.find( key ) == derivatives.end() )
+            derivatives[key] = derivative;
+        else
+            Operator::release( derivative );
+
+        Operator::release( variable );
+        Operator::release( node     );
+    }
+
+    importedDerivatives.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTable::endImport(){
+
+    MemoMap::iterator it;
+
+    for( it = memo.begin(); it != memo.end(); ++it )
+        Operator::release( it->second );
+
+    memo.clear();
+    fresh.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+returnValue OperatorTable::clear(){
+
+    int run1;
+
+    endImport();
+
+    StateMap::iterator      it1;
+    NodeMap::iterator       it2;
+    DerivativeMap::iterator it3;
+
+    for( it3 = derivatives.begin(); it3 != derivatives.end(); ++it3 )
+        Operator::release( it3->second );
+
+    for( it1 = states.begin(); it1 != states.end(); ++it1 )
+        Operator::release( it1->second );
+
+    for( it2 = nodes.begin(); it2 != nodes.end(); ++it2 )
+        Operator::release( it2->second );
+
+    for( run1 = 0; run1 < (int) importedDerivatives.size(); run1++ )
+        Operator::release( importedDerivatives[run1] );
+
+    importedDerivatives.clear();
+    derivatives.clear();
+    states.clear();
+    nodes.clear();
+    members.clear();
+    parents.clear();
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+int OperatorTable::getNumberOfNodes() const{
+
+    return (int) nodes.size();
+}
+
+
+
+OperatorTable::NodeMap* OperatorTable::expressionNodes = 0;
+volatile long           OperatorTable::expressionLock  = 0;
+
+
+Operator* OperatorTable::shareExpression( const Operator *arg ){
+
+    if( arg == 0 ) return 0;
+
+    MemoMap expressionMemo;
+    Operator *result = shareExpression( arg, expressionMemo );
+
+    MemoMap::iterator it;
+    for( it = expressionMemo.begin(); it != expressionMemo.end(); ++it )
+        Operator::release( it->second );
+
+    return result;
+}
+
+
+void OperatorTable::shareExpressionNode( Operator *arg ){
+
+    acadoLock( &expressionLock );
+    arg->nCount++;
+    acadoUnlock( &expressionLock );
+}
+
+
+BooleanType OperatorTable::releaseExpressionNode( Operator *arg ){
+
+    acadoLock( &expressionLock );
+
+    if( arg->nCount > 0 ){
+        arg->nCount--;
+        acadoUnlock( &expressionLock );
+        return BT_FALSE;
+    }
+
+    // the last owner is gone, i.e. the node must not be found anymore:
+    int    type  = 0  ;
+    int    index = 0  ;
+    double value = 0.0;
+
+    arg->getHashKey( type, index, value );
+
+    OperatorKey key( arg->getName(), type, index, value,
+                     arg->getArgumentPointer(0), arg->getArgumentPointer(1) );
+
+    NodeMap::iterator it = expressionNodes->find( key );
+    if( it != expressionNodes->end() && it->second == arg )
+        expressionNodes->erase( it );
+
+    arg->isUnique = BT_FALSE;
+
+    acadoUnlock( &expressionLock );
+    return BT_TRUE;
+}
+
+
+int OperatorTable::getNumberOfExpressionNodes(){
+
+    int result = 0;
+
+    acadoLock( &expressionLock );
+    if( expressionNodes != 0 ) result = (int) expressionNodes->size();
+    acadoUnlock( &expressionLock );
+
+    return result;
+}
+
+
+
+//
+// PROTECTED MEMBER FUNCTIONS:
+//
+
+void OperatorTable::countReferences( Operator *arg, CountMap &counter, std::vector<Operator*> &order ){
+
+    CountMap::iterator it = counter.find( arg );
+
+    if( it != counter.end() ){
+        it->second++;
+        return;
+    }
+
+    counter[arg] = 1;
+    order.push_back( arg );
+
+    // nodes of previous imports are not modified anymore:
+    if( fresh.find( arg ) == fresh.end() ) return;
+
+    int run1;
+    for( run1 = 0; run1 < arg->getNumberOfArguments(); run1++ )
+        countReferences( arg->getArgumentPointer(run1), counter, order );
+
+    Operator *tmp = arg->passArgument();
+    if( tmp != 0 ) countReferences( tmp, counter, order );
+}
+
+
+Operator* OperatorTable::simplify( Operator *node, int type ){
+
+    int nArgs = node->getNumberOfArguments();
+    OperatorName name = node->getName();
+
+    if( nArgs == 0 || ( name > ON_QUOTIENT && name != ON_NEGATION ) )
+        return 0;
+
+    Operator *a = node->getArgumentPointer(0);
+    Operator *b = 0;
+    Operator *result = 0;
+
+    if( nArgs > 1 ) b = node->getArgumentPointer(1);
+
+
+    // FOLD OPERATORS WITH CONSTANT ARGUMENTS:
+    // ---------------------------------------
+    if( isConstant( a ) == BT_TRUE && ( b == 0 || isConstant( b ) == BT_TRUE ) ){
+
+        double value;
+        node->evaluate( 0, 0, &value );
+
+        Operator::release( node );
+        return constant( value );
+    }
+
+
+    // APPLY ALGEBRAIC IDENTITIES:
+    // ---------------------------
+    switch( name ){
+
+        case ON_ADDITION:
+             if( a->isOneOrZero() == NE_ZERO )    result = b->share();
+             else if( b->isOneOrZero() == NE_ZERO )    result = a->share();
+             else if( isNegation( b ) == BT_TRUE )     result = unique( new Subtraction( a->share(), b->getArgumentPointer(0)->share() ) );
+             else if( isNegation( a ) == BT_TRUE )     result = unique( new Subtraction( b->share(), a->getArgumentPointer(0)->share() ) );
+             break;
+
+        case ON_SUBTRACTION:
+             if( b->isOneOrZero() == NE_ZERO )         result = a->share();
+             else if( isNegation( b ) == BT_TRUE ){
+                 if( a->isOneOrZero() == NE_ZERO )     result = b->getArgumentPointer(0)->share();
+                 else                                  result = unique( new Addition( a->share(), b->getArgumentPointer(0)->share() ) );
+             }
+             else if( a->isOneOrZero() == NE_ZERO )    result = unique( new Negation( b->share() ) );
+             break;
+
+        case ON_NEGATION:
+             if( isNegation( a ) == BT_TRUE )          result = a->getArgumentPointer(0)->share();
+             break;
+
+        case ON_PRODUCT:
+             if( a->isOneOrZero() == NE_ONE )          result = b->share();
+             else if( b->isOneOrZero() == NE_ONE )     result = a->share();
+             else if( isConstant( a ) == BT_TRUE && acadoIsEqual( a->getValue(), -1.0 ) == BT_TRUE )
+                  result = unique( new Negation( b->share() ) );
+             else if( isConstant( b ) == BT_TRUE && acadoIsEqual( b->getValue(), -1.0 ) == BT_TRUE )
+                  result = unique( new Negation( a->share() ) );
+             else if( isNegation( a ) == BT_TRUE && isNegation( b ) == BT_TRUE )
+                  result = unique( new Product( a->getArgumentPointer(0)->share(),
+                                                b->getArgumentPointer(0)->share() ) );
+             else if( isNegation( a ) == BT_TRUE )
+                  result = negate( new Product( a->getArgumentPointer(0)->share(), b->share() ) );
+             else if( isNegation( b ) == BT_TRUE )
+                  result = negate( new Product( a->share(), b->getArgumentPointer(0)->share() ) );
+             break;
+
+        case ON_QUOTIENT:
+             if( b->isOneOrZero() == NE_ONE )          result = a->share();
+             else if( isConstant( b ) == BT_TRUE && acadoIsEqual( b->getValue(), -1.0 ) == BT_TRUE )
+                  result = unique( new Negation( a->share() ) );
+             else if( isNegation( a ) == BT_TRUE && isNegation( b ) == BT_TRUE )
+                  result = unique( new Quotient( a->getArgumentPointer(0)->share(),
+                                                 b->getArgumentPointer(0)->share() ) );
+             else if( isNegation( a ) == BT_TRUE )
+                  result = negate( new Quotient( a->getArgumentPointer(0)->share(), b->share() ) );
+             else if( isNegation( b ) == BT_TRUE )
+                  result = negate( new Quotient( a->share(), b->getArgumentPointer(0)->share() ) );
+             break;
+
+        case ON_POWER:
+             if( b->isOneOrZero() == NE_ONE )          result = a->share();
+             break;
+
+        case ON_POWER_INT:
+             if( type == 1 )                           result = a->share();
+             break;
+
+        default:
+             break;
+    }
+
+    if( result != 0 ){
+        Operator::release( node );
+        return result;
+    }
+
+
+    // SORT THE ARGUMENTS OF COMMUTATIVE OPERATORS (CONSTANTS FIRST):
+    // ---------------------------------------------------------------
+    if( ( name == ON_ADDITION || name == ON_PRODUCT ) && isOrdered( a, b ) == BT_FALSE ){
+
+        a->share();
+        b->share();
+        node->setArgumentPointer( 0, b );
+        node->setArgumentPointer( 1, a );
+    }
+
+    return 0;
+}
+
+
+Operator* OperatorTable::applyChainRule( Operator *node, int index ){
+
+    int nArgs = node->getNumberOfArguments();
+
+    // LEAVES AND INTERMEDIATE STATES:
+    // -------------------------------
+    if( nArgs == 0 ){
+
+        if( node->passArgument() != 0 )
+            return differentiate( node->passArgument(), index );
+
+        // C functions cannot be differentiated symbolically:
+        if( node->getName() == ON_CEXPRESSION )
+            return 0;
+
+        Operator *tmp = node->differentiate( index );
+
+        if( tmp == 0 || isConstant( tmp ) == BT_FALSE ){
+            Operator::release( tmp );
+            return 0;
+        }
+
+        double value = tmp->getValue();
+
+        Operator::release( tmp );
+        return constant( value );
+    }
+
+    Operator *a  = node->getArgumentPointer(0);
+    Operator *b  = 0;
+    Operator *da = differentiate( a, index );
+    Operator *db = 0;
+
+    if( da == 0 )
+        return 0;
+
+    if( nArgs > 1 ){
+        b  = node->getArgumentPointer(1);
+        db = differentiate( b, index );
+
+        if( db == 0 ){
+            Operator::release( da );
+            return 0;
+        }
+    }
+
+    Operator *result = 0;
+    int n;
+
+    switch( node->getName() ){
+
+        case ON_ADDITION:
+             return unique( new Addition( da, db ) );
+
+        case ON_SUBTRACTION:
+             return unique( new Subtraction( da, db ) );
+
+        case ON_PRODUCT:
+             return unique( new Addition( multiply( da, b->share() ),
+                                          multiply( a->share(), db ) ) );
+
+        case ON_QUOTIENT:
+             return unique( new Subtraction( divide( da, b->share() ),
+                                             divide( multiply( a->share(), db ),
+                                                     unique( new Power_Int( b->share(), 2 ), 2 ) ) ) );
+
+        case ON_POWER:
+             result = unique( new Power( a->share(), unique( new Addition( b->share(), constant( -1.0 ) ) ) ) );
+             return unique( new Addition( multiply( multiply( b->share(), result ), da ),
+                                          multiply( node->share(),
+                                                    multiply( db, unique( new Logarithm( a->share() ) ) ) ) ) );
+
+        case ON_POWER_INT:
+             n = ((Power_Int*)node)->getExponent();
+             if( n == 0 ){
+                 Operator::release( da );
+                 return constant( 0.0 );
+             }
+             if( n == 1 ) return da;
+             result = unique( new Power_Int( a->share(), n-1 ), n-1 );
+             return multiply( multiply( constant( (double) n ), result ), da );
+
+        case ON_SIN:
+             return multiply( da, unique( new Cos( a->share() ) ) );
+
+        case ON_COS:
+             return unique( new Negation( multiply( da, unique( new Sin( a->share() ) ) ) ) );
+
+        case ON_TAN:
+             return divide( da, unique( new Power_Int( unique( new Cos( a->share() ) ), 2 ), 2 ) );
+
+        case ON_ASIN:
+        case ON_ACOS:
+             result = unique( new Subtraction( constant( 1.0 ),
+                                               unique( new Power_Int( a->share(), 2 ), 2 ) ) );
+             result = multiply( da, unique( new Power( result, constant( -0.5 ) ) ) );
+             if( node->getName() == ON_ASIN ) return result;
+             return unique( new Negation( result ) );
+
+        case ON_ATAN:
+             return divide( da, unique( new Addition( constant( 1.0 ),
+                                                      unique( new Power_Int( a->share(), 2 ), 2 ) ) ) );
+
+        case ON_LOGARITHM:
+             return divide( da, a->share() );
+
+        case ON_EXP:
+             return multiply( da, node->share() );
+
+        case ON_NEGATION:
+             return unique( new Negation( da ) );
+
+        default:
+             break;
+    }
+
+    Operator::release( da );
+    Operator::release( db );
+    return 0;
+}
+
+
+Operator* OperatorTable::multiply( Operator *a, Operator *b ){
+
+    if( a->isOneOrZero() == NE_ZERO || b->isOneOrZero() == NE_ZERO ){
+
+        Operator::release( a );
+        Operator::release( b );
+        return constant( 0.0 );
+    }
+
+    return unique( new Product( a, b ) );
+}
+
+
+Operator* OperatorTable::divide( Operator *a, Operator *b ){
+
+    if( a->isOneOrZero() == NE_ZERO ){
+
+        Operator::release( a );
+        Operator::release( b );
+        return constant( 0.0 );
+    }
+
+    return unique( new Quotient( a, b ) );
+}
+
+
+Operator* OperatorTable::constant( double value ){
+
+    NeutralElement ne = NE_NEITHER_ONE_NOR_ZERO;
+
+    if( isExactlyEqual( value,0.0 ) == BT_TRUE ) ne = NE_ZERO;
+    if( isExactlyEqual( value,1.0 ) == BT_TRUE ) ne = NE_ONE ;
+
+    return unique( new DoubleConstant( value, ne ), ne, 0, value );
+}
+
+
+Operator* OperatorTable::negate( Operator *node ){
+
+    return unique( new Negation( unique( node ) ) );
+}
+
+
+BooleanType OperatorTable::isConstant( Operator *arg ) const{
+
+    if( arg->getName() == ON_DOUBLE_CONSTANT ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+BooleanType OperatorTable::isNegation( Operator *arg ) const{
+
+    if( arg->getName() == ON_NEGATION ) return BT_TRUE;
+    return BT_FALSE;
+}
+
+
+BooleanType OperatorTable::isOrdered( Operator *a, Operator *b ) const{
+
+    if( isConstant( a ) == BT_TRUE ) return BT_TRUE ;
+    if( isConstant( b ) == BT_TRUE ) return BT_FALSE;
+
+    CountMap::const_iterator it1 = members.find( a );
+    CountMap::const_iterator it2 = members.find( b );
+
+    if( it1 == members.end() || it2 == members.end() ) return BT_TRUE;
+    if( it2->second < it1->second ) return BT_FALSE;
+
+    return BT_TRUE;
+}
+
+
+returnValue OperatorTable::collect( Operator *arg, CountMap &id, std::vector<Operator*> &order ) const{
+
+    if( id.find( arg ) != id.end() ) return SUCCESSFUL_RETURN;
+
+    if( arg->isSymbolic() == BT_FALSE ||
+        ( arg->getName() > ON_DOUBLE_CONSTANT && arg->getName() != ON_NEGATION ) )
+        return RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS;
+
+    int run1;
+    for( run1 = 0; run1 < arg->getNumberOfArguments(); run1++ )
+        if( collect( arg->getArgumentPointer(run1), id, order ) != SUCCESSFUL_RETURN )
+            return RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS;
+
+    Operator *tmp = arg->passArgument();
+    if( tmp != 0 && collect( tmp, id, order ) != SUCCESSFUL_RETURN )
+        return RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS;
+
+    id[arg] = (int) order.size();
+    order.push_back( arg );
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* OperatorTable::create( const int *record, double value, Operator *a, Operator *b ){
+
+    if( record[0] == ON_DOUBLE_CONSTANT )
+        return unique( new DoubleConstant( value, (NeutralElement) record[1] ), record[1], 0, value );
+
+    if( record[0] == ON_VARIABLE ){
+
+        if( a != 0 ){
+            TreeProjection *state = new TreeProjection( a, (BooleanType) record[2] );
+            Operator *result = unique( state, VT_INTERMEDIATE_STATE, state->getGlobalIndex() );
+            addIntermediateState( (TreeProjection*)result );
+            return result;
+        }
+
+        Projection *tmp = new Projection( (VariableType) record[1], record[2], "" );
+        tmp->setScale( value );
+        return unique( tmp, record[1], record[2], value );
+    }
+
+    if( a == 0 ) return 0;
+
+    if( record[0] == ON_POWER_INT )
+        return unique( new Power_Int( a, record[2] ), record[2] );
+
+    if( b == 0 ) switch( record[0] ){
+
+        case ON_SIN:        return unique( new Sin      ( a ) );
+        case ON_COS:        return unique( new Cos      ( a ) );
+        case ON_TAN:        return unique( new Tan      ( a ) );
+        case ON_ASIN:       return unique( new Asin     ( a ) );
+        case ON_ACOS:       return unique( new Acos     ( a ) );
+        case ON_ATAN:       return unique( new Atan     ( a ) );
+        case ON_LOGARITHM:  return unique( new Logarithm( a ) );
+        case ON_EXP:        return unique( new Exp      ( a ) );
+        case ON_NEGATION:   return unique( new Negation ( a ) );
+        default:            break;
+    }
+
+    if( b == 0 ) return 0;
+
+    switch( record[0] ){
+
+        case ON_ADDITION:    return unique( new Addition   ( a, b ) );
+        case ON_SUBTRACTION: return unique( new Subtraction( a, b ) );
+        case ON_PRODUCT:     return unique( new Product    ( a, b ) );
+        case ON_QUOTIENT:    return unique( new Quotient   ( a, b ) );
+        case ON_POWER:       return unique( new Power      ( a, b ) );
+        default:             break;
+    }
+
+    return 0;
+}
+
+
+BooleanType OperatorTable::findPreviousNode( Operator *arg, CountMap &visited ) const{
+
+    if( visited.find( arg ) != visited.end() ) return BT_FALSE;
+    visited[arg] = 1;
+
+    if( fresh.find( arg ) == fresh.end() ){
+
+        if( arg->getNumberOfArguments() > 0 && getIntermediateState( arg ) == 0 )
+            return BT_TRUE;
+
+        return BT_FALSE;
+    }
+
+    int run1;
+    for( run1 = 0; run1 < arg->getNumberOfArguments(); run1++ )
+        if( findPreviousNode( arg->getArgumentPointer(run1), visited ) == BT_TRUE )
+            return BT_TRUE;
+
+    Operator *tmp = arg->passArgument();
+    if( tmp != 0 ) return findPreviousNode( tmp, visited );
+
+    return BT_FALSE;
+}
+
+
+Operator* OperatorTable::hornerize( Operator *node, MemoMap &hornerMemo ){
+
+    MemoMap::iterator it = hornerMemo.find( node );
+    if( it != hornerMemo.end() ) return it->second->share();
+
+    Operator *result = 0;
+
+    if( isPolynomialNode( node ) == BT_TRUE ){
+
+        // COLLECT THE LEAVES AND THE COEFFICIENTS OF THE POLYNOMIAL:
+        // ----------------------------------------------------------
+        CountMap               atom, visited;
+        std::vector<Operator*> order;
+
+        int cost = collectMonomials( node, atom, order, visited );
+
+        Polynomial    p;
+        PolynomialMap expandMemo;
+
+        if( expand( node, atom, (int) order.size(), p, expandMemo ) == BT_TRUE ){
+
+            int hornerCost = 0;
+            buildHorner( p, 0, hornerCost );
+
+            if( hornerCost < cost ){
+
+                int run1;
+                Operator **converted = (Operator**)calloc(order.size()+1,sizeof(Operator*));
+
+                for( run1 = 0; run1 < (int) order.size(); run1++ )
+                    converted[run1] = hornerize( order[run1], hornerMemo );
+
+                result = buildHorner( p, converted, hornerCost );
+
+                for( run1 = 0; run1 < (int) order.size(); run1++ )
+                    Operator::release( converted[run1] );
+                free( converted );
+            }
+        }
+    }
+
+    if( result == 0 )
+        result = hornerizeArguments( node, hornerMemo );
+
+    hornerMemo[node] = result->share();
+    return result;
+}
+
+
+Operator* OperatorTable::hornerizeArguments( Operator *node, MemoMap &hornerMemo ){
+
+    int nArgs = node->getNumberOfArguments();
+
+    if( nArgs == 0 || nArgs > 2 )
+        return node->share();
+
+    Operator *a = hornerize( node->getArgumentPointer(0), hornerMemo );
+    Operator *b = 0;
+
+    if( nArgs > 1 ) b = hornerize( node->getArgumentPointer(1), hornerMemo );
+
+    if( a == node->getArgumentPointer(0) && ( b == 0 || b == node->getArgumentPointer(1) ) ){
+
+        Operator::release( a );
+        if( b != 0 ) Operator::release( b );
+        return node->share();
+    }
+
+    int record[5] = { node->getName(), 0, 0, -1, -1 };
+
+    if( record[0] == ON_POWER_INT )
+        record[2] = ((Power_Int*)node)->getExponent();
+
+    Operator *result = create( record, 0.0, a, b );
+
+    if( result == 0 ){
+        Operator::release( a );
+        if( b != 0 ) Operator::release( b );
+        return node->share();
+    }
+
+    return result;
+}
+
+
+int OperatorTable::getPolynomialExponent( Operator *node ) const{
+
+    int exponent = -1;
+
+    if( node->getName() == ON_POWER_INT )
+        exponent = ((Power_Int*)node)->getExponent();
+
+    if( node->getName() == ON_POWER ){
+
+        Operator *b = node->getArgumentPointer(1);
+
+        if( isConstant( b ) == BT_TRUE && isExactlyEqual( b->getValue(),floor( b->getValue() ) ) == BT_TRUE &&
+            b->getValue() >= 0.0 && b->getValue() <= OT_HORNER_MAX_EXPONENT )
+            exponent = (int) b->getValue();
+    }
+
+    if( exponent > OT_HORNER_MAX_EXPONENT )
+        return -1;
+
+    return exponent;
+}
+
+
+BooleanType OperatorTable::isPolynomialNode( Operator *node ) const{
+
+    switch( node->getName() ){
+
+        case ON_ADDITION   :
+        case ON_SUBTRACTION:
+        case ON_PRODUCT    :
+        case ON_NEGATION   : return BT_TRUE;
+
+        case ON_POWER_INT  :
+        case ON_POWER      :
+             if( getPolynomialExponent( node ) >= 0 ) return BT_TRUE;
+             return BT_FALSE;
+
+        default: return BT_FALSE;
+    }
+}
+
+
+int OperatorTable::collectMonomials( Operator *node, CountMap &atom, std::vector<Operator*> &order,
+                                     CountMap &visited ) const{
+
+    if( visited.find( node ) != visited.end() ) return 0;
+    visited[node] = 1;
+
+    if( isConstant( node ) == BT_TRUE ) return 0;
+
+    if( isPolynomialNode( node ) == BT_FALSE ){
+
+        atom[node] = (int) order.size();
+        order.push_back( node );
+        return 0;
+    }
+
+    int cost = 1;
+
+    switch( node->getName() ){
+
+        case ON_POWER_INT: cost = OT_COST_POWER_INT; break;
+        case ON_POWER    : cost = OT_COST_POWER    ; break;
+        default          : break;
+    }
+
+    cost += collectMonomials( node->getArgumentPointer(0), atom, order, visited );
+
+    if( node->getNumberOfArguments() > 1 && node->getName() != ON_POWER_INT && node->getName() != ON_POWER )
+        cost += collectMonomials( node->getArgumentPointer(1), atom, order, visited );
+
+    return cost;
+}
+
+
+BooleanType OperatorTable::expand( Operator *node, const CountMap &atom, int nAtoms,
+                                   Polynomial &p, PolynomialMap &expandMemo ) const{
+
+    int run1;
+
+    // (shared nodes are expanded once, as the DAG may be exponentially
+    //  smaller than the tree)
+    PolynomialMap::const_iterator known = expandMemo.find( node );
+
+    if( known != expandMemo.end() ){
+        p = known->second;
+        return BT_TRUE;
+    }
+
+    p.clear();
+
+    if( isConstant( node ) == BT_TRUE ){
+
+        if( isExactlyEqual( node->getValue(),0.0 ) == BT_FALSE )
+            p[ std::vector<int>( nAtoms, 0 ) ] = node->getValue();
+        return BT_TRUE;
+    }
+
+    if( isPolynomialNode( node ) == BT_FALSE ){
+
+        std::vector<int> exponent( nAtoms, 0 );
+        exponent[ atom.find( node )->second ] = 1;
+        p[exponent] = 1.0;
+        return BT_TRUE;
+    }
+
+    Polynomial a, b;
+    Polynomial::iterator it;
+
+    if( expand( node->getArgumentPointer(0), atom, nAtoms, a, expandMemo ) == BT_FALSE )
+        return BT_FALSE;
+
+    switch( node->getName() ){
+
+        case ON_ADDITION   :
+        case ON_SUBTRACTION:
+
+             if( expand( node->getArgumentPointer(1), atom, nAtoms, b, expandMemo ) == BT_FALSE )
+                 return BT_FALSE;
+
+             p = a;
+             for( it = b.begin(); it != b.end(); ++it ){
+
+                 if( node->getName() == ON_ADDITION ) p[it->first] += it->second;
+                 else                                 p[it->first] -= it->second;
+
+                 if( isExactlyEqual( p[it->first],0.0 ) == BT_TRUE ) p.erase( it->first );
+             }
+             break;
+
+        case ON_PRODUCT:
+
+             if( expand( node->getArgumentPointer(1), atom, nAtoms, b, expandMemo ) == BT_FALSE )
+                 return BT_FALSE;
+
+             if( multiply( a, b, p ) == BT_FALSE )
+                 return BT_FALSE;
+             break;
+
+        case ON_NEGATION:
+
+             p = a;
+             for( it = p.begin(); it != p.end(); ++it )
+                 it->second = -it->second;
+             break;
+
+        default:
+
+             p[ std::vector<int>( nAtoms, 0 ) ] = 1.0;
+
+             for( run1 = 0; run1 < getPolynomialExponent( node ); run1++ ){
+
+                 b = p;
+                 if( multiply( b, a, p ) == BT_FALSE )
+                     return BT_FALSE;
+             }
+             break;
+    }
+
+    if( (int) p.size() > OT_HORNER_MAX_TERMS )
+        return BT_FALSE;
+
+    expandMemo[node] = p;
+    return BT_TRUE;
+}
+
+
+BooleanType OperatorTable::multiply( const Polynomial &a, const Polynomial &b,
+                                     Polynomial &result ){
+
+    int run1;
+    Polynomial::const_iterator it1, it2;
+
+    result.clear();
+
+    for( it1 = a.begin(); it1 != a.end(); ++it1 ){
+        for( it2 = b.begin(); it2 != b.end(); ++it2 ){
+
+            std::vector<int> exponent( it1->first );
+
+            for( run1 = 0; run1 < (int) exponent.size(); run1++ )
+                exponent[run1] += it2->first[run1];
+
+            result[exponent] += it1->second*it2->second;
+
+            if( isExactlyEqual( result[exponent],0.0 ) == BT_TRUE ) result.erase( exponent );
+        }
+        if( (int) result.size() > OT_HORNER_MAX_TERMS )
+            return BT_FALSE;
+    }
+
+    return BT_TRUE;
+}
+
+
+Operator* OperatorTable::buildHorner( const Polynomial &p, Operator **atom, int &cost ){
+
+    int run1;
+    Polynomial::const_iterator it;
+
+    if( p.empty() == true ){
+        if( atom == 0 ) return 0;
+        return constant( 0.0 );
+    }
+
+    // CHOOSE THE LEAF WHICH OCCURS IN MOST TERMS:
+    // -------------------------------------------
+    const int nAtoms = (int) p.begin()->first.size();
+
+    int best = -1, bestCount = 0;
+
+    for( run1 = 0; run1 < nAtoms; run1++ ){
+
+        int count = 0;
+        for( it = p.begin(); it != p.end(); ++it )
+            if( it->first[run1] > 0 ) count++;
+
+        if( count > bestCount ){
+            best      = run1 ;
+            bestCount = count;
+        }
+    }
+
+    if( best < 0 ){
+        if( atom == 0 ) return 0;
+        return constant( p.begin()->second );
+    }
+
+    // p = sum_k x^k q_k(...) IS EVALUATED AS (q_K x^(K-J) + q_J) x^J ...:
+    // --------------------------------------------------------------------
+    std::map< int, Polynomial > group;
+
+    for( it = p.begin(); it != p.end(); ++it ){
+
+        std::vector<int> exponent( it->first );
+        exponent[best] = 0;
+        group[ it->first[best] ][exponent] = it->second;
+    }
+
+    std::map< int, Polynomial >::reverse_iterator g = group.rbegin();
+
+    Operator *result = buildHorner( g->second, atom, cost );
+    int previous = g->first;
+
+    for( ++g; ; ++g ){
+
+        const int next  = ( g == group.rend() ) ? 0 : g->first;
+        const int power = previous - next;
+
+        if( power > 0 ){
+
+            // small powers are multiplied out:
+            if( power <= OT_HORNER_MAX_PRODUCTS ) cost += power;
+            else                                  cost += 1 + OT_COST_POWER_INT;
+
+            if( atom != 0 ){
+
+                if( power <= OT_HORNER_MAX_PRODUCTS ){
+                    for( run1 = 0; run1 < power; run1++ )
+                        result = multiply( result, atom[best]->share() );
+                }
+                else
+                    result = multiply( result, unique( new Power_Int( atom[best]->share(), power ), power ) );
+            }
+        }
+
+        if( g == group.rend() ) break;
+
+        Operator *q = buildHorner( g->second, atom, cost );
+
+        cost += 1;
+        if( atom != 0 ) result = unique( new Addition( result, q ) );
+
+        previous = next;
+    }
+
+    return result;
+}
+
+
+Operator* OperatorTable::shareExpression( const Operator *arg, MemoMap &expressionMemo ){
+
+    if( arg->isUnique == BT_TRUE )
+        return ((Operator*)arg)->share();
+
+    MemoMap::iterator it = expressionMemo.find( arg );
+    if( it != expressionMemo.end() ) return it->second->share();
+
+    // the key is taken from the copy, as copying may already simplify
+    // the node (e.g. an addition of zero):
+    Operator *node = arg->clone();
+
+    int    type  = 0  ;
+    int    index = 0  ;
+    double value = 0.0;
+
+    if( node->getHashKey( type, index, value ) == BT_FALSE )
+        return node;
+
+    // the arguments are registered first, such that they can be
+    // compared by their addresses:
+    int run1;
+
+    for( run1 = 0; run1 < node->getNumberOfArguments(); run1++ ){
+
+        Operator *tmp = node->getArgumentPointer( run1 );
+
+        if( tmp->isUnique == BT_FALSE )
+            node->setArgumentPointer( run1, shareExpression( tmp, expressionMemo ) );
+    }
+
+    OperatorKey key( node->getName(), type, index, value,
+                     node->getArgumentPointer(0), node->getArgumentPointer(1) );
+
+    Operator *result;
+
+    acadoLock( &expressionLock );
+
+    // allocated on first use and kept until the end of the program, such
+    // that expressions which are destroyed at exit can still be removed:
+    if( expressionNodes == 0 )
+        expressionNodes = new NodeMap;
+
+    NodeMap::iterator it2 = expressionNodes->find( key );
+
+    if( it2 != expressionNodes->end() ){
+        result = it2->second;
+        result->nCount++;
+    }
+    else{
+        expressionNodes->insert( NodeMap::value_type( key, node ) );
+        node->isUnique = BT_TRUE;
+        result = node;
+        node   = 0;
+    }
+
+    acadoUnlock( &expressionLock );
+
+    Operator::release( node );
+
+    expressionMemo[arg] = result->share();
+    return result;
+}
+
+
+TreeProjection* OperatorTable::getIntermediateState( const Operator *arg ) const{
+
+    StateMap::const_iterator it = states.find( arg );
+
+    if( it == states.end() ) return 0;
+    return it->second;
+}
+
+
+CLOSE_NAMESPACE_ACADO
+
+// end of file.
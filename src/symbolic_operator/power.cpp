@@ -92,12 +92,16 @@ returnValue Power::evaluate( EvaluationBase *x ){
 
 Operator* Power::differentiate( int index ){
 
-  dargument1 = argument1->differentiate( index );
-  dargument2 = argument2->differentiate( index );
+  Operator *dargument1 = argument1->differentiate( index );
+  Operator *dargument2 = argument2->differentiate( index );
   if( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
+    release( dargument2 );
     return new Product(
              clone(),
              new Logarithm(
@@ -106,6 +110,8 @@ Operator* Power::differentiate( int index ){
            );
   }
   if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new Product(
              argument2->clone(),
              new Power(
@@ -118,6 +124,8 @@ Operator* Power::differentiate( int index ){
            );
   }
   if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
+    release( dargument2 );
     return new Addition(
              new Product(
                clone(),
@@ -138,10 +146,11 @@ Operator* Power::differentiate( int index ){
            );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
     return new Product(
              clone(),
              new Product(
-               dargument2->clone(),
+               dargument2,
                new Logarithm(
                  argument1->clone()
                )
@@ -149,6 +158,7 @@ Operator* Power::differentiate( int index ){
            );
   }
   if ( dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument2 );
     return new Product(
              argument2->clone(),
              new Product(
@@ -159,16 +169,17 @@ Operator* Power::differentiate( int index ){
                    new DoubleConstant(-1.0, NE_NEITHER_ONE_NOR_ZERO)
                  )
                ),
-               dargument1->clone()
+               dargument1
              )
            );
   }
   if ( dargument1->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
     return new Addition(
              new Product(
                clone(),
                new Product(
-                 dargument2->clone(),
+                 dargument2,
                  new Logarithm(
                    argument1->clone()
                  )
@@ -187,6 +198,7 @@ Operator* Power::differentiate( int index ){
            );
   }
   if ( dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument2 );
     return new Addition(
              new Product(
                clone(),
@@ -204,7 +216,7 @@ Operator* Power::differentiate( int index ){
                      new DoubleConstant(-1.0, NE_NEITHER_ONE_NOR_ZERO)
                    )
                  ),
-                 dargument1->clone()
+                 dargument1
                )
              )
            );
@@ -213,7 +225,7 @@ Operator* Power::differentiate( int index ){
            new Product(
              clone(),
              new Product(
-               dargument2->clone(),
+               dargument2,
                new Logarithm(
                  argument1->clone()
                )
@@ -229,7 +241,7 @@ Operator* Power::differentiate( int index ){
                    new DoubleConstant(-1.0, NE_NEITHER_ONE_NOR_ZERO)
                  )
                ),
-               dargument1->clone()
+               dargument1
              )
            )
          );
@@ -244,20 +256,18 @@ Operator* Power::AD_forward( int dim,
                                int &nNewIS,
                                TreeProjection ***newIS ){
 
-    if( dargument1 != 0 )
-        delete dargument1;
-
-    if( dargument2 != 0 )
-        delete dargument2;
-
-    dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
-    dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
 
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
+        release( dargument2 );
         return new Product(
                  clone(),
                  new Logarithm(
@@ -266,6 +276,8 @@ Operator* Power::AD_forward( int dim,
              );
     }
     if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ZERO ){
+       release( dargument1 );
+       release( dargument2 );
        return new Product(
                 argument2->clone(),
                 new Power(
@@ -278,6 +290,8 @@ Operator* Power::AD_forward( int dim,
             );
     }
     if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
+        release( dargument2 );
         return new Addition(
                  new Product(
                      clone(),
@@ -298,10 +312,11 @@ Operator* Power::AD_forward( int dim,
              );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
         return new Product(
                  clone(),
                  new Product(
-                     dargument2->clone(),
+                     dargument2,
                      new Logarithm(
                          argument1->clone()
                      )
@@ -309,6 +324,7 @@ Operator* Power::AD_forward( int dim,
              );
     }
     if ( dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument2 );
         return new Product(
                  argument2->clone(),
                  new Product(
@@ -319,16 +335,17 @@ Operator* Power::AD_forward( int dim,
                              new DoubleConstant(-1.0, NE_NEITHER_ONE_NOR_ZERO)
                          )
                      ),
-                     dargument1->clone()
+                     dargument1
                  )
              );
     }
     if ( dargument1->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
         return new Addition(
                  new Product(
                      clone(),
                      new Product(
-                         dargument2->clone(),
+                         dargument2,
                          new Logarithm(
                              argument1->clone()
                          )
@@ -347,6 +364,7 @@ Operator* Power::AD_forward( int dim,
             );
     }
     if ( dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument2 );
         return new Addition(
                  new Product(
                      clone(),
@@ -364,7 +382,7 @@ Operator* Power::AD_forward( int dim,
                                  new DoubleConstant(-1.0, NE_NEITHER_ONE_NOR_ZERO)
                              )
                          ),
-                         dargument1->clone()
+                         dargument1
                      )
                  )
             );
@@ -373,7 +391,7 @@ Operator* Power::AD_forward( int dim,
            new Product(
              clone(),
              new Product(
-               dargument2->clone(),
+               dargument2,
                new Logarithm(
                  argument1->clone()
                )
@@ -389,7 +407,7 @@ Operator* Power::AD_forward( int dim,
                    new DoubleConstant(-1.0, NE_NEITHER_ONE_NOR_ZERO)
                  )
                ),
-               dargument1->clone()
+               dargument1
              )
            )
          );
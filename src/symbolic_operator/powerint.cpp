@@ -50,7 +50,6 @@ Power_Int::Power_Int( Operator *_argument, int _exponent ) : SmoothOperator( )
 {
     argument          = _argument                        ;
     exponent          = _exponent                        ;
-    dargument         = NULL                             ;
     argument_result   = (double*)calloc(1,sizeof(double));
     dargument_result  = (double*)calloc(1,sizeof(double));
     bufferSize        = 1                                ;
@@ -68,17 +67,7 @@ Power_Int::Power_Int( const Power_Int &arg ){
     bufferSize       = arg.bufferSize;
     exponent         = arg.exponent;
 
-	argument         = arg.argument->clone();
-	
-// 	argument         = arg.argument;
-// 	argument->nCount++;
-
-    if( arg.dargument == NULL ){
-        dargument = NULL;
-    }
-    else{
-        dargument = arg.dargument->clone();
-    }
+    argument         = arg.argument->share();
 
     argument_result  = (double*)calloc(bufferSize,sizeof(double));
     dargument_result = (double*)calloc(bufferSize,sizeof(double));
@@ -98,58 +87,25 @@ Power_Int::Power_Int( const Power_Int &arg ){
 
 Power_Int::~Power_Int(){
 
- delete argument;
-//     if( argument != 0 ){
-// 
-//         if( argument->nCount == 0 ){
-//             delete argument;
-//             argument = 0;
-//         }
-//         else{
-//             argument->nCount--;
-//         }
-//     }
-
-    if( dargument != NULL ){
-        delete dargument;
-    }
+    release( argument  );
 
     free(  argument_result );
     free( dargument_result );
-
 }
 
 Power_Int& Power_Int::operator=( const Power_Int &arg ){
 
     if( this != &arg ){
 
-	 
-	 delete argument;
-//         if( argument != 0 ){
-// 
-//             if( argument->nCount == 0 ){
-//                 delete argument;
-//                 argument = 0;
-//             }
-//             else{
-//                 argument->nCount--;
-//             }
-//         }
-
-        if( dargument != NULL ){
-            delete dargument;
-        }
+        Operator *tmp = arg.argument->share();
+
+        release( argument  );
 
         free(  argument_result );
         free( dargument_result );
 
-        argument = arg.argument->clone();
-		
-//         argument = arg.argument;
-// 		argument->nCount++;
-
+        argument          = tmp                                ;
         exponent          = arg.exponent                       ;
-        dargument         = NULL                               ;
         bufferSize        = arg.bufferSize                     ;
         argument_result   = (double*)calloc(bufferSize,sizeof(double))  ;
         dargument_result  = (double*)calloc(bufferSize,sizeof(double))  ;
@@ -192,23 +148,25 @@ Operator* Power_Int::differentiate( int index ){
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if ( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
 
   if( exponent == 1 ){
-    return dargument->clone();
+    return dargument;
   }
   
   if( exponent == 2 ){
     return new Product( argument->clone(),
 						new Product( new DoubleConstant( 2.0, NE_NEITHER_ONE_NOR_ZERO ),
-									 dargument->clone() )
+									 dargument )
 						);
   }
   
   if ( dargument->isOneOrZero() == NE_ONE ){
+  release( dargument );
   return new Product(
            new DoubleConstant(
              (double) exponent,
@@ -231,7 +189,7 @@ Operator* Power_Int::differentiate( int index ){
                exponent-1
              )
            ),
-           dargument->clone()
+           dargument
          );
 
 }
@@ -244,31 +202,31 @@ Operator* Power_Int::AD_forward( int dim,
                                    int &nNewIS,
                                    TreeProjection ***newIS ){
 
-	if( dargument != 0 )
-		delete dargument;
-
-	dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+	Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
 	if( exponent == 0 ){
+		release( dargument );
 		return new DoubleConstant( 0.0 , NE_ZERO );
 	}
 	
 	if ( dargument->isOneOrZero() == NE_ZERO ){
+		release( dargument );
 		return new DoubleConstant( 0.0 , NE_ZERO );
 	}
 
 	if( exponent == 1 ){
-		return dargument->clone();
+		return dargument;
 	}
   
 	if( exponent == 2 ){
 		return new Product( argument->clone(),
 							new Product( new DoubleConstant( 2.0, NE_NEITHER_ONE_NOR_ZERO ),
-										 dargument->clone() )
+										 dargument )
 							);
 	}
   
   if ( dargument->isOneOrZero() == NE_ONE ){
+  release( dargument );
   return new Product(
            new DoubleConstant(
              (double) exponent,
@@ -291,7 +249,7 @@ Operator* Power_Int::AD_forward( int dim,
                exponent-1
              )
            ),
-           dargument->clone()
+           dargument
          );
 }
 
@@ -654,6 +612,57 @@ BooleanType Power_Int::isSymbolic() const{
     return BT_TRUE;
 }
 
+
+int Power_Int::getNumberOfArguments() const{
+
+    return 1;
+}
+
+
+Operator* Power_Int::getArgumentPointer( int idx ) const{
+
+    if( idx == 0 ) return argument;
+    return 0;
+}
+
+
+returnValue Power_Int::setArgumentPointer( int idx, Operator *_argument ){
+
+    if( idx != 0 )
+        return Operator::setArgumentPointer( idx, _argument );
+
+    release( argument );
+    argument = _argument;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* Power_Int::hashCons( OperatorTable *table ) const{
+
+    Power_Int *tmp = new Power_Int( *this );
+
+    tmp->setArgumentPointer( 0, table->import( argument ) );
+
+    return table->unique( tmp, exponent );
+}
+
+
+BooleanType Power_Int::getHashKey( int &type, int &index, double &value ) const{
+
+    type  = exponent;
+    index = 0       ;
+    value = 0.0     ;
+
+    return BT_TRUE;
+}
+
+
+int Power_Int::getExponent() const{
+
+    return exponent;
+}
+
 returnValue Power_Int::setVariableExportName( const VariableType &type, const Stream *name )
 {
 	argument->setVariableExportName(type, name);
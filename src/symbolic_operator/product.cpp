@@ -98,61 +98,73 @@ returnValue Product::evaluate( EvaluationBase *x ){
 
 Operator* Product::differentiate( int index ){
 
-  dargument1 = argument1->differentiate( index );
-  dargument2 = argument2->differentiate( index );
+  Operator *dargument1 = argument1->differentiate( index );
+  Operator *dargument2 = argument2->differentiate( index );
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return argument2->clone();
   }
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
+    release( dargument2 );
     return argument1->clone();
   }
   if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
+    release( dargument2 );
     return new Addition(
              argument1->clone(),
              argument2->clone()
            );
   }
   if ( dargument1->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
     return new Addition(
              argument2->clone(),
              new Product(
                argument1->clone(),
-               dargument2->clone()
+               dargument2
              )
            );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
     return new Product(
              argument1->clone(),
-             dargument2->clone()
+             dargument2
            );
   }
   if ( dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument2 );
     return new Addition(
              argument1->clone(),
              new Product(
                argument2->clone(),
-               dargument1->clone()
+               dargument1
              )
            );
   }
   if ( dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument2 );
     return new Product(
              argument2->clone(),
-             dargument1->clone()
+             dargument1
            );
   }
   return new Addition(
            new Product(
-             dargument1->clone(),
+             dargument1,
              argument2->clone()
            ),
            new Product(
              argument1->clone(),
-             dargument2->clone()
+             dargument2
            )
          );
 
@@ -166,69 +178,75 @@ Operator* Product::AD_forward( int dim,
                                  int &nNewIS,
                                  TreeProjection ***newIS ){
 
-    if( dargument1 != 0 )
-        delete dargument1;
-
-    if( dargument2 != 0 )
-        delete dargument2;
-
-    dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
-    dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
 
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return argument2->clone();
     }
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
+        release( dargument2 );
         return argument1->clone();
     }
     if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
+        release( dargument2 );
         return new Addition(
                  argument1->clone(),
                  argument2->clone()
              );
     }
     if ( dargument1->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
         return new Addition(
                  argument2->clone(),
                  new Product(
                      argument1->clone(),
-                     dargument2->clone()
+                     dargument2
                  )
              );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
         return new Product(
                  argument1->clone(),
-                 dargument2->clone()
+                 dargument2
              );
     }
     if ( dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument2 );
         return new Addition(
                  argument1->clone(),
                  new Product(
                      argument2->clone(),
-                     dargument1->clone()
+                     dargument1
                  )
              );
     }
     if ( dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument2 );
         return new Product(
                  argument2->clone(),
-                 dargument1->clone()
+                 dargument1
              );
     }
     return new Addition(
            new Product(
-             dargument1->clone(),
+             dargument1,
              argument2->clone()
            ),
            new Product(
              argument1->clone(),
-             dargument2->clone()
+             dargument2
            )
          );
 }
@@ -424,6 +424,22 @@ BooleanType Projection::isSymbolic() const{
 }
 
 
+Operator* Projection::hashCons( OperatorTable *table ) const{
+
+    return table->unique( clone(), variableType, vIndex, scale );
+}
+
+
+BooleanType Projection::getHashKey( int &type, int &index, double &value ) const{
+
+    type  = variableType;
+    index = vIndex      ;
+    value = scale       ;
+
+    return BT_TRUE;
+}
+
+
 Operator* Projection::ADforwardProtected( int dim,
                                                   VariableType *varType,
                                                   int *component,
@@ -97,18 +97,24 @@ returnValue Quotient::evaluate( EvaluationBase *x ){
 
 Operator* Quotient::differentiate( int index ){
 
-  dargument1 = argument1->differentiate( index );
-  dargument2 = argument2->differentiate( index );
+  Operator *dargument1 = argument1->differentiate( index );
+  Operator *dargument2 = argument2->differentiate( index );
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new Quotient(
                    new DoubleConstant( 1.0, NE_ONE ),
                    argument2->clone()
                );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ONE ){
+    release( dargument1 );
+    release( dargument2 );
     return new Quotient(
                    new Subtraction(
                            new DoubleConstant( 0.0 , NE_ZERO ),
@@ -121,6 +127,8 @@ Operator* Quotient::differentiate( int index ){
                );
   }
   if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ONE ){
+      release( dargument1 );
+      release( dargument2 );
       return new Subtraction(
                      new Quotient(
                          new DoubleConstant( 1.0, NE_ONE ),
@@ -136,6 +144,7 @@ Operator* Quotient::differentiate( int index ){
                  );
   }
   if ( dargument1->isOneOrZero() == NE_ONE ){
+      release( dargument1 );
       return new Subtraction(
                      new Quotient(
                          new DoubleConstant( 1.0, NE_ONE ),
@@ -144,7 +153,7 @@ Operator* Quotient::differentiate( int index ){
                      new Quotient(
                              new Product(
                                      argument1->clone(),
-                                     dargument2->clone()
+                                     dargument2
                                  ),
                              new Power_Int(
                                      argument2->clone(),
@@ -154,12 +163,13 @@ Operator* Quotient::differentiate( int index ){
                   );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO ){
+      release( dargument1 );
       return new Subtraction(
                      new DoubleConstant( 0.0, NE_ZERO ),
                      new Quotient(
                              new Product(
                                      argument1->clone(),
-                                     dargument2->clone()
+                                     dargument2
                                  ),
                              new Power_Int(
                                      argument2->clone(),
@@ -169,9 +179,10 @@ Operator* Quotient::differentiate( int index ){
                   );
   }
   if ( dargument2->isOneOrZero() == NE_ONE ){
+      release( dargument2 );
       return new Subtraction(
                      new Quotient(
-                         dargument1->clone(),
+                         dargument1,
                          argument2->clone()
                      ),
                      new Quotient(
@@ -184,20 +195,21 @@ Operator* Quotient::differentiate( int index ){
                  );
   }
   if ( dargument2->isOneOrZero() == NE_ZERO ){
+      release( dargument2 );
       return new Quotient(
-                     dargument1->clone(),
+                     dargument1,
                      argument2->clone()
                  );
   }
   return new Subtraction(
                    new Quotient(
-                       dargument1->clone(),
+                       dargument1,
                        argument2->clone()
                    ),
                    new Quotient(
                            new Product(
                                    argument1->clone(),
-                                   dargument2->clone()
+                                   dargument2
                                ),
                            new Power_Int(
                                    argument2->clone(),
@@ -218,27 +230,27 @@ Operator* Quotient::AD_forward( int dim,
                                   int &nNewIS,
                                   TreeProjection ***newIS ){
 
-    if( dargument1 != 0 )
-        delete dargument1;
-
-    if( dargument2 != 0 )
-        delete dargument2;
-
-    dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
-    dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
 
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
 
     if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return new Quotient(
                    new DoubleConstant( 1.0, NE_ONE ),
                    argument2->clone()
                );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ONE ){
+       release( dargument1 );
+       release( dargument2 );
        return new Quotient(
                    new Subtraction(
                            new DoubleConstant( 0.0 , NE_ZERO ),
@@ -251,6 +263,8 @@ Operator* Quotient::AD_forward( int dim,
                );
     }
     if ( dargument1->isOneOrZero() == NE_ONE && dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
+        release( dargument2 );
         return new Subtraction(
                      new Quotient(
                          new DoubleConstant( 1.0, NE_ONE ),
@@ -266,6 +280,7 @@ Operator* Quotient::AD_forward( int dim,
                  );
     }
     if ( dargument1->isOneOrZero() == NE_ONE ){
+        release( dargument1 );
         return new Subtraction(
                      new Quotient(
                          new DoubleConstant( 1.0, NE_ONE ),
@@ -274,7 +289,7 @@ Operator* Quotient::AD_forward( int dim,
                      new Quotient(
                              new Product(
                                      argument1->clone(),
-                                     dargument2->clone()
+                                     dargument2
                                  ),
                              new Power_Int(
                                      argument2->clone(),
@@ -284,12 +299,13 @@ Operator* Quotient::AD_forward( int dim,
                   );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
         return new Subtraction(
                      new DoubleConstant( 0.0, NE_ZERO ),
                      new Quotient(
                              new Product(
                                      argument1->clone(),
-                                     dargument2->clone()
+                                     dargument2
                                  ),
                              new Power_Int(
                                      argument2->clone(),
@@ -299,9 +315,10 @@ Operator* Quotient::AD_forward( int dim,
                   );
     }
     if ( dargument2->isOneOrZero() == NE_ONE ){
+        release( dargument2 );
         return new Subtraction(
                      new Quotient(
-                         dargument1->clone(),
+                         dargument1,
                          argument2->clone()
                      ),
                      new Quotient(
@@ -314,20 +331,21 @@ Operator* Quotient::AD_forward( int dim,
                  );
     }
     if ( dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument2 );
         return new Quotient(
-                     dargument1->clone(),
+                     dargument1,
                      argument2->clone()
                  );
     }
     return new Subtraction(
                    new Quotient(
-                       dargument1->clone(),
+                       dargument1,
                        argument2->clone()
                    ),
                    new Quotient(
                            new Product(
                                    argument1->clone(),
-                                   dargument2->clone()
+                                   dargument2
                                ),
                            new Power_Int(
                                    argument2->clone(),
@@ -90,14 +90,16 @@ Sin& Sin::operator=( const Sin &arg ){
 
 Operator* Sin::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return new Cos( argument->clone() );
   }
-  return new Product( dargument->clone() , new Cos( argument->clone() ) );
+  return new Product( dargument , new Cos( argument->clone() ) );
 
 }
 
@@ -116,18 +118,17 @@ Operator* Sin::ADforwardProtected( int dim,
                                      int &nNewIS,
                                      TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Cos( argument->clone() );
     }
-    return new Product( dargument->clone() , new Cos( argument->clone() ) );
+    return new Product( dargument , new Cos( argument->clone() ) );
 }
 
 
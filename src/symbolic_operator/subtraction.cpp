@@ -91,18 +91,22 @@ returnValue Subtraction::evaluate( EvaluationBase *x ){
 
 Operator* Subtraction::differentiate( int index ){
 
-  dargument1 = argument1->differentiate( index );
-  dargument2 = argument2->differentiate( index );
+  Operator *dargument1 = argument1->differentiate( index );
+  Operator *dargument2 = argument2->differentiate( index );
   if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+    release( dargument1 );
+    release( dargument2 );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if ( dargument1->isOneOrZero() == NE_ZERO ){
-    return new Subtraction( new DoubleConstant( 0.0 , NE_ZERO ), dargument2->clone() );
+    release( dargument1 );
+    return new Subtraction( new DoubleConstant( 0.0 , NE_ZERO ), dargument2 );
   }
   if ( dargument2->isOneOrZero() == NE_ZERO ){
-    return dargument1->clone();
+    release( dargument2 );
+    return dargument1;
   }
-  return new Subtraction( dargument1->clone() , dargument2->clone() );
+  return new Subtraction( dargument1 , dargument2 );
 
 }
 
@@ -114,26 +118,24 @@ Operator* Subtraction::AD_forward( int dim,
                                      int &nNewIS,
                                      TreeProjection ***newIS ){
 
-    if( dargument1 != 0 )
-        delete dargument1;
-
-    if( dargument2 != 0 )
-        delete dargument2;
-
-    dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
-    dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument1 = argument1->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument2 = argument2->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if ( dargument1->isOneOrZero() == NE_ZERO && dargument2->isOneOrZero() == NE_ZERO ){
+        release( dargument1 );
+        release( dargument2 );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if ( dargument1->isOneOrZero() == NE_ZERO ){
-        return new Subtraction( new DoubleConstant( 0.0 , NE_ZERO ), dargument2->clone() );
+        release( dargument1 );
+        return new Subtraction( new DoubleConstant( 0.0 , NE_ZERO ), dargument2 );
     }
     if ( dargument2->isOneOrZero() == NE_ZERO ){
-        return dargument1->clone();
+        release( dargument2 );
+        return dargument1;
     }
 
-    return new Subtraction( dargument1->clone() , dargument2->clone() );
+    return new Subtraction( dargument1 , dargument2 );
 }
 
 
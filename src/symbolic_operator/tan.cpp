@@ -105,11 +105,13 @@ returnValue Tan::evaluate( EvaluationBase *x ){
 
 Operator* Tan::differentiate( int index ){
 
-  dargument = argument->differentiate( index );
+  Operator *dargument = argument->differentiate( index );
   if( dargument->isOneOrZero() == NE_ZERO ){
+    release( dargument );
     return new DoubleConstant( 0.0 , NE_ZERO );
   }
   if( dargument->isOneOrZero() == NE_ONE ){
+    release( dargument );
     return new Power_Int(
              new Power_Int(
                new Cos(
@@ -121,7 +123,7 @@ Operator* Tan::differentiate( int index ){
            );
   }
   return new Quotient(
-                 dargument->clone(),
+                 dargument,
                  new Power_Int(
                          new Cos(
                                  argument->clone()
@@ -139,15 +141,14 @@ Operator* Tan::ADforwardProtected( int dim,
                                      int &nNewIS,
                                      TreeProjection ***newIS ){
 
-    if( dargument != 0 )
-        delete dargument;
-
-    dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
+    Operator *dargument = argument->AD_forward(dim,varType,component,seed,nNewIS,newIS);
 
     if( dargument->isOneOrZero() == NE_ZERO ){
+        release( dargument );
         return new DoubleConstant( 0.0 , NE_ZERO );
     }
     if( dargument->isOneOrZero() == NE_ONE ){
+        release( dargument );
         return new Power_Int(
                      new Cos(
                          argument->clone()
@@ -156,7 +157,7 @@ Operator* Tan::ADforwardProtected( int dim,
              );
     }
     return new Quotient(
-                 dargument->clone(),
+                 dargument,
                  new Power_Int(
                          new Cos(
                                  argument->clone()
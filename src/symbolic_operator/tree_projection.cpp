@@ -51,6 +51,7 @@ TreeProjection::TreeProjection( )
     variableIndex  = 0                     ;
     argument       = 0                     ;
     ne             = NE_ZERO               ;
+    hoisted        = BT_FALSE              ;
 }
 
 
@@ -62,10 +63,26 @@ TreeProjection::TreeProjection( const String &name_ )
     variableIndex  = 0                     ;
     argument       = 0                     ;
     ne             = NE_ZERO               ;
+    hoisted        = BT_FALSE              ;
 }
 
 
 
+TreeProjection::TreeProjection( Operator *_argument, BooleanType _hoisted )
+               :Projection(){
+
+    variableType   = VT_INTERMEDIATE_STATE   ;
+    vIndex         = count++                 ;
+    variableIndex  = vIndex                  ;
+    argument       = _argument               ;
+    ne             = argument->isOneOrZero() ;
+    hoisted        = _hoisted                ;
+
+    curvature      = CT_UNKNOWN;
+    monotonicity   = MT_UNKNOWN;
+}
+
+
 TreeProjection::TreeProjection( const TreeProjection &arg )
                :Projection(){
 
@@ -75,26 +92,17 @@ TreeProjection::TreeProjection( const TreeProjection &arg )
         argument = 0;
     }
     else{
-        argument = arg.argument;
-        argument->nCount++;
+        argument = arg.argument->share();
     }
 
-    ne = arg.ne;
+    ne      = arg.ne     ;
+    hoisted = arg.hoisted;
 }
 
 
 TreeProjection::~TreeProjection(){
- 
-    if( argument != 0 ){
 
-        if( argument->nCount == 0 ){
-            delete argument;
-            argument = 0;
-        }
-        else{
-            argument->nCount--;
-        }
-    }
+    release( argument );
 }
 
 
@@ -103,23 +111,17 @@ TreeProjection& TreeProjection::operator=( const Operator &arg ){
 
     if( this != &arg ){
 
-        if( argument != 0 ){
-            if( argument->nCount == 0 ){
-                delete argument;
-                argument = 0;
-            }
-            else{
-                argument->nCount--;
-            }
-        }
-
         Operator *tmp = arg.passArgument();
 
-        if( tmp == 0 ) argument = arg.clone() ;
-        else           argument = tmp->clone();
+        if( tmp == 0 ) tmp = arg.clone() ;
+        else           tmp = tmp->clone();
+
+        release( argument );
+        argument = tmp;
 
         vIndex         = count++;
         variableIndex  = vIndex ;
+        hoisted        = BT_FALSE;
 
         curvature      = CT_UNKNOWN; // argument->getCurvature();
         monotonicity   = MT_UNKNOWN; // argument->getMonotonicity();
@@ -138,20 +140,14 @@ TreeProjection& TreeProjection::operator=( const Expression &arg ){
 
     ASSERT( arg.getDim() == 1 );
 
-    if( argument != 0 ){
-        if( argument->nCount == 0 ){
-            delete argument;
-            argument = 0;
-        }
-        else{
-            argument->nCount--;
-        }
-    }
+    Operator *tmp = arg.getOperatorClone(0);
 
-    argument = arg.getOperatorClone(0);
+    release( argument );
+    argument = tmp;
 
     vIndex         = count++;
     variableIndex  = vIndex ;
+    hoisted        = BT_FALSE;
 
         curvature      = CT_UNKNOWN; // argument->getCurvature();
         monotonicity   = MT_UNKNOWN; // argument->getMonotonicity();
@@ -186,6 +182,43 @@ TreeProjection* TreeProjection::cloneTreeProjection() const{
 }
 
 
+Operator* TreeProjection::hashCons( OperatorTable *table ) const{
+
+    TreeProjection *tmp = new TreeProjection( *this );
+
+    if( argument != 0 ){
+        release( tmp->argument );
+        tmp->argument = table->import( argument );
+
+        // intermediate states with a constant value are not needed:
+        if( tmp->argument->getName() == ON_DOUBLE_CONSTANT ){
+            Operator *result = tmp->argument->share();
+            release( tmp );
+            return result;
+        }
+    }
+
+    TreeProjection *result = (TreeProjection*)table->unique( tmp, variableType, vIndex );
+    table->addIntermediateState( result );
+
+    return result;
+}
+
+
+BooleanType TreeProjection::getHashKey( int &type, int &index, double &value ) const{
+
+    // unassigned states cannot be told apart:
+    if( argument == 0 ) return BT_FALSE;
+
+    // the index is renewed by every assignment:
+    type  = variableType;
+    index = vIndex      ;
+    value = scale       ;
+
+    return BT_TRUE;
+}
+
+
 
 Operator* TreeProjection::ADforwardProtected( int dim,
                                                    VariableType *varType,
@@ -299,7 +332,9 @@ BooleanType TreeProjection::isDependingOn( int dim,
                                                 int *component,
                                                 BooleanType   *implicit_dep ){
 
-    return implicit_dep[vIndex];
+    // dependencies are stored behind the queried property (see
+    // FunctionEvaluationTree::isDependingOn()):
+    return implicit_dep[2*vIndex+1];
 }
 
 
@@ -308,7 +343,7 @@ BooleanType TreeProjection::isLinearIn( int dim,
                                              int *component,
                                              BooleanType   *implicit_dep ){
 
-    return implicit_dep[vIndex];
+    return implicit_dep[2*vIndex];
 }
 
 
@@ -317,7 +352,7 @@ BooleanType TreeProjection::isPolynomialIn( int dim,
                                                  int *component,
                                                  BooleanType   *implicit_dep ){
 
-    return implicit_dep[vIndex];
+    return implicit_dep[2*vIndex];
 }
 
 
@@ -326,7 +361,7 @@ BooleanType TreeProjection::isRationalIn( int dim,
                                                int *component,
                                                BooleanType   *implicit_dep ){
 
-    return implicit_dep[vIndex];
+    return implicit_dep[2*vIndex];
 }
 
 
@@ -363,10 +398,16 @@ Operator* TreeProjection::passArgument() const{
 }
 
 
+BooleanType TreeProjection::isHoisted() const{
+
+    return hoisted;
+}
+
+
 returnValue TreeProjection::setVariableExportName( const VariableType &_type, const Stream *_name )
 {
-	argument->setVariableExportName(_type, _name);
-
+	// the argument is exported separately as intermediate expression,
+	// descending into it would visit shared sub-trees exponentially often.
 	return Projection::setVariableExportName(_type, _name);
 }
 
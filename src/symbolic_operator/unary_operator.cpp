@@ -53,7 +53,6 @@ UnaryOperator::UnaryOperator( Operator *_argument ) : SmoothOperator( )
     ddfcn = 0;
 
     argument          = _argument                        ;
-    dargument         = NULL                             ;
     argument_result   = (double*)calloc(1,sizeof(double));
     dargument_result  = (double*)calloc(1,sizeof(double));
     bufferSize        = 1                                ;
@@ -74,13 +73,7 @@ UnaryOperator::UnaryOperator( const UnaryOperator &arg ){
 
     bufferSize = arg.bufferSize;
 
- 	argument   = arg.argument->clone();
-	
-// 	argument   = arg.argument;
-//     argument->nCount++;
-
-    if( arg.dargument == 0 ) dargument = 0;
-    else                     dargument = arg.dargument->clone();
+    argument   = arg.argument->share();
 
     argument_result  = (double*)calloc(bufferSize,sizeof(double));
     dargument_result = (double*)calloc(bufferSize,sizeof(double));
@@ -100,20 +93,8 @@ UnaryOperator::UnaryOperator( const UnaryOperator &arg ){
 
 
 UnaryOperator::~UnaryOperator(){
- 
- 
-//  delete argument;
-    if( argument != 0 ){
-
-        if( argument->nCount == 0 ){
-            delete argument;
-            argument = 0;
-        }
-        else{
-            argument->nCount--;
-        }
-    }
-    if( dargument != 0 ) delete dargument;
+
+    release( argument  );
 
     free(  argument_result );
     free( dargument_result );
@@ -124,31 +105,14 @@ UnaryOperator& UnaryOperator::operator=( const UnaryOperator &arg ){
 
     if( this != &arg ){
 
-	 
-	 
-// 	 delete argument;
-	 
-        if( argument != 0 ){
-
-            if( argument->nCount == 0 ){
-                delete argument;
-                argument = 0;
-            }
-            else{
-                argument->nCount--;
-            }
-        }
-        if( dargument != 0 ) delete dargument;
+        Operator *tmp = arg.argument->share();
+
+        release( argument  );
 
         free(  argument_result );
         free( dargument_result );
 
- 		argument = arg.argument->clone();
-		
-//         argument = arg.argument;
-// 		argument->nCount++;
-
-        dargument         = NULL                               ;
+        argument          = tmp                                ;
         bufferSize        = arg.bufferSize                     ;
         argument_result   = (double*)calloc(bufferSize,sizeof(double))  ;
         dargument_result  = (double*)calloc(bufferSize,sizeof(double))  ;
@@ -412,6 +376,51 @@ BooleanType UnaryOperator::isSymbolic() const{
 }
 
 
+int UnaryOperator::getNumberOfArguments() const{
+
+    return 1;
+}
+
+
+Operator* UnaryOperator::getArgumentPointer( int idx ) const{
+
+    if( idx == 0 ) return argument;
+    return 0;
+}
+
+
+returnValue UnaryOperator::setArgumentPointer( int idx, Operator *_argument ){
+
+    if( idx != 0 )
+        return Operator::setArgumentPointer( idx, _argument );
+
+    release( argument );
+    argument = _argument;
+
+    return SUCCESSFUL_RETURN;
+}
+
+
+Operator* UnaryOperator::hashCons( OperatorTable *table ) const{
+
+    UnaryOperator *tmp = (UnaryOperator*)clone();
+
+    tmp->setArgumentPointer( 0, table->import( argument ) );
+
+    return table->unique( tmp );
+}
+
+
+BooleanType UnaryOperator::getHashKey( int &type, int &index, double &value ) const{
+
+    type  = 0  ;
+    index = 0  ;
+    value = 0.0;
+
+    return BT_TRUE;
+}
+
+
 returnValue UnaryOperator::setVariableExportName( const VariableType &type, const Stream *name )
 {
 	argument->setVariableExportName(type, name);
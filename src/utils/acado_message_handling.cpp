@@ -106,6 +106,7 @@ ReturnValueList returnValueList[] =
 { RET_DISTURBANCE_DIMENSION_MISMATCH,			"Incompatible disturbance vector dimensions", VS_VISIBLE },
 { RET_OUTPUT_DIMENSION_MISMATCH,				"Incompatible output vector dimensions", VS_VISIBLE },
 { RET_MATRIX_NOT_SQUARE,						"Operation requires square matrix", VS_VISIBLE },
+{ RET_MATRIX_NOT_POSITIVE_DEFINITE,				"Operation requires positive definite matrix", VS_VISIBLE },
 
 /* Sparse Solver */
 { RET_LINEAR_SYSTEM_NUMERICALLY_SINGULAR,		"Linear system could not be solved with required accuracy. Check whether the system is singular or ill-conditioned", VS_VISIBLE },
@@ -213,6 +214,8 @@ ReturnValueList returnValueList[] =
 { RET_ONLY_SUPPORTED_FOR_SYMBOLIC_FUNCTIONS,	"This routine is for symbolic functions only", VS_VISIBLE },
 { RET_INFEASIBLE_ALGEBRAIC_CONSTRAINT,			"Infeasible algebraic constraints are not allowed and will be ignored", VS_VISIBLE },
 { RET_ILLFORMED_ODE,							"ODE needs to depend on all differential states", VS_VISIBLE },
+{ RET_UNABLE_TO_COMPILE_FUNCTION,				"The generated code of the function could not be compiled", VS_VISIBLE },
+{ RET_UNABLE_TO_LOAD_COMPILED_FUNCTION,		"The compiled code of the function could not be loaded", VS_VISIBLE },
 
 /* Expression */
 { RET_PRECISION_OUT_OF_RANGE,					"The requested precision is out of range", VS_VISIBLE },
@@ -426,8 +429,12 @@ returnValue::returnValue(const char* msg, returnValueLevel _level, const returnV
 	if (old.data) {
 		data = old.data;
 		data->owner = this;
-		data->messages.push_back(msg);
 	}
+	else {
+		data = new returnValueData();
+		data->owner = this;
+	}
+	data->messages.push_back(msg);
 	status = STATUS_UNHANDLED;
 	level = _level;
 	type = old.type;
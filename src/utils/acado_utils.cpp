@@ -169,6 +169,53 @@ double acadoGetTime( )
 }
 
 
+/*
+ *	g e t C y c l e s
+ */
+unsigned long long acadoGetCycles( )
+{
+	#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+	unsigned int lo, hi;
+	__asm__ __volatile__ ( "rdtsc" : "=a" (lo), "=d" (hi) );
+	return ( (unsigned long long) hi << 32 ) | lo;
+	#else
+	return (unsigned long long) ( 1.0e9*acadoGetTime( ) );
+	#endif
+}
+
+
+/*
+ *	l o c k
+ */
+void acadoLock( volatile long *lock )
+{
+	#if defined(__WIN32__) || defined(WIN32)
+	while ( InterlockedExchange( lock,1 ) != 0 )
+		while ( *lock != 0 );
+	#elif defined(__GNUC__)
+	while ( __sync_lock_test_and_set( lock,1 ) != 0 )
+		while ( *lock != 0 );
+	#else
+	#error "acadoLock() needs an atomic exchange, which is not available for this compiler."
+	#endif
+}
+
+
+/*
+ *	u n l o c k
+ */
+void acadoUnlock( volatile long *lock )
+{
+	#if defined(__WIN32__) || defined(WIN32)
+	InterlockedExchange( lock,0 );
+	#elif defined(__GNUC__)
+	__sync_lock_release( lock );
+	#else
+	#error "acadoUnlock() needs an atomic exchange, which is not available for this compiler."
+	#endif
+}
+
+
 BooleanType acadoIsInteger( double x )
 {
 	//if ( fabs( x - floor( x + 0.5) ) < 10000.0*EPS )